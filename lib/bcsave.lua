@@ -0,0 +1,125 @@
+----------------------------------------------------------------------------
+-- LuaJIT module to save/list bytecode.
+--
+-- Copyright (C) 2005-2010 Mike Pall. All rights reserved.
+-- Released under the MIT/X license. See Copyright Notice in luajit.h
+----------------------------------------------------------------------------
+--
+-- This module saves or lists the bytecode for an input file.
+-- It's run by the -b command line option.
+--
+-- Example usage:
+--
+--   luajit -b foo.lua foo.out     -- Save stripped bytecode.
+--   luajit -bg foo.lua foo.out    -- Save bytecode with debug info.
+--   luajit -bl foo.lua            -- List bytecode to stdout.
+--   luajit -be "print(1)" x.out   -- Save bytecode for a chunk string.
+--
+-- Use '-' for stdin/stdout. The output file is always overwritten.
+-- A tree of modules is compiled by running -b once per file.
+--
+------------------------------------------------------------------------------
+
+local jit = require("jit")
+assert(jit.version_num == 20000, "LuaJIT core/library version mismatch")
+
+------------------------------------------------------------------------------
+
+local function usage()
+  io.stderr:write[[
+Save LuaJIT bytecode: luajit -b[options] input output
+  -l        Only list bytecode.
+  -s        Strip debug info (default).
+  -g        Keep debug info.
+  -e chunk  Use chunk string as input.
+  --        Stop handling options.
+  -         Use stdin as input and/or stdout as output.
+]]
+  os.exit(1)
+end
+
+local function check(ok, ...)
+  if ok then return ok, ... end
+  io.stderr:write("luajit: ", ...)
+  io.stderr:write("\n")
+  os.exit(1)
+end
+
+local function readfile(input)
+  if type(input) == "function" then return input end
+  if input == "-" then input = nil end
+  return check(loadfile(input))
+end
+
+local function savefile(name, mode)
+  if name == "-" then return io.stdout end
+  return check(io.open(name, mode))
+end
+
+------------------------------------------------------------------------------
+
+local function bclistf(f, out)
+  local jutil = require("jit.util")
+  for i=-jutil.funcinfo(f).gcconsts,-1 do
+    local k = jutil.funck(f, i)
+    if type(k) == "proto" then bclistf(k, out) end
+  end
+  require("jit.bc").dump(f, out)
+end
+
+local function bclist(input, output)
+  bclistf(readfile(input), savefile(output, "w"))
+end
+
+local function bcsave(ctx, input, output)
+  local f = readfile(input)
+  local s = string.dump(f, ctx.strip)
+  local fp = savefile(output, "wb")
+  check(fp:write(s))
+  if fp ~= io.stdout then check(fp:close()) end
+end
+
+local function docmd(...)
+  local arg = {...}
+  local n = 1
+  local list = false
+  local ctx = { strip = true }
+  while n <= #arg do
+    local a = arg[n]
+    if type(a) == "string" and string.sub(a, 1, 1) == "-" and a ~= "-" then
+      table.remove(arg, n)
+      if a == "--" then break end
+      for m=2,#a do
+	local opt = string.sub(a, m, m)
+	if opt == "l" then
+	  list = true
+	elseif opt == "s" then
+	  ctx.strip = true
+	elseif opt == "g" then
+	  ctx.strip = false
+	elseif opt == "e" then
+	  if n ~= 1 or not arg[1] then usage() end
+	  arg[1] = check(loadstring(arg[1]))
+	else
+	  usage()
+	end
+      end
+    else
+      n = n + 1
+    end
+  end
+  if list then
+    if #arg == 0 or #arg > 2 then usage() end
+    bclist(arg[1], arg[2] or "-")
+  else
+    if #arg ~= 2 then usage() end
+    bcsave(ctx, arg[1], arg[2])
+  end
+end
+
+------------------------------------------------------------------------------
+
+-- Public module functions.
+module(...)
+
+start = docmd -- Process -b command line option.
@@ -142,6 +142,7 @@ local irtype_text = {
   "u8 ",
   "i16",
   "u16",
+  "v2n",
 }
 
 local colortype_ansi = {
@@ -163,6 +164,7 @@ local colortype_ansi = {
   "\027[35m%s\027[m",
   "\027[35m%s\027[m",
   "\027[35m%s\027[m",
+  "\027[34m%s\027[m",
 }
 
 local function colorize_text(s, t)
@@ -204,7 +206,7 @@ span.irt_str { color: #00a000; }
 span.irt_thr, span.irt_fun { color: #404040; font-weight: bold; }
 span.irt_tab { color: #c00000; }
 span.irt_udt, span.irt_lud { color: #00c0c0; }
-span.irt_num { color: #4040c0; }
+span.irt_num, span.irt_v2n { color: #4040c0; }
 span.irt_int, span.irt_i8, span.irt_u8, span.irt_i16, span.irt_u16 { color: #b040b0; }
 </style>
 ]]
@@ -221,6 +223,7 @@ local litname = {
     if band(mode, 8) ~= 0 then s = s.."C" end
     if band(mode, 16) ~= 0 then s = s.."R" end
     if band(mode, 32) ~= 0 then s = s.."I" end
+    if band(mode, 64) ~= 0 then s = s.."K" end
     t[mode] = s
     return s
   end}),
@@ -335,6 +338,7 @@ local reg_map = ({
 -- Return a register name or stack slot for a rid/sp location.
 local function ridsp_name(ridsp)
   local rid = band(ridsp, 0xff)
+  if rid == 254 then return "{sink" end
   if ridsp > 255 then return format("[%x]", shr(ridsp, 8)*4) end
   if rid < 128 then return reg_map[rid] end
   return ""
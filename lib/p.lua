@@ -0,0 +1,175 @@
+----------------------------------------------------------------------------
+-- LuaJIT profiler.
+--
+-- Copyright (C) 2005-2010 Mike Pall. All rights reserved.
+-- Released under the MIT/X license. See Copyright Notice in luajit.h
+----------------------------------------------------------------------------
+--
+-- This module is a simple command line interface to the sampling profiler
+-- in jit.profile. A timer signal samples the VM state at regular intervals.
+-- The samples are aggregated by function, line, VM state or trace and a
+-- summary is printed when the program exits or the profiler is stopped.
+--
+-- Example usage:
+--
+--   luajit -jp myapp.lua
+--   luajit -jp=lv myapp.lua
+--   luajit -jp=t,myapp.prof myapp.lua
+--   luajit -jp=F,myapp.folded myapp.lua
+--
+-- The first argument holds the profiler options:
+--
+--   f  Aggregate by function (default).
+--   l  Aggregate by line.
+--   v  Show the split by VM state: Interpreted, Compiled, C code,
+--      Garbage collector and JIT compiler.
+--   t  Show the split by trace, with the traced line as well.
+--   F  Print one line per distinct stack ("root;...;leaf count") for
+--      flame graph tools. Combine with 'l' for lines, 'v' for a VM state
+--      leaf. No summary is printed.
+--   i<n>  Sample interval in milliseconds (default 10).
+--   <n>   Show the top n entries (default 10).
+--
+-- Default output is to stdout. To redirect the output to a file, pass a
+-- filename as the second argument or set the environment variable
+-- LUAJIT_PROFILEFILE. The file is overwritten every time the module is
+-- started.
+--
+-- This module can also be used programmatically:
+--
+--   local prof = require("jit.p")
+--   prof.start("l")
+--   ... code to profile ...
+--   prof.stop()
+--
+------------------------------------------------------------------------------
+
+-- Cache some library functions and objects.
+local jit = require("jit")
+assert(jit.version_num == 20000, "LuaJIT core/library version mismatch")
+local profile = require("jit.profile")
+local dumpstack = profile.dumpstack
+local pairs, tonumber, floor = pairs, tonumber, math.floor
+local sort, format = table.sort, string.format
+local match, gsub = string.match, string.gsub
+local stdout = io.stdout
+
+-- Active flag, output file handle and finalizer proxy.
+local active, out, prof_ud
+
+-- Profiler options and counts.
+local prof_fmt, prof_states, prof_traces, prof_folded, prof_top
+local prof_count, prof_vm, prof_tr, prof_samples
+
+local vmstate_names = {
+  I = "Interpreted", N = "Compiled", C = "C code",
+  G = "Garbage Collector", J = "JIT Compiler",
+}
+
+------------------------------------------------------------------------------
+
+-- Profiler callback.
+local function prof_cb(th, samples, vmstate, tr, loc)
+  prof_samples = prof_samples + samples
+  local key
+  -- Passing the trace number dumps the frames at the sampled trace location.
+  if prof_folded then
+    key = dumpstack(th, prof_fmt, -100, tr)
+    if prof_states then key = key..";["..vmstate_names[vmstate].."]" end
+  else
+    key = dumpstack(th, prof_fmt, 1, tr)
+    prof_vm[vmstate] = (prof_vm[vmstate] or 0) + samples
+    if tr then
+      local k = format("TRACE %-4d %s", tr, loc or "")
+      prof_tr[k] = (prof_tr[k] or 0) + samples
+    end
+  end
+  prof_count[key] = (prof_count[key] or 0) + samples
+end
+
+-- Print the top entries of a count table.
+local function prof_top_write(title, count)
+  local keys, n = {}, 0
+  for k in pairs(count) do n = n + 1; keys[n] = k end
+  if n == 0 then return end
+  sort(keys, function(a, b)
+    local ca, cb = count[a], count[b]
+    if ca == cb then return a < b end
+    return ca > cb
+  end)
+  out:write("--- ", title, " ---\n")
+  for i=1,n do
+    if i > prof_top then break end
+    local k = keys[i]
+    local pct = floor(count[k]*100/prof_samples + 0.5)
+    out:write(format("%4d%%  %s\n", pct, k))
+  end
+end
+
+-- Print the results.
+local function prof_finish()
+  if prof_folded then
+    for k, v in pairs(prof_count) do out:write(k, " ", v, "\n") end
+  elseif prof_samples > 0 then
+    out:write(format("====== jit.p: %d samples ======\n", prof_samples))
+    if prof_states then
+      local vm = {}
+      for k, v in pairs(prof_vm) do vm[vmstate_names[k]] = v end
+      prof_top_write("VM states", vm)
+    end
+    prof_top_write(prof_fmt == "l" and "Lines" or "Functions", prof_count)
+    if prof_traces then prof_top_write("Traces", prof_tr) end
+  end
+  out:flush()
+end
+
+------------------------------------------------------------------------------
+
+-- Stop profiling and print the results.
+local function prof_stop()
+  if active then
+    active = false
+    profile.stop()
+    prof_finish()
+    if out ~= stdout then out:close() end
+    out = nil
+  end
+end
+
+-- Start profiling.
+local function prof_start(mode, outfile)
+  if active then prof_stop() end
+  mode = mode or "f"
+  local interval = match(mode, "i(%d+)")
+  mode = gsub(mode, "i%d*", "")
+  prof_top = tonumber(match(mode, "%d+")) or 10
+  prof_states = match(mode, "v") ~= nil
+  prof_traces = match(mode, "t") ~= nil
+  prof_folded = match(mode, "F") ~= nil
+  if match(mode, "l") then
+    prof_fmt = prof_folded and "l;Z" or "l"
+  else
+    prof_fmt = prof_folded and "f;Z" or "f"
+  end
+  prof_count, prof_vm, prof_tr, prof_samples = {}, {}, {}, 0
+  if not outfile then outfile = os.getenv("LUAJIT_PROFILEFILE") end
+  if outfile and outfile ~= "-" then
+    out = assert(io.open(outfile, "w"))
+  else
+    out = stdout
+  end
+  -- Print the results when the state is closed. Created after the output
+  -- file, so it's finalized first.
+  prof_ud = newproxy(true)
+  getmetatable(prof_ud).__gc = prof_stop
+  active = true
+  profile.start("i"..(interval or 10), prof_cb)
+end
+
+------------------------------------------------------------------------------
+
+-- Public module functions.
+module(...)
+
+start = prof_start -- For -j command line option.
+stop = prof_stop
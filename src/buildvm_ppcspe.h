@@ -12,7 +12,7 @@
 #define DASM_SECTION_CODE_OP	0
 #define DASM_SECTION_CODE_SUB	1
 #define DASM_MAXSECTION		2
-static const unsigned int build_actionlist[4928] = {
+static const unsigned int build_actionlist[4932] = {
 0x00010001,
 0x00060014,
 0x72000000,
@@ -2551,6 +2551,10 @@ static const unsigned int build_actionlist[4928] = {
 0x40820000,
 0x0005080f,
 0x2c800000,
+0x70c00000,
+0x00090200,
+0x40820000,
+0x00050801,
 0x3529ffff,
 0x41860000,
 0x0005080f,
@@ -2569,10 +2573,10 @@ static const unsigned int build_actionlist[4928] = {
 0x48000001,
 0x00030024,
 0x0006000d,
+0x00000000,
 0x81d20000,
 0x00098200,
 0x0006000e,
-0x00000000,
 0x80f0fffc,
 0x54e815ba,
 0x54ea5d78,
@@ -5354,49 +5358,49 @@ static void build_subroutines(BuildCtx *ctx)
 #if LJ_HASJIT
   dasm_put(Dst, 2511);
 #endif
-  dasm_put(Dst, 2513, DISPATCH_GL(hookmask), HOOK_ACTIVE, GG_DISP2STATIC, DISPATCH_GL(hookmask), DISPATCH_GL(hookcount), HOOK_ACTIVE, 31-LUA_HOOKLINE, DISPATCH_GL(hookcount), Dt1(->base), Dt1(->base));
-  dasm_put(Dst, 2560, GG_DISP2STATIC);
-#if LJ_HASJIT
-  dasm_put(Dst, 2578);
-#endif
-  dasm_put(Dst, 2580);
+  dasm_put(Dst, 2513, DISPATCH_GL(hookmask), HOOK_ACTIVE, GG_DISP2STATIC, DISPATCH_GL(hookmask), DISPATCH_GL(hookcount), HOOK_ACTIVE, 31-LUA_HOOKLINE, HOOK_PROFILE, DISPATCH_GL(hookcount), Dt1(->base));
+  dasm_put(Dst, 2561, Dt1(->base), GG_DISP2STATIC);
 #if LJ_HASJIT
-  dasm_put(Dst, 2583);
+  dasm_put(Dst, 2582);
 #endif
-  dasm_put(Dst, 2586);
+  dasm_put(Dst, 2584);
 #if LJ_HASJIT
-  dasm_put(Dst, 2588);
+  dasm_put(Dst, 2587);
 #endif
-  dasm_put(Dst, 2591, Dt1(->base), Dt1(->top), Dt1(->base), Dt1(->top));
+  dasm_put(Dst, 2590);
 #if LJ_HASJIT
-  dasm_put(Dst, 2613);
+  dasm_put(Dst, 2592);
 #endif
-  dasm_put(Dst, 2615);
+  dasm_put(Dst, 2595, Dt1(->base), Dt1(->top), Dt1(->base), Dt1(->top));
 #if LJ_HASJIT
   dasm_put(Dst, 2617);
 #endif
   dasm_put(Dst, 2619);
 #if LJ_HASJIT
-  dasm_put(Dst, 2696);
-#else
-  dasm_put(Dst, 2719);
+  dasm_put(Dst, 2621);
 #endif
-  dasm_put(Dst, 2722);
+  dasm_put(Dst, 2623);
 #if LJ_HASJIT
-  dasm_put(Dst, 2724);
+  dasm_put(Dst, 2700);
+#else
+  dasm_put(Dst, 2723);
 #endif
   dasm_put(Dst, 2726);
 #if LJ_HASJIT
   dasm_put(Dst, 2728);
 #endif
   dasm_put(Dst, 2730);
+#if LJ_HASJIT
+  dasm_put(Dst, 2732);
+#endif
+  dasm_put(Dst, 2734);
 }
 
 /* Generate the code for a single instruction. */
 static void build_ins(BuildCtx *ctx, BCOp op, int defop)
 {
   int vk = 0;
-  dasm_put(Dst, 2792, defop);
+  dasm_put(Dst, 2796, defop);
 
   switch (op) {
 
@@ -5405,112 +5409,112 @@ static void build_ins(BuildCtx *ctx, BCOp op, int defop)
   /* Remember: all ops branch for a true comparison, fall through otherwise. */
 
   case BC_ISLT: case BC_ISGE: case BC_ISLE: case BC_ISGT:
-    dasm_put(Dst, 2794, -(BCBIAS_J*4 >> 16));
+    dasm_put(Dst, 2798, -(BCBIAS_J*4 >> 16));
     if (op == BC_ISLE || op == BC_ISGT) {
-      dasm_put(Dst, 2808);
+      dasm_put(Dst, 2812);
     }
     if (op == BC_ISLT || op == BC_ISLE) {
-      dasm_put(Dst, 2811);
+      dasm_put(Dst, 2815);
     } else {
-      dasm_put(Dst, 2813);
+      dasm_put(Dst, 2817);
     }
-    dasm_put(Dst, 2815);
+    dasm_put(Dst, 2819);
     break;
 
   case BC_ISEQV: case BC_ISNEV:
     vk = op == BC_ISEQV;
-    dasm_put(Dst, 2826, -(BCBIAS_J*4 >> 16));
+    dasm_put(Dst, 2830, -(BCBIAS_J*4 >> 16));
     if (vk) {
-      dasm_put(Dst, 2840);
+      dasm_put(Dst, 2844);
     } else {
-      dasm_put(Dst, 2842);
+      dasm_put(Dst, 2846);
     }
-    dasm_put(Dst, 2844, ~LJ_TISPRI, ~LJ_TISTABUD);
+    dasm_put(Dst, 2848, ~LJ_TISPRI, ~LJ_TISTABUD);
     if (vk) {
-      dasm_put(Dst, 2866);
+      dasm_put(Dst, 2870);
     } else {
-      dasm_put(Dst, 2868);
+      dasm_put(Dst, 2872);
     }
-    dasm_put(Dst, 2870);
+    dasm_put(Dst, 2874);
     if (vk) {
-      dasm_put(Dst, 2872);
+      dasm_put(Dst, 2876);
     } else {
-      dasm_put(Dst, 2874);
+      dasm_put(Dst, 2878);
     }
-    dasm_put(Dst, 2876, Dt6(->metatable), 1-vk, Dt6(->nomm), 1<<MM_eq);
+    dasm_put(Dst, 2880, Dt6(->metatable), 1-vk, Dt6(->nomm), 1<<MM_eq);
     break;
 
   case BC_ISEQS: case BC_ISNES:
     vk = op == BC_ISEQS;
-    dasm_put(Dst, 2897, 32-1, -(BCBIAS_J*4 >> 16));
+    dasm_put(Dst, 2901, 32-1, -(BCBIAS_J*4 >> 16));
     if (vk) {
-      dasm_put(Dst, 2911);
+      dasm_put(Dst, 2915);
     } else {
-      dasm_put(Dst, 2913);
+      dasm_put(Dst, 2917);
     }
-    dasm_put(Dst, 2915);
+    dasm_put(Dst, 2919);
     break;
 
   case BC_ISEQN: case BC_ISNEN:
     vk = op == BC_ISEQN;
-    dasm_put(Dst, 2926, -(BCBIAS_J*4 >> 16));
+    dasm_put(Dst, 2930, -(BCBIAS_J*4 >> 16));
     if (vk) {
-      dasm_put(Dst, 2940);
+      dasm_put(Dst, 2944);
     } else {
-      dasm_put(Dst, 2943);
+      dasm_put(Dst, 2947);
     }
-    dasm_put(Dst, 2945);
+    dasm_put(Dst, 2949);
     if (!vk) {
-      dasm_put(Dst, 2957);
+      dasm_put(Dst, 2961);
     }
     break;
 
   case BC_ISEQP: case BC_ISNEP:
     vk = op == BC_ISEQP;
-    dasm_put(Dst, 2963, 32-3, -(BCBIAS_J*4 >> 16));
+    dasm_put(Dst, 2967, 32-3, -(BCBIAS_J*4 >> 16));
     if (vk) {
-      dasm_put(Dst, 2975);
+      dasm_put(Dst, 2979);
     } else {
-      dasm_put(Dst, 2977);
+      dasm_put(Dst, 2981);
     }
-    dasm_put(Dst, 2979);
+    dasm_put(Dst, 2983);
     break;
 
   /* -- Unary test and copy ops ------------------------------------------- */
 
   case BC_ISTC: case BC_ISFC: case BC_IST: case BC_ISF:
-    dasm_put(Dst, 2990);
+    dasm_put(Dst, 2994);
     if (op == BC_IST || op == BC_ISF) {
-      dasm_put(Dst, 2996, -(BCBIAS_J*4 >> 16));
+      dasm_put(Dst, 3000, -(BCBIAS_J*4 >> 16));
       if (op == BC_IST) {
-	dasm_put(Dst, 3001);
+	dasm_put(Dst, 3005);
       } else {
-	dasm_put(Dst, 3003);
+	dasm_put(Dst, 3007);
       }
     } else {
       if (op == BC_ISTC) {
-	dasm_put(Dst, 3005);
+	dasm_put(Dst, 3009);
       } else {
-	dasm_put(Dst, 3008);
+	dasm_put(Dst, 3012);
       }
-      dasm_put(Dst, 3011, -(BCBIAS_J*4 >> 16));
+      dasm_put(Dst, 3015, -(BCBIAS_J*4 >> 16));
     }
-    dasm_put(Dst, 3018);
+    dasm_put(Dst, 3022);
     break;
 
   /* -- Unary ops --------------------------------------------------------- */
 
   case BC_MOV:
-    dasm_put(Dst, 3029);
+    dasm_put(Dst, 3033);
     break;
   case BC_NOT:
-    dasm_put(Dst, 3042, LJ_TTRUE);
+    dasm_put(Dst, 3046, LJ_TTRUE);
     break;
   case BC_UNM:
-    dasm_put(Dst, 3058);
+    dasm_put(Dst, 3062);
     break;
   case BC_LEN:
-    dasm_put(Dst, 3075, Dt5(->len));
+    dasm_put(Dst, 3079, Dt5(->len));
     break;
 
   /* -- Binary ops -------------------------------------------------------- */
@@ -5520,257 +5524,257 @@ static void build_ins(BuildCtx *ctx, BCOp op, int defop)
     vk = ((int)op - BC_ADDVN) / (BC_ADDNV-BC_ADDVN);
     switch (vk) {
     case 0:
-    dasm_put(Dst, 3103);
+    dasm_put(Dst, 3107);
       break;
     case 1:
-    dasm_put(Dst, 3109);
+    dasm_put(Dst, 3113);
       break;
     default:
-    dasm_put(Dst, 3115);
+    dasm_put(Dst, 3119);
       break;
     }
-    dasm_put(Dst, 3122);
+    dasm_put(Dst, 3126);
     break;
   case BC_SUBVN: case BC_SUBNV: case BC_SUBVV:
     vk = ((int)op - BC_ADDVN) / (BC_ADDNV-BC_ADDVN);
     switch (vk) {
     case 0:
-    dasm_put(Dst, 3135);
+    dasm_put(Dst, 3139);
       break;
     case 1:
-    dasm_put(Dst, 3141);
+    dasm_put(Dst, 3145);
       break;
     default:
-    dasm_put(Dst, 3147);
+    dasm_put(Dst, 3151);
       break;
     }
-    dasm_put(Dst, 3154);
+    dasm_put(Dst, 3158);
     break;
   case BC_MULVN: case BC_MULNV: case BC_MULVV:
     vk = ((int)op - BC_ADDVN) / (BC_ADDNV-BC_ADDVN);
     switch (vk) {
     case 0:
-    dasm_put(Dst, 3167);
+    dasm_put(Dst, 3171);
       break;
     case 1:
-    dasm_put(Dst, 3173);
+    dasm_put(Dst, 3177);
       break;
     default:
-    dasm_put(Dst, 3179);
+    dasm_put(Dst, 3183);
       break;
     }
-    dasm_put(Dst, 3186);
+    dasm_put(Dst, 3190);
     break;
   case BC_DIVVN: case BC_DIVNV: case BC_DIVVV:
     vk = ((int)op - BC_ADDVN) / (BC_ADDNV-BC_ADDVN);
     switch (vk) {
     case 0:
-    dasm_put(Dst, 3199);
+    dasm_put(Dst, 3203);
       break;
     case 1:
-    dasm_put(Dst, 3205);
+    dasm_put(Dst, 3209);
       break;
     default:
-    dasm_put(Dst, 3211);
+    dasm_put(Dst, 3215);
       break;
     }
-    dasm_put(Dst, 3218);
+    dasm_put(Dst, 3222);
     break;
   case BC_MODVN:
     vk = ((int)op - BC_ADDVN) / (BC_ADDNV-BC_ADDVN);
     switch (vk) {
     case 0:
-    dasm_put(Dst, 3231);
+    dasm_put(Dst, 3235);
       break;
     case 1:
-    dasm_put(Dst, 3237);
+    dasm_put(Dst, 3241);
       break;
     default:
-    dasm_put(Dst, 3243);
+    dasm_put(Dst, 3247);
       break;
     }
-    dasm_put(Dst, 3250);
+    dasm_put(Dst, 3254);
     break;
   case BC_MODNV: case BC_MODVV:
     vk = ((int)op - BC_ADDVN) / (BC_ADDNV-BC_ADDVN);
     switch (vk) {
     case 0:
-    dasm_put(Dst, 3268);
+    dasm_put(Dst, 3272);
       break;
     case 1:
-    dasm_put(Dst, 3274);
+    dasm_put(Dst, 3278);
       break;
     default:
-    dasm_put(Dst, 3280);
+    dasm_put(Dst, 3284);
       break;
     }
-    dasm_put(Dst, 3287);
+    dasm_put(Dst, 3291);
     break;
   case BC_POW:
-    dasm_put(Dst, 3290);
+    dasm_put(Dst, 3294);
     break;
 
   case BC_CAT:
-    dasm_put(Dst, 3312, Dt1(->base), 32-3, Dt1(->base));
+    dasm_put(Dst, 3316, Dt1(->base), 32-3, Dt1(->base));
     break;
 
   /* -- Constant ops ------------------------------------------------------ */
 
   case BC_KSTR:
-    dasm_put(Dst, 3342, 32-1);
+    dasm_put(Dst, 3346, 32-1);
     break;
   case BC_KSHORT:
-    dasm_put(Dst, 3359, 32-3);
+    dasm_put(Dst, 3363, 32-3);
     break;
   case BC_KNUM:
-    dasm_put(Dst, 3375);
+    dasm_put(Dst, 3379);
     break;
   case BC_KPRI:
-    dasm_put(Dst, 3388, 32-3);
+    dasm_put(Dst, 3392, 32-3);
     break;
   case BC_KNIL:
-    dasm_put(Dst, 3403);
+    dasm_put(Dst, 3407);
     break;
 
   /* -- Upvalue and function ops ------------------------------------------ */
 
   case BC_UGET:
-    dasm_put(Dst, 3422, 32-1, offsetof(GCfuncL, uvptr), DtA(->v));
+    dasm_put(Dst, 3426, 32-1, offsetof(GCfuncL, uvptr), DtA(->v));
     break;
   case BC_USETV:
-    dasm_put(Dst, 3443, 32-1, offsetof(GCfuncL, uvptr), DtA(->marked), DtA(->v), LJ_GC_BLACK, DtA(->closed), -LJ_TISNUM, LJ_TISGCV - LJ_TISNUM, Dt4(->gch.marked), LJ_GC_WHITES, GG_DISP2G);
+    dasm_put(Dst, 3447, 32-1, offsetof(GCfuncL, uvptr), DtA(->marked), DtA(->v), LJ_GC_BLACK, DtA(->closed), -LJ_TISNUM, LJ_TISGCV - LJ_TISNUM, Dt4(->gch.marked), LJ_GC_WHITES, GG_DISP2G);
     break;
   case BC_USETS:
-    dasm_put(Dst, 3495, 32-1, 32-1, offsetof(GCfuncL, uvptr), DtA(->marked), DtA(->v), LJ_GC_BLACK, Dt5(->marked), DtA(->closed), LJ_GC_WHITES, GG_DISP2G);
+    dasm_put(Dst, 3499, 32-1, 32-1, offsetof(GCfuncL, uvptr), DtA(->marked), DtA(->v), LJ_GC_BLACK, Dt5(->marked), DtA(->closed), LJ_GC_WHITES, GG_DISP2G);
     break;
   case BC_USETN:
-    dasm_put(Dst, 3544, 32-1, offsetof(GCfuncL, uvptr), DtA(->v));
+    dasm_put(Dst, 3548, 32-1, offsetof(GCfuncL, uvptr), DtA(->v));
     break;
   case BC_USETP:
-    dasm_put(Dst, 3565, 32-1, offsetof(GCfuncL, uvptr), 32-3, DtA(->v));
+    dasm_put(Dst, 3569, 32-1, offsetof(GCfuncL, uvptr), 32-3, DtA(->v));
     break;
 
   case BC_UCLO:
-    dasm_put(Dst, 3588, Dt1(->openupval), 32-1, -(BCBIAS_J*4 >> 16), Dt1(->base), Dt1(->base));
+    dasm_put(Dst, 3592, Dt1(->openupval), 32-1, -(BCBIAS_J*4 >> 16), Dt1(->base), Dt1(->base));
     break;
 
   case BC_FNEW:
-    dasm_put(Dst, 3618, 32-1, Dt1(->base), Dt1(->base));
+    dasm_put(Dst, 3622, 32-1, Dt1(->base), Dt1(->base));
     break;
 
   /* -- Table ops --------------------------------------------------------- */
 
   case BC_TNEW:
   case BC_TDUP:
-    dasm_put(Dst, 3644, DISPATCH_GL(gc.total), DISPATCH_GL(gc.threshold), Dt1(->base));
+    dasm_put(Dst, 3648, DISPATCH_GL(gc.total), DISPATCH_GL(gc.threshold), Dt1(->base));
     if (op == BC_TNEW) {
-      dasm_put(Dst, 3657);
+      dasm_put(Dst, 3661);
     } else {
-      dasm_put(Dst, 3665, 32-1);
+      dasm_put(Dst, 3669, 32-1);
     }
-    dasm_put(Dst, 3672, Dt1(->base));
+    dasm_put(Dst, 3676, Dt1(->base));
     break;
 
   case BC_GGET:
   case BC_GSET:
-    dasm_put(Dst, 3695, 32-1, Dt7(->env));
+    dasm_put(Dst, 3699, 32-1, Dt7(->env));
     if (op == BC_GGET) {
-      dasm_put(Dst, 3703);
+      dasm_put(Dst, 3707);
     } else {
-      dasm_put(Dst, 3706);
+      dasm_put(Dst, 3710);
     }
     break;
 
   case BC_TGETV:
-    dasm_put(Dst, 3709, Dt6(->asize), Dt6(->array), 31-3, Dt6(->metatable), Dt6(->nomm), 1<<MM_index);
+    dasm_put(Dst, 3713, Dt6(->asize), Dt6(->array), 31-3, Dt6(->metatable), Dt6(->nomm), 1<<MM_index);
     break;
   case BC_TGETS:
-    dasm_put(Dst, 3767, 32-1, Dt6(->hmask), Dt5(->hash), Dt6(->node), 31-5, 31-3, DtB(->key), DtB(->val), DtB(->next), Dt6(->metatable), Dt6(->nomm), 1<<MM_index);
-    dasm_put(Dst, 3831);
+    dasm_put(Dst, 3771, 32-1, Dt6(->hmask), Dt5(->hash), Dt6(->node), 31-5, 31-3, DtB(->key), DtB(->val), DtB(->next), Dt6(->metatable), Dt6(->nomm), 1<<MM_index);
+    dasm_put(Dst, 3835);
     break;
   case BC_TGETB:
-    dasm_put(Dst, 3836, 32-3, Dt6(->asize), Dt6(->array), Dt6(->metatable), Dt6(->nomm), 1<<MM_index);
+    dasm_put(Dst, 3840, 32-3, Dt6(->asize), Dt6(->array), Dt6(->metatable), Dt6(->nomm), 1<<MM_index);
     break;
 
   case BC_TSETV:
-    dasm_put(Dst, 3880, Dt6(->asize), Dt6(->array), 31-3, Dt6(->marked), LJ_GC_BLACK, Dt6(->metatable), Dt6(->nomm), 1<<MM_newindex);
-    dasm_put(Dst, 3947, DISPATCH_GL(gc.grayagain), DISPATCH_GL(gc.grayagain), Dt6(->marked), Dt6(->gclist));
+    dasm_put(Dst, 3884, Dt6(->asize), Dt6(->array), 31-3, Dt6(->marked), LJ_GC_BLACK, Dt6(->metatable), Dt6(->nomm), 1<<MM_newindex);
+    dasm_put(Dst, 3951, DISPATCH_GL(gc.grayagain), DISPATCH_GL(gc.grayagain), Dt6(->marked), Dt6(->gclist));
     break;
   case BC_TSETS:
-    dasm_put(Dst, 3959, 32-1, Dt6(->hmask), Dt5(->hash), Dt6(->node), Dt6(->nomm), 31-5, 31-3, Dt6(->marked), DtB(->key), DtB(->val), LJ_GC_BLACK, DtB(->val), Dt6(->metatable));
-    dasm_put(Dst, 4020, Dt6(->nomm), 1<<MM_newindex, DtB(->next), Dt6(->metatable), DISPATCH_GL(tmptv), Dt1(->base), Dt6(->nomm), 1<<MM_newindex, Dt1(->base), DISPATCH_GL(gc.grayagain), DISPATCH_GL(gc.grayagain));
-    dasm_put(Dst, 4071, Dt6(->marked), Dt6(->gclist));
+    dasm_put(Dst, 3963, 32-1, Dt6(->hmask), Dt5(->hash), Dt6(->node), Dt6(->nomm), 31-5, 31-3, Dt6(->marked), DtB(->key), DtB(->val), LJ_GC_BLACK, DtB(->val), Dt6(->metatable));
+    dasm_put(Dst, 4024, Dt6(->nomm), 1<<MM_newindex, DtB(->next), Dt6(->metatable), DISPATCH_GL(tmptv), Dt1(->base), Dt6(->nomm), 1<<MM_newindex, Dt1(->base), DISPATCH_GL(gc.grayagain), DISPATCH_GL(gc.grayagain));
+    dasm_put(Dst, 4075, Dt6(->marked), Dt6(->gclist));
     break;
   case BC_TSETB:
-    dasm_put(Dst, 4078, 32-3, Dt6(->asize), Dt6(->array), Dt6(->marked), LJ_GC_BLACK, Dt6(->metatable), Dt6(->nomm), 1<<MM_newindex, DISPATCH_GL(gc.grayagain), DISPATCH_GL(gc.grayagain), Dt6(->marked));
-    dasm_put(Dst, 4138, Dt6(->gclist));
+    dasm_put(Dst, 4082, 32-3, Dt6(->asize), Dt6(->array), Dt6(->marked), LJ_GC_BLACK, Dt6(->metatable), Dt6(->nomm), 1<<MM_newindex, DISPATCH_GL(gc.grayagain), DISPATCH_GL(gc.grayagain), Dt6(->marked));
+    dasm_put(Dst, 4142, Dt6(->gclist));
     break;
 
   case BC_TSETM:
-    dasm_put(Dst, 4143, 32-3, Dt6(->asize), 31-3, Dt6(->marked), Dt6(->array), LJ_GC_BLACK, Dt1(->base), DISPATCH_GL(gc.grayagain), DISPATCH_GL(gc.grayagain), Dt6(->marked), Dt6(->gclist));
-    dasm_put(Dst, 4212);
+    dasm_put(Dst, 4147, 32-3, Dt6(->asize), 31-3, Dt6(->marked), Dt6(->array), LJ_GC_BLACK, Dt1(->base), DISPATCH_GL(gc.grayagain), DISPATCH_GL(gc.grayagain), Dt6(->marked), Dt6(->gclist));
+    dasm_put(Dst, 4216);
     break;
 
   /* -- Calls and vararg handling ----------------------------------------- */
 
   case BC_CALLM:
-    dasm_put(Dst, 4215);
+    dasm_put(Dst, 4219);
     break;
   case BC_CALL:
-    dasm_put(Dst, 4217, Dt7(->pc));
+    dasm_put(Dst, 4221, Dt7(->pc));
     break;
 
   case BC_CALLMT:
-    dasm_put(Dst, 4237);
+    dasm_put(Dst, 4241);
     break;
   case BC_CALLT:
-    dasm_put(Dst, 4239, FRAME_TYPE, Dt7(->ffid), FRAME_VARG, Dt7(->pc), -4-8, Dt7(->pc), PC2PROTO(k), FRAME_TYPEP);
-    dasm_put(Dst, 4304, FRAME_TYPE);
+    dasm_put(Dst, 4243, FRAME_TYPE, Dt7(->ffid), FRAME_VARG, Dt7(->pc), -4-8, Dt7(->pc), PC2PROTO(k), FRAME_TYPEP);
+    dasm_put(Dst, 4308, FRAME_TYPE);
     break;
 
   case BC_ITERC:
-    dasm_put(Dst, 4311, Dt7(->pc));
+    dasm_put(Dst, 4315, Dt7(->pc));
     break;
 
   case BC_ITERN:
 #if LJ_HASJIT
 #endif
-    dasm_put(Dst, 4337, Dt6(->asize), Dt6(->array), 31-3, -(BCBIAS_J*4 >> 16), Dt6(->hmask), Dt6(->node), 31-5, 31-3, DtB(->key), -(BCBIAS_J*4 >> 16));
-    dasm_put(Dst, 4416);
+    dasm_put(Dst, 4341, Dt6(->asize), Dt6(->array), 31-3, -(BCBIAS_J*4 >> 16), Dt6(->hmask), Dt6(->node), 31-5, 31-3, DtB(->key), -(BCBIAS_J*4 >> 16));
+    dasm_put(Dst, 4420);
     break;
 
   case BC_ISNEXT:
-    dasm_put(Dst, 4420, LJ_TTAB, LJ_TFUNC, LJ_TNIL, Dt8(->ffid), FF_next_N, 32-1, -(BCBIAS_J*4 >> 16), BC_JMP, BC_ITERC, -(BCBIAS_J*4 >> 16));
+    dasm_put(Dst, 4424, LJ_TTAB, LJ_TFUNC, LJ_TNIL, Dt8(->ffid), FF_next_N, 32-1, -(BCBIAS_J*4 >> 16), BC_JMP, BC_ITERC, -(BCBIAS_J*4 >> 16));
     break;
 
   case BC_VARG:
-    dasm_put(Dst, 4471, FRAME_VARG, Dt1(->maxstack), Dt1(->top), Dt1(->base), 32-3, Dt1(->base));
-    dasm_put(Dst, 4551);
+    dasm_put(Dst, 4475, FRAME_VARG, Dt1(->maxstack), Dt1(->top), Dt1(->base), 32-3, Dt1(->base));
+    dasm_put(Dst, 4555);
     break;
 
   /* -- Returns ----------------------------------------------------------- */
 
   case BC_RETM:
-    dasm_put(Dst, 4557);
+    dasm_put(Dst, 4561);
     break;
 
   case BC_RET:
-    dasm_put(Dst, 4559, FRAME_TYPE, FRAME_VARG, Dt7(->pc), PC2PROTO(k), FRAME_TYPEP);
+    dasm_put(Dst, 4563, FRAME_TYPE, FRAME_VARG, Dt7(->pc), PC2PROTO(k), FRAME_TYPEP);
     break;
 
   case BC_RET0: case BC_RET1:
-    dasm_put(Dst, 4629, FRAME_TYPE, FRAME_VARG);
+    dasm_put(Dst, 4633, FRAME_TYPE, FRAME_VARG);
     if (op == BC_RET1) {
-      dasm_put(Dst, 4642);
+      dasm_put(Dst, 4646);
     }
-    dasm_put(Dst, 4645, Dt7(->pc), PC2PROTO(k));
+    dasm_put(Dst, 4649, Dt7(->pc), PC2PROTO(k));
     break;
 
   /* -- Loops and branches ------------------------------------------------ */
 
   case BC_FORL:
 #if LJ_HASJIT
-    dasm_put(Dst, 4673);
+    dasm_put(Dst, 4677);
 #endif
     break;
 
@@ -5782,35 +5786,35 @@ static void build_ins(BuildCtx *ctx, BCOp op, int defop)
   case BC_FORI:
   case BC_IFORL:
     vk = (op == BC_IFORL || op == BC_JFORL);
-    dasm_put(Dst, 4675, FORL_IDX*8, FORL_STEP*8, FORL_STOP*8);
+    dasm_put(Dst, 4679, FORL_IDX*8, FORL_STEP*8, FORL_STOP*8);
     if (!vk) {
-      dasm_put(Dst, 4683);
+      dasm_put(Dst, 4687);
     }
     if (vk) {
-      dasm_put(Dst, 4691, FORL_IDX*8);
+      dasm_put(Dst, 4695, FORL_IDX*8);
     }
-    dasm_put(Dst, 4695, FORL_EXT*8);
+    dasm_put(Dst, 4699, FORL_EXT*8);
     if (op != BC_JFORL) {
-      dasm_put(Dst, 4703, 32-1);
+      dasm_put(Dst, 4707, 32-1);
       if (op == BC_JFORI) {
-	dasm_put(Dst, 4707, -(BCBIAS_J*4 >> 16));
+	dasm_put(Dst, 4711, -(BCBIAS_J*4 >> 16));
       } else {
-	dasm_put(Dst, 4710, -(BCBIAS_J*4 >> 16));
+	dasm_put(Dst, 4714, -(BCBIAS_J*4 >> 16));
       }
     }
     if (op == BC_FORI) {
-      dasm_put(Dst, 4713);
+      dasm_put(Dst, 4717);
     } else if (op == BC_IFORL) {
-      dasm_put(Dst, 4715);
+      dasm_put(Dst, 4719);
     } else {
-      dasm_put(Dst, 4717, BC_JLOOP);
+      dasm_put(Dst, 4721, BC_JLOOP);
     }
-    dasm_put(Dst, 4720);
+    dasm_put(Dst, 4724);
     break;
 
   case BC_ITERL:
 #if LJ_HASJIT
-    dasm_put(Dst, 4735);
+    dasm_put(Dst, 4739);
 #endif
     break;
 
@@ -5819,40 +5823,40 @@ static void build_ins(BuildCtx *ctx, BCOp op, int defop)
     break;
 #endif
   case BC_IITERL:
-    dasm_put(Dst, 4737);
+    dasm_put(Dst, 4741);
     if (op == BC_JITERL) {
-      dasm_put(Dst, 4743);
+      dasm_put(Dst, 4747);
     } else {
-      dasm_put(Dst, 4745, 32-1, -(BCBIAS_J*4 >> 16));
+      dasm_put(Dst, 4749, 32-1, -(BCBIAS_J*4 >> 16));
     }
-    dasm_put(Dst, 4752);
+    dasm_put(Dst, 4756);
     break;
 
   case BC_LOOP:
 #if LJ_HASJIT
-    dasm_put(Dst, 4764);
+    dasm_put(Dst, 4768);
 #endif
     break;
 
   case BC_ILOOP:
-    dasm_put(Dst, 4766);
+    dasm_put(Dst, 4770);
     break;
 
   case BC_JLOOP:
 #if LJ_HASJIT
-    dasm_put(Dst, 4777);
+    dasm_put(Dst, 4781);
 #endif
     break;
 
   case BC_JMP:
-    dasm_put(Dst, 4779, 32-1, -(BCBIAS_J*4 >> 16));
+    dasm_put(Dst, 4783, 32-1, -(BCBIAS_J*4 >> 16));
     break;
 
   /* -- Function headers -------------------------------------------------- */
 
   case BC_FUNCF:
 #if LJ_HASJIT
-    dasm_put(Dst, 4795);
+    dasm_put(Dst, 4799);
 #endif
   case BC_FUNCV:  /* NYI: compiled vararg functions. */
     break;
@@ -5862,38 +5866,38 @@ static void build_ins(BuildCtx *ctx, BCOp op, int defop)
     break;
 #endif
   case BC_IFUNCF:
-    dasm_put(Dst, 4797, Dt1(->maxstack), -4+PC2PROTO(numparams), -4+PC2PROTO(k), 31-3);
+    dasm_put(Dst, 4801, Dt1(->maxstack), -4+PC2PROTO(numparams), -4+PC2PROTO(k), 31-3);
     if (op == BC_JFUNCF) {
-      dasm_put(Dst, 4815);
+      dasm_put(Dst, 4819);
     } else {
-      dasm_put(Dst, 4817);
+      dasm_put(Dst, 4821);
     }
-    dasm_put(Dst, 4826);
+    dasm_put(Dst, 4830);
     break;
 
   case BC_JFUNCV:
 #if !LJ_HASJIT
     break;
 #endif
-    dasm_put(Dst, 4832);
+    dasm_put(Dst, 4836);
     break;  /* NYI: compiled vararg functions. */
 
   case BC_IFUNCV:
-    dasm_put(Dst, 4834, Dt1(->maxstack), 8+FRAME_VARG, -4+PC2PROTO(k), -4+PC2PROTO(numparams));
+    dasm_put(Dst, 4838, Dt1(->maxstack), 8+FRAME_VARG, -4+PC2PROTO(k), -4+PC2PROTO(numparams));
     break;
 
   case BC_FUNCC:
   case BC_FUNCCW:
     if (op == BC_FUNCC) {
-      dasm_put(Dst, 4884, Dt8(->f));
+      dasm_put(Dst, 4888, Dt8(->f));
     } else {
-      dasm_put(Dst, 4887, DISPATCH_GL(wrapf));
+      dasm_put(Dst, 4891, DISPATCH_GL(wrapf));
     }
-    dasm_put(Dst, 4890, Dt1(->maxstack), Dt1(->base), Dt1(->top), ~LJ_VMST_C);
+    dasm_put(Dst, 4894, Dt1(->maxstack), Dt1(->base), Dt1(->top), ~LJ_VMST_C);
     if (op == BC_FUNCCW) {
-      dasm_put(Dst, 4903, Dt8(->f));
+      dasm_put(Dst, 4907, Dt8(->f));
     }
-    dasm_put(Dst, 4906, DISPATCH_GL(vmstate), Dt1(->top), 31-3, Dt1(->base), ~LJ_VMST_INTERP, DISPATCH_GL(vmstate));
+    dasm_put(Dst, 4910, DISPATCH_GL(vmstate), Dt1(->top), 31-3, Dt1(->base), ~LJ_VMST_INTERP, DISPATCH_GL(vmstate));
     break;
 
   /* ---------------------------------------------------------------------- */
@@ -5913,7 +5917,7 @@ static int build_backend(BuildCtx *ctx)
 
   build_subroutines(ctx);
 
-  dasm_put(Dst, 4927);
+  dasm_put(Dst, 4931);
   for (op = 0; op < BC__MAX; op++)
     build_ins(ctx, (BCOp)op, op);
 
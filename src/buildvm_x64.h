@@ -12,7 +12,7 @@
 #define DASM_SECTION_CODE_OP	0
 #define DASM_SECTION_CODE_SUB	1
 #define DASM_MAXSECTION		2
-static const unsigned char build_actionlist[14278] = {
+static const unsigned char build_actionlist[14420] = {
   254,1,248,10,252,247,195,237,15,132,244,11,131,227,252,248,41,218,72,141,
   76,25,252,248,139,90,252,252,199,68,10,4,237,248,12,131,192,1,137,68,36,4,
   252,247,195,237,15,132,244,13,248,14,129,252,243,239,252,247,195,237,15,133,
@@ -355,345 +355,352 @@ static const unsigned char build_actionlist[14278] = {
   168,235,15,133,244,251,168,235,15,133,244,247,168,235,15,132,244,247,65,252,
   255,142,233,252,233,244,247,255,248,137,65,15,182,134,233,168,235,15,133,
   244,251,252,233,244,247,248,138,65,15,182,134,233,168,235,15,133,244,251,
-  168,235,15,132,244,251,65,252,255,142,233,15,132,244,247,168,235,15,132,244,
-  251,248,1,255,139,108,36,24,137,149,233,137,222,137,252,239,232,251,1,20,
-  248,3,139,149,233,248,4,15,182,75,252,253,248,5,15,182,107,252,252,15,183,
-  67,252,254,65,252,255,164,253,252,238,233,248,139,131,195,4,139,77,232,137,
-  76,36,4,252,233,244,4,248,140,255,139,106,252,248,139,173,233,15,182,133,
-  233,141,4,194,139,108,36,24,137,149,233,137,133,233,137,222,65,141,190,233,
-  73,137,174,233,137,92,36,28,232,251,1,21,252,233,244,3,255,248,141,137,92,
-  36,28,255,248,142,255,137,92,36,28,131,203,1,248,1,255,141,68,194,252,248,
-  139,108,36,24,137,149,233,137,133,233,137,222,137,252,239,232,251,1,22,199,
-  68,36,28,0,0,0,0,255,131,227,252,254,255,139,149,233,72,137,193,139,133,233,
-  41,208,72,137,205,15,182,75,252,253,193,232,3,131,192,1,252,255,229,248,143,
-  255,65,85,65,84,65,83,65,82,65,81,65,80,87,86,85,72,141,108,36,88,85,83,82,
-  81,80,15,182,69,252,248,138,101,252,240,76,137,125,252,248,76,137,117,252,
-  240,68,139,117,0,65,139,142,233,65,199,134,233,237,65,137,134,233,65,137,
-  142,233,72,129,252,236,239,72,131,197,128,252,242,68,15,17,125,252,248,252,
-  242,68,15,17,117,252,240,252,242,68,15,17,109,232,252,242,68,15,17,101,224,
-  252,242,68,15,17,93,216,252,242,68,15,17,85,208,252,242,68,15,17,77,200,252,
-  242,68,15,17,69,192,252,242,15,17,125,184,252,242,15,17,117,176,252,242,15,
-  17,109,168,252,242,15,17,101,160,252,242,15,17,93,152,252,242,15,17,85,144,
-  252,242,15,17,77,136,252,242,15,17,69,128,65,139,174,233,65,139,150,233,73,
-  137,174,233,65,199,134,233,0,0,0,0,137,149,233,72,137,230,65,141,190,233,
-  232,251,1,23,72,139,141,233,72,129,225,239,72,137,204,137,169,233,139,149,
-  233,139,153,233,252,233,244,247,255,248,144,255,72,131,196,16,248,1,76,139,
-  108,36,8,76,139,36,36,133,192,15,136,244,249,137,68,36,4,68,139,122,252,248,
-  69,139,191,233,69,139,191,233,65,199,134,233,0,0,0,0,65,199,134,233,237,139,
-  3,15,182,204,15,182,232,131,195,4,193,232,16,129,252,253,239,15,130,244,248,
-  139,68,36,4,248,2,65,252,255,36,252,238,248,3,252,247,216,137,252,239,137,
-  198,232,251,1,24,255,248,82,255,217,124,36,4,137,68,36,8,102,184,0,4,102,
-  11,68,36,4,102,37,252,255,252,247,102,137,68,36,6,217,108,36,6,217,252,252,
-  217,108,36,4,139,68,36,8,195,255,248,145,72,184,237,237,102,72,15,110,208,
-  72,184,237,237,102,72,15,110,216,15,40,200,102,15,84,202,102,15,46,217,15,
-  134,244,247,102,15,85,208,252,242,15,88,203,252,242,15,92,203,102,15,86,202,
-  72,184,237,237,102,72,15,110,208,252,242,15,194,193,1,102,15,84,194,252,242,
-  15,92,200,15,40,193,248,1,195,248,84,255,217,124,36,4,137,68,36,8,102,184,
-  0,8,102,11,68,36,4,102,37,252,255,252,251,102,137,68,36,6,217,108,36,6,217,
-  252,252,217,108,36,4,139,68,36,8,195,255,248,146,72,184,237,237,102,72,15,
-  110,208,72,184,237,237,102,72,15,110,216,15,40,200,102,15,84,202,102,15,46,
-  217,15,134,244,247,102,15,85,208,252,242,15,88,203,252,242,15,92,203,102,
-  15,86,202,72,184,237,237,102,72,15,110,208,252,242,15,194,193,6,102,15,84,
-  194,252,242,15,92,200,15,40,193,248,1,195,248,104,255,217,124,36,4,137,68,
-  36,8,102,184,0,12,102,11,68,36,4,102,137,68,36,6,217,108,36,6,217,252,252,
-  217,108,36,4,139,68,36,8,195,255,248,147,72,184,237,237,102,72,15,110,208,
-  72,184,237,237,102,72,15,110,216,15,40,200,102,15,84,202,102,15,46,217,15,
-  134,244,247,102,15,85,208,15,40,193,252,242,15,88,203,252,242,15,92,203,72,
-  184,237,237,102,72,15,110,216,252,242,15,194,193,1,102,15,84,195,252,242,
-  15,92,200,102,15,86,202,15,40,193,248,1,195,248,148,255,15,40,232,252,242,
-  15,94,193,72,184,237,237,102,72,15,110,208,72,184,237,237,102,72,15,110,216,
-  15,40,224,102,15,84,226,102,15,46,220,15,134,244,247,102,15,85,208,252,242,
-  15,88,227,252,242,15,92,227,102,15,86,226,72,184,237,237,102,72,15,110,208,
-  252,242,15,194,196,1,102,15,84,194,252,242,15,92,224,15,40,197,252,242,15,
-  89,204,252,242,15,92,193,195,248,1,252,242,15,89,200,15,40,197,252,242,15,
-  92,193,195,255,217,193,216,252,241,217,124,36,4,102,184,0,4,102,11,68,36,
-  4,102,37,252,255,252,247,102,137,68,36,6,217,108,36,6,217,252,252,217,108,
-  36,4,222,201,222,252,233,195,255,248,88,217,252,234,222,201,248,149,217,84,
-  36,252,248,129,124,36,252,248,0,0,128,127,15,132,244,247,129,124,36,252,248,
-  0,0,128,252,255,15,132,244,248,248,150,217,192,217,252,252,220,252,233,217,
-  201,217,252,240,217,232,222,193,217,252,253,221,217,248,1,195,248,2,221,216,
-  217,252,238,195,255,248,107,255,248,151,252,242,15,45,193,252,242,15,42,208,
-  102,15,46,202,15,133,244,254,15,138,244,255,248,152,131,252,248,1,15,142,
-  244,252,248,1,169,1,0,0,0,15,133,244,248,252,242,15,89,192,209,232,252,233,
-  244,1,248,2,209,232,15,132,244,251,15,40,200,248,3,252,242,15,89,192,209,
-  232,15,132,244,250,15,131,244,3,255,252,242,15,89,200,252,233,244,3,248,4,
-  252,242,15,89,193,248,5,195,248,6,15,132,244,5,15,130,244,253,80,72,184,237,
-  237,102,72,15,110,200,252,242,15,94,200,88,15,40,193,252,247,216,131,252,
-  248,1,15,132,244,5,252,233,244,1,248,7,72,184,237,237,102,72,15,110,192,195,
-  248,8,102,72,15,126,200,72,209,224,72,193,192,12,72,61,252,254,15,0,0,15,
-  132,244,248,255,102,72,15,126,192,72,209,224,15,132,244,250,72,193,192,12,
-  72,61,252,254,15,0,0,15,132,244,251,252,242,15,17,76,36,252,240,252,242,15,
-  17,68,36,252,248,221,68,36,252,240,221,68,36,252,248,217,252,241,217,192,
+  168,235,15,133,244,247,168,235,15,132,244,251,65,252,255,142,233,15,132,244,
+  247,255,168,235,15,132,244,251,248,1,139,108,36,24,137,149,233,137,222,137,
+  252,239,232,251,1,20,248,3,139,149,233,248,4,15,182,75,252,253,248,5,15,182,
+  107,252,252,15,183,67,252,254,65,252,255,164,253,252,238,233,248,139,131,
+  195,4,139,77,232,137,76,36,4,252,233,244,4,248,140,255,139,106,252,248,139,
+  173,233,15,182,133,233,141,4,194,139,108,36,24,137,149,233,137,133,233,137,
+  222,65,141,190,233,73,137,174,233,137,92,36,28,232,251,1,21,252,233,244,3,
+  255,248,141,255,139,106,252,248,139,173,233,15,182,133,233,141,4,194,139,
+  108,36,24,137,149,233,137,133,233,137,222,65,141,190,233,73,137,174,233,137,
+  92,36,28,232,251,1,21,139,149,233,15,183,67,252,254,141,156,253,131,233,139,
+  3,15,182,204,15,182,232,131,195,4,193,232,16,65,252,255,36,252,238,255,248,
+  142,137,92,36,28,255,248,143,255,137,92,36,28,131,203,1,248,1,255,141,68,
+  194,252,248,139,108,36,24,137,149,233,137,133,233,137,222,137,252,239,232,
+  251,1,22,199,68,36,28,0,0,0,0,255,131,227,252,254,255,139,149,233,72,137,
+  193,139,133,233,41,208,72,137,205,15,182,75,252,253,193,232,3,131,192,1,252,
+  255,229,248,144,255,65,85,65,84,65,83,65,82,65,81,65,80,87,86,85,72,141,108,
+  36,88,85,83,82,81,80,15,182,69,252,248,138,101,252,240,76,137,125,252,248,
+  76,137,117,252,240,68,139,117,0,65,139,142,233,65,199,134,233,237,65,137,
+  134,233,65,137,142,233,72,129,252,236,239,72,131,197,128,252,242,68,15,17,
+  125,252,248,252,242,68,15,17,117,252,240,252,242,68,15,17,109,232,252,242,
+  68,15,17,101,224,252,242,68,15,17,93,216,252,242,68,15,17,85,208,252,242,
+  68,15,17,77,200,252,242,68,15,17,69,192,252,242,15,17,125,184,252,242,15,
+  17,117,176,252,242,15,17,109,168,252,242,15,17,101,160,252,242,15,17,93,152,
+  252,242,15,17,85,144,252,242,15,17,77,136,252,242,15,17,69,128,65,139,174,
+  233,65,139,150,233,73,137,174,233,65,199,134,233,0,0,0,0,137,149,233,72,137,
+  230,65,141,190,233,232,251,1,23,72,139,141,233,72,129,225,239,72,137,204,
+  137,169,233,139,149,233,139,153,233,252,233,244,247,255,248,145,255,72,131,
+  196,16,248,1,76,139,108,36,8,76,139,36,36,133,192,15,136,244,249,137,68,36,
+  4,68,139,122,252,248,69,139,191,233,69,139,191,233,65,199,134,233,0,0,0,0,
+  65,199,134,233,237,139,3,15,182,204,15,182,232,131,195,4,193,232,16,129,252,
+  253,239,15,130,244,248,139,68,36,4,248,2,65,252,255,36,252,238,248,3,252,
+  247,216,137,252,239,137,198,232,251,1,24,255,248,82,255,217,124,36,4,137,
+  68,36,8,102,184,0,4,102,11,68,36,4,102,37,252,255,252,247,102,137,68,36,6,
+  217,108,36,6,217,252,252,217,108,36,4,139,68,36,8,195,255,248,146,72,184,
+  237,237,102,72,15,110,208,72,184,237,237,102,72,15,110,216,15,40,200,102,
+  15,84,202,102,15,46,217,15,134,244,247,102,15,85,208,252,242,15,88,203,252,
+  242,15,92,203,102,15,86,202,72,184,237,237,102,72,15,110,208,252,242,15,194,
+  193,1,102,15,84,194,252,242,15,92,200,15,40,193,248,1,195,248,84,255,217,
+  124,36,4,137,68,36,8,102,184,0,8,102,11,68,36,4,102,37,252,255,252,251,102,
+  137,68,36,6,217,108,36,6,217,252,252,217,108,36,4,139,68,36,8,195,255,248,
+  147,72,184,237,237,102,72,15,110,208,72,184,237,237,102,72,15,110,216,15,
+  40,200,102,15,84,202,102,15,46,217,15,134,244,247,102,15,85,208,252,242,15,
+  88,203,252,242,15,92,203,102,15,86,202,72,184,237,237,102,72,15,110,208,252,
+  242,15,194,193,6,102,15,84,194,252,242,15,92,200,15,40,193,248,1,195,248,
+  104,255,217,124,36,4,137,68,36,8,102,184,0,12,102,11,68,36,4,102,137,68,36,
+  6,217,108,36,6,217,252,252,217,108,36,4,139,68,36,8,195,255,248,148,72,184,
+  237,237,102,72,15,110,208,72,184,237,237,102,72,15,110,216,15,40,200,102,
+  15,84,202,102,15,46,217,15,134,244,247,102,15,85,208,15,40,193,252,242,15,
+  88,203,252,242,15,92,203,72,184,237,237,102,72,15,110,216,252,242,15,194,
+  193,1,102,15,84,195,252,242,15,92,200,102,15,86,202,15,40,193,248,1,195,248,
+  149,255,15,40,232,252,242,15,94,193,72,184,237,237,102,72,15,110,208,72,184,
+  237,237,102,72,15,110,216,15,40,224,102,15,84,226,102,15,46,220,15,134,244,
+  247,102,15,85,208,252,242,15,88,227,252,242,15,92,227,102,15,86,226,72,184,
+  237,237,102,72,15,110,208,252,242,15,194,196,1,102,15,84,194,252,242,15,92,
+  224,15,40,197,252,242,15,89,204,252,242,15,92,193,195,248,1,252,242,15,89,
+  200,15,40,197,252,242,15,92,193,195,255,217,193,216,252,241,217,124,36,4,
+  102,184,0,4,102,11,68,36,4,102,37,252,255,252,247,102,137,68,36,6,217,108,
+  36,6,217,252,252,217,108,36,4,222,201,222,252,233,195,255,248,88,217,252,
+  234,222,201,248,150,217,84,36,252,248,129,124,36,252,248,0,0,128,127,15,132,
+  244,247,129,124,36,252,248,0,0,128,252,255,15,132,244,248,248,151,217,192,
   217,252,252,220,252,233,217,201,217,252,240,217,232,222,193,217,252,253,221,
-  217,221,92,36,252,248,252,242,15,16,68,36,252,248,195,248,9,72,184,237,237,
-  102,72,15,110,208,102,15,46,194,15,132,244,247,15,40,193,248,1,195,248,2,
-  72,184,237,237,102,72,15,110,208,102,15,84,194,72,184,237,237,102,72,15,110,
-  208,102,15,46,194,15,132,244,1,102,15,80,193,15,87,192,136,196,15,146,208,
-  48,224,15,133,244,1,248,3,72,184,237,237,255,102,72,15,110,192,195,248,4,
-  102,15,80,193,133,192,15,133,244,3,15,87,192,195,248,5,102,15,80,193,133,
-  192,15,132,244,3,15,87,192,195,248,153,255,131,252,255,1,15,130,244,82,15,
-  132,244,84,131,252,255,3,15,130,244,104,15,135,244,248,252,242,15,81,192,
-  195,248,2,252,242,15,17,68,36,252,248,221,68,36,252,248,131,252,255,5,15,
-  135,244,248,15,132,244,247,232,244,88,252,233,244,253,248,1,232,244,149,255,
-  252,233,244,253,248,2,131,252,255,7,15,132,244,247,15,135,244,248,217,252,
-  237,217,201,217,252,241,252,233,244,253,248,1,217,232,217,201,217,252,241,
-  252,233,244,253,248,2,131,252,255,9,15,132,244,247,15,135,244,248,217,252,
-  236,217,201,217,252,241,252,233,244,253,248,1,255,217,252,254,252,233,244,
-  253,248,2,131,252,255,11,15,132,244,247,15,135,244,255,217,252,255,252,233,
-  244,253,248,1,217,252,242,221,216,248,7,221,92,36,252,248,252,242,15,16,68,
-  36,252,248,195,255,139,124,36,12,221,68,36,4,131,252,255,1,15,130,244,82,
-  15,132,244,84,131,252,255,3,15,130,244,104,15,135,244,248,217,252,250,195,
-  248,2,131,252,255,5,15,130,244,88,15,132,244,149,131,252,255,7,15,132,244,
-  247,15,135,244,248,217,252,237,217,201,217,252,241,195,248,1,217,232,217,
-  201,217,252,241,195,248,2,131,252,255,9,15,132,244,247,255,15,135,244,248,
-  217,252,236,217,201,217,252,241,195,248,1,217,252,254,195,248,2,131,252,255,
-  11,15,132,244,247,15,135,244,255,217,252,255,195,248,1,217,252,242,221,216,
-  195,255,248,9,204,255,248,154,255,131,252,255,1,15,132,244,247,15,135,244,
-  248,252,242,15,88,193,195,248,1,252,242,15,92,193,195,248,2,131,252,255,3,
-  15,132,244,247,15,135,244,248,252,242,15,89,193,195,248,1,252,242,15,94,193,
-  195,248,2,131,252,255,5,15,130,244,148,15,132,244,107,131,252,255,7,15,132,
-  244,247,15,135,244,248,72,184,237,237,255,102,72,15,110,200,15,87,193,195,
-  248,1,72,184,237,237,102,72,15,110,200,15,84,193,195,248,2,131,252,255,9,
-  15,135,244,248,252,242,15,17,68,36,252,248,252,242,15,17,76,36,252,240,221,
-  68,36,252,248,221,68,36,252,240,15,132,244,247,217,252,243,248,7,221,92,36,
-  252,248,252,242,15,16,68,36,252,248,195,248,1,217,201,217,252,253,221,217,
-  252,233,244,7,248,2,131,252,255,11,15,132,244,247,15,135,244,255,252,242,
-  15,93,193,195,248,1,252,242,15,95,193,195,248,9,204,255,139,68,36,20,221,
-  68,36,4,221,68,36,12,131,252,248,1,15,132,244,247,15,135,244,248,222,193,
-  195,248,1,222,252,233,195,248,2,131,252,248,3,15,132,244,247,15,135,244,248,
-  222,201,195,248,1,222,252,249,195,248,2,131,252,248,5,15,130,244,148,15,132,
-  244,107,131,252,248,7,15,132,244,247,15,135,244,248,255,221,216,217,224,195,
-  248,1,221,216,217,225,195,248,2,131,252,248,9,15,132,244,247,15,135,244,248,
-  217,252,243,195,248,1,217,201,217,252,253,221,217,195,248,2,131,252,248,11,
-  15,132,244,247,15,135,244,255,255,219,252,233,219,209,221,217,195,248,1,219,
-  252,233,218,209,221,217,195,255,221,225,223,224,252,246,196,1,15,132,244,
-  248,217,201,248,2,221,216,195,248,1,221,225,223,224,252,246,196,1,15,133,
-  244,248,217,201,248,2,221,216,195,255,248,155,137,252,248,83,15,162,137,6,
-  137,94,4,137,78,8,137,86,12,91,195,255,129,124,253,202,4,239,15,135,244,41,
-  129,124,253,194,4,239,15,135,244,41,255,252,242,15,16,4,194,131,195,4,102,
-  15,46,4,202,255,221,4,202,221,4,194,131,195,4,255,223,252,233,221,216,255,
-  218,252,233,223,224,158,255,15,134,244,248,255,15,131,244,248,255,248,1,15,
-  183,67,252,254,141,156,253,131,233,248,2,139,3,15,182,204,15,182,232,131,
-  195,4,193,232,16,65,252,255,36,252,238,255,139,108,194,4,131,195,4,129,252,
-  253,239,15,135,244,251,129,124,253,202,4,239,15,135,244,251,255,252,242,15,
-  16,4,194,102,15,46,4,202,255,221,4,202,221,4,194,255,15,138,244,248,15,133,
-  244,248,255,15,138,244,248,15,132,244,247,255,248,1,15,183,67,252,254,141,
-  156,253,131,233,248,2,255,248,2,15,183,67,252,254,141,156,253,131,233,248,
-  1,255,248,5,57,108,202,4,15,133,244,2,129,252,253,239,15,131,244,1,139,12,
-  202,139,4,194,57,193,15,132,244,1,129,252,253,239,15,135,244,2,139,169,233,
-  133,252,237,15,132,244,2,252,246,133,233,235,15,133,244,2,255,49,252,237,
-  255,189,1,0,0,0,255,252,233,244,45,255,72,252,247,208,131,195,4,129,124,253,
-  202,4,239,15,133,244,248,139,12,202,65,59,12,135,255,131,195,4,129,124,253,
-  202,4,239,15,135,244,248,255,252,242,65,15,16,4,199,102,15,46,4,202,255,221,
-  4,202,65,221,4,199,255,72,252,247,208,131,195,4,57,68,202,4,255,139,108,194,
-  4,131,195,4,129,252,253,239,255,15,131,244,247,255,15,130,244,247,255,137,
-  108,202,4,139,44,194,137,44,202,255,15,183,67,252,254,141,156,253,131,233,
-  248,1,139,3,15,182,204,15,182,232,131,195,4,193,232,16,65,252,255,36,252,
-  238,255,72,139,44,194,72,137,44,202,139,3,15,182,204,15,182,232,131,195,4,
-  193,232,16,65,252,255,36,252,238,255,49,252,237,129,124,253,194,4,239,129,
-  213,239,137,108,202,4,139,3,15,182,204,15,182,232,131,195,4,193,232,16,65,
-  252,255,36,252,238,255,129,124,253,194,4,239,15,135,244,48,255,252,242,15,
-  16,4,194,72,184,237,237,102,72,15,110,200,15,87,193,252,242,15,17,4,202,255,
-  221,4,194,217,224,221,28,202,255,129,124,253,194,4,239,15,133,244,248,139,
-  4,194,255,15,87,192,252,242,15,42,128,233,248,1,252,242,15,17,4,202,255,219,
-  128,233,248,1,221,28,202,255,139,3,15,182,204,15,182,232,131,195,4,193,232,
-  16,65,252,255,36,252,238,248,2,129,124,253,194,4,239,15,133,244,50,139,60,
-  194,137,213,232,251,1,18,255,252,242,15,42,192,137,252,234,255,15,182,75,
-  252,253,252,233,244,1,255,15,182,252,236,15,182,192,255,129,124,253,252,234,
-  4,239,15,135,244,46,255,252,242,15,16,4,252,234,252,242,65,15,88,4,199,255,
-  221,4,252,234,65,220,4,199,255,129,124,253,252,234,4,239,15,135,244,47,255,
-  252,242,65,15,16,4,199,252,242,15,88,4,252,234,255,65,221,4,199,220,4,252,
-  234,255,129,124,253,252,234,4,239,15,135,244,49,129,124,253,194,4,239,15,
-  135,244,49,255,252,242,15,16,4,252,234,252,242,15,88,4,194,255,221,4,252,
-  234,220,4,194,255,252,242,15,16,4,252,234,252,242,65,15,92,4,199,255,221,
-  4,252,234,65,220,36,199,255,252,242,65,15,16,4,199,252,242,15,92,4,252,234,
-  255,65,221,4,199,220,36,252,234,255,252,242,15,16,4,252,234,252,242,15,92,
-  4,194,255,221,4,252,234,220,36,194,255,252,242,15,16,4,252,234,252,242,65,
-  15,89,4,199,255,221,4,252,234,65,220,12,199,255,252,242,65,15,16,4,199,252,
-  242,15,89,4,252,234,255,65,221,4,199,220,12,252,234,255,252,242,15,16,4,252,
-  234,252,242,15,89,4,194,255,221,4,252,234,220,12,194,255,252,242,15,16,4,
-  252,234,252,242,65,15,94,4,199,255,221,4,252,234,65,220,52,199,255,252,242,
-  65,15,16,4,199,252,242,15,94,4,252,234,255,65,221,4,199,220,52,252,234,255,
-  252,242,15,16,4,252,234,252,242,15,94,4,194,255,221,4,252,234,220,52,194,
-  255,252,242,15,16,4,252,234,252,242,65,15,16,12,199,255,221,4,252,234,65,
-  221,4,199,255,252,242,65,15,16,4,199,252,242,15,16,12,252,234,255,65,221,
-  4,199,221,4,252,234,255,252,242,15,16,4,252,234,252,242,15,16,12,194,255,
-  221,4,252,234,221,4,194,255,248,156,232,244,148,255,252,233,244,156,255,232,
-  244,107,255,15,182,252,236,15,182,192,139,124,36,24,137,151,233,141,52,194,
-  137,194,41,252,234,248,33,137,252,253,137,92,36,28,232,251,1,25,139,149,233,
-  133,192,15,133,244,42,15,182,107,252,255,15,182,75,252,253,72,139,4,252,234,
-  72,137,4,202,139,3,15,182,204,15,182,232,131,195,4,193,232,16,65,252,255,
-  36,252,238,255,72,252,247,208,65,139,4,135,199,68,202,4,237,137,4,202,139,
-  3,15,182,204,15,182,232,131,195,4,193,232,16,65,252,255,36,252,238,255,15,
-  191,192,252,242,15,42,192,252,242,15,17,4,202,255,223,67,252,254,221,28,202,
-  255,252,242,65,15,16,4,199,252,242,15,17,4,202,255,65,221,4,199,221,28,202,
-  255,72,252,247,208,137,68,202,4,139,3,15,182,204,15,182,232,131,195,4,193,
-  232,16,65,252,255,36,252,238,255,141,76,202,12,141,68,194,4,189,237,137,105,
-  252,248,248,1,137,41,131,193,8,57,193,15,134,244,1,139,3,15,182,204,15,182,
-  232,131,195,4,193,232,16,65,252,255,36,252,238,255,139,106,252,248,139,172,
-  253,133,233,139,173,233,72,139,69,0,72,137,4,202,139,3,15,182,204,15,182,
-  232,131,195,4,193,232,16,65,252,255,36,252,238,255,139,106,252,248,139,172,
-  253,141,233,128,189,233,0,139,173,233,139,12,194,139,68,194,4,137,77,0,137,
-  69,4,15,132,244,247,252,246,133,233,235,15,133,244,248,248,1,139,3,15,182,
-  204,15,182,232,131,195,4,193,232,16,65,252,255,36,252,238,248,2,129,232,239,
-  129,252,248,239,15,134,244,1,252,246,129,233,235,15,132,244,1,137,252,238,
-  137,213,65,141,190,233,255,232,251,1,26,137,252,234,252,233,244,1,255,72,
-  252,247,208,139,106,252,248,139,172,253,141,233,65,139,12,135,139,133,233,
-  137,8,199,64,4,237,252,246,133,233,235,15,133,244,248,248,1,139,3,15,182,
-  204,15,182,232,131,195,4,193,232,16,65,252,255,36,252,238,248,2,252,246,129,
-  233,235,15,132,244,1,128,189,233,0,15,132,244,1,137,213,137,198,65,141,190,
-  233,232,251,1,26,137,252,234,252,233,244,1,255,139,106,252,248,255,252,242,
-  65,15,16,4,199,255,139,172,253,141,233,139,141,233,255,252,242,15,17,1,255,
-  221,25,255,72,252,247,208,139,106,252,248,139,172,253,141,233,139,141,233,
-  137,65,4,139,3,15,182,204,15,182,232,131,195,4,193,232,16,65,252,255,36,252,
-  238,255,141,156,253,131,233,139,108,36,24,131,189,233,0,15,132,244,247,137,
-  149,233,141,52,202,137,252,239,232,251,1,27,139,149,233,248,1,139,3,15,182,
-  204,15,182,232,131,195,4,193,232,16,65,252,255,36,252,238,255,72,252,247,
-  208,139,108,36,24,137,149,233,139,82,252,248,65,139,52,135,137,252,239,137,
-  92,36,28,232,251,1,28,139,149,233,15,182,75,252,253,137,4,202,199,68,202,
-  4,237,139,3,15,182,204,15,182,232,131,195,4,193,232,16,65,252,255,36,252,
-  238,255,139,108,36,24,137,149,233,65,139,142,233,65,59,142,233,137,92,36,
-  28,15,131,244,251,248,1,137,194,37,252,255,7,0,0,193,252,234,11,61,252,255,
-  7,0,0,15,132,244,249,248,2,137,252,239,137,198,232,251,1,29,139,149,233,15,
-  182,75,252,253,137,4,202,199,68,202,4,237,139,3,15,182,204,15,182,232,131,
-  195,4,193,232,16,65,252,255,36,252,238,248,3,184,1,8,0,0,252,233,244,2,248,
-  5,137,252,239,232,251,1,30,15,183,67,252,254,252,233,244,1,255,72,252,247,
-  208,139,108,36,24,65,139,142,233,137,92,36,28,65,59,142,233,137,149,233,15,
-  131,244,249,248,2,65,139,52,135,137,252,239,232,251,1,31,139,149,233,15,182,
+  217,248,1,195,248,2,221,216,217,252,238,195,255,248,107,255,248,152,252,242,
+  15,45,193,252,242,15,42,208,102,15,46,202,15,133,244,254,15,138,244,255,248,
+  153,131,252,248,1,15,142,244,252,248,1,169,1,0,0,0,15,133,244,248,252,242,
+  15,89,192,209,232,252,233,244,1,248,2,209,232,15,132,244,251,15,40,200,248,
+  3,252,242,15,89,192,209,232,15,132,244,250,15,131,244,3,255,252,242,15,89,
+  200,252,233,244,3,248,4,252,242,15,89,193,248,5,195,248,6,15,132,244,5,15,
+  130,244,253,80,72,184,237,237,102,72,15,110,200,252,242,15,94,200,88,15,40,
+  193,252,247,216,131,252,248,1,15,132,244,5,252,233,244,1,248,7,72,184,237,
+  237,102,72,15,110,192,195,248,8,102,72,15,126,200,72,209,224,72,193,192,12,
+  72,61,252,254,15,0,0,15,132,244,248,255,102,72,15,126,192,72,209,224,15,132,
+  244,250,72,193,192,12,72,61,252,254,15,0,0,15,132,244,251,252,242,15,17,76,
+  36,252,240,252,242,15,17,68,36,252,248,221,68,36,252,240,221,68,36,252,248,
+  217,252,241,217,192,217,252,252,220,252,233,217,201,217,252,240,217,232,222,
+  193,217,252,253,221,217,221,92,36,252,248,252,242,15,16,68,36,252,248,195,
+  248,9,72,184,237,237,102,72,15,110,208,102,15,46,194,15,132,244,247,15,40,
+  193,248,1,195,248,2,72,184,237,237,102,72,15,110,208,102,15,84,194,72,184,
+  237,237,102,72,15,110,208,102,15,46,194,15,132,244,1,102,15,80,193,15,87,
+  192,136,196,15,146,208,48,224,15,133,244,1,248,3,72,184,237,237,255,102,72,
+  15,110,192,195,248,4,102,15,80,193,133,192,15,133,244,3,15,87,192,195,248,
+  5,102,15,80,193,133,192,15,132,244,3,15,87,192,195,248,154,255,131,252,255,
+  1,15,130,244,82,15,132,244,84,131,252,255,3,15,130,244,104,15,135,244,248,
+  252,242,15,81,192,195,248,2,252,242,15,17,68,36,252,248,221,68,36,252,248,
+  131,252,255,5,15,135,244,248,15,132,244,247,232,244,88,252,233,244,253,248,
+  1,232,244,150,255,252,233,244,253,248,2,131,252,255,7,15,132,244,247,15,135,
+  244,248,217,252,237,217,201,217,252,241,252,233,244,253,248,1,217,232,217,
+  201,217,252,241,252,233,244,253,248,2,131,252,255,9,15,132,244,247,15,135,
+  244,248,217,252,236,217,201,217,252,241,252,233,244,253,248,1,255,217,252,
+  254,252,233,244,253,248,2,131,252,255,11,15,132,244,247,15,135,244,255,217,
+  252,255,252,233,244,253,248,1,217,252,242,221,216,248,7,221,92,36,252,248,
+  252,242,15,16,68,36,252,248,195,255,139,124,36,12,221,68,36,4,131,252,255,
+  1,15,130,244,82,15,132,244,84,131,252,255,3,15,130,244,104,15,135,244,248,
+  217,252,250,195,248,2,131,252,255,5,15,130,244,88,15,132,244,150,131,252,
+  255,7,15,132,244,247,15,135,244,248,217,252,237,217,201,217,252,241,195,248,
+  1,217,232,217,201,217,252,241,195,248,2,131,252,255,9,15,132,244,247,255,
+  15,135,244,248,217,252,236,217,201,217,252,241,195,248,1,217,252,254,195,
+  248,2,131,252,255,11,15,132,244,247,15,135,244,255,217,252,255,195,248,1,
+  217,252,242,221,216,195,255,248,9,204,255,248,155,255,131,252,255,1,15,132,
+  244,247,15,135,244,248,252,242,15,88,193,195,248,1,252,242,15,92,193,195,
+  248,2,131,252,255,3,15,132,244,247,15,135,244,248,252,242,15,89,193,195,248,
+  1,252,242,15,94,193,195,248,2,131,252,255,5,15,130,244,149,15,132,244,107,
+  131,252,255,7,15,132,244,247,15,135,244,248,72,184,237,237,255,102,72,15,
+  110,200,15,87,193,195,248,1,72,184,237,237,102,72,15,110,200,15,84,193,195,
+  248,2,131,252,255,9,15,135,244,248,252,242,15,17,68,36,252,248,252,242,15,
+  17,76,36,252,240,221,68,36,252,248,221,68,36,252,240,15,132,244,247,217,252,
+  243,248,7,221,92,36,252,248,252,242,15,16,68,36,252,248,195,248,1,217,201,
+  217,252,253,221,217,252,233,244,7,248,2,131,252,255,11,15,132,244,247,15,
+  135,244,255,252,242,15,93,193,195,248,1,252,242,15,95,193,195,248,9,204,255,
+  139,68,36,20,221,68,36,4,221,68,36,12,131,252,248,1,15,132,244,247,15,135,
+  244,248,222,193,195,248,1,222,252,233,195,248,2,131,252,248,3,15,132,244,
+  247,15,135,244,248,222,201,195,248,1,222,252,249,195,248,2,131,252,248,5,
+  15,130,244,149,15,132,244,107,131,252,248,7,15,132,244,247,15,135,244,248,
+  255,221,216,217,224,195,248,1,221,216,217,225,195,248,2,131,252,248,9,15,
+  132,244,247,15,135,244,248,217,252,243,195,248,1,217,201,217,252,253,221,
+  217,195,248,2,131,252,248,11,15,132,244,247,15,135,244,255,255,219,252,233,
+  219,209,221,217,195,248,1,219,252,233,218,209,221,217,195,255,221,225,223,
+  224,252,246,196,1,15,132,244,248,217,201,248,2,221,216,195,248,1,221,225,
+  223,224,252,246,196,1,15,133,244,248,217,201,248,2,221,216,195,255,248,156,
+  137,252,248,83,15,162,137,6,137,94,4,137,78,8,137,86,12,91,195,255,129,124,
+  253,202,4,239,15,135,244,41,129,124,253,194,4,239,15,135,244,41,255,252,242,
+  15,16,4,194,131,195,4,102,15,46,4,202,255,221,4,202,221,4,194,131,195,4,255,
+  223,252,233,221,216,255,218,252,233,223,224,158,255,15,134,244,248,255,15,
+  131,244,248,255,248,1,15,183,67,252,254,141,156,253,131,233,248,2,139,3,15,
+  182,204,15,182,232,131,195,4,193,232,16,65,252,255,36,252,238,255,139,108,
+  194,4,131,195,4,129,252,253,239,15,135,244,251,129,124,253,202,4,239,15,135,
+  244,251,255,252,242,15,16,4,194,102,15,46,4,202,255,221,4,202,221,4,194,255,
+  15,138,244,248,15,133,244,248,255,15,138,244,248,15,132,244,247,255,248,1,
+  15,183,67,252,254,141,156,253,131,233,248,2,255,248,2,15,183,67,252,254,141,
+  156,253,131,233,248,1,255,248,5,57,108,202,4,15,133,244,2,129,252,253,239,
+  15,131,244,1,139,12,202,139,4,194,57,193,15,132,244,1,129,252,253,239,15,
+  135,244,2,139,169,233,133,252,237,15,132,244,2,252,246,133,233,235,15,133,
+  244,2,255,49,252,237,255,189,1,0,0,0,255,252,233,244,45,255,72,252,247,208,
+  131,195,4,129,124,253,202,4,239,15,133,244,248,139,12,202,65,59,12,135,255,
+  131,195,4,129,124,253,202,4,239,15,135,244,248,255,252,242,65,15,16,4,199,
+  102,15,46,4,202,255,221,4,202,65,221,4,199,255,72,252,247,208,131,195,4,57,
+  68,202,4,255,139,108,194,4,131,195,4,129,252,253,239,255,15,131,244,247,255,
+  15,130,244,247,255,137,108,202,4,139,44,194,137,44,202,255,15,183,67,252,
+  254,141,156,253,131,233,248,1,139,3,15,182,204,15,182,232,131,195,4,193,232,
+  16,65,252,255,36,252,238,255,72,139,44,194,72,137,44,202,139,3,15,182,204,
+  15,182,232,131,195,4,193,232,16,65,252,255,36,252,238,255,49,252,237,129,
+  124,253,194,4,239,129,213,239,137,108,202,4,139,3,15,182,204,15,182,232,131,
+  195,4,193,232,16,65,252,255,36,252,238,255,129,124,253,194,4,239,15,135,244,
+  48,255,252,242,15,16,4,194,72,184,237,237,102,72,15,110,200,15,87,193,252,
+  242,15,17,4,202,255,221,4,194,217,224,221,28,202,255,129,124,253,194,4,239,
+  15,133,244,248,139,4,194,255,15,87,192,252,242,15,42,128,233,248,1,252,242,
+  15,17,4,202,255,219,128,233,248,1,221,28,202,255,139,3,15,182,204,15,182,
+  232,131,195,4,193,232,16,65,252,255,36,252,238,248,2,129,124,253,194,4,239,
+  15,133,244,50,139,60,194,137,213,232,251,1,18,255,252,242,15,42,192,137,252,
+  234,255,15,182,75,252,253,252,233,244,1,255,15,182,252,236,15,182,192,255,
+  129,124,253,252,234,4,239,15,135,244,46,255,252,242,15,16,4,252,234,252,242,
+  65,15,88,4,199,255,221,4,252,234,65,220,4,199,255,129,124,253,252,234,4,239,
+  15,135,244,47,255,252,242,65,15,16,4,199,252,242,15,88,4,252,234,255,65,221,
+  4,199,220,4,252,234,255,129,124,253,252,234,4,239,15,135,244,49,129,124,253,
+  194,4,239,15,135,244,49,255,252,242,15,16,4,252,234,252,242,15,88,4,194,255,
+  221,4,252,234,220,4,194,255,252,242,15,16,4,252,234,252,242,65,15,92,4,199,
+  255,221,4,252,234,65,220,36,199,255,252,242,65,15,16,4,199,252,242,15,92,
+  4,252,234,255,65,221,4,199,220,36,252,234,255,252,242,15,16,4,252,234,252,
+  242,15,92,4,194,255,221,4,252,234,220,36,194,255,252,242,15,16,4,252,234,
+  252,242,65,15,89,4,199,255,221,4,252,234,65,220,12,199,255,252,242,65,15,
+  16,4,199,252,242,15,89,4,252,234,255,65,221,4,199,220,12,252,234,255,252,
+  242,15,16,4,252,234,252,242,15,89,4,194,255,221,4,252,234,220,12,194,255,
+  252,242,15,16,4,252,234,252,242,65,15,94,4,199,255,221,4,252,234,65,220,52,
+  199,255,252,242,65,15,16,4,199,252,242,15,94,4,252,234,255,65,221,4,199,220,
+  52,252,234,255,252,242,15,16,4,252,234,252,242,15,94,4,194,255,221,4,252,
+  234,220,52,194,255,252,242,15,16,4,252,234,252,242,65,15,16,12,199,255,221,
+  4,252,234,65,221,4,199,255,252,242,65,15,16,4,199,252,242,15,16,12,252,234,
+  255,65,221,4,199,221,4,252,234,255,252,242,15,16,4,252,234,252,242,15,16,
+  12,194,255,221,4,252,234,221,4,194,255,248,157,232,244,149,255,252,233,244,
+  157,255,232,244,107,255,15,182,252,236,15,182,192,139,124,36,24,137,151,233,
+  141,52,194,137,194,41,252,234,248,33,137,252,253,137,92,36,28,232,251,1,25,
+  139,149,233,133,192,15,133,244,42,15,182,107,252,255,15,182,75,252,253,72,
+  139,4,252,234,72,137,4,202,139,3,15,182,204,15,182,232,131,195,4,193,232,
+  16,65,252,255,36,252,238,255,72,252,247,208,65,139,4,135,199,68,202,4,237,
+  137,4,202,139,3,15,182,204,15,182,232,131,195,4,193,232,16,65,252,255,36,
+  252,238,255,15,191,192,252,242,15,42,192,252,242,15,17,4,202,255,223,67,252,
+  254,221,28,202,255,252,242,65,15,16,4,199,252,242,15,17,4,202,255,65,221,
+  4,199,221,28,202,255,72,252,247,208,137,68,202,4,139,3,15,182,204,15,182,
+  232,131,195,4,193,232,16,65,252,255,36,252,238,255,141,76,202,12,141,68,194,
+  4,189,237,137,105,252,248,248,1,137,41,131,193,8,57,193,15,134,244,1,139,
+  3,15,182,204,15,182,232,131,195,4,193,232,16,65,252,255,36,252,238,255,139,
+  106,252,248,139,172,253,133,233,139,173,233,72,139,69,0,72,137,4,202,139,
+  3,15,182,204,15,182,232,131,195,4,193,232,16,65,252,255,36,252,238,255,139,
+  106,252,248,139,172,253,141,233,128,189,233,0,139,173,233,139,12,194,139,
+  68,194,4,137,77,0,137,69,4,15,132,244,247,252,246,133,233,235,15,133,244,
+  248,248,1,139,3,15,182,204,15,182,232,131,195,4,193,232,16,65,252,255,36,
+  252,238,248,2,129,232,239,129,252,248,239,15,134,244,1,252,246,129,233,235,
+  15,132,244,1,137,252,238,137,213,65,141,190,233,255,232,251,1,26,137,252,
+  234,252,233,244,1,255,72,252,247,208,139,106,252,248,139,172,253,141,233,
+  65,139,12,135,139,133,233,137,8,199,64,4,237,252,246,133,233,235,15,133,244,
+  248,248,1,139,3,15,182,204,15,182,232,131,195,4,193,232,16,65,252,255,36,
+  252,238,248,2,252,246,129,233,235,15,132,244,1,128,189,233,0,15,132,244,1,
+  137,213,137,198,65,141,190,233,232,251,1,26,137,252,234,252,233,244,1,255,
+  139,106,252,248,255,252,242,65,15,16,4,199,255,139,172,253,141,233,139,141,
+  233,255,252,242,15,17,1,255,221,25,255,72,252,247,208,139,106,252,248,139,
+  172,253,141,233,139,141,233,137,65,4,139,3,15,182,204,15,182,232,131,195,
+  4,193,232,16,65,252,255,36,252,238,255,141,156,253,131,233,139,108,36,24,
+  131,189,233,0,15,132,244,247,137,149,233,141,52,202,137,252,239,232,251,1,
+  27,139,149,233,248,1,139,3,15,182,204,15,182,232,131,195,4,193,232,16,65,
+  252,255,36,252,238,255,72,252,247,208,139,108,36,24,137,149,233,139,82,252,
+  248,65,139,52,135,137,252,239,137,92,36,28,232,251,1,28,139,149,233,15,182,
   75,252,253,137,4,202,199,68,202,4,237,139,3,15,182,204,15,182,232,131,195,
-  4,193,232,16,65,252,255,36,252,238,248,3,137,252,239,232,251,1,30,15,183,
-  67,252,254,72,252,247,208,252,233,244,2,255,72,252,247,208,139,106,252,248,
-  139,173,233,65,139,4,135,252,233,244,157,255,72,252,247,208,139,106,252,248,
-  139,173,233,65,139,4,135,252,233,244,158,255,15,182,252,236,15,182,192,129,
-  124,253,252,234,4,239,15,133,244,36,139,44,252,234,129,124,253,194,4,239,
-  15,135,244,251,255,252,242,15,16,4,194,252,242,15,45,192,252,242,15,42,200,
-  102,15,46,193,255,15,133,244,36,59,133,233,15,131,244,36,193,224,3,3,133,
-  233,129,120,253,4,239,15,132,244,248,72,139,40,72,137,44,202,248,1,139,3,
-  15,182,204,15,182,232,131,195,4,193,232,16,65,252,255,36,252,238,248,2,131,
-  189,233,0,15,132,244,249,139,141,233,252,246,129,233,235,15,132,244,36,15,
-  182,75,252,253,248,3,255,199,68,202,4,237,252,233,244,1,248,5,129,124,253,
-  194,4,239,15,133,244,36,139,4,194,252,233,244,157,255,15,182,252,236,15,182,
-  192,72,252,247,208,65,139,4,135,129,124,253,252,234,4,239,15,133,244,34,139,
-  44,252,234,248,157,139,141,233,35,136,233,105,201,239,3,141,233,248,1,129,
-  185,233,239,15,133,244,250,57,129,233,15,133,244,250,129,121,253,4,239,15,
-  132,244,251,15,182,67,252,253,72,139,41,72,137,44,194,248,2,255,139,3,15,
-  182,204,15,182,232,131,195,4,193,232,16,65,252,255,36,252,238,248,3,15,182,
-  67,252,253,199,68,194,4,237,252,233,244,2,248,4,139,137,233,133,201,15,133,
-  244,1,248,5,139,141,233,133,201,15,132,244,3,252,246,129,233,235,15,133,244,
-  3,252,233,244,34,255,15,182,252,236,15,182,192,129,124,253,252,234,4,239,
-  15,133,244,35,139,44,252,234,59,133,233,15,131,244,35,193,224,3,3,133,233,
-  129,120,253,4,239,15,132,244,248,72,139,40,72,137,44,202,248,1,139,3,15,182,
-  204,15,182,232,131,195,4,193,232,16,65,252,255,36,252,238,248,2,131,189,233,
-  0,15,132,244,249,139,141,233,252,246,129,233,235,15,132,244,35,255,15,182,
-  75,252,253,248,3,199,68,202,4,237,252,233,244,1,255,15,182,252,236,15,182,
-  192,129,124,253,252,234,4,239,15,133,244,39,139,44,252,234,129,124,253,194,
-  4,239,15,135,244,251,255,15,133,244,39,59,133,233,15,131,244,39,193,224,3,
-  3,133,233,129,120,253,4,239,15,132,244,249,248,1,252,246,133,233,235,15,133,
-  244,253,248,2,72,139,44,202,72,137,40,139,3,15,182,204,15,182,232,131,195,
-  4,193,232,16,65,252,255,36,252,238,248,3,131,189,233,0,15,132,244,1,139,141,
-  233,255,252,246,129,233,235,15,132,244,39,15,182,75,252,253,252,233,244,1,
-  248,5,129,124,253,194,4,239,15,133,244,39,139,4,194,252,233,244,158,248,7,
-  128,165,233,235,65,139,142,233,65,137,174,233,137,141,233,15,182,75,252,253,
-  252,233,244,2,255,15,182,252,236,15,182,192,72,252,247,208,65,139,4,135,129,
-  124,253,252,234,4,239,15,133,244,37,139,44,252,234,248,158,139,141,233,35,
-  136,233,105,201,239,198,133,233,0,3,141,233,248,1,129,185,233,239,15,133,
-  244,251,57,129,233,15,133,244,251,129,121,253,4,239,15,132,244,250,248,2,
-  255,252,246,133,233,235,15,133,244,253,248,3,15,182,67,252,253,72,139,44,
-  194,72,137,41,139,3,15,182,204,15,182,232,131,195,4,193,232,16,65,252,255,
-  36,252,238,248,4,131,189,233,0,15,132,244,2,137,12,36,139,141,233,252,246,
-  129,233,235,15,132,244,37,139,12,36,252,233,244,2,248,5,139,137,233,133,201,
-  15,133,244,1,255,139,141,233,133,201,15,132,244,252,252,246,129,233,235,15,
-  132,244,37,248,6,137,4,36,199,68,36,4,237,137,108,36,8,139,124,36,24,137,
-  151,233,72,141,20,36,137,252,238,137,252,253,137,92,36,28,232,251,1,32,139,
-  149,233,139,108,36,8,137,193,252,233,244,2,248,7,128,165,233,235,65,139,134,
-  233,65,137,174,233,137,133,233,252,233,244,3,255,15,182,252,236,15,182,192,
-  129,124,253,252,234,4,239,15,133,244,38,139,44,252,234,59,133,233,15,131,
-  244,38,193,224,3,3,133,233,129,120,253,4,239,15,132,244,249,248,1,252,246,
-  133,233,235,15,133,244,253,248,2,72,139,12,202,72,137,8,139,3,15,182,204,
-  15,182,232,131,195,4,193,232,16,65,252,255,36,252,238,248,3,131,189,233,0,
-  15,132,244,1,255,139,141,233,252,246,129,233,235,15,132,244,38,15,182,75,
-  252,253,252,233,244,1,248,7,128,165,233,235,65,139,142,233,65,137,174,233,
-  137,141,233,15,182,75,252,253,252,233,244,2,255,68,137,60,36,69,139,60,199,
-  248,1,141,12,202,139,105,252,248,252,246,133,233,235,15,133,244,253,248,2,
-  139,68,36,4,131,232,1,15,132,244,250,68,1,252,248,59,133,233,15,135,244,251,
-  68,41,252,248,65,193,231,3,68,3,189,233,248,3,72,139,41,131,193,8,73,137,
-  47,65,131,199,8,131,232,1,15,133,244,3,248,4,68,139,60,36,139,3,15,182,204,
-  15,182,232,131,195,4,193,232,16,65,252,255,36,252,238,248,5,139,124,36,24,
-  137,151,233,137,252,238,137,194,137,252,253,137,92,36,28,232,251,1,33,139,
-  149,233,15,182,75,252,253,252,233,244,1,248,7,255,128,165,233,235,65,139,
-  134,233,65,137,174,233,137,133,233,252,233,244,2,255,3,68,36,4,255,129,124,
-  253,202,4,239,139,44,202,15,133,244,51,141,84,202,8,137,90,252,252,139,157,
-  233,139,11,15,182,252,233,15,182,205,131,195,4,65,252,255,36,252,238,255,
-  141,76,202,8,65,137,215,139,105,252,248,129,121,253,252,252,239,15,133,244,
-  28,248,52,139,90,252,252,252,247,195,237,15,133,244,253,248,1,137,106,252,
-  248,137,68,36,4,131,232,1,15,132,244,249,248,2,72,139,41,131,193,8,73,137,
-  47,65,131,199,8,131,232,1,15,133,244,2,139,106,252,248,248,3,139,68,36,4,
-  128,189,233,1,15,135,244,251,248,4,139,157,233,139,11,15,182,252,233,15,182,
-  205,131,195,4,65,252,255,36,252,238,248,5,255,252,247,195,237,15,133,244,
-  4,15,182,75,252,253,72,252,247,209,141,12,202,68,139,121,252,248,69,139,191,
-  233,69,139,191,233,252,233,244,4,248,7,129,252,235,239,252,247,195,237,15,
-  133,244,254,41,218,65,137,215,139,90,252,252,252,233,244,1,248,8,129,195,
-  239,252,233,244,1,255,141,76,202,8,72,139,105,232,72,139,65,252,240,72,137,
-  41,72,137,65,8,139,105,224,139,65,228,137,105,252,248,137,65,252,252,129,
-  252,248,239,184,237,15,133,244,28,137,202,137,90,252,252,139,157,233,139,
-  11,15,182,252,233,15,182,205,131,195,4,65,252,255,36,252,238,255,68,137,60,
-  36,68,137,116,36,4,139,108,202,252,240,139,68,202,252,248,68,139,181,233,
-  131,195,4,68,139,189,233,248,1,68,57,252,240,15,131,244,251,65,129,124,253,
-  199,4,239,15,132,244,250,255,252,242,15,42,192,255,219,68,202,252,248,255,
-  73,139,44,199,72,137,108,202,8,131,192,1,255,137,68,202,252,248,248,2,15,
-  183,67,252,254,141,156,253,131,233,248,3,68,139,116,36,4,68,139,60,36,139,
-  3,15,182,204,15,182,232,131,195,4,193,232,16,65,252,255,36,252,238,248,4,
-  131,192,1,255,137,68,202,252,248,255,252,233,244,1,248,5,68,41,252,240,248,
-  6,59,133,233,15,135,244,3,68,105,252,248,239,68,3,189,233,65,129,191,233,
-  239,15,132,244,253,70,141,116,48,1,73,139,175,233,73,139,135,233,72,137,44,
-  202,72,137,68,202,8,68,137,116,202,252,248,252,233,244,2,248,7,131,192,1,
-  252,233,244,6,255,129,124,253,202,252,236,239,15,133,244,251,139,108,202,
-  232,129,124,253,202,252,244,239,15,133,244,251,129,124,253,202,252,252,239,
-  15,133,244,251,128,189,233,235,15,133,244,251,141,156,253,131,233,199,68,
-  202,252,248,0,0,0,0,248,1,139,3,15,182,204,15,182,232,131,195,4,193,232,16,
-  65,252,255,36,252,238,248,5,198,67,252,252,235,141,156,253,131,233,198,3,
-  235,252,233,244,1,255,15,182,252,236,15,182,192,68,137,60,36,68,141,188,253,
-  194,233,141,12,202,68,43,122,252,252,133,252,237,15,132,244,251,141,108,252,
-  233,252,248,65,57,215,15,131,244,248,248,1,73,139,71,252,248,65,131,199,8,
-  72,137,1,131,193,8,57,252,233,15,131,244,249,65,57,215,15,130,244,1,248,2,
-  199,65,4,237,131,193,8,57,252,233,15,130,244,2,248,3,68,139,60,36,139,3,15,
-  182,204,15,182,232,131,195,4,193,232,16,65,252,255,36,252,238,248,5,199,68,
-  36,4,1,0,0,0,137,208,68,41,252,248,15,134,244,3,137,197,193,252,237,3,131,
-  197,1,137,108,36,4,139,108,36,24,1,200,59,133,233,15,135,244,253,248,6,255,
-  73,139,71,252,248,65,131,199,8,72,137,1,131,193,8,65,57,215,15,130,244,6,
-  252,233,244,3,248,7,137,149,233,137,141,233,137,92,36,28,65,41,215,139,116,
-  36,4,131,252,238,1,137,252,239,232,251,1,0,139,149,233,139,141,233,65,1,215,
-  252,233,244,6,255,193,225,3,255,248,1,139,90,252,252,137,68,36,4,252,247,
-  195,237,15,133,244,253,255,248,13,65,137,215,131,232,1,15,132,244,249,248,
-  2,73,139,44,15,73,137,111,252,248,65,131,199,8,131,232,1,15,133,244,2,248,
-  3,139,68,36,4,15,182,107,252,255,248,5,57,197,15,135,244,252,255,72,139,44,
-  10,72,137,106,252,248,255,248,5,56,67,252,255,15,135,244,252,255,15,182,75,
-  252,253,72,252,247,209,141,20,202,68,139,122,252,248,69,139,191,233,69,139,
-  191,233,139,3,15,182,204,15,182,232,131,195,4,193,232,16,65,252,255,36,252,
-  238,248,6,255,65,199,71,252,252,237,65,131,199,8,255,199,68,194,252,244,237,
-  255,131,192,1,252,233,244,5,248,7,141,171,233,252,247,197,237,15,133,244,
-  14,41,252,234,255,1,252,233,255,137,221,209,252,237,129,229,239,102,65,131,
-  172,253,46,233,1,15,132,244,140,255,141,12,202,255,129,121,253,4,239,15,135,
-  244,53,129,121,253,12,239,15,135,244,53,255,139,105,20,255,129,252,253,239,
-  15,135,244,53,255,252,242,15,16,1,252,242,15,16,73,8,255,252,242,15,88,65,
-  16,252,242,15,17,1,133,252,237,15,136,244,249,255,15,140,244,249,255,102,
-  15,46,200,248,1,252,242,15,17,65,24,255,221,65,8,221,1,255,220,65,16,221,
-  17,221,81,24,133,252,237,15,136,244,247,255,221,81,24,15,140,244,247,255,
-  217,201,248,1,255,15,183,67,252,254,255,15,131,244,248,141,156,253,131,233,
-  255,141,156,253,131,233,15,183,67,252,254,15,131,245,255,15,130,244,248,141,
-  156,253,131,233,255,248,3,102,15,46,193,252,233,244,1,255,141,12,202,139,
-  105,4,129,252,253,239,15,132,244,247,255,137,105,252,252,139,41,137,105,252,
-  248,252,233,245,255,141,156,253,131,233,139,1,137,105,252,252,137,65,252,
-  248,255,65,139,142,233,139,4,129,72,139,128,233,139,108,36,24,65,137,150,
-  233,65,137,174,233,76,137,36,36,76,137,108,36,8,72,131,252,236,16,252,255,
-  224,255,141,156,253,131,233,139,3,15,182,204,15,182,232,131,195,4,193,232,
-  16,65,252,255,36,252,238,255,137,221,209,252,237,129,229,239,102,65,131,172,
-  253,46,233,1,15,132,244,142,255,68,139,187,233,139,108,36,24,141,12,202,59,
-  141,233,15,135,244,23,15,182,139,233,57,200,15,134,244,249,248,2,255,15,183,
-  67,252,254,252,233,245,255,248,3,199,68,194,252,252,237,131,192,1,57,200,
-  15,134,244,3,252,233,244,2,255,141,44,197,237,141,4,194,68,139,122,252,248,
-  137,104,252,252,68,137,120,252,248,139,108,36,24,141,12,200,59,141,233,15,
-  135,244,22,137,209,137,194,15,182,171,233,133,252,237,15,132,244,248,248,
+  4,193,232,16,65,252,255,36,252,238,255,139,108,36,24,137,149,233,65,139,142,
+  233,65,59,142,233,137,92,36,28,15,131,244,251,248,1,137,194,37,252,255,7,
+  0,0,193,252,234,11,61,252,255,7,0,0,15,132,244,249,248,2,137,252,239,137,
+  198,232,251,1,29,139,149,233,15,182,75,252,253,137,4,202,199,68,202,4,237,
+  139,3,15,182,204,15,182,232,131,195,4,193,232,16,65,252,255,36,252,238,248,
+  3,184,1,8,0,0,252,233,244,2,248,5,137,252,239,232,251,1,30,15,183,67,252,
+  254,252,233,244,1,255,72,252,247,208,139,108,36,24,65,139,142,233,137,92,
+  36,28,65,59,142,233,137,149,233,15,131,244,249,248,2,65,139,52,135,137,252,
+  239,232,251,1,31,139,149,233,15,182,75,252,253,137,4,202,199,68,202,4,237,
+  139,3,15,182,204,15,182,232,131,195,4,193,232,16,65,252,255,36,252,238,248,
+  3,137,252,239,232,251,1,30,15,183,67,252,254,72,252,247,208,252,233,244,2,
+  255,72,252,247,208,139,106,252,248,139,173,233,65,139,4,135,252,233,244,158,
+  255,72,252,247,208,139,106,252,248,139,173,233,65,139,4,135,252,233,244,159,
+  255,15,182,252,236,15,182,192,129,124,253,252,234,4,239,15,133,244,36,139,
+  44,252,234,129,124,253,194,4,239,15,135,244,251,255,252,242,15,16,4,194,252,
+  242,15,45,192,252,242,15,42,200,102,15,46,193,255,15,133,244,36,59,133,233,
+  15,131,244,36,193,224,3,3,133,233,129,120,253,4,239,15,132,244,248,72,139,
+  40,72,137,44,202,248,1,139,3,15,182,204,15,182,232,131,195,4,193,232,16,65,
+  252,255,36,252,238,248,2,131,189,233,0,15,132,244,249,139,141,233,252,246,
+  129,233,235,15,132,244,36,15,182,75,252,253,248,3,255,199,68,202,4,237,252,
+  233,244,1,248,5,129,124,253,194,4,239,15,133,244,36,139,4,194,252,233,244,
+  158,255,15,182,252,236,15,182,192,72,252,247,208,65,139,4,135,129,124,253,
+  252,234,4,239,15,133,244,34,139,44,252,234,248,158,139,141,233,35,136,233,
+  105,201,239,3,141,233,248,1,129,185,233,239,15,133,244,250,57,129,233,15,
+  133,244,250,129,121,253,4,239,15,132,244,251,15,182,67,252,253,72,139,41,
+  72,137,44,194,248,2,255,139,3,15,182,204,15,182,232,131,195,4,193,232,16,
+  65,252,255,36,252,238,248,3,15,182,67,252,253,199,68,194,4,237,252,233,244,
+  2,248,4,139,137,233,133,201,15,133,244,1,248,5,139,141,233,133,201,15,132,
+  244,3,252,246,129,233,235,15,133,244,3,252,233,244,34,255,15,182,252,236,
+  15,182,192,129,124,253,252,234,4,239,15,133,244,35,139,44,252,234,59,133,
+  233,15,131,244,35,193,224,3,3,133,233,129,120,253,4,239,15,132,244,248,72,
+  139,40,72,137,44,202,248,1,139,3,15,182,204,15,182,232,131,195,4,193,232,
+  16,65,252,255,36,252,238,248,2,131,189,233,0,15,132,244,249,139,141,233,252,
+  246,129,233,235,15,132,244,35,255,15,182,75,252,253,248,3,199,68,202,4,237,
+  252,233,244,1,255,15,182,252,236,15,182,192,129,124,253,252,234,4,239,15,
+  133,244,39,139,44,252,234,129,124,253,194,4,239,15,135,244,251,255,15,133,
+  244,39,59,133,233,15,131,244,39,193,224,3,3,133,233,129,120,253,4,239,15,
+  132,244,249,248,1,252,246,133,233,235,15,133,244,253,248,2,72,139,44,202,
+  72,137,40,139,3,15,182,204,15,182,232,131,195,4,193,232,16,65,252,255,36,
+  252,238,248,3,131,189,233,0,15,132,244,1,139,141,233,255,252,246,129,233,
+  235,15,132,244,39,15,182,75,252,253,252,233,244,1,248,5,129,124,253,194,4,
+  239,15,133,244,39,139,4,194,252,233,244,159,248,7,128,165,233,235,65,139,
+  142,233,65,137,174,233,137,141,233,15,182,75,252,253,252,233,244,2,255,15,
+  182,252,236,15,182,192,72,252,247,208,65,139,4,135,129,124,253,252,234,4,
+  239,15,133,244,37,139,44,252,234,248,159,139,141,233,35,136,233,105,201,239,
+  198,133,233,0,3,141,233,248,1,129,185,233,239,15,133,244,251,57,129,233,15,
+  133,244,251,129,121,253,4,239,15,132,244,250,248,2,255,252,246,133,233,235,
+  15,133,244,253,248,3,15,182,67,252,253,72,139,44,194,72,137,41,139,3,15,182,
+  204,15,182,232,131,195,4,193,232,16,65,252,255,36,252,238,248,4,131,189,233,
+  0,15,132,244,2,137,12,36,139,141,233,252,246,129,233,235,15,132,244,37,139,
+  12,36,252,233,244,2,248,5,139,137,233,133,201,15,133,244,1,255,139,141,233,
+  133,201,15,132,244,252,252,246,129,233,235,15,132,244,37,248,6,137,4,36,199,
+  68,36,4,237,137,108,36,8,139,124,36,24,137,151,233,72,141,20,36,137,252,238,
+  137,252,253,137,92,36,28,232,251,1,32,139,149,233,139,108,36,8,137,193,252,
+  233,244,2,248,7,128,165,233,235,65,139,134,233,65,137,174,233,137,133,233,
+  252,233,244,3,255,15,182,252,236,15,182,192,129,124,253,252,234,4,239,15,
+  133,244,38,139,44,252,234,59,133,233,15,131,244,38,193,224,3,3,133,233,129,
+  120,253,4,239,15,132,244,249,248,1,252,246,133,233,235,15,133,244,253,248,
+  2,72,139,12,202,72,137,8,139,3,15,182,204,15,182,232,131,195,4,193,232,16,
+  65,252,255,36,252,238,248,3,131,189,233,0,15,132,244,1,255,139,141,233,252,
+  246,129,233,235,15,132,244,38,15,182,75,252,253,252,233,244,1,248,7,128,165,
+  233,235,65,139,142,233,65,137,174,233,137,141,233,15,182,75,252,253,252,233,
+  244,2,255,68,137,60,36,69,139,60,199,248,1,141,12,202,139,105,252,248,252,
+  246,133,233,235,15,133,244,253,248,2,139,68,36,4,131,232,1,15,132,244,250,
+  68,1,252,248,59,133,233,15,135,244,251,68,41,252,248,65,193,231,3,68,3,189,
+  233,248,3,72,139,41,131,193,8,73,137,47,65,131,199,8,131,232,1,15,133,244,
+  3,248,4,68,139,60,36,139,3,15,182,204,15,182,232,131,195,4,193,232,16,65,
+  252,255,36,252,238,248,5,139,124,36,24,137,151,233,137,252,238,137,194,137,
+  252,253,137,92,36,28,232,251,1,33,139,149,233,15,182,75,252,253,252,233,244,
+  1,248,7,255,128,165,233,235,65,139,134,233,65,137,174,233,137,133,233,252,
+  233,244,2,255,3,68,36,4,255,129,124,253,202,4,239,139,44,202,15,133,244,51,
+  141,84,202,8,137,90,252,252,139,157,233,139,11,15,182,252,233,15,182,205,
+  131,195,4,65,252,255,36,252,238,255,141,76,202,8,65,137,215,139,105,252,248,
+  129,121,253,252,252,239,15,133,244,28,248,52,139,90,252,252,252,247,195,237,
+  15,133,244,253,248,1,137,106,252,248,137,68,36,4,131,232,1,15,132,244,249,
+  248,2,72,139,41,131,193,8,73,137,47,65,131,199,8,131,232,1,15,133,244,2,139,
+  106,252,248,248,3,139,68,36,4,128,189,233,1,15,135,244,251,248,4,139,157,
+  233,139,11,15,182,252,233,15,182,205,131,195,4,65,252,255,36,252,238,248,
+  5,255,252,247,195,237,15,133,244,4,15,182,75,252,253,72,252,247,209,141,12,
+  202,68,139,121,252,248,69,139,191,233,69,139,191,233,252,233,244,4,248,7,
+  129,252,235,239,252,247,195,237,15,133,244,254,41,218,65,137,215,139,90,252,
+  252,252,233,244,1,248,8,129,195,239,252,233,244,1,255,141,76,202,8,72,139,
+  105,232,72,139,65,252,240,72,137,41,72,137,65,8,139,105,224,139,65,228,137,
+  105,252,248,137,65,252,252,129,252,248,239,184,237,15,133,244,28,137,202,
+  137,90,252,252,139,157,233,139,11,15,182,252,233,15,182,205,131,195,4,65,
+  252,255,36,252,238,255,68,137,60,36,68,137,116,36,4,139,108,202,252,240,139,
+  68,202,252,248,68,139,181,233,131,195,4,68,139,189,233,248,1,68,57,252,240,
+  15,131,244,251,65,129,124,253,199,4,239,15,132,244,250,255,252,242,15,42,
+  192,255,219,68,202,252,248,255,73,139,44,199,72,137,108,202,8,131,192,1,255,
+  137,68,202,252,248,248,2,68,139,116,36,4,68,139,60,36,255,128,123,252,252,
+  235,15,133,244,254,65,252,246,134,233,235,15,132,244,255,137,221,209,252,
+  237,129,229,239,102,65,131,172,253,46,233,1,15,132,244,141,248,9,255,15,183,
+  67,252,254,141,156,253,131,233,139,3,15,182,204,15,182,232,131,195,4,193,
+  232,16,65,252,255,36,252,238,248,3,68,139,116,36,4,68,139,60,36,139,3,15,
+  182,204,15,182,232,131,195,4,193,232,16,65,252,255,36,252,238,248,4,131,192,
+  1,255,137,68,202,252,248,255,252,233,244,1,248,5,68,41,252,240,248,6,59,133,
+  233,15,135,244,3,68,105,252,248,239,68,3,189,233,65,129,191,233,239,15,132,
+  244,253,70,141,116,48,1,73,139,175,233,73,139,135,233,72,137,44,202,72,137,
+  68,202,8,68,137,116,202,252,248,252,233,244,2,248,7,131,192,1,252,233,244,
+  6,255,248,8,128,123,252,252,235,15,133,244,9,15,183,67,252,254,252,233,245,
+  255,129,124,253,202,252,236,239,15,133,244,251,139,108,202,232,129,124,253,
+  202,252,244,239,15,133,244,251,129,124,253,202,252,252,239,15,133,244,251,
+  128,189,233,235,15,133,244,251,141,156,253,131,233,199,68,202,252,248,0,0,
+  0,0,248,1,139,3,15,182,204,15,182,232,131,195,4,193,232,16,65,252,255,36,
+  252,238,248,5,198,67,252,252,235,141,156,253,131,233,198,3,235,252,233,244,
+  1,255,15,182,252,236,15,182,192,68,137,60,36,68,141,188,253,194,233,141,12,
+  202,68,43,122,252,252,133,252,237,15,132,244,251,141,108,252,233,252,248,
+  65,57,215,15,131,244,248,248,1,73,139,71,252,248,65,131,199,8,72,137,1,131,
+  193,8,57,252,233,15,131,244,249,65,57,215,15,130,244,1,248,2,199,65,4,237,
+  131,193,8,57,252,233,15,130,244,2,248,3,68,139,60,36,139,3,15,182,204,15,
+  182,232,131,195,4,193,232,16,65,252,255,36,252,238,248,5,199,68,36,4,1,0,
+  0,0,137,208,68,41,252,248,15,134,244,3,137,197,193,252,237,3,131,197,1,137,
+  108,36,4,139,108,36,24,1,200,59,133,233,15,135,244,253,248,6,255,73,139,71,
+  252,248,65,131,199,8,72,137,1,131,193,8,65,57,215,15,130,244,6,252,233,244,
+  3,248,7,137,149,233,137,141,233,137,92,36,28,65,41,215,139,116,36,4,131,252,
+  238,1,137,252,239,232,251,1,0,139,149,233,139,141,233,65,1,215,252,233,244,
+  6,255,193,225,3,255,248,1,139,90,252,252,137,68,36,4,252,247,195,237,15,133,
+  244,253,255,248,13,65,137,215,131,232,1,15,132,244,249,248,2,73,139,44,15,
+  73,137,111,252,248,65,131,199,8,131,232,1,15,133,244,2,248,3,139,68,36,4,
+  15,182,107,252,255,248,5,57,197,15,135,244,252,255,72,139,44,10,72,137,106,
+  252,248,255,248,5,56,67,252,255,15,135,244,252,255,15,182,75,252,253,72,252,
+  247,209,141,20,202,68,139,122,252,248,69,139,191,233,69,139,191,233,139,3,
+  15,182,204,15,182,232,131,195,4,193,232,16,65,252,255,36,252,238,248,6,255,
+  65,199,71,252,252,237,65,131,199,8,255,199,68,194,252,244,237,255,131,192,
+  1,252,233,244,5,248,7,141,171,233,252,247,197,237,15,133,244,14,41,252,234,
+  255,1,252,233,255,137,221,209,252,237,129,229,239,102,65,131,172,253,46,233,
+  1,15,132,244,140,255,141,12,202,255,129,121,253,4,239,15,135,244,53,129,121,
+  253,12,239,15,135,244,53,255,139,105,20,255,129,252,253,239,15,135,244,53,
+  255,252,242,15,16,1,252,242,15,16,73,8,255,252,242,15,88,65,16,252,242,15,
+  17,1,133,252,237,15,136,244,249,255,15,140,244,249,255,102,15,46,200,248,
+  1,252,242,15,17,65,24,255,221,65,8,221,1,255,220,65,16,221,17,221,81,24,133,
+  252,237,15,136,244,247,255,221,81,24,15,140,244,247,255,217,201,248,1,255,
+  15,183,67,252,254,255,15,131,244,248,141,156,253,131,233,255,141,156,253,
+  131,233,15,183,67,252,254,15,131,245,255,15,130,244,248,141,156,253,131,233,
+  255,248,3,102,15,46,193,252,233,244,1,255,141,12,202,139,105,4,129,252,253,
+  239,15,132,244,247,255,137,105,252,252,139,41,137,105,252,248,252,233,245,
+  255,141,156,253,131,233,139,1,137,105,252,252,137,65,252,248,255,65,139,142,
+  233,139,4,129,72,139,128,233,139,108,36,24,65,137,150,233,65,137,174,233,
+  76,137,36,36,76,137,108,36,8,72,131,252,236,16,252,255,224,255,137,221,209,
+  252,237,129,229,239,102,65,131,172,253,46,233,1,15,132,244,143,255,68,139,
+  187,233,139,108,36,24,141,12,202,59,141,233,15,135,244,23,15,182,139,233,
+  57,200,15,134,244,249,248,2,255,248,3,199,68,194,252,252,237,131,192,1,57,
+  200,15,134,244,3,252,233,244,2,255,141,44,197,237,141,4,194,68,139,122,252,
+  248,137,104,252,252,68,137,120,252,248,139,108,36,24,141,12,200,59,141,233,
+  15,135,244,22,137,209,137,194,15,182,171,233,133,252,237,15,132,244,248,248,
   1,131,193,8,57,209,15,131,244,249,68,139,121,252,248,68,137,56,68,139,121,
   252,252,68,137,120,4,131,192,8,199,65,252,252,237,131,252,237,1,15,133,244,
   1,248,2,255,68,139,187,233,139,3,15,182,204,15,182,232,131,195,4,193,232,
@@ -838,6 +845,7 @@ enum {
   GLOB_vm_inshook,
   GLOB_cont_hook,
   GLOB_vm_hotloop,
+  GLOB_vm_hotitern,
   GLOB_vm_callhook,
   GLOB_vm_hotcall,
   GLOB_vm_exit_handler,
@@ -990,6 +998,7 @@ static const char *const globnames[] = {
   "vm_inshook",
   "cont_hook",
   "vm_hotloop",
+  "vm_hotitern",
   "vm_callhook",
   "vm_hotcall",
   "vm_exit_handler",
@@ -1366,84 +1375,88 @@ static void build_subroutines(BuildCtx *ctx, int cmov, int sse)
 #if LJ_HASJIT
   dasm_put(Dst, 6990, DISPATCH_GL(hookmask), HOOK_VMEVENT, HOOK_ACTIVE, LUA_MASKLINE|LUA_MASKCOUNT, DISPATCH_GL(hookcount));
 #endif
-  dasm_put(Dst, 7023, DISPATCH_GL(hookmask), HOOK_ACTIVE, DISPATCH_GL(hookmask), HOOK_ACTIVE, LUA_MASKLINE|LUA_MASKCOUNT, DISPATCH_GL(hookcount), LUA_MASKLINE);
-  dasm_put(Dst, 7077, Dt1(->base), Dt1(->base), GG_DISP2STATIC);
+  dasm_put(Dst, 7023, DISPATCH_GL(hookmask), HOOK_ACTIVE, DISPATCH_GL(hookmask), HOOK_ACTIVE, HOOK_PROFILE, LUA_MASKLINE|LUA_MASKCOUNT, DISPATCH_GL(hookcount));
+  dasm_put(Dst, 7075, LUA_MASKLINE, Dt1(->base), Dt1(->base), GG_DISP2STATIC);
+#if LJ_HASJIT
+  dasm_put(Dst, 7150, Dt7(->pc), PC2PROTO(framesize), Dt1(->base), Dt1(->top), GG_DISP2J, DISPATCH_J(L));
+#endif
+  dasm_put(Dst, 7197);
 #if LJ_HASJIT
-  dasm_put(Dst, 7144, Dt7(->pc), PC2PROTO(framesize), Dt1(->base), Dt1(->top), GG_DISP2J, DISPATCH_J(L));
+  dasm_put(Dst, 7200, Dt7(->pc), PC2PROTO(framesize), Dt1(->base), Dt1(->top), GG_DISP2J, DISPATCH_J(L), Dt1(->base), -BCBIAS_J*4);
 #endif
-  dasm_put(Dst, 7191);
+  dasm_put(Dst, 7276);
 #if LJ_HASJIT
   dasm_put(Dst, 7018);
 #endif
-  dasm_put(Dst, 7198);
+  dasm_put(Dst, 7283);
 #if LJ_HASJIT
-  dasm_put(Dst, 7201);
+  dasm_put(Dst, 7286);
 #endif
-  dasm_put(Dst, 7211, Dt1(->base), Dt1(->top));
+  dasm_put(Dst, 7296, Dt1(->base), Dt1(->top));
 #if LJ_HASJIT
-  dasm_put(Dst, 7244);
+  dasm_put(Dst, 7329);
 #endif
-  dasm_put(Dst, 7249, Dt1(->base), Dt1(->top));
+  dasm_put(Dst, 7334, Dt1(->base), Dt1(->top));
 #if LJ_HASJIT
-  dasm_put(Dst, 7280, DISPATCH_GL(vmstate), DISPATCH_GL(vmstate), ~LJ_VMST_EXIT, DISPATCH_J(exitno), DISPATCH_J(parent), 16*8, DISPATCH_GL(jit_L), DISPATCH_GL(jit_base), DISPATCH_J(L), DISPATCH_GL(jit_L), Dt1(->base), GG_DISP2J, Dt1(->cframe), CFRAME_RAWMASK, CFRAME_OFS_L, Dt1(->base), CFRAME_OFS_PC);
+  dasm_put(Dst, 7365, DISPATCH_GL(vmstate), DISPATCH_GL(vmstate), ~LJ_VMST_EXIT, DISPATCH_J(exitno), DISPATCH_J(parent), 16*8, DISPATCH_GL(jit_L), DISPATCH_GL(jit_base), DISPATCH_J(L), DISPATCH_GL(jit_L), Dt1(->base), GG_DISP2J, Dt1(->cframe), CFRAME_RAWMASK, CFRAME_OFS_L, Dt1(->base), CFRAME_OFS_PC);
 #endif
-  dasm_put(Dst, 7519);
+  dasm_put(Dst, 7604);
 #if LJ_HASJIT
-  dasm_put(Dst, 7522, Dt7(->pc), PC2PROTO(k), DISPATCH_GL(jit_L), DISPATCH_GL(vmstate), ~LJ_VMST_INTERP, BC_FUNCF);
+  dasm_put(Dst, 7607, Dt7(->pc), PC2PROTO(k), DISPATCH_GL(jit_L), DISPATCH_GL(vmstate), ~LJ_VMST_INTERP, BC_FUNCF);
 #endif
-  dasm_put(Dst, 7622);
+  dasm_put(Dst, 7707);
   if (!sse) {
-  dasm_put(Dst, 7625);
+  dasm_put(Dst, 7710);
   }
-  dasm_put(Dst, 7670, (unsigned int)(U64x(7fffffff,ffffffff)), (unsigned int)((U64x(7fffffff,ffffffff))>>32), (unsigned int)(U64x(43300000,00000000)), (unsigned int)((U64x(43300000,00000000))>>32), (unsigned int)(U64x(3ff00000,00000000)), (unsigned int)((U64x(3ff00000,00000000))>>32));
+  dasm_put(Dst, 7755, (unsigned int)(U64x(7fffffff,ffffffff)), (unsigned int)((U64x(7fffffff,ffffffff))>>32), (unsigned int)(U64x(43300000,00000000)), (unsigned int)((U64x(43300000,00000000))>>32), (unsigned int)(U64x(3ff00000,00000000)), (unsigned int)((U64x(3ff00000,00000000))>>32));
   if (!sse) {
-  dasm_put(Dst, 7756);
+  dasm_put(Dst, 7841);
   }
-  dasm_put(Dst, 7801, (unsigned int)(U64x(7fffffff,ffffffff)), (unsigned int)((U64x(7fffffff,ffffffff))>>32), (unsigned int)(U64x(43300000,00000000)), (unsigned int)((U64x(43300000,00000000))>>32), (unsigned int)(U64x(bff00000,00000000)), (unsigned int)((U64x(bff00000,00000000))>>32));
+  dasm_put(Dst, 7886, (unsigned int)(U64x(7fffffff,ffffffff)), (unsigned int)((U64x(7fffffff,ffffffff))>>32), (unsigned int)(U64x(43300000,00000000)), (unsigned int)((U64x(43300000,00000000))>>32), (unsigned int)(U64x(bff00000,00000000)), (unsigned int)((U64x(bff00000,00000000))>>32));
   if (!sse) {
-  dasm_put(Dst, 7887);
+  dasm_put(Dst, 7972);
   }
-  dasm_put(Dst, 7926, (unsigned int)(U64x(7fffffff,ffffffff)), (unsigned int)((U64x(7fffffff,ffffffff))>>32), (unsigned int)(U64x(43300000,00000000)), (unsigned int)((U64x(43300000,00000000))>>32), (unsigned int)(U64x(3ff00000,00000000)), (unsigned int)((U64x(3ff00000,00000000))>>32));
+  dasm_put(Dst, 8011, (unsigned int)(U64x(7fffffff,ffffffff)), (unsigned int)((U64x(7fffffff,ffffffff))>>32), (unsigned int)(U64x(43300000,00000000)), (unsigned int)((U64x(43300000,00000000))>>32), (unsigned int)(U64x(3ff00000,00000000)), (unsigned int)((U64x(3ff00000,00000000))>>32));
   if (sse) {
-    dasm_put(Dst, 8015, (unsigned int)(U64x(7fffffff,ffffffff)), (unsigned int)((U64x(7fffffff,ffffffff))>>32), (unsigned int)(U64x(43300000,00000000)), (unsigned int)((U64x(43300000,00000000))>>32), (unsigned int)(U64x(3ff00000,00000000)), (unsigned int)((U64x(3ff00000,00000000))>>32));
+    dasm_put(Dst, 8100, (unsigned int)(U64x(7fffffff,ffffffff)), (unsigned int)((U64x(7fffffff,ffffffff))>>32), (unsigned int)(U64x(43300000,00000000)), (unsigned int)((U64x(43300000,00000000))>>32), (unsigned int)(U64x(3ff00000,00000000)), (unsigned int)((U64x(3ff00000,00000000))>>32));
   } else {
-    dasm_put(Dst, 8129);
+    dasm_put(Dst, 8214);
   }
-  dasm_put(Dst, 8176);
+  dasm_put(Dst, 8261);
   if (!sse) {
   } else {
-    dasm_put(Dst, 8253);
+    dasm_put(Dst, 8338);
   }
-  dasm_put(Dst, 8256);
-  dasm_put(Dst, 8341, (unsigned int)(U64x(3ff00000,00000000)), (unsigned int)((U64x(3ff00000,00000000))>>32), (unsigned int)(U64x(3ff00000,00000000)), (unsigned int)((U64x(3ff00000,00000000))>>32));
-  dasm_put(Dst, 8442, (unsigned int)(U64x(3ff00000,00000000)), (unsigned int)((U64x(3ff00000,00000000))>>32), (unsigned int)(U64x(7fffffff,ffffffff)), (unsigned int)((U64x(7fffffff,ffffffff))>>32), (unsigned int)(U64x(3ff00000,00000000)), (unsigned int)((U64x(3ff00000,00000000))>>32), (unsigned int)(U64x(7ff00000,00000000)), (unsigned int)((U64x(7ff00000,00000000))>>32));
-  dasm_put(Dst, 8616);
+  dasm_put(Dst, 8341);
+  dasm_put(Dst, 8426, (unsigned int)(U64x(3ff00000,00000000)), (unsigned int)((U64x(3ff00000,00000000))>>32), (unsigned int)(U64x(3ff00000,00000000)), (unsigned int)((U64x(3ff00000,00000000))>>32));
+  dasm_put(Dst, 8527, (unsigned int)(U64x(3ff00000,00000000)), (unsigned int)((U64x(3ff00000,00000000))>>32), (unsigned int)(U64x(7fffffff,ffffffff)), (unsigned int)((U64x(7fffffff,ffffffff))>>32), (unsigned int)(U64x(3ff00000,00000000)), (unsigned int)((U64x(3ff00000,00000000))>>32), (unsigned int)(U64x(7ff00000,00000000)), (unsigned int)((U64x(7ff00000,00000000))>>32));
+  dasm_put(Dst, 8701);
 #if LJ_HASJIT
   if (sse) {
-    dasm_put(Dst, 8657);
-    dasm_put(Dst, 8727);
-    dasm_put(Dst, 8799);
+    dasm_put(Dst, 8742);
+    dasm_put(Dst, 8812);
+    dasm_put(Dst, 8884);
   } else {
-    dasm_put(Dst, 8851);
-    dasm_put(Dst, 8943);
+    dasm_put(Dst, 8936);
+    dasm_put(Dst, 9028);
   }
-  dasm_put(Dst, 8989);
+  dasm_put(Dst, 9074);
 #endif
-  dasm_put(Dst, 8993);
+  dasm_put(Dst, 9078);
   if (sse) {
-    dasm_put(Dst, 8996, (unsigned int)(U64x(80000000,00000000)), (unsigned int)((U64x(80000000,00000000))>>32));
-    dasm_put(Dst, 9081, (unsigned int)(U64x(7fffffff,ffffffff)), (unsigned int)((U64x(7fffffff,ffffffff))>>32));
+    dasm_put(Dst, 9081, (unsigned int)(U64x(80000000,00000000)), (unsigned int)((U64x(80000000,00000000))>>32));
+    dasm_put(Dst, 9166, (unsigned int)(U64x(7fffffff,ffffffff)), (unsigned int)((U64x(7fffffff,ffffffff))>>32));
   } else {
-    dasm_put(Dst, 9209);
-    dasm_put(Dst, 9292);
+    dasm_put(Dst, 9294);
+    dasm_put(Dst, 9377);
     if (cmov) {
-    dasm_put(Dst, 9347);
+    dasm_put(Dst, 9432);
     } else {
-    dasm_put(Dst, 9366);
+    dasm_put(Dst, 9451);
     }
-    dasm_put(Dst, 8989);
+    dasm_put(Dst, 9074);
   }
-  dasm_put(Dst, 9407);
+  dasm_put(Dst, 9492);
 }
 
 /* Generate the code for a single instruction. */
@@ -1459,616 +1472,621 @@ static void build_ins(BuildCtx *ctx, BCOp op, int defop, int cmov, int sse)
   /* Remember: all ops branch for a true comparison, fall through otherwise. */
 
   case BC_ISLT: case BC_ISGE: case BC_ISLE: case BC_ISGT:
-    dasm_put(Dst, 9429, LJ_TISNUM, LJ_TISNUM);
+    dasm_put(Dst, 9514, LJ_TISNUM, LJ_TISNUM);
     if (sse) {
-      dasm_put(Dst, 9450);
+      dasm_put(Dst, 9535);
     } else {
-      dasm_put(Dst, 9465);
+      dasm_put(Dst, 9550);
       if (cmov) {
-      dasm_put(Dst, 9475);
+      dasm_put(Dst, 9560);
       } else {
-      dasm_put(Dst, 9481);
+      dasm_put(Dst, 9566);
       }
     }
     switch (op) {
     case BC_ISLT:
-      dasm_put(Dst, 9488);
+      dasm_put(Dst, 9573);
       break;
     case BC_ISGE:
-      dasm_put(Dst, 9287);
+      dasm_put(Dst, 9372);
       break;
     case BC_ISLE:
       dasm_put(Dst, 5894);
       break;
     case BC_ISGT:
-      dasm_put(Dst, 9493);
+      dasm_put(Dst, 9578);
       break;
     default: break;  /* Shut up GCC. */
     }
-    dasm_put(Dst, 9498, -BCBIAS_J*4);
+    dasm_put(Dst, 9583, -BCBIAS_J*4);
     break;
 
   case BC_ISEQV: case BC_ISNEV:
     vk = op == BC_ISEQV;
-    dasm_put(Dst, 9533, LJ_TISNUM, LJ_TISNUM);
+    dasm_put(Dst, 9618, LJ_TISNUM, LJ_TISNUM);
     if (sse) {
-      dasm_put(Dst, 9559);
+      dasm_put(Dst, 9644);
     } else {
-      dasm_put(Dst, 9571);
+      dasm_put(Dst, 9656);
       if (cmov) {
-      dasm_put(Dst, 9475);
+      dasm_put(Dst, 9560);
       } else {
-      dasm_put(Dst, 9481);
+      dasm_put(Dst, 9566);
       }
     }
   iseqne_fp:
     if (vk) {
-      dasm_put(Dst, 9578);
+      dasm_put(Dst, 9663);
     } else {
-      dasm_put(Dst, 9587);
+      dasm_put(Dst, 9672);
     }
   iseqne_end:
     if (vk) {
-      dasm_put(Dst, 9596, -BCBIAS_J*4);
+      dasm_put(Dst, 9681, -BCBIAS_J*4);
     } else {
-      dasm_put(Dst, 9611, -BCBIAS_J*4);
+      dasm_put(Dst, 9696, -BCBIAS_J*4);
     }
-    dasm_put(Dst, 9512);
+    dasm_put(Dst, 7255);
     if (op == BC_ISEQV || op == BC_ISNEV) {
-      dasm_put(Dst, 9626, LJ_TISPRI, LJ_TISTABUD, Dt6(->metatable), Dt6(->nomm), 1<<MM_eq);
+      dasm_put(Dst, 9711, LJ_TISPRI, LJ_TISTABUD, Dt6(->metatable), Dt6(->nomm), 1<<MM_eq);
       if (vk) {
-	dasm_put(Dst, 9684);
+	dasm_put(Dst, 9769);
       } else {
-	dasm_put(Dst, 9688);
+	dasm_put(Dst, 9773);
       }
-      dasm_put(Dst, 9694);
+      dasm_put(Dst, 9779);
     }
     break;
   case BC_ISEQS: case BC_ISNES:
     vk = op == BC_ISEQS;
-    dasm_put(Dst, 9699, LJ_TSTR);
+    dasm_put(Dst, 9784, LJ_TSTR);
   iseqne_test:
     if (vk) {
-      dasm_put(Dst, 9582);
+      dasm_put(Dst, 9667);
     } else {
       dasm_put(Dst, 2803);
     }
     goto iseqne_end;
   case BC_ISEQN: case BC_ISNEN:
     vk = op == BC_ISEQN;
-    dasm_put(Dst, 9724, LJ_TISNUM);
+    dasm_put(Dst, 9809, LJ_TISNUM);
     if (sse) {
-      dasm_put(Dst, 9738);
+      dasm_put(Dst, 9823);
     } else {
-      dasm_put(Dst, 9751);
+      dasm_put(Dst, 9836);
       if (cmov) {
-      dasm_put(Dst, 9475);
+      dasm_put(Dst, 9560);
       } else {
-      dasm_put(Dst, 9481);
+      dasm_put(Dst, 9566);
       }
     }
     goto iseqne_fp;
   case BC_ISEQP: case BC_ISNEP:
     vk = op == BC_ISEQP;
-    dasm_put(Dst, 9759);
+    dasm_put(Dst, 9844);
     goto iseqne_test;
 
   /* -- Unary test and copy ops ------------------------------------------- */
 
   case BC_ISTC: case BC_ISFC: case BC_IST: case BC_ISF:
-    dasm_put(Dst, 9771, LJ_TISTRUECOND);
+    dasm_put(Dst, 9856, LJ_TISTRUECOND);
     if (op == BC_IST || op == BC_ISTC) {
-      dasm_put(Dst, 9783);
+      dasm_put(Dst, 9868);
     } else {
-      dasm_put(Dst, 9788);
+      dasm_put(Dst, 9873);
     }
     if (op == BC_ISTC || op == BC_ISFC) {
-      dasm_put(Dst, 9793);
+      dasm_put(Dst, 9878);
     }
-    dasm_put(Dst, 9804, -BCBIAS_J*4);
+    dasm_put(Dst, 9889, -BCBIAS_J*4);
     break;
 
   /* -- Unary ops --------------------------------------------------------- */
 
   case BC_MOV:
-    dasm_put(Dst, 9837);
+    dasm_put(Dst, 9922);
     break;
   case BC_NOT:
-    dasm_put(Dst, 9866, LJ_TISTRUECOND, LJ_TTRUE);
+    dasm_put(Dst, 9951, LJ_TISTRUECOND, LJ_TTRUE);
     break;
   case BC_UNM:
-    dasm_put(Dst, 9903, LJ_TISNUM);
+    dasm_put(Dst, 9988, LJ_TISNUM);
     if (sse) {
-      dasm_put(Dst, 9914, (unsigned int)(U64x(80000000,00000000)), (unsigned int)((U64x(80000000,00000000))>>32));
+      dasm_put(Dst, 9999, (unsigned int)(U64x(80000000,00000000)), (unsigned int)((U64x(80000000,00000000))>>32));
     } else {
-      dasm_put(Dst, 9939);
+      dasm_put(Dst, 10024);
     }
-    dasm_put(Dst, 9512);
+    dasm_put(Dst, 7255);
     break;
   case BC_LEN:
-    dasm_put(Dst, 9948, LJ_TSTR);
+    dasm_put(Dst, 10033, LJ_TSTR);
     if (sse) {
-      dasm_put(Dst, 9962, Dt5(->len));
+      dasm_put(Dst, 10047, Dt5(->len));
     } else {
-      dasm_put(Dst, 9980, Dt5(->len));
+      dasm_put(Dst, 10065, Dt5(->len));
     }
-    dasm_put(Dst, 9989, LJ_TTAB);
+    dasm_put(Dst, 10074, LJ_TTAB);
     if (sse) {
-      dasm_put(Dst, 10031);
+      dasm_put(Dst, 10116);
     } else {
     }
-    dasm_put(Dst, 10040);
+    dasm_put(Dst, 10125);
     break;
 
   /* -- Binary ops -------------------------------------------------------- */
 
 
   case BC_ADDVN: case BC_ADDNV: case BC_ADDVV:
-    dasm_put(Dst, 10050);
+    dasm_put(Dst, 10135);
     vk = ((int)op - BC_ADDVN) / (BC_ADDNV-BC_ADDVN);
     switch (vk) {
     case 0:
-    dasm_put(Dst, 10058, LJ_TISNUM);
+    dasm_put(Dst, 10143, LJ_TISNUM);
     if (sse) {
-    dasm_put(Dst, 10070);
+    dasm_put(Dst, 10155);
     } else {
-    dasm_put(Dst, 10085);
+    dasm_put(Dst, 10170);
     }
       break;
     case 1:
-    dasm_put(Dst, 10094, LJ_TISNUM);
+    dasm_put(Dst, 10179, LJ_TISNUM);
     if (sse) {
-    dasm_put(Dst, 10106);
+    dasm_put(Dst, 10191);
     } else {
-    dasm_put(Dst, 10121);
+    dasm_put(Dst, 10206);
     }
       break;
     default:
-    dasm_put(Dst, 10130, LJ_TISNUM, LJ_TISNUM);
+    dasm_put(Dst, 10215, LJ_TISNUM, LJ_TISNUM);
     if (sse) {
-    dasm_put(Dst, 10152);
+    dasm_put(Dst, 10237);
     } else {
-    dasm_put(Dst, 10166);
+    dasm_put(Dst, 10251);
     }
       break;
     }
     if (sse) {
-    dasm_put(Dst, 9932);
+    dasm_put(Dst, 10017);
     } else {
-    dasm_put(Dst, 9944);
+    dasm_put(Dst, 10029);
     }
-    dasm_put(Dst, 9512);
+    dasm_put(Dst, 7255);
     break;
   case BC_SUBVN: case BC_SUBNV: case BC_SUBVV:
-    dasm_put(Dst, 10050);
+    dasm_put(Dst, 10135);
     vk = ((int)op - BC_ADDVN) / (BC_ADDNV-BC_ADDVN);
     switch (vk) {
     case 0:
-    dasm_put(Dst, 10058, LJ_TISNUM);
+    dasm_put(Dst, 10143, LJ_TISNUM);
     if (sse) {
-    dasm_put(Dst, 10174);
+    dasm_put(Dst, 10259);
     } else {
-    dasm_put(Dst, 10189);
+    dasm_put(Dst, 10274);
     }
       break;
     case 1:
-    dasm_put(Dst, 10094, LJ_TISNUM);
+    dasm_put(Dst, 10179, LJ_TISNUM);
     if (sse) {
-    dasm_put(Dst, 10198);
+    dasm_put(Dst, 10283);
     } else {
-    dasm_put(Dst, 10213);
+    dasm_put(Dst, 10298);
     }
       break;
     default:
-    dasm_put(Dst, 10130, LJ_TISNUM, LJ_TISNUM);
+    dasm_put(Dst, 10215, LJ_TISNUM, LJ_TISNUM);
     if (sse) {
-    dasm_put(Dst, 10222);
+    dasm_put(Dst, 10307);
     } else {
-    dasm_put(Dst, 10236);
+    dasm_put(Dst, 10321);
     }
       break;
     }
     if (sse) {
-    dasm_put(Dst, 9932);
+    dasm_put(Dst, 10017);
     } else {
-    dasm_put(Dst, 9944);
+    dasm_put(Dst, 10029);
     }
-    dasm_put(Dst, 9512);
+    dasm_put(Dst, 7255);
     break;
   case BC_MULVN: case BC_MULNV: case BC_MULVV:
-    dasm_put(Dst, 10050);
+    dasm_put(Dst, 10135);
     vk = ((int)op - BC_ADDVN) / (BC_ADDNV-BC_ADDVN);
     switch (vk) {
     case 0:
-    dasm_put(Dst, 10058, LJ_TISNUM);
+    dasm_put(Dst, 10143, LJ_TISNUM);
     if (sse) {
-    dasm_put(Dst, 10244);
+    dasm_put(Dst, 10329);
     } else {
-    dasm_put(Dst, 10259);
+    dasm_put(Dst, 10344);
     }
       break;
     case 1:
-    dasm_put(Dst, 10094, LJ_TISNUM);
+    dasm_put(Dst, 10179, LJ_TISNUM);
     if (sse) {
-    dasm_put(Dst, 10268);
+    dasm_put(Dst, 10353);
     } else {
-    dasm_put(Dst, 10283);
+    dasm_put(Dst, 10368);
     }
       break;
     default:
-    dasm_put(Dst, 10130, LJ_TISNUM, LJ_TISNUM);
+    dasm_put(Dst, 10215, LJ_TISNUM, LJ_TISNUM);
     if (sse) {
-    dasm_put(Dst, 10292);
+    dasm_put(Dst, 10377);
     } else {
-    dasm_put(Dst, 10306);
+    dasm_put(Dst, 10391);
     }
       break;
     }
     if (sse) {
-    dasm_put(Dst, 9932);
+    dasm_put(Dst, 10017);
     } else {
-    dasm_put(Dst, 9944);
+    dasm_put(Dst, 10029);
     }
-    dasm_put(Dst, 9512);
+    dasm_put(Dst, 7255);
     break;
   case BC_DIVVN: case BC_DIVNV: case BC_DIVVV:
-    dasm_put(Dst, 10050);
+    dasm_put(Dst, 10135);
     vk = ((int)op - BC_ADDVN) / (BC_ADDNV-BC_ADDVN);
     switch (vk) {
     case 0:
-    dasm_put(Dst, 10058, LJ_TISNUM);
+    dasm_put(Dst, 10143, LJ_TISNUM);
     if (sse) {
-    dasm_put(Dst, 10314);
+    dasm_put(Dst, 10399);
     } else {
-    dasm_put(Dst, 10329);
+    dasm_put(Dst, 10414);
     }
       break;
     case 1:
-    dasm_put(Dst, 10094, LJ_TISNUM);
+    dasm_put(Dst, 10179, LJ_TISNUM);
     if (sse) {
-    dasm_put(Dst, 10338);
+    dasm_put(Dst, 10423);
     } else {
-    dasm_put(Dst, 10353);
+    dasm_put(Dst, 10438);
     }
       break;
     default:
-    dasm_put(Dst, 10130, LJ_TISNUM, LJ_TISNUM);
+    dasm_put(Dst, 10215, LJ_TISNUM, LJ_TISNUM);
     if (sse) {
-    dasm_put(Dst, 10362);
+    dasm_put(Dst, 10447);
     } else {
-    dasm_put(Dst, 10376);
+    dasm_put(Dst, 10461);
     }
       break;
     }
     if (sse) {
-    dasm_put(Dst, 9932);
+    dasm_put(Dst, 10017);
     } else {
-    dasm_put(Dst, 9944);
+    dasm_put(Dst, 10029);
     }
-    dasm_put(Dst, 9512);
+    dasm_put(Dst, 7255);
     break;
   case BC_MODVN:
-    dasm_put(Dst, 10050);
+    dasm_put(Dst, 10135);
     vk = ((int)op - BC_ADDVN) / (BC_ADDNV-BC_ADDVN);
     switch (vk) {
     case 0:
-    dasm_put(Dst, 10058, LJ_TISNUM);
+    dasm_put(Dst, 10143, LJ_TISNUM);
     if (sse) {
-    dasm_put(Dst, 10384);
+    dasm_put(Dst, 10469);
     } else {
-    dasm_put(Dst, 10399);
+    dasm_put(Dst, 10484);
     }
       break;
     case 1:
-    dasm_put(Dst, 10094, LJ_TISNUM);
+    dasm_put(Dst, 10179, LJ_TISNUM);
     if (sse) {
-    dasm_put(Dst, 10408);
+    dasm_put(Dst, 10493);
     } else {
-    dasm_put(Dst, 10423);
+    dasm_put(Dst, 10508);
     }
       break;
     default:
-    dasm_put(Dst, 10130, LJ_TISNUM, LJ_TISNUM);
+    dasm_put(Dst, 10215, LJ_TISNUM, LJ_TISNUM);
     if (sse) {
-    dasm_put(Dst, 10432);
+    dasm_put(Dst, 10517);
     } else {
-    dasm_put(Dst, 10446);
+    dasm_put(Dst, 10531);
     }
       break;
     }
-    dasm_put(Dst, 10454);
+    dasm_put(Dst, 10539);
     if (sse) {
-    dasm_put(Dst, 9932);
+    dasm_put(Dst, 10017);
     } else {
-    dasm_put(Dst, 9944);
+    dasm_put(Dst, 10029);
     }
-    dasm_put(Dst, 9512);
+    dasm_put(Dst, 7255);
     break;
   case BC_MODNV: case BC_MODVV:
-    dasm_put(Dst, 10050);
+    dasm_put(Dst, 10135);
     vk = ((int)op - BC_ADDVN) / (BC_ADDNV-BC_ADDVN);
     switch (vk) {
     case 0:
-    dasm_put(Dst, 10058, LJ_TISNUM);
+    dasm_put(Dst, 10143, LJ_TISNUM);
     if (sse) {
-    dasm_put(Dst, 10384);
+    dasm_put(Dst, 10469);
     } else {
-    dasm_put(Dst, 10399);
+    dasm_put(Dst, 10484);
     }
       break;
     case 1:
-    dasm_put(Dst, 10094, LJ_TISNUM);
+    dasm_put(Dst, 10179, LJ_TISNUM);
     if (sse) {
-    dasm_put(Dst, 10408);
+    dasm_put(Dst, 10493);
     } else {
-    dasm_put(Dst, 10423);
+    dasm_put(Dst, 10508);
     }
       break;
     default:
-    dasm_put(Dst, 10130, LJ_TISNUM, LJ_TISNUM);
+    dasm_put(Dst, 10215, LJ_TISNUM, LJ_TISNUM);
     if (sse) {
-    dasm_put(Dst, 10432);
+    dasm_put(Dst, 10517);
     } else {
-    dasm_put(Dst, 10446);
+    dasm_put(Dst, 10531);
     }
       break;
     }
-    dasm_put(Dst, 10460);
+    dasm_put(Dst, 10545);
     break;
   case BC_POW:
-    dasm_put(Dst, 10050);
+    dasm_put(Dst, 10135);
     vk = ((int)op - BC_ADDVN) / (BC_ADDNV-BC_ADDVN);
     switch (vk) {
     case 0:
-    dasm_put(Dst, 10058, LJ_TISNUM);
+    dasm_put(Dst, 10143, LJ_TISNUM);
     if (sse) {
-    dasm_put(Dst, 10384);
+    dasm_put(Dst, 10469);
     } else {
-    dasm_put(Dst, 10399);
+    dasm_put(Dst, 10484);
     }
       break;
     case 1:
-    dasm_put(Dst, 10094, LJ_TISNUM);
+    dasm_put(Dst, 10179, LJ_TISNUM);
     if (sse) {
-    dasm_put(Dst, 10408);
+    dasm_put(Dst, 10493);
     } else {
-    dasm_put(Dst, 10423);
+    dasm_put(Dst, 10508);
     }
       break;
     default:
-    dasm_put(Dst, 10130, LJ_TISNUM, LJ_TISNUM);
+    dasm_put(Dst, 10215, LJ_TISNUM, LJ_TISNUM);
     if (sse) {
-    dasm_put(Dst, 10432);
+    dasm_put(Dst, 10517);
     } else {
-    dasm_put(Dst, 10446);
+    dasm_put(Dst, 10531);
     }
       break;
     }
-    dasm_put(Dst, 10465);
+    dasm_put(Dst, 10550);
     if (sse) {
-    dasm_put(Dst, 9932);
+    dasm_put(Dst, 10017);
     } else {
-    dasm_put(Dst, 9944);
+    dasm_put(Dst, 10029);
     }
-    dasm_put(Dst, 9512);
+    dasm_put(Dst, 7255);
     break;
 
   case BC_CAT:
-    dasm_put(Dst, 10469, Dt1(->base), Dt1(->base));
+    dasm_put(Dst, 10554, Dt1(->base), Dt1(->base));
     break;
 
   /* -- Constant ops ------------------------------------------------------ */
 
   case BC_KSTR:
-    dasm_put(Dst, 10553, LJ_TSTR);
+    dasm_put(Dst, 10638, LJ_TSTR);
     break;
   case BC_KSHORT:
     if (sse) {
-      dasm_put(Dst, 10590);
+      dasm_put(Dst, 10675);
     } else {
-      dasm_put(Dst, 10605);
+      dasm_put(Dst, 10690);
     }
-    dasm_put(Dst, 9512);
+    dasm_put(Dst, 7255);
     break;
   case BC_KNUM:
     if (sse) {
-      dasm_put(Dst, 10613);
+      dasm_put(Dst, 10698);
     } else {
-      dasm_put(Dst, 10627);
+      dasm_put(Dst, 10712);
     }
-    dasm_put(Dst, 9512);
+    dasm_put(Dst, 7255);
     break;
   case BC_KPRI:
-    dasm_put(Dst, 10635);
+    dasm_put(Dst, 10720);
     break;
   case BC_KNIL:
-    dasm_put(Dst, 10664, LJ_TNIL);
+    dasm_put(Dst, 10749, LJ_TNIL);
     break;
 
   /* -- Upvalue and function ops ------------------------------------------ */
 
   case BC_UGET:
-    dasm_put(Dst, 10712, offsetof(GCfuncL, uvptr), DtA(->v));
+    dasm_put(Dst, 10797, offsetof(GCfuncL, uvptr), DtA(->v));
     break;
   case BC_USETV:
 #define TV2MARKOFS \
  ((int32_t)offsetof(GCupval, marked)-(int32_t)offsetof(GCupval, tv))
-    dasm_put(Dst, 10753, offsetof(GCfuncL, uvptr), DtA(->closed), DtA(->v), TV2MARKOFS, LJ_GC_BLACK, LJ_TISGCV, LJ_TISNUM - LJ_TISGCV, Dt4(->gch.marked), LJ_GC_WHITES, GG_DISP2G);
-    dasm_put(Dst, 10849);
+    dasm_put(Dst, 10838, offsetof(GCfuncL, uvptr), DtA(->closed), DtA(->v), TV2MARKOFS, LJ_GC_BLACK, LJ_TISGCV, LJ_TISNUM - LJ_TISGCV, Dt4(->gch.marked), LJ_GC_WHITES, GG_DISP2G);
+    dasm_put(Dst, 10934);
     break;
 #undef TV2MARKOFS
   case BC_USETS:
-    dasm_put(Dst, 10861, offsetof(GCfuncL, uvptr), DtA(->v), LJ_TSTR, DtA(->marked), LJ_GC_BLACK, Dt4(->gch.marked), LJ_GC_WHITES, DtA(->closed), GG_DISP2G);
+    dasm_put(Dst, 10946, offsetof(GCfuncL, uvptr), DtA(->v), LJ_TSTR, DtA(->marked), LJ_GC_BLACK, Dt4(->gch.marked), LJ_GC_WHITES, DtA(->closed), GG_DISP2G);
     break;
   case BC_USETN:
-    dasm_put(Dst, 10957);
+    dasm_put(Dst, 11042);
     if (sse) {
-      dasm_put(Dst, 10962);
+      dasm_put(Dst, 11047);
     } else {
-      dasm_put(Dst, 9754);
+      dasm_put(Dst, 9839);
     }
-    dasm_put(Dst, 10970, offsetof(GCfuncL, uvptr), DtA(->v));
+    dasm_put(Dst, 11055, offsetof(GCfuncL, uvptr), DtA(->v));
     if (sse) {
-      dasm_put(Dst, 10979);
+      dasm_put(Dst, 11064);
     } else {
-      dasm_put(Dst, 10985);
+      dasm_put(Dst, 11070);
     }
-    dasm_put(Dst, 9512);
+    dasm_put(Dst, 7255);
     break;
   case BC_USETP:
-    dasm_put(Dst, 10988, offsetof(GCfuncL, uvptr), DtA(->v));
+    dasm_put(Dst, 11073, offsetof(GCfuncL, uvptr), DtA(->v));
     break;
   case BC_UCLO:
-    dasm_put(Dst, 11028, -BCBIAS_J*4, Dt1(->openupval), Dt1(->base), Dt1(->base));
+    dasm_put(Dst, 11113, -BCBIAS_J*4, Dt1(->openupval), Dt1(->base), Dt1(->base));
     break;
 
   case BC_FNEW:
-    dasm_put(Dst, 11084, Dt1(->base), Dt1(->base), LJ_TFUNC);
+    dasm_put(Dst, 11169, Dt1(->base), Dt1(->base), LJ_TFUNC);
     break;
 
   /* -- Table ops --------------------------------------------------------- */
 
   case BC_TNEW:
-    dasm_put(Dst, 11151, Dt1(->base), DISPATCH_GL(gc.total), DISPATCH_GL(gc.threshold), Dt1(->base), LJ_TTAB);
+    dasm_put(Dst, 11236, Dt1(->base), DISPATCH_GL(gc.total), DISPATCH_GL(gc.threshold), Dt1(->base), LJ_TTAB);
     break;
   case BC_TDUP:
-    dasm_put(Dst, 11275, DISPATCH_GL(gc.total), DISPATCH_GL(gc.threshold), Dt1(->base), Dt1(->base), LJ_TTAB);
+    dasm_put(Dst, 11360, DISPATCH_GL(gc.total), DISPATCH_GL(gc.threshold), Dt1(->base), Dt1(->base), LJ_TTAB);
     break;
 
   case BC_GGET:
-    dasm_put(Dst, 11374, Dt7(->env));
+    dasm_put(Dst, 11459, Dt7(->env));
     break;
   case BC_GSET:
-    dasm_put(Dst, 11394, Dt7(->env));
+    dasm_put(Dst, 11479, Dt7(->env));
     break;
 
   case BC_TGETV:
-    dasm_put(Dst, 11414, LJ_TTAB, LJ_TISNUM);
+    dasm_put(Dst, 11499, LJ_TTAB, LJ_TISNUM);
     if (sse) {
-      dasm_put(Dst, 11447);
+      dasm_put(Dst, 11532);
     } else {
     }
-    dasm_put(Dst, 11468, Dt6(->asize), Dt6(->array), LJ_TNIL, Dt6(->metatable), Dt6(->metatable), Dt6(->nomm), 1<<MM_index);
-    dasm_put(Dst, 11553, LJ_TNIL, LJ_TSTR);
+    dasm_put(Dst, 11553, Dt6(->asize), Dt6(->array), LJ_TNIL, Dt6(->metatable), Dt6(->metatable), Dt6(->nomm), 1<<MM_index);
+    dasm_put(Dst, 11638, LJ_TNIL, LJ_TSTR);
     break;
   case BC_TGETS:
-    dasm_put(Dst, 11582, LJ_TTAB, Dt6(->hmask), Dt5(->hash), sizeof(Node), Dt6(->node), DtB(->key.it), LJ_TSTR, DtB(->key.gcr), LJ_TNIL);
-    dasm_put(Dst, 11667, LJ_TNIL, DtB(->next), Dt6(->metatable), Dt6(->nomm), 1<<MM_index);
+    dasm_put(Dst, 11667, LJ_TTAB, Dt6(->hmask), Dt5(->hash), sizeof(Node), Dt6(->node), DtB(->key.it), LJ_TSTR, DtB(->key.gcr), LJ_TNIL);
+    dasm_put(Dst, 11752, LJ_TNIL, DtB(->next), Dt6(->metatable), Dt6(->nomm), 1<<MM_index);
     break;
   case BC_TGETB:
-    dasm_put(Dst, 11739, LJ_TTAB, Dt6(->asize), Dt6(->array), LJ_TNIL, Dt6(->metatable), Dt6(->metatable), Dt6(->nomm), 1<<MM_index);
-    dasm_put(Dst, 11835, LJ_TNIL);
+    dasm_put(Dst, 11824, LJ_TTAB, Dt6(->asize), Dt6(->array), LJ_TNIL, Dt6(->metatable), Dt6(->metatable), Dt6(->nomm), 1<<MM_index);
+    dasm_put(Dst, 11920, LJ_TNIL);
     break;
 
   case BC_TSETV:
-    dasm_put(Dst, 11852, LJ_TTAB, LJ_TISNUM);
+    dasm_put(Dst, 11937, LJ_TTAB, LJ_TISNUM);
     if (sse) {
-      dasm_put(Dst, 11447);
+      dasm_put(Dst, 11532);
     } else {
     }
-    dasm_put(Dst, 11885, Dt6(->asize), Dt6(->array), LJ_TNIL, Dt6(->marked), LJ_GC_BLACK, Dt6(->metatable), Dt6(->metatable));
-    dasm_put(Dst, 11965, Dt6(->nomm), 1<<MM_newindex, LJ_TSTR, Dt6(->marked), cast_byte(~LJ_GC_BLACK), DISPATCH_GL(gc.grayagain), DISPATCH_GL(gc.grayagain), Dt6(->gclist));
+    dasm_put(Dst, 11970, Dt6(->asize), Dt6(->array), LJ_TNIL, Dt6(->marked), LJ_GC_BLACK, Dt6(->metatable), Dt6(->metatable));
+    dasm_put(Dst, 12050, Dt6(->nomm), 1<<MM_newindex, LJ_TSTR, Dt6(->marked), cast_byte(~LJ_GC_BLACK), DISPATCH_GL(gc.grayagain), DISPATCH_GL(gc.grayagain), Dt6(->gclist));
     break;
   case BC_TSETS:
-    dasm_put(Dst, 12029, LJ_TTAB, Dt6(->hmask), Dt5(->hash), sizeof(Node), Dt6(->nomm), Dt6(->node), DtB(->key.it), LJ_TSTR, DtB(->key.gcr), LJ_TNIL);
-    dasm_put(Dst, 12106, Dt6(->marked), LJ_GC_BLACK, Dt6(->metatable), Dt6(->metatable), Dt6(->nomm), 1<<MM_newindex, DtB(->next));
-    dasm_put(Dst, 12193, Dt6(->metatable), Dt6(->nomm), 1<<MM_newindex, LJ_TSTR, Dt1(->base), Dt1(->base), Dt6(->marked), cast_byte(~LJ_GC_BLACK), DISPATCH_GL(gc.grayagain), DISPATCH_GL(gc.grayagain), Dt6(->gclist));
+    dasm_put(Dst, 12114, LJ_TTAB, Dt6(->hmask), Dt5(->hash), sizeof(Node), Dt6(->nomm), Dt6(->node), DtB(->key.it), LJ_TSTR, DtB(->key.gcr), LJ_TNIL);
+    dasm_put(Dst, 12191, Dt6(->marked), LJ_GC_BLACK, Dt6(->metatable), Dt6(->metatable), Dt6(->nomm), 1<<MM_newindex, DtB(->next));
+    dasm_put(Dst, 12278, Dt6(->metatable), Dt6(->nomm), 1<<MM_newindex, LJ_TSTR, Dt1(->base), Dt1(->base), Dt6(->marked), cast_byte(~LJ_GC_BLACK), DISPATCH_GL(gc.grayagain), DISPATCH_GL(gc.grayagain), Dt6(->gclist));
     break;
   case BC_TSETB:
-    dasm_put(Dst, 12285, LJ_TTAB, Dt6(->asize), Dt6(->array), LJ_TNIL, Dt6(->marked), LJ_GC_BLACK, Dt6(->metatable));
-    dasm_put(Dst, 12380, Dt6(->metatable), Dt6(->nomm), 1<<MM_newindex, Dt6(->marked), cast_byte(~LJ_GC_BLACK), DISPATCH_GL(gc.grayagain), DISPATCH_GL(gc.grayagain), Dt6(->gclist));
+    dasm_put(Dst, 12370, LJ_TTAB, Dt6(->asize), Dt6(->array), LJ_TNIL, Dt6(->marked), LJ_GC_BLACK, Dt6(->metatable));
+    dasm_put(Dst, 12465, Dt6(->metatable), Dt6(->nomm), 1<<MM_newindex, Dt6(->marked), cast_byte(~LJ_GC_BLACK), DISPATCH_GL(gc.grayagain), DISPATCH_GL(gc.grayagain), Dt6(->gclist));
     break;
 
   case BC_TSETM:
-    dasm_put(Dst, 12428, Dt6(->marked), LJ_GC_BLACK, Dt6(->asize), Dt6(->array), Dt1(->base), Dt1(->base));
-    dasm_put(Dst, 12578, Dt6(->marked), cast_byte(~LJ_GC_BLACK), DISPATCH_GL(gc.grayagain), DISPATCH_GL(gc.grayagain), Dt6(->gclist));
+    dasm_put(Dst, 12513, Dt6(->marked), LJ_GC_BLACK, Dt6(->asize), Dt6(->array), Dt1(->base), Dt1(->base));
+    dasm_put(Dst, 12663, Dt6(->marked), cast_byte(~LJ_GC_BLACK), DISPATCH_GL(gc.grayagain), DISPATCH_GL(gc.grayagain), Dt6(->gclist));
     break;
 
   /* -- Calls and vararg handling ----------------------------------------- */
 
   case BC_CALL: case BC_CALLM:
-    dasm_put(Dst, 10054);
+    dasm_put(Dst, 10139);
     if (op == BC_CALLM) {
-      dasm_put(Dst, 12598);
+      dasm_put(Dst, 12683);
     }
-    dasm_put(Dst, 12603, LJ_TFUNC, Dt7(->pc));
+    dasm_put(Dst, 12688, LJ_TFUNC, Dt7(->pc));
     break;
 
   case BC_CALLMT:
-    dasm_put(Dst, 12598);
+    dasm_put(Dst, 12683);
     break;
   case BC_CALLT:
-    dasm_put(Dst, 12646, LJ_TFUNC, FRAME_TYPE, Dt7(->ffid), Dt7(->pc));
-    dasm_put(Dst, 12764, FRAME_TYPE, Dt7(->pc), PC2PROTO(k), FRAME_VARG, FRAME_TYPEP, FRAME_VARG);
+    dasm_put(Dst, 12731, LJ_TFUNC, FRAME_TYPE, Dt7(->ffid), Dt7(->pc));
+    dasm_put(Dst, 12849, FRAME_TYPE, Dt7(->pc), PC2PROTO(k), FRAME_VARG, FRAME_TYPEP, FRAME_VARG);
     break;
 
   case BC_ITERC:
-    dasm_put(Dst, 12838, LJ_TFUNC, 2+1, Dt7(->pc));
+    dasm_put(Dst, 12923, LJ_TFUNC, 2+1, Dt7(->pc));
     break;
 
   case BC_ITERN:
-#if LJ_HASJIT
-#endif
-    dasm_put(Dst, 12910, Dt6(->asize), Dt6(->array), LJ_TNIL);
+    dasm_put(Dst, 12995, Dt6(->asize), Dt6(->array), LJ_TNIL);
     if (sse) {
-      dasm_put(Dst, 12962);
+      dasm_put(Dst, 13047);
     } else {
-      dasm_put(Dst, 12968);
+      dasm_put(Dst, 13053);
     }
-    dasm_put(Dst, 12974);
+    dasm_put(Dst, 13059);
     if (sse) {
-      dasm_put(Dst, 9932);
+      dasm_put(Dst, 10017);
     } else {
-      dasm_put(Dst, 9944);
+      dasm_put(Dst, 10029);
     }
-    dasm_put(Dst, 12987, -BCBIAS_J*4);
+    dasm_put(Dst, 13072);
+#if LJ_HASJIT
+    dasm_put(Dst, 13089, BC_ITERL, DISPATCH_J(flags), JIT_F_ON, HOTCOUNT_PCMASK, GG_DISP2HOT);
+#endif
+    dasm_put(Dst, 13131, -BCBIAS_J*4);
     if (!sse) {
-      dasm_put(Dst, 13041);
+      dasm_put(Dst, 13198);
     }
-    dasm_put(Dst, 13047, Dt6(->hmask), sizeof(Node), Dt6(->node), DtB(->val.it), LJ_TNIL, DtB(->key), DtB(->val));
+    dasm_put(Dst, 13204, Dt6(->hmask), sizeof(Node), Dt6(->node), DtB(->val.it), LJ_TNIL, DtB(->key), DtB(->val));
+#if LJ_HASJIT
+    dasm_put(Dst, 13283, BC_JITERL, BC_JLOOP);
+#endif
     break;
 
   case BC_ISNEXT:
-    dasm_put(Dst, 13126, LJ_TFUNC, LJ_TTAB, LJ_TNIL, Dt8(->ffid), FF_next_N, -BCBIAS_J*4, BC_JMP, -BCBIAS_J*4, BC_ITERC);
+    dasm_put(Dst, 13303, LJ_TFUNC, LJ_TTAB, LJ_TNIL, Dt8(->ffid), FF_next_N, -BCBIAS_J*4, BC_JMP, -BCBIAS_J*4, BC_ITERC);
     break;
 
   case BC_VARG:
-    dasm_put(Dst, 13227, (8+FRAME_VARG), LJ_TNIL, Dt1(->maxstack));
-    dasm_put(Dst, 13394, Dt1(->base), Dt1(->top), Dt1(->base), Dt1(->top));
+    dasm_put(Dst, 13404, (8+FRAME_VARG), LJ_TNIL, Dt1(->maxstack));
+    dasm_put(Dst, 13571, Dt1(->base), Dt1(->top), Dt1(->base), Dt1(->top));
     break;
 
   /* -- Returns ----------------------------------------------------------- */
 
   case BC_RETM:
-    dasm_put(Dst, 12598);
+    dasm_put(Dst, 12683);
     break;
 
   case BC_RET: case BC_RET0: case BC_RET1:
     if (op != BC_RET0) {
-      dasm_put(Dst, 13464);
+      dasm_put(Dst, 13641);
     }
-    dasm_put(Dst, 13468, FRAME_TYPE);
+    dasm_put(Dst, 13645, FRAME_TYPE);
     switch (op) {
     case BC_RET:
-      dasm_put(Dst, 13487);
+      dasm_put(Dst, 13664);
       break;
     case BC_RET1:
-      dasm_put(Dst, 13541);
+      dasm_put(Dst, 13718);
       /* fallthrough */
     case BC_RET0:
-      dasm_put(Dst, 13551);
+      dasm_put(Dst, 13728);
     default:
       break;
     }
-    dasm_put(Dst, 13562, Dt7(->pc), PC2PROTO(k));
+    dasm_put(Dst, 13739, Dt7(->pc), PC2PROTO(k));
     if (op == BC_RET) {
-      dasm_put(Dst, 13610, LJ_TNIL);
+      dasm_put(Dst, 13787, LJ_TNIL);
     } else {
-      dasm_put(Dst, 13621, LJ_TNIL);
+      dasm_put(Dst, 13798, LJ_TNIL);
     }
-    dasm_put(Dst, 13628, -FRAME_VARG, FRAME_TYPEP);
+    dasm_put(Dst, 13805, -FRAME_VARG, FRAME_TYPEP);
     if (op != BC_RET0) {
-      dasm_put(Dst, 13652);
+      dasm_put(Dst, 13829);
     }
     dasm_put(Dst, 4546);
     break;
@@ -2078,7 +2096,7 @@ static void build_ins(BuildCtx *ctx, BCOp op, int defop, int cmov, int sse)
 
   case BC_FORL:
 #if LJ_HASJIT
-    dasm_put(Dst, 13656, HOTCOUNT_PCMASK, GG_DISP2HOT);
+    dasm_put(Dst, 13833, HOTCOUNT_PCMASK, GG_DISP2HOT);
 #endif
     break;
 
@@ -2090,57 +2108,57 @@ static void build_ins(BuildCtx *ctx, BCOp op, int defop, int cmov, int sse)
   case BC_FORI:
   case BC_IFORL:
     vk = (op == BC_IFORL || op == BC_JFORL);
-    dasm_put(Dst, 13677);
+    dasm_put(Dst, 13854);
     if (!vk) {
-      dasm_put(Dst, 13681, LJ_TISNUM, LJ_TISNUM);
+      dasm_put(Dst, 13858, LJ_TISNUM, LJ_TISNUM);
     }
-    dasm_put(Dst, 13700);
+    dasm_put(Dst, 13877);
     if (!vk) {
-      dasm_put(Dst, 13704, LJ_TISNUM);
+      dasm_put(Dst, 13881, LJ_TISNUM);
     }
     if (sse) {
-      dasm_put(Dst, 13713);
+      dasm_put(Dst, 13890);
       if (vk) {
-	dasm_put(Dst, 13725);
+	dasm_put(Dst, 13902);
       } else {
-	dasm_put(Dst, 13744);
+	dasm_put(Dst, 13921);
       }
-      dasm_put(Dst, 13749);
+      dasm_put(Dst, 13926);
     } else {
-      dasm_put(Dst, 13762);
+      dasm_put(Dst, 13939);
       if (vk) {
-	dasm_put(Dst, 13768);
+	dasm_put(Dst, 13945);
       } else {
-	dasm_put(Dst, 13784);
+	dasm_put(Dst, 13961);
       }
-      dasm_put(Dst, 13792);
+      dasm_put(Dst, 13969);
       if (cmov) {
-      dasm_put(Dst, 9475);
+      dasm_put(Dst, 9560);
       } else {
-      dasm_put(Dst, 9481);
+      dasm_put(Dst, 9566);
       }
       if (!cmov) {
-	dasm_put(Dst, 13797);
+	dasm_put(Dst, 13974);
       }
     }
     if (op == BC_FORI) {
-      dasm_put(Dst, 13803, -BCBIAS_J*4);
+      dasm_put(Dst, 13980, -BCBIAS_J*4);
     } else if (op == BC_JFORI) {
-      dasm_put(Dst, 13813, -BCBIAS_J*4, BC_JLOOP);
+      dasm_put(Dst, 13990, -BCBIAS_J*4, BC_JLOOP);
     } else if (op == BC_IFORL) {
-      dasm_put(Dst, 13827, -BCBIAS_J*4);
+      dasm_put(Dst, 14004, -BCBIAS_J*4);
     } else {
-      dasm_put(Dst, 13823, BC_JLOOP);
+      dasm_put(Dst, 14000, BC_JLOOP);
     }
-    dasm_put(Dst, 9510);
+    dasm_put(Dst, 9595);
     if (sse) {
-      dasm_put(Dst, 13837);
+      dasm_put(Dst, 14014);
     }
     break;
 
   case BC_ITERL:
 #if LJ_HASJIT
-    dasm_put(Dst, 13656, HOTCOUNT_PCMASK, GG_DISP2HOT);
+    dasm_put(Dst, 13833, HOTCOUNT_PCMASK, GG_DISP2HOT);
 #endif
     break;
 
@@ -2149,33 +2167,33 @@ static void build_ins(BuildCtx *ctx, BCOp op, int defop, int cmov, int sse)
     break;
 #endif
   case BC_IITERL:
-    dasm_put(Dst, 13848, LJ_TNIL);
+    dasm_put(Dst, 14025, LJ_TNIL);
     if (op == BC_JITERL) {
-      dasm_put(Dst, 13863, BC_JLOOP);
+      dasm_put(Dst, 14040, BC_JLOOP);
     } else {
-      dasm_put(Dst, 13877, -BCBIAS_J*4);
+      dasm_put(Dst, 14054, -BCBIAS_J*4);
     }
-    dasm_put(Dst, 9814);
+    dasm_put(Dst, 9899);
     break;
 
   case BC_LOOP:
 #if LJ_HASJIT
-    dasm_put(Dst, 13656, HOTCOUNT_PCMASK, GG_DISP2HOT);
+    dasm_put(Dst, 13833, HOTCOUNT_PCMASK, GG_DISP2HOT);
 #endif
     break;
 
   case BC_ILOOP:
-    dasm_put(Dst, 9512);
+    dasm_put(Dst, 7255);
     break;
 
   case BC_JLOOP:
 #if LJ_HASJIT
-    dasm_put(Dst, 13893, DISPATCH_J(trace), DtD(->mcode), DISPATCH_GL(jit_base), DISPATCH_GL(jit_L));
+    dasm_put(Dst, 14070, DISPATCH_J(trace), DtD(->mcode), DISPATCH_GL(jit_base), DISPATCH_GL(jit_L));
 #endif
     break;
 
   case BC_JMP:
-    dasm_put(Dst, 13934, -BCBIAS_J*4);
+    dasm_put(Dst, 7250, -BCBIAS_J*4);
     break;
 
   /* -- Function headers -------------------------------------------------- */
@@ -2189,7 +2207,7 @@ static void build_ins(BuildCtx *ctx, BCOp op, int defop, int cmov, int sse)
 
   case BC_FUNCF:
 #if LJ_HASJIT
-    dasm_put(Dst, 13960, HOTCOUNT_PCMASK, GG_DISP2HOT);
+    dasm_put(Dst, 14111, HOTCOUNT_PCMASK, GG_DISP2HOT);
 #endif
   case BC_FUNCV:  /* NYI: compiled vararg functions. */
     break;
@@ -2199,47 +2217,47 @@ static void build_ins(BuildCtx *ctx, BCOp op, int defop, int cmov, int sse)
     break;
 #endif
   case BC_IFUNCF:
-    dasm_put(Dst, 13981, -4+PC2PROTO(k), Dt1(->maxstack), -4+PC2PROTO(numparams));
+    dasm_put(Dst, 14132, -4+PC2PROTO(k), Dt1(->maxstack), -4+PC2PROTO(numparams));
     if (op == BC_JFUNCF) {
-      dasm_put(Dst, 14012, BC_JLOOP);
+      dasm_put(Dst, 13294, BC_JLOOP);
     } else {
-      dasm_put(Dst, 9512);
+      dasm_put(Dst, 7255);
     }
-    dasm_put(Dst, 14021, LJ_TNIL);
+    dasm_put(Dst, 14163, LJ_TNIL);
     break;
 
   case BC_JFUNCV:
 #if !LJ_HASJIT
     break;
 #endif
-    dasm_put(Dst, 8991);
+    dasm_put(Dst, 9076);
     break;  /* NYI: compiled vararg functions. */
 
   case BC_IFUNCV:
-    dasm_put(Dst, 14043, FRAME_VARG, Dt1(->maxstack), -4+PC2PROTO(numparams), LJ_TNIL);
+    dasm_put(Dst, 14185, FRAME_VARG, Dt1(->maxstack), -4+PC2PROTO(numparams), LJ_TNIL);
     if (op == BC_JFUNCV) {
-      dasm_put(Dst, 14012, BC_JLOOP);
+      dasm_put(Dst, 13294, BC_JLOOP);
     } else {
-      dasm_put(Dst, 14140, -4+PC2PROTO(k));
+      dasm_put(Dst, 14282, -4+PC2PROTO(k));
     }
-    dasm_put(Dst, 14165, LJ_TNIL);
+    dasm_put(Dst, 14307, LJ_TNIL);
     break;
 
   case BC_FUNCC:
   case BC_FUNCCW:
-    dasm_put(Dst, 14187, Dt8(->f), Dt1(->base), 8*LUA_MINSTACK, Dt1(->maxstack), Dt1(->top));
+    dasm_put(Dst, 14329, Dt8(->f), Dt1(->base), 8*LUA_MINSTACK, Dt1(->maxstack), Dt1(->top));
     if (op == BC_FUNCC) {
-      dasm_put(Dst, 14217);
+      dasm_put(Dst, 14359);
     } else {
-      dasm_put(Dst, 14221);
+      dasm_put(Dst, 14363);
     }
-    dasm_put(Dst, 14229, DISPATCH_GL(vmstate), ~LJ_VMST_C);
+    dasm_put(Dst, 14371, DISPATCH_GL(vmstate), ~LJ_VMST_C);
     if (op == BC_FUNCC) {
-      dasm_put(Dst, 14239);
+      dasm_put(Dst, 14381);
     } else {
-      dasm_put(Dst, 14244, DISPATCH_GL(wrapf));
+      dasm_put(Dst, 14386, DISPATCH_GL(wrapf));
     }
-    dasm_put(Dst, 14250, DISPATCH_GL(vmstate), ~LJ_VMST_INTERP, Dt1(->base), Dt1(->top));
+    dasm_put(Dst, 14392, DISPATCH_GL(vmstate), ~LJ_VMST_INTERP, Dt1(->base), Dt1(->top));
     break;
 
   /* ---------------------------------------------------------------------- */
@@ -2267,7 +2285,7 @@ static int build_backend(BuildCtx *ctx)
 
   build_subroutines(ctx, cmov, sse);
 
-  dasm_put(Dst, 14276);
+  dasm_put(Dst, 14418);
   for (op = 0; op < BC__MAX; op++)
     build_ins(ctx, (BCOp)op, op, cmov, sse);
 
@@ -12,7 +12,7 @@
 #define DASM_SECTION_CODE_OP	0
 #define DASM_SECTION_CODE_SUB	1
 #define DASM_MAXSECTION		2
-static const unsigned char build_actionlist[14223] = {
+static const unsigned char build_actionlist[14362] = {
   254,1,248,10,252,247,198,237,15,132,244,11,131,230,252,248,41,252,242,72,
   141,76,49,252,248,139,114,252,252,199,68,10,4,237,248,12,131,192,1,137,68,
   36,84,252,247,198,237,15,132,244,13,248,14,129,252,246,239,252,247,198,237,
@@ -354,356 +354,363 @@ static const unsigned char build_actionlist[14223] = {
   139,108,36,32,85,195,248,136,255,15,182,131,233,168,235,15,133,244,251,168,
   235,15,133,244,247,168,235,15,132,244,247,252,255,139,233,252,233,244,247,
   255,248,137,15,182,131,233,168,235,15,133,244,251,252,233,244,247,248,138,
-  15,182,131,233,168,235,15,133,244,251,168,235,15,132,244,251,252,255,139,
-  233,15,132,244,247,168,235,15,132,244,251,248,1,255,139,108,36,96,137,149,
-  233,137,252,242,137,252,233,232,251,1,20,248,3,139,149,233,248,4,15,182,78,
-  252,253,248,5,15,182,110,252,252,15,183,70,252,254,252,255,164,253,252,235,
-  233,248,139,131,198,4,139,77,232,137,76,36,84,252,233,244,4,248,140,255,139,
-  106,252,248,139,173,233,15,182,133,233,141,4,194,139,108,36,96,137,149,233,
-  137,133,233,137,252,242,141,139,233,72,137,171,233,137,116,36,100,232,251,
-  1,21,252,233,244,3,255,248,141,137,116,36,100,255,248,142,255,137,116,36,
-  100,131,206,1,248,1,255,141,68,194,252,248,139,108,36,96,137,149,233,137,
-  133,233,137,252,242,137,252,233,232,251,1,22,199,68,36,100,0,0,0,0,255,131,
-  230,252,254,255,139,149,233,72,137,193,139,133,233,41,208,72,137,205,15,182,
-  78,252,253,193,232,3,131,192,1,252,255,229,248,143,255,65,85,65,84,65,83,
-  65,82,65,81,65,80,87,86,85,72,141,108,36,88,85,83,82,81,80,15,182,69,252,
-  248,138,101,252,240,76,137,125,252,248,76,137,117,252,240,139,93,0,139,139,
-  233,199,131,233,237,137,131,233,137,139,233,72,129,252,236,239,72,131,197,
-  128,252,242,68,15,17,125,252,248,252,242,68,15,17,117,252,240,252,242,68,
-  15,17,109,232,252,242,68,15,17,101,224,252,242,68,15,17,93,216,252,242,68,
-  15,17,85,208,252,242,68,15,17,77,200,252,242,68,15,17,69,192,252,242,15,17,
-  125,184,252,242,15,17,117,176,252,242,15,17,109,168,252,242,15,17,101,160,
-  252,242,15,17,93,152,252,242,15,17,85,144,252,242,15,17,77,136,252,242,15,
-  17,69,128,139,171,233,139,147,233,72,137,171,233,199,131,233,0,0,0,0,137,
-  149,233,72,141,148,253,36,233,141,139,233,232,251,1,23,72,139,141,233,72,
-  129,225,239,137,169,233,139,149,233,139,177,233,252,233,244,247,255,248,144,
-  255,72,141,140,253,36,233,248,1,102,68,15,111,185,233,102,68,15,111,177,233,
-  102,68,15,111,169,233,102,68,15,111,161,233,102,68,15,111,153,233,102,68,
-  15,111,145,233,102,68,15,111,137,233,102,68,15,111,129,233,102,15,111,185,
-  233,72,137,204,102,15,111,49,76,139,124,36,16,76,139,116,36,24,76,139,108,
-  36,32,76,139,100,36,80,133,192,15,136,244,249,137,68,36,84,139,122,252,248,
-  139,191,233,139,191,233,199,131,233,0,0,0,0,199,131,233,237,139,6,15,182,
-  204,15,182,232,131,198,4,193,232,16,129,252,253,239,15,130,244,248,255,139,
-  68,36,84,248,2,252,255,36,252,235,248,3,252,247,216,137,252,233,137,194,232,
-  251,1,24,255,248,82,255,217,124,36,4,137,68,36,8,102,184,0,4,102,11,68,36,
-  4,102,37,252,255,252,247,102,137,68,36,6,217,108,36,6,217,252,252,217,108,
-  36,4,139,68,36,8,195,255,248,145,72,184,237,237,102,72,15,110,208,72,184,
-  237,237,102,72,15,110,216,15,40,200,102,15,84,202,102,15,46,217,15,134,244,
-  247,102,15,85,208,252,242,15,88,203,252,242,15,92,203,102,15,86,202,72,184,
-  237,237,102,72,15,110,208,252,242,15,194,193,1,102,15,84,194,252,242,15,92,
-  200,15,40,193,248,1,195,248,84,255,217,124,36,4,137,68,36,8,102,184,0,8,102,
-  11,68,36,4,102,37,252,255,252,251,102,137,68,36,6,217,108,36,6,217,252,252,
+  15,182,131,233,168,235,15,133,244,251,168,235,15,133,244,247,168,235,15,132,
+  244,251,252,255,139,233,15,132,244,247,255,168,235,15,132,244,251,248,1,139,
+  108,36,96,137,149,233,137,252,242,137,252,233,232,251,1,20,248,3,139,149,
+  233,248,4,15,182,78,252,253,248,5,15,182,110,252,252,15,183,70,252,254,252,
+  255,164,253,252,235,233,248,139,131,198,4,139,77,232,137,76,36,84,252,233,
+  244,4,248,140,255,139,106,252,248,139,173,233,15,182,133,233,141,4,194,139,
+  108,36,96,137,149,233,137,133,233,137,252,242,141,139,233,72,137,171,233,
+  137,116,36,100,232,251,1,21,252,233,244,3,255,248,141,255,139,106,252,248,
+  139,173,233,15,182,133,233,141,4,194,139,108,36,96,137,149,233,137,133,233,
+  137,252,242,141,139,233,72,137,171,233,137,116,36,100,232,251,1,21,139,149,
+  233,15,183,70,252,254,141,180,253,134,233,139,6,15,182,204,15,182,232,131,
+  198,4,193,232,16,252,255,36,252,235,255,248,142,137,116,36,100,255,248,143,
+  255,137,116,36,100,131,206,1,248,1,255,141,68,194,252,248,139,108,36,96,137,
+  149,233,137,133,233,137,252,242,137,252,233,232,251,1,22,199,68,36,100,0,
+  0,0,0,255,131,230,252,254,255,139,149,233,72,137,193,139,133,233,41,208,72,
+  137,205,15,182,78,252,253,193,232,3,131,192,1,252,255,229,248,144,255,65,
+  85,65,84,65,83,65,82,65,81,65,80,87,86,85,72,141,108,36,88,85,83,82,81,80,
+  15,182,69,252,248,138,101,252,240,76,137,125,252,248,76,137,117,252,240,139,
+  93,0,139,139,233,199,131,233,237,137,131,233,137,139,233,72,129,252,236,239,
+  72,131,197,128,252,242,68,15,17,125,252,248,252,242,68,15,17,117,252,240,
+  252,242,68,15,17,109,232,252,242,68,15,17,101,224,252,242,68,15,17,93,216,
+  252,242,68,15,17,85,208,252,242,68,15,17,77,200,252,242,68,15,17,69,192,252,
+  242,15,17,125,184,252,242,15,17,117,176,252,242,15,17,109,168,252,242,15,
+  17,101,160,252,242,15,17,93,152,252,242,15,17,85,144,252,242,15,17,77,136,
+  252,242,15,17,69,128,139,171,233,139,147,233,72,137,171,233,199,131,233,0,
+  0,0,0,137,149,233,72,141,148,253,36,233,141,139,233,232,251,1,23,72,139,141,
+  233,72,129,225,239,137,169,233,139,149,233,139,177,233,252,233,244,247,255,
+  248,145,255,72,141,140,253,36,233,248,1,102,68,15,111,185,233,102,68,15,111,
+  177,233,102,68,15,111,169,233,102,68,15,111,161,233,102,68,15,111,153,233,
+  102,68,15,111,145,233,102,68,15,111,137,233,102,68,15,111,129,233,102,15,
+  111,185,233,72,137,204,102,15,111,49,76,139,124,36,16,76,139,116,36,24,76,
+  139,108,36,32,76,139,100,36,80,133,192,15,136,244,249,137,68,36,84,139,122,
+  252,248,139,191,233,139,191,233,199,131,233,0,0,0,0,199,131,233,237,139,6,
+  15,182,204,15,182,232,131,198,4,193,232,16,129,252,253,239,15,130,244,248,
+  255,139,68,36,84,248,2,252,255,36,252,235,248,3,252,247,216,137,252,233,137,
+  194,232,251,1,24,255,248,82,255,217,124,36,4,137,68,36,8,102,184,0,4,102,
+  11,68,36,4,102,37,252,255,252,247,102,137,68,36,6,217,108,36,6,217,252,252,
   217,108,36,4,139,68,36,8,195,255,248,146,72,184,237,237,102,72,15,110,208,
   72,184,237,237,102,72,15,110,216,15,40,200,102,15,84,202,102,15,46,217,15,
   134,244,247,102,15,85,208,252,242,15,88,203,252,242,15,92,203,102,15,86,202,
-  72,184,237,237,102,72,15,110,208,252,242,15,194,193,6,102,15,84,194,252,242,
-  15,92,200,15,40,193,248,1,195,248,104,255,217,124,36,4,137,68,36,8,102,184,
-  0,12,102,11,68,36,4,102,137,68,36,6,217,108,36,6,217,252,252,217,108,36,4,
-  139,68,36,8,195,255,248,147,72,184,237,237,102,72,15,110,208,72,184,237,237,
-  102,72,15,110,216,15,40,200,102,15,84,202,102,15,46,217,15,134,244,247,102,
-  15,85,208,15,40,193,252,242,15,88,203,252,242,15,92,203,72,184,237,237,102,
-  72,15,110,216,252,242,15,194,193,1,102,15,84,195,252,242,15,92,200,102,15,
-  86,202,15,40,193,248,1,195,248,148,255,15,40,232,252,242,15,94,193,72,184,
-  237,237,102,72,15,110,208,72,184,237,237,102,72,15,110,216,15,40,224,102,
-  15,84,226,102,15,46,220,15,134,244,247,102,15,85,208,252,242,15,88,227,252,
-  242,15,92,227,102,15,86,226,72,184,237,237,102,72,15,110,208,252,242,15,194,
-  196,1,102,15,84,194,252,242,15,92,224,15,40,197,252,242,15,89,204,252,242,
-  15,92,193,195,248,1,252,242,15,89,200,15,40,197,252,242,15,92,193,195,255,
-  217,193,216,252,241,217,124,36,4,102,184,0,4,102,11,68,36,4,102,37,252,255,
-  252,247,102,137,68,36,6,217,108,36,6,217,252,252,217,108,36,4,222,201,222,
-  252,233,195,255,248,88,217,252,234,222,201,248,149,217,84,36,8,129,124,36,
-  8,0,0,128,127,15,132,244,247,129,124,36,8,0,0,128,252,255,15,132,244,248,
-  248,150,217,192,217,252,252,220,252,233,217,201,217,252,240,217,232,222,193,
-  217,252,253,221,217,248,1,195,248,2,221,216,217,252,238,195,255,248,107,255,
-  248,151,252,242,15,45,193,252,242,15,42,208,102,15,46,202,15,133,244,254,
-  15,138,244,255,248,152,131,252,248,1,15,142,244,252,248,1,169,1,0,0,0,15,
-  133,244,248,252,242,15,89,192,209,232,252,233,244,1,248,2,209,232,15,132,
-  244,251,15,40,200,248,3,252,242,15,89,192,209,232,15,132,244,250,15,131,244,
-  3,255,252,242,15,89,200,252,233,244,3,248,4,252,242,15,89,193,248,5,195,248,
-  6,15,132,244,5,15,130,244,253,80,72,184,237,237,102,72,15,110,200,252,242,
-  15,94,200,88,15,40,193,252,247,216,131,252,248,1,15,132,244,5,252,233,244,
-  1,248,7,72,184,237,237,102,72,15,110,192,195,248,8,102,72,15,126,200,72,209,
-  224,72,193,192,12,72,61,252,254,15,0,0,15,132,244,248,255,102,72,15,126,192,
-  72,209,224,15,132,244,250,72,193,192,12,72,61,252,254,15,0,0,15,132,244,251,
-  252,242,15,17,76,36,16,252,242,15,17,68,36,8,221,68,36,16,221,68,36,8,217,
-  252,241,217,192,217,252,252,220,252,233,217,201,217,252,240,217,232,222,193,
-  217,252,253,221,217,221,92,36,8,252,242,15,16,68,36,8,195,248,9,72,184,237,
-  237,102,72,15,110,208,102,15,46,194,15,132,244,247,15,40,193,248,1,195,248,
-  2,72,184,237,237,102,72,15,110,208,102,15,84,194,72,184,237,237,102,72,15,
-  110,208,102,15,46,194,15,132,244,1,102,15,80,193,15,87,192,136,196,15,146,
-  208,48,224,15,133,244,1,248,3,72,184,237,237,255,102,72,15,110,192,195,248,
-  4,102,15,80,193,133,192,15,133,244,3,15,87,192,195,248,5,102,15,80,193,133,
-  192,15,132,244,3,15,87,192,195,248,153,255,131,252,250,1,15,130,244,82,15,
-  132,244,84,131,252,250,3,15,130,244,104,15,135,244,248,252,242,15,81,192,
-  195,248,2,252,242,15,17,68,36,8,221,68,36,8,131,252,250,5,15,135,244,248,
-  88,15,132,244,247,232,244,88,80,252,233,244,253,248,1,232,244,149,255,80,
-  252,233,244,253,248,2,131,252,250,7,15,132,244,247,15,135,244,248,217,252,
-  237,217,201,217,252,241,252,233,244,253,248,1,217,232,217,201,217,252,241,
-  252,233,244,253,248,2,131,252,250,9,15,132,244,247,15,135,244,248,217,252,
-  236,217,201,217,252,241,252,233,244,253,248,1,255,217,252,254,252,233,244,
-  253,248,2,131,252,250,11,15,132,244,247,15,135,244,255,217,252,255,252,233,
-  244,253,248,1,217,252,242,221,216,248,7,221,92,36,8,252,242,15,16,68,36,8,
-  195,255,139,84,36,12,221,68,36,4,131,252,250,1,15,130,244,82,15,132,244,84,
-  131,252,250,3,15,130,244,104,15,135,244,248,217,252,250,195,248,2,131,252,
-  250,5,15,130,244,88,15,132,244,149,131,252,250,7,15,132,244,247,15,135,244,
-  248,217,252,237,217,201,217,252,241,195,248,1,217,232,217,201,217,252,241,
-  195,248,2,131,252,250,9,15,132,244,247,255,15,135,244,248,217,252,236,217,
-  201,217,252,241,195,248,1,217,252,254,195,248,2,131,252,250,11,15,132,244,
-  247,15,135,244,255,217,252,255,195,248,1,217,252,242,221,216,195,255,248,
-  9,204,255,248,154,255,65,131,252,248,1,15,132,244,247,15,135,244,248,252,
-  242,15,88,193,195,248,1,252,242,15,92,193,195,248,2,65,131,252,248,3,15,132,
-  244,247,15,135,244,248,252,242,15,89,193,195,248,1,252,242,15,94,193,195,
-  248,2,65,131,252,248,5,15,130,244,148,15,132,244,107,65,131,252,248,7,15,
-  132,244,247,15,135,244,248,72,184,237,237,255,102,72,15,110,200,15,87,193,
-  195,248,1,72,184,237,237,102,72,15,110,200,15,84,193,195,248,2,65,131,252,
-  248,9,15,135,244,248,252,242,15,17,68,36,8,252,242,15,17,76,36,16,221,68,
-  36,8,221,68,36,16,15,132,244,247,217,252,243,248,7,221,92,36,8,252,242,15,
-  16,68,36,8,195,248,1,217,201,217,252,253,221,217,252,233,244,7,248,2,65,131,
-  252,248,11,15,132,244,247,15,135,244,255,252,242,15,93,193,195,248,1,252,
-  242,15,95,193,195,248,9,204,255,139,68,36,20,221,68,36,4,221,68,36,12,131,
-  252,248,1,15,132,244,247,15,135,244,248,222,193,195,248,1,222,252,233,195,
-  248,2,131,252,248,3,15,132,244,247,15,135,244,248,222,201,195,248,1,222,252,
-  249,195,248,2,131,252,248,5,15,130,244,148,15,132,244,107,131,252,248,7,15,
-  132,244,247,15,135,244,248,255,221,216,217,224,195,248,1,221,216,217,225,
-  195,248,2,131,252,248,9,15,132,244,247,15,135,244,248,217,252,243,195,248,
-  1,217,201,217,252,253,221,217,195,248,2,131,252,248,11,15,132,244,247,15,
-  135,244,255,255,219,252,233,219,209,221,217,195,248,1,219,252,233,218,209,
-  221,217,195,255,221,225,223,224,252,246,196,1,15,132,244,248,217,201,248,
-  2,221,216,195,248,1,221,225,223,224,252,246,196,1,15,133,244,248,217,201,
-  248,2,221,216,195,255,248,155,137,200,86,72,137,214,83,15,162,137,6,137,94,
-  4,137,78,8,137,86,12,91,94,195,255,129,124,253,202,4,239,15,135,244,41,129,
-  124,253,194,4,239,15,135,244,41,255,252,242,15,16,4,194,131,198,4,102,15,
-  46,4,202,255,221,4,202,221,4,194,131,198,4,255,223,252,233,221,216,255,218,
-  252,233,223,224,158,255,15,134,244,248,255,15,131,244,248,255,248,1,15,183,
-  70,252,254,141,180,253,134,233,248,2,139,6,15,182,204,15,182,232,131,198,
-  4,193,232,16,252,255,36,252,235,255,139,108,194,4,131,198,4,129,252,253,239,
-  15,135,244,251,129,124,253,202,4,239,15,135,244,251,255,252,242,15,16,4,194,
-  102,15,46,4,202,255,221,4,202,221,4,194,255,15,138,244,248,15,133,244,248,
-  255,15,138,244,248,15,132,244,247,255,248,1,15,183,70,252,254,141,180,253,
-  134,233,248,2,255,248,2,15,183,70,252,254,141,180,253,134,233,248,1,255,248,
-  5,57,108,202,4,15,133,244,2,129,252,253,239,15,131,244,1,139,12,202,139,4,
-  194,57,193,15,132,244,1,129,252,253,239,15,135,244,2,139,169,233,133,252,
-  237,15,132,244,2,252,246,133,233,235,15,133,244,2,255,49,252,237,255,189,
-  1,0,0,0,255,252,233,244,45,255,72,252,247,208,131,198,4,129,124,253,202,4,
-  239,15,133,244,248,139,12,202,59,12,135,255,131,198,4,129,124,253,202,4,239,
-  15,135,244,248,255,252,242,15,16,4,199,102,15,46,4,202,255,221,4,202,221,
-  4,199,255,72,252,247,208,131,198,4,57,68,202,4,255,139,108,194,4,131,198,
-  4,129,252,253,239,255,15,131,244,247,255,15,130,244,247,255,137,108,202,4,
-  139,44,194,137,44,202,255,15,183,70,252,254,141,180,253,134,233,248,1,139,
-  6,15,182,204,15,182,232,131,198,4,193,232,16,252,255,36,252,235,255,72,139,
-  44,194,72,137,44,202,139,6,15,182,204,15,182,232,131,198,4,193,232,16,252,
-  255,36,252,235,255,49,252,237,129,124,253,194,4,239,129,213,239,137,108,202,
-  4,139,6,15,182,204,15,182,232,131,198,4,193,232,16,252,255,36,252,235,255,
-  129,124,253,194,4,239,15,135,244,48,255,252,242,15,16,4,194,72,184,237,237,
-  102,72,15,110,200,15,87,193,252,242,15,17,4,202,255,221,4,194,217,224,221,
-  28,202,255,129,124,253,194,4,239,15,133,244,248,139,4,194,255,15,87,192,252,
-  242,15,42,128,233,248,1,252,242,15,17,4,202,255,219,128,233,248,1,221,28,
-  202,255,139,6,15,182,204,15,182,232,131,198,4,193,232,16,252,255,36,252,235,
-  248,2,129,124,253,194,4,239,15,133,244,50,139,12,194,137,213,232,251,1,18,
-  255,252,242,15,42,192,137,252,234,255,15,182,78,252,253,252,233,244,1,255,
-  15,182,252,236,15,182,192,255,129,124,253,252,234,4,239,15,135,244,46,255,
-  252,242,15,16,4,252,234,252,242,15,88,4,199,255,221,4,252,234,220,4,199,255,
-  129,124,253,252,234,4,239,15,135,244,47,255,252,242,15,16,4,199,252,242,15,
-  88,4,252,234,255,221,4,199,220,4,252,234,255,129,124,253,252,234,4,239,15,
-  135,244,49,129,124,253,194,4,239,15,135,244,49,255,252,242,15,16,4,252,234,
-  252,242,15,88,4,194,255,221,4,252,234,220,4,194,255,252,242,15,16,4,252,234,
-  252,242,15,92,4,199,255,221,4,252,234,220,36,199,255,252,242,15,16,4,199,
-  252,242,15,92,4,252,234,255,221,4,199,220,36,252,234,255,252,242,15,16,4,
-  252,234,252,242,15,92,4,194,255,221,4,252,234,220,36,194,255,252,242,15,16,
-  4,252,234,252,242,15,89,4,199,255,221,4,252,234,220,12,199,255,252,242,15,
-  16,4,199,252,242,15,89,4,252,234,255,221,4,199,220,12,252,234,255,252,242,
-  15,16,4,252,234,252,242,15,89,4,194,255,221,4,252,234,220,12,194,255,252,
-  242,15,16,4,252,234,252,242,15,94,4,199,255,221,4,252,234,220,52,199,255,
-  252,242,15,16,4,199,252,242,15,94,4,252,234,255,221,4,199,220,52,252,234,
-  255,252,242,15,16,4,252,234,252,242,15,94,4,194,255,221,4,252,234,220,52,
-  194,255,252,242,15,16,4,252,234,252,242,15,16,12,199,255,221,4,252,234,221,
-  4,199,255,252,242,15,16,4,199,252,242,15,16,12,252,234,255,221,4,199,221,
-  4,252,234,255,252,242,15,16,4,252,234,252,242,15,16,12,194,255,221,4,252,
-  234,221,4,194,255,248,156,232,244,148,255,252,233,244,156,255,232,244,107,
-  255,15,182,252,236,15,182,192,139,76,36,96,137,145,233,141,20,194,65,137,
-  192,65,41,232,248,33,137,205,137,116,36,100,232,251,1,25,139,149,233,133,
-  192,15,133,244,42,15,182,110,252,255,15,182,78,252,253,72,139,4,252,234,72,
-  137,4,202,139,6,15,182,204,15,182,232,131,198,4,193,232,16,252,255,36,252,
-  235,255,72,252,247,208,139,4,135,199,68,202,4,237,137,4,202,139,6,15,182,
-  204,15,182,232,131,198,4,193,232,16,252,255,36,252,235,255,15,191,192,252,
-  242,15,42,192,252,242,15,17,4,202,255,223,70,252,254,221,28,202,255,252,242,
-  15,16,4,199,252,242,15,17,4,202,255,221,4,199,221,28,202,255,72,252,247,208,
-  137,68,202,4,139,6,15,182,204,15,182,232,131,198,4,193,232,16,252,255,36,
-  252,235,255,141,76,202,12,141,68,194,4,189,237,137,105,252,248,248,1,137,
-  41,131,193,8,57,193,15,134,244,1,139,6,15,182,204,15,182,232,131,198,4,193,
-  232,16,252,255,36,252,235,255,139,106,252,248,139,172,253,133,233,139,173,
-  233,72,139,69,0,72,137,4,202,139,6,15,182,204,15,182,232,131,198,4,193,232,
-  16,252,255,36,252,235,255,139,106,252,248,139,172,253,141,233,128,189,233,
-  0,139,173,233,139,12,194,139,68,194,4,137,77,0,137,69,4,15,132,244,247,252,
-  246,133,233,235,15,133,244,248,248,1,139,6,15,182,204,15,182,232,131,198,
-  4,193,232,16,252,255,36,252,235,248,2,129,232,239,129,252,248,239,15,134,
-  244,1,252,246,129,233,235,15,132,244,1,135,213,141,139,233,255,232,251,1,
-  26,137,252,234,252,233,244,1,255,72,252,247,208,139,106,252,248,139,172,253,
-  141,233,139,12,135,139,133,233,137,8,199,64,4,237,252,246,133,233,235,15,
-  133,244,248,248,1,139,6,15,182,204,15,182,232,131,198,4,193,232,16,252,255,
-  36,252,235,248,2,252,246,129,233,235,15,132,244,1,128,189,233,0,15,132,244,
-  1,137,213,137,194,141,139,233,232,251,1,26,137,252,234,252,233,244,1,255,
-  139,106,252,248,255,252,242,15,16,4,199,255,139,172,253,141,233,139,141,233,
-  255,252,242,15,17,1,255,221,25,255,72,252,247,208,139,106,252,248,139,172,
-  253,141,233,139,141,233,137,65,4,139,6,15,182,204,15,182,232,131,198,4,193,
-  232,16,252,255,36,252,235,255,141,180,253,134,233,139,108,36,96,131,189,233,
-  0,15,132,244,247,137,149,233,141,20,202,137,252,233,232,251,1,27,139,149,
-  233,248,1,139,6,15,182,204,15,182,232,131,198,4,193,232,16,252,255,36,252,
-  235,255,72,252,247,208,139,108,36,96,137,149,233,68,139,66,252,248,139,20,
-  135,137,252,233,137,116,36,100,232,251,1,28,139,149,233,15,182,78,252,253,
-  137,4,202,199,68,202,4,237,139,6,15,182,204,15,182,232,131,198,4,193,232,
-  16,252,255,36,252,235,255,139,108,36,96,137,149,233,139,139,233,59,139,233,
-  137,116,36,100,15,131,244,251,248,1,65,137,192,37,252,255,7,0,0,65,193,232,
-  11,61,252,255,7,0,0,15,132,244,249,248,2,137,252,233,137,194,232,251,1,29,
-  139,149,233,15,182,78,252,253,137,4,202,199,68,202,4,237,139,6,15,182,204,
-  15,182,232,131,198,4,193,232,16,252,255,36,252,235,248,3,184,1,8,0,0,252,
-  233,244,2,248,5,137,252,233,232,251,1,30,15,183,70,252,254,252,233,244,1,
-  255,72,252,247,208,139,108,36,96,139,139,233,137,116,36,100,59,139,233,137,
-  149,233,15,131,244,249,248,2,139,20,135,137,252,233,232,251,1,31,139,149,
-  233,15,182,78,252,253,137,4,202,199,68,202,4,237,139,6,15,182,204,15,182,
-  232,131,198,4,193,232,16,252,255,36,252,235,248,3,137,252,233,232,251,1,30,
-  15,183,70,252,254,72,252,247,208,252,233,244,2,255,72,252,247,208,139,106,
-  252,248,139,173,233,139,4,135,252,233,244,157,255,72,252,247,208,139,106,
-  252,248,139,173,233,139,4,135,252,233,244,158,255,15,182,252,236,15,182,192,
-  129,124,253,252,234,4,239,15,133,244,36,139,44,252,234,129,124,253,194,4,
-  239,15,135,244,251,255,252,242,15,16,4,194,252,242,15,45,192,252,242,15,42,
-  200,102,15,46,193,255,15,133,244,36,59,133,233,15,131,244,36,193,224,3,3,
-  133,233,129,120,253,4,239,15,132,244,248,72,139,40,72,137,44,202,248,1,139,
-  6,15,182,204,15,182,232,131,198,4,193,232,16,252,255,36,252,235,248,2,131,
-  189,233,0,15,132,244,249,139,141,233,252,246,129,233,235,15,132,244,36,15,
-  182,78,252,253,248,3,255,199,68,202,4,237,252,233,244,1,248,5,129,124,253,
-  194,4,239,15,133,244,36,139,4,194,252,233,244,157,255,15,182,252,236,15,182,
-  192,72,252,247,208,139,4,135,129,124,253,252,234,4,239,15,133,244,34,139,
-  44,252,234,248,157,139,141,233,35,136,233,105,201,239,3,141,233,248,1,129,
-  185,233,239,15,133,244,250,57,129,233,15,133,244,250,129,121,253,4,239,15,
-  132,244,251,15,182,70,252,253,72,139,41,72,137,44,194,248,2,255,139,6,15,
-  182,204,15,182,232,131,198,4,193,232,16,252,255,36,252,235,248,3,15,182,70,
-  252,253,199,68,194,4,237,252,233,244,2,248,4,139,137,233,133,201,15,133,244,
-  1,248,5,139,141,233,133,201,15,132,244,3,252,246,129,233,235,15,133,244,3,
-  252,233,244,34,255,15,182,252,236,15,182,192,129,124,253,252,234,4,239,15,
-  133,244,35,139,44,252,234,59,133,233,15,131,244,35,193,224,3,3,133,233,129,
-  120,253,4,239,15,132,244,248,72,139,40,72,137,44,202,248,1,139,6,15,182,204,
-  15,182,232,131,198,4,193,232,16,252,255,36,252,235,248,2,131,189,233,0,15,
-  132,244,249,139,141,233,252,246,129,233,235,15,132,244,35,255,15,182,78,252,
-  253,248,3,199,68,202,4,237,252,233,244,1,255,15,182,252,236,15,182,192,129,
-  124,253,252,234,4,239,15,133,244,39,139,44,252,234,129,124,253,194,4,239,
-  15,135,244,251,255,15,133,244,39,59,133,233,15,131,244,39,193,224,3,3,133,
-  233,129,120,253,4,239,15,132,244,249,248,1,252,246,133,233,235,15,133,244,
-  253,248,2,72,139,44,202,72,137,40,139,6,15,182,204,15,182,232,131,198,4,193,
-  232,16,252,255,36,252,235,248,3,131,189,233,0,15,132,244,1,139,141,233,255,
-  252,246,129,233,235,15,132,244,39,15,182,78,252,253,252,233,244,1,248,5,129,
-  124,253,194,4,239,15,133,244,39,139,4,194,252,233,244,158,248,7,128,165,233,
-  235,139,139,233,137,171,233,137,141,233,15,182,78,252,253,252,233,244,2,255,
-  15,182,252,236,15,182,192,72,252,247,208,139,4,135,129,124,253,252,234,4,
-  239,15,133,244,37,139,44,252,234,248,158,139,141,233,35,136,233,105,201,239,
-  198,133,233,0,3,141,233,248,1,129,185,233,239,15,133,244,251,57,129,233,15,
-  133,244,251,129,121,253,4,239,15,132,244,250,248,2,255,252,246,133,233,235,
-  15,133,244,253,248,3,15,182,70,252,253,72,139,44,194,72,137,41,139,6,15,182,
-  204,15,182,232,131,198,4,193,232,16,252,255,36,252,235,248,4,131,189,233,
-  0,15,132,244,2,137,76,36,80,139,141,233,252,246,129,233,235,15,132,244,37,
-  139,76,36,80,252,233,244,2,248,5,139,137,233,133,201,15,133,244,1,255,139,
-  141,233,133,201,15,132,244,252,252,246,129,233,235,15,132,244,37,248,6,137,
-  68,36,80,199,68,36,84,237,137,108,36,32,139,76,36,96,137,145,233,76,141,68,
-  36,80,137,252,234,137,205,137,116,36,100,232,251,1,32,139,149,233,139,108,
-  36,32,137,193,252,233,244,2,248,7,128,165,233,235,139,131,233,137,171,233,
-  137,133,233,252,233,244,3,255,15,182,252,236,15,182,192,129,124,253,252,234,
-  4,239,15,133,244,38,139,44,252,234,59,133,233,15,131,244,38,193,224,3,3,133,
-  233,129,120,253,4,239,15,132,244,249,248,1,252,246,133,233,235,15,133,244,
-  253,248,2,72,139,12,202,72,137,8,139,6,15,182,204,15,182,232,131,198,4,193,
-  232,16,252,255,36,252,235,248,3,131,189,233,0,15,132,244,1,255,139,141,233,
-  252,246,129,233,235,15,132,244,38,15,182,78,252,253,252,233,244,1,248,7,128,
-  165,233,235,139,139,233,137,171,233,137,141,233,15,182,78,252,253,252,233,
-  244,2,255,137,124,36,80,139,60,199,248,1,141,12,202,139,105,252,248,252,246,
-  133,233,235,15,133,244,253,248,2,139,68,36,84,131,232,1,15,132,244,250,1,
-  252,248,59,133,233,15,135,244,251,41,252,248,193,231,3,3,189,233,248,3,72,
-  139,41,131,193,8,72,137,47,131,199,8,131,232,1,15,133,244,3,248,4,139,124,
-  36,80,139,6,15,182,204,15,182,232,131,198,4,193,232,16,252,255,36,252,235,
-  248,5,139,76,36,96,137,145,233,137,252,234,65,137,192,137,205,137,116,36,
-  100,232,251,1,33,139,149,233,15,182,78,252,253,252,233,244,1,248,7,255,128,
-  165,233,235,139,131,233,137,171,233,137,133,233,252,233,244,2,255,3,68,36,
-  84,255,129,124,253,202,4,239,139,44,202,15,133,244,51,141,84,202,8,137,114,
-  252,252,139,181,233,139,14,15,182,252,233,15,182,205,131,198,4,252,255,36,
-  252,235,255,141,76,202,8,137,215,139,105,252,248,129,121,253,252,252,239,
-  15,133,244,28,248,52,139,114,252,252,252,247,198,237,15,133,244,253,248,1,
-  137,106,252,248,137,68,36,84,131,232,1,15,132,244,249,248,2,72,139,41,131,
-  193,8,72,137,47,131,199,8,131,232,1,15,133,244,2,139,106,252,248,248,3,139,
-  68,36,84,128,189,233,1,15,135,244,251,248,4,139,181,233,139,14,15,182,252,
-  233,15,182,205,131,198,4,252,255,36,252,235,248,5,255,252,247,198,237,15,
-  133,244,4,15,182,78,252,253,72,252,247,209,141,12,202,139,121,252,248,139,
-  191,233,139,191,233,252,233,244,4,248,7,129,252,238,239,252,247,198,237,15,
-  133,244,254,41,252,242,137,215,139,114,252,252,252,233,244,1,248,8,129,198,
-  239,252,233,244,1,255,141,76,202,8,72,139,105,232,72,139,65,252,240,72,137,
-  41,72,137,65,8,139,105,224,139,65,228,137,105,252,248,137,65,252,252,129,
-  252,248,239,184,237,15,133,244,28,137,202,137,114,252,252,139,181,233,139,
-  14,15,182,252,233,15,182,205,131,198,4,252,255,36,252,235,255,137,124,36,
-  80,137,92,36,84,139,108,202,252,240,139,68,202,252,248,139,157,233,131,198,
-  4,139,189,233,248,1,57,216,15,131,244,251,129,124,253,199,4,239,15,132,244,
-  250,255,252,242,15,42,192,255,219,68,202,252,248,255,72,139,44,199,72,137,
-  108,202,8,131,192,1,255,137,68,202,252,248,248,2,15,183,70,252,254,141,180,
-  253,134,233,248,3,139,92,36,84,139,124,36,80,139,6,15,182,204,15,182,232,
-  131,198,4,193,232,16,252,255,36,252,235,248,4,131,192,1,255,137,68,202,252,
-  248,255,252,233,244,1,248,5,41,216,248,6,59,133,233,15,135,244,3,105,252,
-  248,239,3,189,233,129,191,233,239,15,132,244,253,141,92,24,1,72,139,175,233,
-  72,139,135,233,72,137,44,202,72,137,68,202,8,137,92,202,252,248,252,233,244,
-  2,248,7,131,192,1,252,233,244,6,255,129,124,253,202,252,236,239,15,133,244,
-  251,139,108,202,232,129,124,253,202,252,244,239,15,133,244,251,129,124,253,
-  202,252,252,239,15,133,244,251,128,189,233,235,15,133,244,251,141,180,253,
-  134,233,199,68,202,252,248,0,0,0,0,248,1,139,6,15,182,204,15,182,232,131,
-  198,4,193,232,16,252,255,36,252,235,248,5,198,70,252,252,235,141,180,253,
-  134,233,198,6,235,252,233,244,1,255,15,182,252,236,15,182,192,137,124,36,
-  80,141,188,253,194,233,141,12,202,43,122,252,252,133,252,237,15,132,244,251,
-  141,108,252,233,252,248,57,215,15,131,244,248,248,1,72,139,71,252,248,131,
-  199,8,72,137,1,131,193,8,57,252,233,15,131,244,249,57,215,15,130,244,1,248,
-  2,199,65,4,237,131,193,8,57,252,233,15,130,244,2,248,3,139,124,36,80,139,
-  6,15,182,204,15,182,232,131,198,4,193,232,16,252,255,36,252,235,248,5,199,
-  68,36,84,1,0,0,0,137,208,41,252,248,15,134,244,3,137,197,193,252,237,3,131,
-  197,1,137,108,36,84,139,108,36,96,1,200,59,133,233,15,135,244,253,248,6,255,
-  72,139,71,252,248,131,199,8,72,137,1,131,193,8,57,215,15,130,244,6,252,233,
-  244,3,248,7,137,149,233,137,141,233,137,116,36,100,41,215,139,84,36,84,131,
-  252,234,1,137,252,233,232,251,1,0,139,149,233,139,141,233,1,215,252,233,244,
-  6,255,193,225,3,255,248,1,139,114,252,252,137,68,36,84,252,247,198,237,15,
-  133,244,253,255,248,13,137,215,131,232,1,15,132,244,249,248,2,72,139,44,15,
-  72,137,111,252,248,131,199,8,131,232,1,15,133,244,2,248,3,139,68,36,84,15,
-  182,110,252,255,248,5,57,197,15,135,244,252,255,72,139,44,10,72,137,106,252,
-  248,255,248,5,56,70,252,255,15,135,244,252,255,15,182,78,252,253,72,252,247,
-  209,141,20,202,139,122,252,248,139,191,233,139,191,233,139,6,15,182,204,15,
-  182,232,131,198,4,193,232,16,252,255,36,252,235,248,6,255,199,71,252,252,
-  237,131,199,8,255,199,68,194,252,244,237,255,131,192,1,252,233,244,5,248,
-  7,141,174,233,252,247,197,237,15,133,244,14,41,252,234,255,1,252,233,255,
-  137,252,245,209,252,237,129,229,239,102,131,172,253,43,233,1,15,132,244,140,
-  255,141,12,202,255,129,121,253,4,239,15,135,244,53,129,121,253,12,239,15,
-  135,244,53,255,139,105,20,255,129,252,253,239,15,135,244,53,255,252,242,15,
-  16,1,252,242,15,16,73,8,255,252,242,15,88,65,16,252,242,15,17,1,133,252,237,
-  15,136,244,249,255,15,140,244,249,255,102,15,46,200,248,1,252,242,15,17,65,
-  24,255,221,65,8,221,1,255,220,65,16,221,17,221,81,24,133,252,237,15,136,244,
-  247,255,221,81,24,15,140,244,247,255,217,201,248,1,255,15,183,70,252,254,
-  255,15,131,244,248,141,180,253,134,233,255,141,180,253,134,233,15,183,70,
-  252,254,15,131,245,255,15,130,244,248,141,180,253,134,233,255,248,3,102,15,
-  46,193,252,233,244,1,255,141,12,202,139,105,4,129,252,253,239,15,132,244,
-  247,255,137,105,252,252,139,41,137,105,252,248,252,233,245,255,141,180,253,
-  134,233,139,1,137,105,252,252,137,65,252,248,255,139,139,233,139,4,129,72,
-  139,128,233,139,108,36,96,137,147,233,137,171,233,76,137,100,36,80,76,137,
-  108,36,32,76,137,116,36,24,76,137,124,36,16,72,137,225,72,129,252,236,239,
-  102,15,127,49,102,15,127,185,233,102,68,15,127,129,233,102,68,15,127,137,
-  233,102,68,15,127,145,233,102,68,15,127,153,233,102,68,15,127,161,233,102,
-  68,15,127,169,233,102,68,15,127,177,233,102,68,15,127,185,233,252,255,224,
-  255,141,180,253,134,233,139,6,15,182,204,15,182,232,131,198,4,193,232,16,
-  252,255,36,252,235,255,137,252,245,209,252,237,129,229,239,102,131,172,253,
-  43,233,1,15,132,244,142,255,139,190,233,139,108,36,96,141,12,202,59,141,233,
-  15,135,244,23,15,182,142,233,57,200,15,134,244,249,248,2,255,15,183,70,252,
-  254,252,233,245,255,248,3,199,68,194,252,252,237,131,192,1,57,200,15,134,
-  244,3,252,233,244,2,255,141,44,197,237,141,4,194,139,122,252,248,137,104,
-  252,252,137,120,252,248,139,108,36,96,141,12,200,59,141,233,15,135,244,22,
-  137,209,137,194,15,182,174,233,133,252,237,15,132,244,248,248,1,131,193,8,
-  57,209,15,131,244,249,139,121,252,248,137,56,139,121,252,252,137,120,4,131,
-  192,8,199,65,252,252,237,131,252,237,1,15,133,244,1,248,2,255,139,190,233,
-  139,6,15,182,204,15,182,232,131,198,4,193,232,16,252,255,36,252,235,255,248,
-  3,199,64,4,237,131,192,8,131,252,237,1,15,133,244,3,252,233,244,2,255,139,
-  106,252,248,72,139,189,233,139,108,36,96,141,68,194,252,248,137,149,233,141,
-  136,233,59,141,233,137,133,233,255,137,252,233,255,72,137,252,250,137,252,
-  233,255,15,135,244,21,199,131,233,237,255,252,255,215,255,252,255,147,233,
-  255,199,131,233,237,139,149,233,141,12,194,252,247,217,3,141,233,139,114,
-  252,252,252,233,244,12,255,254,0
+  72,184,237,237,102,72,15,110,208,252,242,15,194,193,1,102,15,84,194,252,242,
+  15,92,200,15,40,193,248,1,195,248,84,255,217,124,36,4,137,68,36,8,102,184,
+  0,8,102,11,68,36,4,102,37,252,255,252,251,102,137,68,36,6,217,108,36,6,217,
+  252,252,217,108,36,4,139,68,36,8,195,255,248,147,72,184,237,237,102,72,15,
+  110,208,72,184,237,237,102,72,15,110,216,15,40,200,102,15,84,202,102,15,46,
+  217,15,134,244,247,102,15,85,208,252,242,15,88,203,252,242,15,92,203,102,
+  15,86,202,72,184,237,237,102,72,15,110,208,252,242,15,194,193,6,102,15,84,
+  194,252,242,15,92,200,15,40,193,248,1,195,248,104,255,217,124,36,4,137,68,
+  36,8,102,184,0,12,102,11,68,36,4,102,137,68,36,6,217,108,36,6,217,252,252,
+  217,108,36,4,139,68,36,8,195,255,248,148,72,184,237,237,102,72,15,110,208,
+  72,184,237,237,102,72,15,110,216,15,40,200,102,15,84,202,102,15,46,217,15,
+  134,244,247,102,15,85,208,15,40,193,252,242,15,88,203,252,242,15,92,203,72,
+  184,237,237,102,72,15,110,216,252,242,15,194,193,1,102,15,84,195,252,242,
+  15,92,200,102,15,86,202,15,40,193,248,1,195,248,149,255,15,40,232,252,242,
+  15,94,193,72,184,237,237,102,72,15,110,208,72,184,237,237,102,72,15,110,216,
+  15,40,224,102,15,84,226,102,15,46,220,15,134,244,247,102,15,85,208,252,242,
+  15,88,227,252,242,15,92,227,102,15,86,226,72,184,237,237,102,72,15,110,208,
+  252,242,15,194,196,1,102,15,84,194,252,242,15,92,224,15,40,197,252,242,15,
+  89,204,252,242,15,92,193,195,248,1,252,242,15,89,200,15,40,197,252,242,15,
+  92,193,195,255,217,193,216,252,241,217,124,36,4,102,184,0,4,102,11,68,36,
+  4,102,37,252,255,252,247,102,137,68,36,6,217,108,36,6,217,252,252,217,108,
+  36,4,222,201,222,252,233,195,255,248,88,217,252,234,222,201,248,150,217,84,
+  36,8,129,124,36,8,0,0,128,127,15,132,244,247,129,124,36,8,0,0,128,252,255,
+  15,132,244,248,248,151,217,192,217,252,252,220,252,233,217,201,217,252,240,
+  217,232,222,193,217,252,253,221,217,248,1,195,248,2,221,216,217,252,238,195,
+  255,248,107,255,248,152,252,242,15,45,193,252,242,15,42,208,102,15,46,202,
+  15,133,244,254,15,138,244,255,248,153,131,252,248,1,15,142,244,252,248,1,
+  169,1,0,0,0,15,133,244,248,252,242,15,89,192,209,232,252,233,244,1,248,2,
+  209,232,15,132,244,251,15,40,200,248,3,252,242,15,89,192,209,232,15,132,244,
+  250,15,131,244,3,255,252,242,15,89,200,252,233,244,3,248,4,252,242,15,89,
+  193,248,5,195,248,6,15,132,244,5,15,130,244,253,80,72,184,237,237,102,72,
+  15,110,200,252,242,15,94,200,88,15,40,193,252,247,216,131,252,248,1,15,132,
+  244,5,252,233,244,1,248,7,72,184,237,237,102,72,15,110,192,195,248,8,102,
+  72,15,126,200,72,209,224,72,193,192,12,72,61,252,254,15,0,0,15,132,244,248,
+  255,102,72,15,126,192,72,209,224,15,132,244,250,72,193,192,12,72,61,252,254,
+  15,0,0,15,132,244,251,252,242,15,17,76,36,16,252,242,15,17,68,36,8,221,68,
+  36,16,221,68,36,8,217,252,241,217,192,217,252,252,220,252,233,217,201,217,
+  252,240,217,232,222,193,217,252,253,221,217,221,92,36,8,252,242,15,16,68,
+  36,8,195,248,9,72,184,237,237,102,72,15,110,208,102,15,46,194,15,132,244,
+  247,15,40,193,248,1,195,248,2,72,184,237,237,102,72,15,110,208,102,15,84,
+  194,72,184,237,237,102,72,15,110,208,102,15,46,194,15,132,244,1,102,15,80,
+  193,15,87,192,136,196,15,146,208,48,224,15,133,244,1,248,3,72,184,237,237,
+  255,102,72,15,110,192,195,248,4,102,15,80,193,133,192,15,133,244,3,15,87,
+  192,195,248,5,102,15,80,193,133,192,15,132,244,3,15,87,192,195,248,154,255,
+  131,252,250,1,15,130,244,82,15,132,244,84,131,252,250,3,15,130,244,104,15,
+  135,244,248,252,242,15,81,192,195,248,2,252,242,15,17,68,36,8,221,68,36,8,
+  131,252,250,5,15,135,244,248,88,15,132,244,247,232,244,88,80,252,233,244,
+  253,248,1,232,244,150,255,80,252,233,244,253,248,2,131,252,250,7,15,132,244,
+  247,15,135,244,248,217,252,237,217,201,217,252,241,252,233,244,253,248,1,
+  217,232,217,201,217,252,241,252,233,244,253,248,2,131,252,250,9,15,132,244,
+  247,15,135,244,248,217,252,236,217,201,217,252,241,252,233,244,253,248,1,
+  255,217,252,254,252,233,244,253,248,2,131,252,250,11,15,132,244,247,15,135,
+  244,255,217,252,255,252,233,244,253,248,1,217,252,242,221,216,248,7,221,92,
+  36,8,252,242,15,16,68,36,8,195,255,139,84,36,12,221,68,36,4,131,252,250,1,
+  15,130,244,82,15,132,244,84,131,252,250,3,15,130,244,104,15,135,244,248,217,
+  252,250,195,248,2,131,252,250,5,15,130,244,88,15,132,244,150,131,252,250,
+  7,15,132,244,247,15,135,244,248,217,252,237,217,201,217,252,241,195,248,1,
+  217,232,217,201,217,252,241,195,248,2,131,252,250,9,15,132,244,247,255,15,
+  135,244,248,217,252,236,217,201,217,252,241,195,248,1,217,252,254,195,248,
+  2,131,252,250,11,15,132,244,247,15,135,244,255,217,252,255,195,248,1,217,
+  252,242,221,216,195,255,248,9,204,255,248,155,255,65,131,252,248,1,15,132,
+  244,247,15,135,244,248,252,242,15,88,193,195,248,1,252,242,15,92,193,195,
+  248,2,65,131,252,248,3,15,132,244,247,15,135,244,248,252,242,15,89,193,195,
+  248,1,252,242,15,94,193,195,248,2,65,131,252,248,5,15,130,244,149,15,132,
+  244,107,65,131,252,248,7,15,132,244,247,15,135,244,248,72,184,237,237,255,
+  102,72,15,110,200,15,87,193,195,248,1,72,184,237,237,102,72,15,110,200,15,
+  84,193,195,248,2,65,131,252,248,9,15,135,244,248,252,242,15,17,68,36,8,252,
+  242,15,17,76,36,16,221,68,36,8,221,68,36,16,15,132,244,247,217,252,243,248,
+  7,221,92,36,8,252,242,15,16,68,36,8,195,248,1,217,201,217,252,253,221,217,
+  252,233,244,7,248,2,65,131,252,248,11,15,132,244,247,15,135,244,255,252,242,
+  15,93,193,195,248,1,252,242,15,95,193,195,248,9,204,255,139,68,36,20,221,
+  68,36,4,221,68,36,12,131,252,248,1,15,132,244,247,15,135,244,248,222,193,
+  195,248,1,222,252,233,195,248,2,131,252,248,3,15,132,244,247,15,135,244,248,
+  222,201,195,248,1,222,252,249,195,248,2,131,252,248,5,15,130,244,149,15,132,
+  244,107,131,252,248,7,15,132,244,247,15,135,244,248,255,221,216,217,224,195,
+  248,1,221,216,217,225,195,248,2,131,252,248,9,15,132,244,247,15,135,244,248,
+  217,252,243,195,248,1,217,201,217,252,253,221,217,195,248,2,131,252,248,11,
+  15,132,244,247,15,135,244,255,255,219,252,233,219,209,221,217,195,248,1,219,
+  252,233,218,209,221,217,195,255,221,225,223,224,252,246,196,1,15,132,244,
+  248,217,201,248,2,221,216,195,248,1,221,225,223,224,252,246,196,1,15,133,
+  244,248,217,201,248,2,221,216,195,255,248,156,137,200,86,72,137,214,83,15,
+  162,137,6,137,94,4,137,78,8,137,86,12,91,94,195,255,129,124,253,202,4,239,
+  15,135,244,41,129,124,253,194,4,239,15,135,244,41,255,252,242,15,16,4,194,
+  131,198,4,102,15,46,4,202,255,221,4,202,221,4,194,131,198,4,255,223,252,233,
+  221,216,255,218,252,233,223,224,158,255,15,134,244,248,255,15,131,244,248,
+  255,248,1,15,183,70,252,254,141,180,253,134,233,248,2,139,6,15,182,204,15,
+  182,232,131,198,4,193,232,16,252,255,36,252,235,255,139,108,194,4,131,198,
+  4,129,252,253,239,15,135,244,251,129,124,253,202,4,239,15,135,244,251,255,
+  252,242,15,16,4,194,102,15,46,4,202,255,221,4,202,221,4,194,255,15,138,244,
+  248,15,133,244,248,255,15,138,244,248,15,132,244,247,255,248,1,15,183,70,
+  252,254,141,180,253,134,233,248,2,255,248,2,15,183,70,252,254,141,180,253,
+  134,233,248,1,255,248,5,57,108,202,4,15,133,244,2,129,252,253,239,15,131,
+  244,1,139,12,202,139,4,194,57,193,15,132,244,1,129,252,253,239,15,135,244,
+  2,139,169,233,133,252,237,15,132,244,2,252,246,133,233,235,15,133,244,2,255,
+  49,252,237,255,189,1,0,0,0,255,252,233,244,45,255,72,252,247,208,131,198,
+  4,129,124,253,202,4,239,15,133,244,248,139,12,202,59,12,135,255,131,198,4,
+  129,124,253,202,4,239,15,135,244,248,255,252,242,15,16,4,199,102,15,46,4,
+  202,255,221,4,202,221,4,199,255,72,252,247,208,131,198,4,57,68,202,4,255,
+  139,108,194,4,131,198,4,129,252,253,239,255,15,131,244,247,255,15,130,244,
+  247,255,137,108,202,4,139,44,194,137,44,202,255,15,183,70,252,254,141,180,
+  253,134,233,248,1,139,6,15,182,204,15,182,232,131,198,4,193,232,16,252,255,
+  36,252,235,255,72,139,44,194,72,137,44,202,139,6,15,182,204,15,182,232,131,
+  198,4,193,232,16,252,255,36,252,235,255,49,252,237,129,124,253,194,4,239,
+  129,213,239,137,108,202,4,139,6,15,182,204,15,182,232,131,198,4,193,232,16,
+  252,255,36,252,235,255,129,124,253,194,4,239,15,135,244,48,255,252,242,15,
+  16,4,194,72,184,237,237,102,72,15,110,200,15,87,193,252,242,15,17,4,202,255,
+  221,4,194,217,224,221,28,202,255,129,124,253,194,4,239,15,133,244,248,139,
+  4,194,255,15,87,192,252,242,15,42,128,233,248,1,252,242,15,17,4,202,255,219,
+  128,233,248,1,221,28,202,255,139,6,15,182,204,15,182,232,131,198,4,193,232,
+  16,252,255,36,252,235,248,2,129,124,253,194,4,239,15,133,244,50,139,12,194,
+  137,213,232,251,1,18,255,252,242,15,42,192,137,252,234,255,15,182,78,252,
+  253,252,233,244,1,255,15,182,252,236,15,182,192,255,129,124,253,252,234,4,
+  239,15,135,244,46,255,252,242,15,16,4,252,234,252,242,15,88,4,199,255,221,
+  4,252,234,220,4,199,255,129,124,253,252,234,4,239,15,135,244,47,255,252,242,
+  15,16,4,199,252,242,15,88,4,252,234,255,221,4,199,220,4,252,234,255,129,124,
+  253,252,234,4,239,15,135,244,49,129,124,253,194,4,239,15,135,244,49,255,252,
+  242,15,16,4,252,234,252,242,15,88,4,194,255,221,4,252,234,220,4,194,255,252,
+  242,15,16,4,252,234,252,242,15,92,4,199,255,221,4,252,234,220,36,199,255,
+  252,242,15,16,4,199,252,242,15,92,4,252,234,255,221,4,199,220,36,252,234,
+  255,252,242,15,16,4,252,234,252,242,15,92,4,194,255,221,4,252,234,220,36,
+  194,255,252,242,15,16,4,252,234,252,242,15,89,4,199,255,221,4,252,234,220,
+  12,199,255,252,242,15,16,4,199,252,242,15,89,4,252,234,255,221,4,199,220,
+  12,252,234,255,252,242,15,16,4,252,234,252,242,15,89,4,194,255,221,4,252,
+  234,220,12,194,255,252,242,15,16,4,252,234,252,242,15,94,4,199,255,221,4,
+  252,234,220,52,199,255,252,242,15,16,4,199,252,242,15,94,4,252,234,255,221,
+  4,199,220,52,252,234,255,252,242,15,16,4,252,234,252,242,15,94,4,194,255,
+  221,4,252,234,220,52,194,255,252,242,15,16,4,252,234,252,242,15,16,12,199,
+  255,221,4,252,234,221,4,199,255,252,242,15,16,4,199,252,242,15,16,12,252,
+  234,255,221,4,199,221,4,252,234,255,252,242,15,16,4,252,234,252,242,15,16,
+  12,194,255,221,4,252,234,221,4,194,255,248,157,232,244,149,255,252,233,244,
+  157,255,232,244,107,255,15,182,252,236,15,182,192,139,76,36,96,137,145,233,
+  141,20,194,65,137,192,65,41,232,248,33,137,205,137,116,36,100,232,251,1,25,
+  139,149,233,133,192,15,133,244,42,15,182,110,252,255,15,182,78,252,253,72,
+  139,4,252,234,72,137,4,202,139,6,15,182,204,15,182,232,131,198,4,193,232,
+  16,252,255,36,252,235,255,72,252,247,208,139,4,135,199,68,202,4,237,137,4,
+  202,139,6,15,182,204,15,182,232,131,198,4,193,232,16,252,255,36,252,235,255,
+  15,191,192,252,242,15,42,192,252,242,15,17,4,202,255,223,70,252,254,221,28,
+  202,255,252,242,15,16,4,199,252,242,15,17,4,202,255,221,4,199,221,28,202,
+  255,72,252,247,208,137,68,202,4,139,6,15,182,204,15,182,232,131,198,4,193,
+  232,16,252,255,36,252,235,255,141,76,202,12,141,68,194,4,189,237,137,105,
+  252,248,248,1,137,41,131,193,8,57,193,15,134,244,1,139,6,15,182,204,15,182,
+  232,131,198,4,193,232,16,252,255,36,252,235,255,139,106,252,248,139,172,253,
+  133,233,139,173,233,72,139,69,0,72,137,4,202,139,6,15,182,204,15,182,232,
+  131,198,4,193,232,16,252,255,36,252,235,255,139,106,252,248,139,172,253,141,
+  233,128,189,233,0,139,173,233,139,12,194,139,68,194,4,137,77,0,137,69,4,15,
+  132,244,247,252,246,133,233,235,15,133,244,248,248,1,139,6,15,182,204,15,
+  182,232,131,198,4,193,232,16,252,255,36,252,235,248,2,129,232,239,129,252,
+  248,239,15,134,244,1,252,246,129,233,235,15,132,244,1,135,213,141,139,233,
+  255,232,251,1,26,137,252,234,252,233,244,1,255,72,252,247,208,139,106,252,
+  248,139,172,253,141,233,139,12,135,139,133,233,137,8,199,64,4,237,252,246,
+  133,233,235,15,133,244,248,248,1,139,6,15,182,204,15,182,232,131,198,4,193,
+  232,16,252,255,36,252,235,248,2,252,246,129,233,235,15,132,244,1,128,189,
+  233,0,15,132,244,1,137,213,137,194,141,139,233,232,251,1,26,137,252,234,252,
+  233,244,1,255,139,106,252,248,255,252,242,15,16,4,199,255,139,172,253,141,
+  233,139,141,233,255,252,242,15,17,1,255,221,25,255,72,252,247,208,139,106,
+  252,248,139,172,253,141,233,139,141,233,137,65,4,139,6,15,182,204,15,182,
+  232,131,198,4,193,232,16,252,255,36,252,235,255,141,180,253,134,233,139,108,
+  36,96,131,189,233,0,15,132,244,247,137,149,233,141,20,202,137,252,233,232,
+  251,1,27,139,149,233,248,1,139,6,15,182,204,15,182,232,131,198,4,193,232,
+  16,252,255,36,252,235,255,72,252,247,208,139,108,36,96,137,149,233,68,139,
+  66,252,248,139,20,135,137,252,233,137,116,36,100,232,251,1,28,139,149,233,
+  15,182,78,252,253,137,4,202,199,68,202,4,237,139,6,15,182,204,15,182,232,
+  131,198,4,193,232,16,252,255,36,252,235,255,139,108,36,96,137,149,233,139,
+  139,233,59,139,233,137,116,36,100,15,131,244,251,248,1,65,137,192,37,252,
+  255,7,0,0,65,193,232,11,61,252,255,7,0,0,15,132,244,249,248,2,137,252,233,
+  137,194,232,251,1,29,139,149,233,15,182,78,252,253,137,4,202,199,68,202,4,
+  237,139,6,15,182,204,15,182,232,131,198,4,193,232,16,252,255,36,252,235,248,
+  3,184,1,8,0,0,252,233,244,2,248,5,137,252,233,232,251,1,30,15,183,70,252,
+  254,252,233,244,1,255,72,252,247,208,139,108,36,96,139,139,233,137,116,36,
+  100,59,139,233,137,149,233,15,131,244,249,248,2,139,20,135,137,252,233,232,
+  251,1,31,139,149,233,15,182,78,252,253,137,4,202,199,68,202,4,237,139,6,15,
+  182,204,15,182,232,131,198,4,193,232,16,252,255,36,252,235,248,3,137,252,
+  233,232,251,1,30,15,183,70,252,254,72,252,247,208,252,233,244,2,255,72,252,
+  247,208,139,106,252,248,139,173,233,139,4,135,252,233,244,158,255,72,252,
+  247,208,139,106,252,248,139,173,233,139,4,135,252,233,244,159,255,15,182,
+  252,236,15,182,192,129,124,253,252,234,4,239,15,133,244,36,139,44,252,234,
+  129,124,253,194,4,239,15,135,244,251,255,252,242,15,16,4,194,252,242,15,45,
+  192,252,242,15,42,200,102,15,46,193,255,15,133,244,36,59,133,233,15,131,244,
+  36,193,224,3,3,133,233,129,120,253,4,239,15,132,244,248,72,139,40,72,137,
+  44,202,248,1,139,6,15,182,204,15,182,232,131,198,4,193,232,16,252,255,36,
+  252,235,248,2,131,189,233,0,15,132,244,249,139,141,233,252,246,129,233,235,
+  15,132,244,36,15,182,78,252,253,248,3,255,199,68,202,4,237,252,233,244,1,
+  248,5,129,124,253,194,4,239,15,133,244,36,139,4,194,252,233,244,158,255,15,
+  182,252,236,15,182,192,72,252,247,208,139,4,135,129,124,253,252,234,4,239,
+  15,133,244,34,139,44,252,234,248,158,139,141,233,35,136,233,105,201,239,3,
+  141,233,248,1,129,185,233,239,15,133,244,250,57,129,233,15,133,244,250,129,
+  121,253,4,239,15,132,244,251,15,182,70,252,253,72,139,41,72,137,44,194,248,
+  2,255,139,6,15,182,204,15,182,232,131,198,4,193,232,16,252,255,36,252,235,
+  248,3,15,182,70,252,253,199,68,194,4,237,252,233,244,2,248,4,139,137,233,
+  133,201,15,133,244,1,248,5,139,141,233,133,201,15,132,244,3,252,246,129,233,
+  235,15,133,244,3,252,233,244,34,255,15,182,252,236,15,182,192,129,124,253,
+  252,234,4,239,15,133,244,35,139,44,252,234,59,133,233,15,131,244,35,193,224,
+  3,3,133,233,129,120,253,4,239,15,132,244,248,72,139,40,72,137,44,202,248,
+  1,139,6,15,182,204,15,182,232,131,198,4,193,232,16,252,255,36,252,235,248,
+  2,131,189,233,0,15,132,244,249,139,141,233,252,246,129,233,235,15,132,244,
+  35,255,15,182,78,252,253,248,3,199,68,202,4,237,252,233,244,1,255,15,182,
+  252,236,15,182,192,129,124,253,252,234,4,239,15,133,244,39,139,44,252,234,
+  129,124,253,194,4,239,15,135,244,251,255,15,133,244,39,59,133,233,15,131,
+  244,39,193,224,3,3,133,233,129,120,253,4,239,15,132,244,249,248,1,252,246,
+  133,233,235,15,133,244,253,248,2,72,139,44,202,72,137,40,139,6,15,182,204,
+  15,182,232,131,198,4,193,232,16,252,255,36,252,235,248,3,131,189,233,0,15,
+  132,244,1,139,141,233,255,252,246,129,233,235,15,132,244,39,15,182,78,252,
+  253,252,233,244,1,248,5,129,124,253,194,4,239,15,133,244,39,139,4,194,252,
+  233,244,159,248,7,128,165,233,235,139,139,233,137,171,233,137,141,233,15,
+  182,78,252,253,252,233,244,2,255,15,182,252,236,15,182,192,72,252,247,208,
+  139,4,135,129,124,253,252,234,4,239,15,133,244,37,139,44,252,234,248,159,
+  139,141,233,35,136,233,105,201,239,198,133,233,0,3,141,233,248,1,129,185,
+  233,239,15,133,244,251,57,129,233,15,133,244,251,129,121,253,4,239,15,132,
+  244,250,248,2,255,252,246,133,233,235,15,133,244,253,248,3,15,182,70,252,
+  253,72,139,44,194,72,137,41,139,6,15,182,204,15,182,232,131,198,4,193,232,
+  16,252,255,36,252,235,248,4,131,189,233,0,15,132,244,2,137,76,36,80,139,141,
+  233,252,246,129,233,235,15,132,244,37,139,76,36,80,252,233,244,2,248,5,139,
+  137,233,133,201,15,133,244,1,255,139,141,233,133,201,15,132,244,252,252,246,
+  129,233,235,15,132,244,37,248,6,137,68,36,80,199,68,36,84,237,137,108,36,
+  32,139,76,36,96,137,145,233,76,141,68,36,80,137,252,234,137,205,137,116,36,
+  100,232,251,1,32,139,149,233,139,108,36,32,137,193,252,233,244,2,248,7,128,
+  165,233,235,139,131,233,137,171,233,137,133,233,252,233,244,3,255,15,182,
+  252,236,15,182,192,129,124,253,252,234,4,239,15,133,244,38,139,44,252,234,
+  59,133,233,15,131,244,38,193,224,3,3,133,233,129,120,253,4,239,15,132,244,
+  249,248,1,252,246,133,233,235,15,133,244,253,248,2,72,139,12,202,72,137,8,
+  139,6,15,182,204,15,182,232,131,198,4,193,232,16,252,255,36,252,235,248,3,
+  131,189,233,0,15,132,244,1,255,139,141,233,252,246,129,233,235,15,132,244,
+  38,15,182,78,252,253,252,233,244,1,248,7,128,165,233,235,139,139,233,137,
+  171,233,137,141,233,15,182,78,252,253,252,233,244,2,255,137,124,36,80,139,
+  60,199,248,1,141,12,202,139,105,252,248,252,246,133,233,235,15,133,244,253,
+  248,2,139,68,36,84,131,232,1,15,132,244,250,1,252,248,59,133,233,15,135,244,
+  251,41,252,248,193,231,3,3,189,233,248,3,72,139,41,131,193,8,72,137,47,131,
+  199,8,131,232,1,15,133,244,3,248,4,139,124,36,80,139,6,15,182,204,15,182,
+  232,131,198,4,193,232,16,252,255,36,252,235,248,5,139,76,36,96,137,145,233,
+  137,252,234,65,137,192,137,205,137,116,36,100,232,251,1,33,139,149,233,15,
+  182,78,252,253,252,233,244,1,248,7,255,128,165,233,235,139,131,233,137,171,
+  233,137,133,233,252,233,244,2,255,3,68,36,84,255,129,124,253,202,4,239,139,
+  44,202,15,133,244,51,141,84,202,8,137,114,252,252,139,181,233,139,14,15,182,
+  252,233,15,182,205,131,198,4,252,255,36,252,235,255,141,76,202,8,137,215,
+  139,105,252,248,129,121,253,252,252,239,15,133,244,28,248,52,139,114,252,
+  252,252,247,198,237,15,133,244,253,248,1,137,106,252,248,137,68,36,84,131,
+  232,1,15,132,244,249,248,2,72,139,41,131,193,8,72,137,47,131,199,8,131,232,
+  1,15,133,244,2,139,106,252,248,248,3,139,68,36,84,128,189,233,1,15,135,244,
+  251,248,4,139,181,233,139,14,15,182,252,233,15,182,205,131,198,4,252,255,
+  36,252,235,248,5,255,252,247,198,237,15,133,244,4,15,182,78,252,253,72,252,
+  247,209,141,12,202,139,121,252,248,139,191,233,139,191,233,252,233,244,4,
+  248,7,129,252,238,239,252,247,198,237,15,133,244,254,41,252,242,137,215,139,
+  114,252,252,252,233,244,1,248,8,129,198,239,252,233,244,1,255,141,76,202,
+  8,72,139,105,232,72,139,65,252,240,72,137,41,72,137,65,8,139,105,224,139,
+  65,228,137,105,252,248,137,65,252,252,129,252,248,239,184,237,15,133,244,
+  28,137,202,137,114,252,252,139,181,233,139,14,15,182,252,233,15,182,205,131,
+  198,4,252,255,36,252,235,255,137,124,36,80,137,92,36,84,139,108,202,252,240,
+  139,68,202,252,248,139,157,233,131,198,4,139,189,233,248,1,57,216,15,131,
+  244,251,129,124,253,199,4,239,15,132,244,250,255,252,242,15,42,192,255,219,
+  68,202,252,248,255,72,139,44,199,72,137,108,202,8,131,192,1,255,137,68,202,
+  252,248,248,2,139,92,36,84,139,124,36,80,255,128,126,252,252,235,15,133,244,
+  254,252,246,131,233,235,15,132,244,255,137,252,245,209,252,237,129,229,239,
+  102,131,172,253,43,233,1,15,132,244,141,248,9,255,15,183,70,252,254,141,180,
+  253,134,233,139,6,15,182,204,15,182,232,131,198,4,193,232,16,252,255,36,252,
+  235,248,3,139,92,36,84,139,124,36,80,139,6,15,182,204,15,182,232,131,198,
+  4,193,232,16,252,255,36,252,235,248,4,131,192,1,255,137,68,202,252,248,255,
+  252,233,244,1,248,5,41,216,248,6,59,133,233,15,135,244,3,105,252,248,239,
+  3,189,233,129,191,233,239,15,132,244,253,141,92,24,1,72,139,175,233,72,139,
+  135,233,72,137,44,202,72,137,68,202,8,137,92,202,252,248,252,233,244,2,248,
+  7,131,192,1,252,233,244,6,255,248,8,128,126,252,252,235,15,133,244,9,15,183,
+  70,252,254,252,233,245,255,129,124,253,202,252,236,239,15,133,244,251,139,
+  108,202,232,129,124,253,202,252,244,239,15,133,244,251,129,124,253,202,252,
+  252,239,15,133,244,251,128,189,233,235,15,133,244,251,141,180,253,134,233,
+  199,68,202,252,248,0,0,0,0,248,1,139,6,15,182,204,15,182,232,131,198,4,193,
+  232,16,252,255,36,252,235,248,5,198,70,252,252,235,141,180,253,134,233,198,
+  6,235,252,233,244,1,255,15,182,252,236,15,182,192,137,124,36,80,141,188,253,
+  194,233,141,12,202,43,122,252,252,133,252,237,15,132,244,251,141,108,252,
+  233,252,248,57,215,15,131,244,248,248,1,72,139,71,252,248,131,199,8,72,137,
+  1,131,193,8,57,252,233,15,131,244,249,57,215,15,130,244,1,248,2,199,65,4,
+  237,131,193,8,57,252,233,15,130,244,2,248,3,139,124,36,80,139,6,15,182,204,
+  15,182,232,131,198,4,193,232,16,252,255,36,252,235,248,5,199,68,36,84,1,0,
+  0,0,137,208,41,252,248,15,134,244,3,137,197,193,252,237,3,131,197,1,137,108,
+  36,84,139,108,36,96,1,200,59,133,233,15,135,244,253,248,6,255,72,139,71,252,
+  248,131,199,8,72,137,1,131,193,8,57,215,15,130,244,6,252,233,244,3,248,7,
+  137,149,233,137,141,233,137,116,36,100,41,215,139,84,36,84,131,252,234,1,
+  137,252,233,232,251,1,0,139,149,233,139,141,233,1,215,252,233,244,6,255,193,
+  225,3,255,248,1,139,114,252,252,137,68,36,84,252,247,198,237,15,133,244,253,
+  255,248,13,137,215,131,232,1,15,132,244,249,248,2,72,139,44,15,72,137,111,
+  252,248,131,199,8,131,232,1,15,133,244,2,248,3,139,68,36,84,15,182,110,252,
+  255,248,5,57,197,15,135,244,252,255,72,139,44,10,72,137,106,252,248,255,248,
+  5,56,70,252,255,15,135,244,252,255,15,182,78,252,253,72,252,247,209,141,20,
+  202,139,122,252,248,139,191,233,139,191,233,139,6,15,182,204,15,182,232,131,
+  198,4,193,232,16,252,255,36,252,235,248,6,255,199,71,252,252,237,131,199,
+  8,255,199,68,194,252,244,237,255,131,192,1,252,233,244,5,248,7,141,174,233,
+  252,247,197,237,15,133,244,14,41,252,234,255,1,252,233,255,137,252,245,209,
+  252,237,129,229,239,102,131,172,253,43,233,1,15,132,244,140,255,141,12,202,
+  255,129,121,253,4,239,15,135,244,53,129,121,253,12,239,15,135,244,53,255,
+  139,105,20,255,129,252,253,239,15,135,244,53,255,252,242,15,16,1,252,242,
+  15,16,73,8,255,252,242,15,88,65,16,252,242,15,17,1,133,252,237,15,136,244,
+  249,255,15,140,244,249,255,102,15,46,200,248,1,252,242,15,17,65,24,255,221,
+  65,8,221,1,255,220,65,16,221,17,221,81,24,133,252,237,15,136,244,247,255,
+  221,81,24,15,140,244,247,255,217,201,248,1,255,15,183,70,252,254,255,15,131,
+  244,248,141,180,253,134,233,255,141,180,253,134,233,15,183,70,252,254,15,
+  131,245,255,15,130,244,248,141,180,253,134,233,255,248,3,102,15,46,193,252,
+  233,244,1,255,141,12,202,139,105,4,129,252,253,239,15,132,244,247,255,137,
+  105,252,252,139,41,137,105,252,248,252,233,245,255,141,180,253,134,233,139,
+  1,137,105,252,252,137,65,252,248,255,139,139,233,139,4,129,72,139,128,233,
+  139,108,36,96,137,147,233,137,171,233,76,137,100,36,80,76,137,108,36,32,76,
+  137,116,36,24,76,137,124,36,16,72,137,225,72,129,252,236,239,102,15,127,49,
+  102,15,127,185,233,102,68,15,127,129,233,102,68,15,127,137,233,102,68,15,
+  127,145,233,102,68,15,127,153,233,102,68,15,127,161,233,102,68,15,127,169,
+  233,102,68,15,127,177,233,102,68,15,127,185,233,252,255,224,255,137,252,245,
+  209,252,237,129,229,239,102,131,172,253,43,233,1,15,132,244,143,255,139,190,
+  233,139,108,36,96,141,12,202,59,141,233,15,135,244,23,15,182,142,233,57,200,
+  15,134,244,249,248,2,255,248,3,199,68,194,252,252,237,131,192,1,57,200,15,
+  134,244,3,252,233,244,2,255,141,44,197,237,141,4,194,139,122,252,248,137,
+  104,252,252,137,120,252,248,139,108,36,96,141,12,200,59,141,233,15,135,244,
+  22,137,209,137,194,15,182,174,233,133,252,237,15,132,244,248,248,1,131,193,
+  8,57,209,15,131,244,249,139,121,252,248,137,56,139,121,252,252,137,120,4,
+  131,192,8,199,65,252,252,237,131,252,237,1,15,133,244,1,248,2,255,139,190,
+  233,139,6,15,182,204,15,182,232,131,198,4,193,232,16,252,255,36,252,235,255,
+  248,3,199,64,4,237,131,192,8,131,252,237,1,15,133,244,3,252,233,244,2,255,
+  139,106,252,248,72,139,189,233,139,108,36,96,141,68,194,252,248,137,149,233,
+  141,136,233,59,141,233,137,133,233,255,137,252,233,255,72,137,252,250,137,
+  252,233,255,15,135,244,21,199,131,233,237,255,252,255,215,255,252,255,147,
+  233,255,199,131,233,237,139,149,233,141,12,194,252,247,217,3,141,233,139,
+  114,252,252,252,233,244,12,255,254,0
 };
 
 enum {
@@ -838,6 +845,7 @@ enum {
   GLOB_vm_inshook,
   GLOB_cont_hook,
   GLOB_vm_hotloop,
+  GLOB_vm_hotitern,
   GLOB_vm_callhook,
   GLOB_vm_hotcall,
   GLOB_vm_exit_handler,
@@ -990,6 +998,7 @@ static const char *const globnames[] = {
   "vm_inshook",
   "cont_hook",
   "vm_hotloop",
+  "vm_hotitern",
   "vm_callhook",
   "vm_hotcall",
   "vm_exit_handler",
@@ -1366,85 +1375,89 @@ static void build_subroutines(BuildCtx *ctx, int cmov, int sse)
 #if LJ_HASJIT
   dasm_put(Dst, 6951, DISPATCH_GL(hookmask), HOOK_VMEVENT, HOOK_ACTIVE, LUA_MASKLINE|LUA_MASKCOUNT, DISPATCH_GL(hookcount));
 #endif
-  dasm_put(Dst, 6982, DISPATCH_GL(hookmask), HOOK_ACTIVE, DISPATCH_GL(hookmask), HOOK_ACTIVE, LUA_MASKLINE|LUA_MASKCOUNT, DISPATCH_GL(hookcount), LUA_MASKLINE);
-  dasm_put(Dst, 7033, Dt1(->base), Dt1(->base), GG_DISP2STATIC);
+  dasm_put(Dst, 6982, DISPATCH_GL(hookmask), HOOK_ACTIVE, DISPATCH_GL(hookmask), HOOK_ACTIVE, HOOK_PROFILE, LUA_MASKLINE|LUA_MASKCOUNT, DISPATCH_GL(hookcount));
+  dasm_put(Dst, 7031, LUA_MASKLINE, Dt1(->base), Dt1(->base), GG_DISP2STATIC);
 #if LJ_HASJIT
-  dasm_put(Dst, 7100, Dt7(->pc), PC2PROTO(framesize), Dt1(->base), Dt1(->top), GG_DISP2J, DISPATCH_J(L));
+  dasm_put(Dst, 7106, Dt7(->pc), PC2PROTO(framesize), Dt1(->base), Dt1(->top), GG_DISP2J, DISPATCH_J(L));
 #endif
-  dasm_put(Dst, 7147);
+  dasm_put(Dst, 7153);
+#if LJ_HASJIT
+  dasm_put(Dst, 7156, Dt7(->pc), PC2PROTO(framesize), Dt1(->base), Dt1(->top), GG_DISP2J, DISPATCH_J(L), Dt1(->base), -BCBIAS_J*4);
+#endif
+  dasm_put(Dst, 7231);
 #if LJ_HASJIT
   dasm_put(Dst, 6977);
 #endif
-  dasm_put(Dst, 7154);
+  dasm_put(Dst, 7238);
 #if LJ_HASJIT
-  dasm_put(Dst, 7157);
+  dasm_put(Dst, 7241);
 #endif
-  dasm_put(Dst, 7167, Dt1(->base), Dt1(->top));
+  dasm_put(Dst, 7251, Dt1(->base), Dt1(->top));
 #if LJ_HASJIT
-  dasm_put(Dst, 7201);
+  dasm_put(Dst, 7285);
 #endif
-  dasm_put(Dst, 7206, Dt1(->base), Dt1(->top));
+  dasm_put(Dst, 7290, Dt1(->base), Dt1(->top));
 #if LJ_HASJIT
-  dasm_put(Dst, 7237, DISPATCH_GL(vmstate), DISPATCH_GL(vmstate), ~LJ_VMST_EXIT, DISPATCH_J(exitno), DISPATCH_J(parent), 16*8+4*8, DISPATCH_GL(jit_L), DISPATCH_GL(jit_base), DISPATCH_J(L), DISPATCH_GL(jit_L), Dt1(->base), 4*8, GG_DISP2J, Dt1(->cframe), CFRAME_RAWMASK, CFRAME_OFS_L, Dt1(->base), CFRAME_OFS_PC);
+  dasm_put(Dst, 7321, DISPATCH_GL(vmstate), DISPATCH_GL(vmstate), ~LJ_VMST_EXIT, DISPATCH_J(exitno), DISPATCH_J(parent), 16*8+4*8, DISPATCH_GL(jit_L), DISPATCH_GL(jit_base), DISPATCH_J(L), DISPATCH_GL(jit_L), Dt1(->base), 4*8, GG_DISP2J, Dt1(->cframe), CFRAME_RAWMASK, CFRAME_OFS_L, Dt1(->base), CFRAME_OFS_PC);
 #endif
-  dasm_put(Dst, 7467);
+  dasm_put(Dst, 7551);
 #if LJ_HASJIT
-  dasm_put(Dst, 7470, 9*16+4*8, -9*16, -8*16, -7*16, -6*16, -5*16, -4*16, -3*16, -2*16, -1*16, Dt7(->pc), PC2PROTO(k), DISPATCH_GL(jit_L), DISPATCH_GL(vmstate), ~LJ_VMST_INTERP, BC_FUNCF);
-  dasm_put(Dst, 7612);
+  dasm_put(Dst, 7554, 9*16+4*8, -9*16, -8*16, -7*16, -6*16, -5*16, -4*16, -3*16, -2*16, -1*16, Dt7(->pc), PC2PROTO(k), DISPATCH_GL(jit_L), DISPATCH_GL(vmstate), ~LJ_VMST_INTERP, BC_FUNCF);
+  dasm_put(Dst, 7696);
 #endif
-  dasm_put(Dst, 7638);
+  dasm_put(Dst, 7722);
   if (!sse) {
-  dasm_put(Dst, 7641);
+  dasm_put(Dst, 7725);
   }
-  dasm_put(Dst, 7686, (unsigned int)(U64x(7fffffff,ffffffff)), (unsigned int)((U64x(7fffffff,ffffffff))>>32), (unsigned int)(U64x(43300000,00000000)), (unsigned int)((U64x(43300000,00000000))>>32), (unsigned int)(U64x(3ff00000,00000000)), (unsigned int)((U64x(3ff00000,00000000))>>32));
+  dasm_put(Dst, 7770, (unsigned int)(U64x(7fffffff,ffffffff)), (unsigned int)((U64x(7fffffff,ffffffff))>>32), (unsigned int)(U64x(43300000,00000000)), (unsigned int)((U64x(43300000,00000000))>>32), (unsigned int)(U64x(3ff00000,00000000)), (unsigned int)((U64x(3ff00000,00000000))>>32));
   if (!sse) {
-  dasm_put(Dst, 7772);
+  dasm_put(Dst, 7856);
   }
-  dasm_put(Dst, 7817, (unsigned int)(U64x(7fffffff,ffffffff)), (unsigned int)((U64x(7fffffff,ffffffff))>>32), (unsigned int)(U64x(43300000,00000000)), (unsigned int)((U64x(43300000,00000000))>>32), (unsigned int)(U64x(bff00000,00000000)), (unsigned int)((U64x(bff00000,00000000))>>32));
+  dasm_put(Dst, 7901, (unsigned int)(U64x(7fffffff,ffffffff)), (unsigned int)((U64x(7fffffff,ffffffff))>>32), (unsigned int)(U64x(43300000,00000000)), (unsigned int)((U64x(43300000,00000000))>>32), (unsigned int)(U64x(bff00000,00000000)), (unsigned int)((U64x(bff00000,00000000))>>32));
   if (!sse) {
-  dasm_put(Dst, 7903);
+  dasm_put(Dst, 7987);
   }
-  dasm_put(Dst, 7942, (unsigned int)(U64x(7fffffff,ffffffff)), (unsigned int)((U64x(7fffffff,ffffffff))>>32), (unsigned int)(U64x(43300000,00000000)), (unsigned int)((U64x(43300000,00000000))>>32), (unsigned int)(U64x(3ff00000,00000000)), (unsigned int)((U64x(3ff00000,00000000))>>32));
+  dasm_put(Dst, 8026, (unsigned int)(U64x(7fffffff,ffffffff)), (unsigned int)((U64x(7fffffff,ffffffff))>>32), (unsigned int)(U64x(43300000,00000000)), (unsigned int)((U64x(43300000,00000000))>>32), (unsigned int)(U64x(3ff00000,00000000)), (unsigned int)((U64x(3ff00000,00000000))>>32));
   if (sse) {
-    dasm_put(Dst, 8031, (unsigned int)(U64x(7fffffff,ffffffff)), (unsigned int)((U64x(7fffffff,ffffffff))>>32), (unsigned int)(U64x(43300000,00000000)), (unsigned int)((U64x(43300000,00000000))>>32), (unsigned int)(U64x(3ff00000,00000000)), (unsigned int)((U64x(3ff00000,00000000))>>32));
+    dasm_put(Dst, 8115, (unsigned int)(U64x(7fffffff,ffffffff)), (unsigned int)((U64x(7fffffff,ffffffff))>>32), (unsigned int)(U64x(43300000,00000000)), (unsigned int)((U64x(43300000,00000000))>>32), (unsigned int)(U64x(3ff00000,00000000)), (unsigned int)((U64x(3ff00000,00000000))>>32));
   } else {
-    dasm_put(Dst, 8145);
+    dasm_put(Dst, 8229);
   }
-  dasm_put(Dst, 8192);
+  dasm_put(Dst, 8276);
   if (!sse) {
   } else {
-    dasm_put(Dst, 8266);
+    dasm_put(Dst, 8350);
   }
-  dasm_put(Dst, 8269);
-  dasm_put(Dst, 8354, (unsigned int)(U64x(3ff00000,00000000)), (unsigned int)((U64x(3ff00000,00000000))>>32), (unsigned int)(U64x(3ff00000,00000000)), (unsigned int)((U64x(3ff00000,00000000))>>32));
-  dasm_put(Dst, 8455, (unsigned int)(U64x(3ff00000,00000000)), (unsigned int)((U64x(3ff00000,00000000))>>32), (unsigned int)(U64x(7fffffff,ffffffff)), (unsigned int)((U64x(7fffffff,ffffffff))>>32), (unsigned int)(U64x(3ff00000,00000000)), (unsigned int)((U64x(3ff00000,00000000))>>32), (unsigned int)(U64x(7ff00000,00000000)), (unsigned int)((U64x(7ff00000,00000000))>>32));
-  dasm_put(Dst, 8623);
+  dasm_put(Dst, 8353);
+  dasm_put(Dst, 8438, (unsigned int)(U64x(3ff00000,00000000)), (unsigned int)((U64x(3ff00000,00000000))>>32), (unsigned int)(U64x(3ff00000,00000000)), (unsigned int)((U64x(3ff00000,00000000))>>32));
+  dasm_put(Dst, 8539, (unsigned int)(U64x(3ff00000,00000000)), (unsigned int)((U64x(3ff00000,00000000))>>32), (unsigned int)(U64x(7fffffff,ffffffff)), (unsigned int)((U64x(7fffffff,ffffffff))>>32), (unsigned int)(U64x(3ff00000,00000000)), (unsigned int)((U64x(3ff00000,00000000))>>32), (unsigned int)(U64x(7ff00000,00000000)), (unsigned int)((U64x(7ff00000,00000000))>>32));
+  dasm_put(Dst, 8707);
 #if LJ_HASJIT
   if (sse) {
-    dasm_put(Dst, 8664);
-    dasm_put(Dst, 8734);
-    dasm_put(Dst, 8807);
+    dasm_put(Dst, 8748);
+    dasm_put(Dst, 8818);
+    dasm_put(Dst, 8891);
   } else {
-    dasm_put(Dst, 8857);
-    dasm_put(Dst, 8949);
+    dasm_put(Dst, 8941);
+    dasm_put(Dst, 9033);
   }
-  dasm_put(Dst, 8995);
+  dasm_put(Dst, 9079);
 #endif
-  dasm_put(Dst, 8999);
+  dasm_put(Dst, 9083);
   if (sse) {
-    dasm_put(Dst, 9002, (unsigned int)(U64x(80000000,00000000)), (unsigned int)((U64x(80000000,00000000))>>32));
-    dasm_put(Dst, 9091, (unsigned int)(U64x(7fffffff,ffffffff)), (unsigned int)((U64x(7fffffff,ffffffff))>>32));
+    dasm_put(Dst, 9086, (unsigned int)(U64x(80000000,00000000)), (unsigned int)((U64x(80000000,00000000))>>32));
+    dasm_put(Dst, 9175, (unsigned int)(U64x(7fffffff,ffffffff)), (unsigned int)((U64x(7fffffff,ffffffff))>>32));
   } else {
-    dasm_put(Dst, 9215);
-    dasm_put(Dst, 9298);
+    dasm_put(Dst, 9299);
+    dasm_put(Dst, 9382);
     if (cmov) {
-    dasm_put(Dst, 9353);
+    dasm_put(Dst, 9437);
     } else {
-    dasm_put(Dst, 9372);
+    dasm_put(Dst, 9456);
     }
-    dasm_put(Dst, 8995);
+    dasm_put(Dst, 9079);
   }
-  dasm_put(Dst, 9413);
+  dasm_put(Dst, 9497);
 }
 
 /* Generate the code for a single instruction. */
@@ -1460,616 +1473,621 @@ static void build_ins(BuildCtx *ctx, BCOp op, int defop, int cmov, int sse)
   /* Remember: all ops branch for a true comparison, fall through otherwise. */
 
   case BC_ISLT: case BC_ISGE: case BC_ISLE: case BC_ISGT:
-    dasm_put(Dst, 9439, LJ_TISNUM, LJ_TISNUM);
+    dasm_put(Dst, 9523, LJ_TISNUM, LJ_TISNUM);
     if (sse) {
-      dasm_put(Dst, 9460);
+      dasm_put(Dst, 9544);
     } else {
-      dasm_put(Dst, 9475);
+      dasm_put(Dst, 9559);
       if (cmov) {
-      dasm_put(Dst, 9485);
+      dasm_put(Dst, 9569);
       } else {
-      dasm_put(Dst, 9491);
+      dasm_put(Dst, 9575);
       }
     }
     switch (op) {
     case BC_ISLT:
-      dasm_put(Dst, 9498);
+      dasm_put(Dst, 9582);
       break;
     case BC_ISGE:
-      dasm_put(Dst, 9293);
+      dasm_put(Dst, 9377);
       break;
     case BC_ISLE:
       dasm_put(Dst, 5854);
       break;
     case BC_ISGT:
-      dasm_put(Dst, 9503);
+      dasm_put(Dst, 9587);
       break;
     default: break;  /* Shut up GCC. */
     }
-    dasm_put(Dst, 9508, -BCBIAS_J*4);
+    dasm_put(Dst, 9592, -BCBIAS_J*4);
     break;
 
   case BC_ISEQV: case BC_ISNEV:
     vk = op == BC_ISEQV;
-    dasm_put(Dst, 9542, LJ_TISNUM, LJ_TISNUM);
+    dasm_put(Dst, 9626, LJ_TISNUM, LJ_TISNUM);
     if (sse) {
-      dasm_put(Dst, 9568);
+      dasm_put(Dst, 9652);
     } else {
-      dasm_put(Dst, 9580);
+      dasm_put(Dst, 9664);
       if (cmov) {
-      dasm_put(Dst, 9485);
+      dasm_put(Dst, 9569);
       } else {
-      dasm_put(Dst, 9491);
+      dasm_put(Dst, 9575);
       }
     }
   iseqne_fp:
     if (vk) {
-      dasm_put(Dst, 9587);
+      dasm_put(Dst, 9671);
     } else {
-      dasm_put(Dst, 9596);
+      dasm_put(Dst, 9680);
     }
   iseqne_end:
     if (vk) {
-      dasm_put(Dst, 9605, -BCBIAS_J*4);
+      dasm_put(Dst, 9689, -BCBIAS_J*4);
     } else {
-      dasm_put(Dst, 9620, -BCBIAS_J*4);
+      dasm_put(Dst, 9704, -BCBIAS_J*4);
     }
-    dasm_put(Dst, 9522);
+    dasm_put(Dst, 7211);
     if (op == BC_ISEQV || op == BC_ISNEV) {
-      dasm_put(Dst, 9635, LJ_TISPRI, LJ_TISTABUD, Dt6(->metatable), Dt6(->nomm), 1<<MM_eq);
+      dasm_put(Dst, 9719, LJ_TISPRI, LJ_TISTABUD, Dt6(->metatable), Dt6(->nomm), 1<<MM_eq);
       if (vk) {
-	dasm_put(Dst, 9693);
+	dasm_put(Dst, 9777);
       } else {
-	dasm_put(Dst, 9697);
+	dasm_put(Dst, 9781);
       }
-      dasm_put(Dst, 9703);
+      dasm_put(Dst, 9787);
     }
     break;
   case BC_ISEQS: case BC_ISNES:
     vk = op == BC_ISEQS;
-    dasm_put(Dst, 9708, LJ_TSTR);
+    dasm_put(Dst, 9792, LJ_TSTR);
   iseqne_test:
     if (vk) {
-      dasm_put(Dst, 9591);
+      dasm_put(Dst, 9675);
     } else {
       dasm_put(Dst, 2772);
     }
     goto iseqne_end;
   case BC_ISEQN: case BC_ISNEN:
     vk = op == BC_ISEQN;
-    dasm_put(Dst, 9732, LJ_TISNUM);
+    dasm_put(Dst, 9816, LJ_TISNUM);
     if (sse) {
-      dasm_put(Dst, 9746);
+      dasm_put(Dst, 9830);
     } else {
-      dasm_put(Dst, 9758);
+      dasm_put(Dst, 9842);
       if (cmov) {
-      dasm_put(Dst, 9485);
+      dasm_put(Dst, 9569);
       } else {
-      dasm_put(Dst, 9491);
+      dasm_put(Dst, 9575);
       }
     }
     goto iseqne_fp;
   case BC_ISEQP: case BC_ISNEP:
     vk = op == BC_ISEQP;
-    dasm_put(Dst, 9765);
+    dasm_put(Dst, 9849);
     goto iseqne_test;
 
   /* -- Unary test and copy ops ------------------------------------------- */
 
   case BC_ISTC: case BC_ISFC: case BC_IST: case BC_ISF:
-    dasm_put(Dst, 9777, LJ_TISTRUECOND);
+    dasm_put(Dst, 9861, LJ_TISTRUECOND);
     if (op == BC_IST || op == BC_ISTC) {
-      dasm_put(Dst, 9789);
+      dasm_put(Dst, 9873);
     } else {
-      dasm_put(Dst, 9794);
+      dasm_put(Dst, 9878);
     }
     if (op == BC_ISTC || op == BC_ISFC) {
-      dasm_put(Dst, 9799);
+      dasm_put(Dst, 9883);
     }
-    dasm_put(Dst, 9810, -BCBIAS_J*4);
+    dasm_put(Dst, 9894, -BCBIAS_J*4);
     break;
 
   /* -- Unary ops --------------------------------------------------------- */
 
   case BC_MOV:
-    dasm_put(Dst, 9842);
+    dasm_put(Dst, 9926);
     break;
   case BC_NOT:
-    dasm_put(Dst, 9870, LJ_TISTRUECOND, LJ_TTRUE);
+    dasm_put(Dst, 9954, LJ_TISTRUECOND, LJ_TTRUE);
     break;
   case BC_UNM:
-    dasm_put(Dst, 9906, LJ_TISNUM);
+    dasm_put(Dst, 9990, LJ_TISNUM);
     if (sse) {
-      dasm_put(Dst, 9917, (unsigned int)(U64x(80000000,00000000)), (unsigned int)((U64x(80000000,00000000))>>32));
+      dasm_put(Dst, 10001, (unsigned int)(U64x(80000000,00000000)), (unsigned int)((U64x(80000000,00000000))>>32));
     } else {
-      dasm_put(Dst, 9942);
+      dasm_put(Dst, 10026);
     }
-    dasm_put(Dst, 9522);
+    dasm_put(Dst, 7211);
     break;
   case BC_LEN:
-    dasm_put(Dst, 9951, LJ_TSTR);
+    dasm_put(Dst, 10035, LJ_TSTR);
     if (sse) {
-      dasm_put(Dst, 9965, Dt5(->len));
+      dasm_put(Dst, 10049, Dt5(->len));
     } else {
-      dasm_put(Dst, 9983, Dt5(->len));
+      dasm_put(Dst, 10067, Dt5(->len));
     }
-    dasm_put(Dst, 9992, LJ_TTAB);
+    dasm_put(Dst, 10076, LJ_TTAB);
     if (sse) {
-      dasm_put(Dst, 10033);
+      dasm_put(Dst, 10117);
     } else {
     }
-    dasm_put(Dst, 10042);
+    dasm_put(Dst, 10126);
     break;
 
   /* -- Binary ops -------------------------------------------------------- */
 
 
   case BC_ADDVN: case BC_ADDNV: case BC_ADDVV:
-    dasm_put(Dst, 10052);
+    dasm_put(Dst, 10136);
     vk = ((int)op - BC_ADDVN) / (BC_ADDNV-BC_ADDVN);
     switch (vk) {
     case 0:
-    dasm_put(Dst, 10060, LJ_TISNUM);
+    dasm_put(Dst, 10144, LJ_TISNUM);
     if (sse) {
-    dasm_put(Dst, 10072);
+    dasm_put(Dst, 10156);
     } else {
-    dasm_put(Dst, 10086);
+    dasm_put(Dst, 10170);
     }
       break;
     case 1:
-    dasm_put(Dst, 10094, LJ_TISNUM);
+    dasm_put(Dst, 10178, LJ_TISNUM);
     if (sse) {
-    dasm_put(Dst, 10106);
+    dasm_put(Dst, 10190);
     } else {
-    dasm_put(Dst, 10120);
+    dasm_put(Dst, 10204);
     }
       break;
     default:
-    dasm_put(Dst, 10128, LJ_TISNUM, LJ_TISNUM);
+    dasm_put(Dst, 10212, LJ_TISNUM, LJ_TISNUM);
     if (sse) {
-    dasm_put(Dst, 10150);
+    dasm_put(Dst, 10234);
     } else {
-    dasm_put(Dst, 10164);
+    dasm_put(Dst, 10248);
     }
       break;
     }
     if (sse) {
-    dasm_put(Dst, 9935);
+    dasm_put(Dst, 10019);
     } else {
-    dasm_put(Dst, 9947);
+    dasm_put(Dst, 10031);
     }
-    dasm_put(Dst, 9522);
+    dasm_put(Dst, 7211);
     break;
   case BC_SUBVN: case BC_SUBNV: case BC_SUBVV:
-    dasm_put(Dst, 10052);
+    dasm_put(Dst, 10136);
     vk = ((int)op - BC_ADDVN) / (BC_ADDNV-BC_ADDVN);
     switch (vk) {
     case 0:
-    dasm_put(Dst, 10060, LJ_TISNUM);
+    dasm_put(Dst, 10144, LJ_TISNUM);
     if (sse) {
-    dasm_put(Dst, 10172);
+    dasm_put(Dst, 10256);
     } else {
-    dasm_put(Dst, 10186);
+    dasm_put(Dst, 10270);
     }
       break;
     case 1:
-    dasm_put(Dst, 10094, LJ_TISNUM);
+    dasm_put(Dst, 10178, LJ_TISNUM);
     if (sse) {
-    dasm_put(Dst, 10194);
+    dasm_put(Dst, 10278);
     } else {
-    dasm_put(Dst, 10208);
+    dasm_put(Dst, 10292);
     }
       break;
     default:
-    dasm_put(Dst, 10128, LJ_TISNUM, LJ_TISNUM);
+    dasm_put(Dst, 10212, LJ_TISNUM, LJ_TISNUM);
     if (sse) {
-    dasm_put(Dst, 10216);
+    dasm_put(Dst, 10300);
     } else {
-    dasm_put(Dst, 10230);
+    dasm_put(Dst, 10314);
     }
       break;
     }
     if (sse) {
-    dasm_put(Dst, 9935);
+    dasm_put(Dst, 10019);
     } else {
-    dasm_put(Dst, 9947);
+    dasm_put(Dst, 10031);
     }
-    dasm_put(Dst, 9522);
+    dasm_put(Dst, 7211);
     break;
   case BC_MULVN: case BC_MULNV: case BC_MULVV:
-    dasm_put(Dst, 10052);
+    dasm_put(Dst, 10136);
     vk = ((int)op - BC_ADDVN) / (BC_ADDNV-BC_ADDVN);
     switch (vk) {
     case 0:
-    dasm_put(Dst, 10060, LJ_TISNUM);
+    dasm_put(Dst, 10144, LJ_TISNUM);
     if (sse) {
-    dasm_put(Dst, 10238);
+    dasm_put(Dst, 10322);
     } else {
-    dasm_put(Dst, 10252);
+    dasm_put(Dst, 10336);
     }
       break;
     case 1:
-    dasm_put(Dst, 10094, LJ_TISNUM);
+    dasm_put(Dst, 10178, LJ_TISNUM);
     if (sse) {
-    dasm_put(Dst, 10260);
+    dasm_put(Dst, 10344);
     } else {
-    dasm_put(Dst, 10274);
+    dasm_put(Dst, 10358);
     }
       break;
     default:
-    dasm_put(Dst, 10128, LJ_TISNUM, LJ_TISNUM);
+    dasm_put(Dst, 10212, LJ_TISNUM, LJ_TISNUM);
     if (sse) {
-    dasm_put(Dst, 10282);
+    dasm_put(Dst, 10366);
     } else {
-    dasm_put(Dst, 10296);
+    dasm_put(Dst, 10380);
     }
       break;
     }
     if (sse) {
-    dasm_put(Dst, 9935);
+    dasm_put(Dst, 10019);
     } else {
-    dasm_put(Dst, 9947);
+    dasm_put(Dst, 10031);
     }
-    dasm_put(Dst, 9522);
+    dasm_put(Dst, 7211);
     break;
   case BC_DIVVN: case BC_DIVNV: case BC_DIVVV:
-    dasm_put(Dst, 10052);
+    dasm_put(Dst, 10136);
     vk = ((int)op - BC_ADDVN) / (BC_ADDNV-BC_ADDVN);
     switch (vk) {
     case 0:
-    dasm_put(Dst, 10060, LJ_TISNUM);
+    dasm_put(Dst, 10144, LJ_TISNUM);
     if (sse) {
-    dasm_put(Dst, 10304);
+    dasm_put(Dst, 10388);
     } else {
-    dasm_put(Dst, 10318);
+    dasm_put(Dst, 10402);
     }
       break;
     case 1:
-    dasm_put(Dst, 10094, LJ_TISNUM);
+    dasm_put(Dst, 10178, LJ_TISNUM);
     if (sse) {
-    dasm_put(Dst, 10326);
+    dasm_put(Dst, 10410);
     } else {
-    dasm_put(Dst, 10340);
+    dasm_put(Dst, 10424);
     }
       break;
     default:
-    dasm_put(Dst, 10128, LJ_TISNUM, LJ_TISNUM);
+    dasm_put(Dst, 10212, LJ_TISNUM, LJ_TISNUM);
     if (sse) {
-    dasm_put(Dst, 10348);
+    dasm_put(Dst, 10432);
     } else {
-    dasm_put(Dst, 10362);
+    dasm_put(Dst, 10446);
     }
       break;
     }
     if (sse) {
-    dasm_put(Dst, 9935);
+    dasm_put(Dst, 10019);
     } else {
-    dasm_put(Dst, 9947);
+    dasm_put(Dst, 10031);
     }
-    dasm_put(Dst, 9522);
+    dasm_put(Dst, 7211);
     break;
   case BC_MODVN:
-    dasm_put(Dst, 10052);
+    dasm_put(Dst, 10136);
     vk = ((int)op - BC_ADDVN) / (BC_ADDNV-BC_ADDVN);
     switch (vk) {
     case 0:
-    dasm_put(Dst, 10060, LJ_TISNUM);
+    dasm_put(Dst, 10144, LJ_TISNUM);
     if (sse) {
-    dasm_put(Dst, 10370);
+    dasm_put(Dst, 10454);
     } else {
-    dasm_put(Dst, 10384);
+    dasm_put(Dst, 10468);
     }
       break;
     case 1:
-    dasm_put(Dst, 10094, LJ_TISNUM);
+    dasm_put(Dst, 10178, LJ_TISNUM);
     if (sse) {
-    dasm_put(Dst, 10392);
+    dasm_put(Dst, 10476);
     } else {
-    dasm_put(Dst, 10406);
+    dasm_put(Dst, 10490);
     }
       break;
     default:
-    dasm_put(Dst, 10128, LJ_TISNUM, LJ_TISNUM);
+    dasm_put(Dst, 10212, LJ_TISNUM, LJ_TISNUM);
     if (sse) {
-    dasm_put(Dst, 10414);
+    dasm_put(Dst, 10498);
     } else {
-    dasm_put(Dst, 10428);
+    dasm_put(Dst, 10512);
     }
       break;
     }
-    dasm_put(Dst, 10436);
+    dasm_put(Dst, 10520);
     if (sse) {
-    dasm_put(Dst, 9935);
+    dasm_put(Dst, 10019);
     } else {
-    dasm_put(Dst, 9947);
+    dasm_put(Dst, 10031);
     }
-    dasm_put(Dst, 9522);
+    dasm_put(Dst, 7211);
     break;
   case BC_MODNV: case BC_MODVV:
-    dasm_put(Dst, 10052);
+    dasm_put(Dst, 10136);
     vk = ((int)op - BC_ADDVN) / (BC_ADDNV-BC_ADDVN);
     switch (vk) {
     case 0:
-    dasm_put(Dst, 10060, LJ_TISNUM);
+    dasm_put(Dst, 10144, LJ_TISNUM);
     if (sse) {
-    dasm_put(Dst, 10370);
+    dasm_put(Dst, 10454);
     } else {
-    dasm_put(Dst, 10384);
+    dasm_put(Dst, 10468);
     }
       break;
     case 1:
-    dasm_put(Dst, 10094, LJ_TISNUM);
+    dasm_put(Dst, 10178, LJ_TISNUM);
     if (sse) {
-    dasm_put(Dst, 10392);
+    dasm_put(Dst, 10476);
     } else {
-    dasm_put(Dst, 10406);
+    dasm_put(Dst, 10490);
     }
       break;
     default:
-    dasm_put(Dst, 10128, LJ_TISNUM, LJ_TISNUM);
+    dasm_put(Dst, 10212, LJ_TISNUM, LJ_TISNUM);
     if (sse) {
-    dasm_put(Dst, 10414);
+    dasm_put(Dst, 10498);
     } else {
-    dasm_put(Dst, 10428);
+    dasm_put(Dst, 10512);
     }
       break;
     }
-    dasm_put(Dst, 10442);
+    dasm_put(Dst, 10526);
     break;
   case BC_POW:
-    dasm_put(Dst, 10052);
+    dasm_put(Dst, 10136);
     vk = ((int)op - BC_ADDVN) / (BC_ADDNV-BC_ADDVN);
     switch (vk) {
     case 0:
-    dasm_put(Dst, 10060, LJ_TISNUM);
+    dasm_put(Dst, 10144, LJ_TISNUM);
     if (sse) {
-    dasm_put(Dst, 10370);
+    dasm_put(Dst, 10454);
     } else {
-    dasm_put(Dst, 10384);
+    dasm_put(Dst, 10468);
     }
       break;
     case 1:
-    dasm_put(Dst, 10094, LJ_TISNUM);
+    dasm_put(Dst, 10178, LJ_TISNUM);
     if (sse) {
-    dasm_put(Dst, 10392);
+    dasm_put(Dst, 10476);
     } else {
-    dasm_put(Dst, 10406);
+    dasm_put(Dst, 10490);
     }
       break;
     default:
-    dasm_put(Dst, 10128, LJ_TISNUM, LJ_TISNUM);
+    dasm_put(Dst, 10212, LJ_TISNUM, LJ_TISNUM);
     if (sse) {
-    dasm_put(Dst, 10414);
+    dasm_put(Dst, 10498);
     } else {
-    dasm_put(Dst, 10428);
+    dasm_put(Dst, 10512);
     }
       break;
     }
-    dasm_put(Dst, 10447);
+    dasm_put(Dst, 10531);
     if (sse) {
-    dasm_put(Dst, 9935);
+    dasm_put(Dst, 10019);
     } else {
-    dasm_put(Dst, 9947);
+    dasm_put(Dst, 10031);
     }
-    dasm_put(Dst, 9522);
+    dasm_put(Dst, 7211);
     break;
 
   case BC_CAT:
-    dasm_put(Dst, 10451, Dt1(->base), Dt1(->base));
+    dasm_put(Dst, 10535, Dt1(->base), Dt1(->base));
     break;
 
   /* -- Constant ops ------------------------------------------------------ */
 
   case BC_KSTR:
-    dasm_put(Dst, 10534, LJ_TSTR);
+    dasm_put(Dst, 10618, LJ_TSTR);
     break;
   case BC_KSHORT:
     if (sse) {
-      dasm_put(Dst, 10569);
+      dasm_put(Dst, 10653);
     } else {
-      dasm_put(Dst, 10584);
+      dasm_put(Dst, 10668);
     }
-    dasm_put(Dst, 9522);
+    dasm_put(Dst, 7211);
     break;
   case BC_KNUM:
     if (sse) {
-      dasm_put(Dst, 10592);
+      dasm_put(Dst, 10676);
     } else {
-      dasm_put(Dst, 10605);
+      dasm_put(Dst, 10689);
     }
-    dasm_put(Dst, 9522);
+    dasm_put(Dst, 7211);
     break;
   case BC_KPRI:
-    dasm_put(Dst, 10612);
+    dasm_put(Dst, 10696);
     break;
   case BC_KNIL:
-    dasm_put(Dst, 10640, LJ_TNIL);
+    dasm_put(Dst, 10724, LJ_TNIL);
     break;
 
   /* -- Upvalue and function ops ------------------------------------------ */
 
   case BC_UGET:
-    dasm_put(Dst, 10687, offsetof(GCfuncL, uvptr), DtA(->v));
+    dasm_put(Dst, 10771, offsetof(GCfuncL, uvptr), DtA(->v));
     break;
   case BC_USETV:
 #define TV2MARKOFS \
  ((int32_t)offsetof(GCupval, marked)-(int32_t)offsetof(GCupval, tv))
-    dasm_put(Dst, 10727, offsetof(GCfuncL, uvptr), DtA(->closed), DtA(->v), TV2MARKOFS, LJ_GC_BLACK, LJ_TISGCV, LJ_TISNUM - LJ_TISGCV, Dt4(->gch.marked), LJ_GC_WHITES, GG_DISP2G);
-    dasm_put(Dst, 10818);
+    dasm_put(Dst, 10811, offsetof(GCfuncL, uvptr), DtA(->closed), DtA(->v), TV2MARKOFS, LJ_GC_BLACK, LJ_TISGCV, LJ_TISNUM - LJ_TISGCV, Dt4(->gch.marked), LJ_GC_WHITES, GG_DISP2G);
+    dasm_put(Dst, 10902);
     break;
 #undef TV2MARKOFS
   case BC_USETS:
-    dasm_put(Dst, 10830, offsetof(GCfuncL, uvptr), DtA(->v), LJ_TSTR, DtA(->marked), LJ_GC_BLACK, Dt4(->gch.marked), LJ_GC_WHITES, DtA(->closed), GG_DISP2G);
+    dasm_put(Dst, 10914, offsetof(GCfuncL, uvptr), DtA(->v), LJ_TSTR, DtA(->marked), LJ_GC_BLACK, Dt4(->gch.marked), LJ_GC_WHITES, DtA(->closed), GG_DISP2G);
     break;
   case BC_USETN:
-    dasm_put(Dst, 10923);
+    dasm_put(Dst, 11007);
     if (sse) {
-      dasm_put(Dst, 10928);
+      dasm_put(Dst, 11012);
     } else {
-      dasm_put(Dst, 9761);
+      dasm_put(Dst, 9845);
     }
-    dasm_put(Dst, 10935, offsetof(GCfuncL, uvptr), DtA(->v));
+    dasm_put(Dst, 11019, offsetof(GCfuncL, uvptr), DtA(->v));
     if (sse) {
-      dasm_put(Dst, 10944);
+      dasm_put(Dst, 11028);
     } else {
-      dasm_put(Dst, 10950);
+      dasm_put(Dst, 11034);
     }
-    dasm_put(Dst, 9522);
+    dasm_put(Dst, 7211);
     break;
   case BC_USETP:
-    dasm_put(Dst, 10953, offsetof(GCfuncL, uvptr), DtA(->v));
+    dasm_put(Dst, 11037, offsetof(GCfuncL, uvptr), DtA(->v));
     break;
   case BC_UCLO:
-    dasm_put(Dst, 10992, -BCBIAS_J*4, Dt1(->openupval), Dt1(->base), Dt1(->base));
+    dasm_put(Dst, 11076, -BCBIAS_J*4, Dt1(->openupval), Dt1(->base), Dt1(->base));
     break;
 
   case BC_FNEW:
-    dasm_put(Dst, 11047, Dt1(->base), Dt1(->base), LJ_TFUNC);
+    dasm_put(Dst, 11131, Dt1(->base), Dt1(->base), LJ_TFUNC);
     break;
 
   /* -- Table ops --------------------------------------------------------- */
 
   case BC_TNEW:
-    dasm_put(Dst, 11113, Dt1(->base), DISPATCH_GL(gc.total), DISPATCH_GL(gc.threshold), Dt1(->base), LJ_TTAB);
+    dasm_put(Dst, 11197, Dt1(->base), DISPATCH_GL(gc.total), DISPATCH_GL(gc.threshold), Dt1(->base), LJ_TTAB);
     break;
   case BC_TDUP:
-    dasm_put(Dst, 11235, DISPATCH_GL(gc.total), DISPATCH_GL(gc.threshold), Dt1(->base), Dt1(->base), LJ_TTAB);
+    dasm_put(Dst, 11319, DISPATCH_GL(gc.total), DISPATCH_GL(gc.threshold), Dt1(->base), Dt1(->base), LJ_TTAB);
     break;
 
   case BC_GGET:
-    dasm_put(Dst, 11330, Dt7(->env));
+    dasm_put(Dst, 11414, Dt7(->env));
     break;
   case BC_GSET:
-    dasm_put(Dst, 11349, Dt7(->env));
+    dasm_put(Dst, 11433, Dt7(->env));
     break;
 
   case BC_TGETV:
-    dasm_put(Dst, 11368, LJ_TTAB, LJ_TISNUM);
+    dasm_put(Dst, 11452, LJ_TTAB, LJ_TISNUM);
     if (sse) {
-      dasm_put(Dst, 11401);
+      dasm_put(Dst, 11485);
     } else {
     }
-    dasm_put(Dst, 11422, Dt6(->asize), Dt6(->array), LJ_TNIL, Dt6(->metatable), Dt6(->metatable), Dt6(->nomm), 1<<MM_index);
-    dasm_put(Dst, 11506, LJ_TNIL, LJ_TSTR);
+    dasm_put(Dst, 11506, Dt6(->asize), Dt6(->array), LJ_TNIL, Dt6(->metatable), Dt6(->metatable), Dt6(->nomm), 1<<MM_index);
+    dasm_put(Dst, 11590, LJ_TNIL, LJ_TSTR);
     break;
   case BC_TGETS:
-    dasm_put(Dst, 11535, LJ_TTAB, Dt6(->hmask), Dt5(->hash), sizeof(Node), Dt6(->node), DtB(->key.it), LJ_TSTR, DtB(->key.gcr), LJ_TNIL);
-    dasm_put(Dst, 11619, LJ_TNIL, DtB(->next), Dt6(->metatable), Dt6(->nomm), 1<<MM_index);
+    dasm_put(Dst, 11619, LJ_TTAB, Dt6(->hmask), Dt5(->hash), sizeof(Node), Dt6(->node), DtB(->key.it), LJ_TSTR, DtB(->key.gcr), LJ_TNIL);
+    dasm_put(Dst, 11703, LJ_TNIL, DtB(->next), Dt6(->metatable), Dt6(->nomm), 1<<MM_index);
     break;
   case BC_TGETB:
-    dasm_put(Dst, 11690, LJ_TTAB, Dt6(->asize), Dt6(->array), LJ_TNIL, Dt6(->metatable), Dt6(->metatable), Dt6(->nomm), 1<<MM_index);
-    dasm_put(Dst, 11785, LJ_TNIL);
+    dasm_put(Dst, 11774, LJ_TTAB, Dt6(->asize), Dt6(->array), LJ_TNIL, Dt6(->metatable), Dt6(->metatable), Dt6(->nomm), 1<<MM_index);
+    dasm_put(Dst, 11869, LJ_TNIL);
     break;
 
   case BC_TSETV:
-    dasm_put(Dst, 11802, LJ_TTAB, LJ_TISNUM);
+    dasm_put(Dst, 11886, LJ_TTAB, LJ_TISNUM);
     if (sse) {
-      dasm_put(Dst, 11401);
+      dasm_put(Dst, 11485);
     } else {
     }
-    dasm_put(Dst, 11835, Dt6(->asize), Dt6(->array), LJ_TNIL, Dt6(->marked), LJ_GC_BLACK, Dt6(->metatable), Dt6(->metatable));
-    dasm_put(Dst, 11914, Dt6(->nomm), 1<<MM_newindex, LJ_TSTR, Dt6(->marked), cast_byte(~LJ_GC_BLACK), DISPATCH_GL(gc.grayagain), DISPATCH_GL(gc.grayagain), Dt6(->gclist));
+    dasm_put(Dst, 11919, Dt6(->asize), Dt6(->array), LJ_TNIL, Dt6(->marked), LJ_GC_BLACK, Dt6(->metatable), Dt6(->metatable));
+    dasm_put(Dst, 11998, Dt6(->nomm), 1<<MM_newindex, LJ_TSTR, Dt6(->marked), cast_byte(~LJ_GC_BLACK), DISPATCH_GL(gc.grayagain), DISPATCH_GL(gc.grayagain), Dt6(->gclist));
     break;
   case BC_TSETS:
-    dasm_put(Dst, 11976, LJ_TTAB, Dt6(->hmask), Dt5(->hash), sizeof(Node), Dt6(->nomm), Dt6(->node), DtB(->key.it), LJ_TSTR, DtB(->key.gcr), LJ_TNIL);
-    dasm_put(Dst, 12052, Dt6(->marked), LJ_GC_BLACK, Dt6(->metatable), Dt6(->metatable), Dt6(->nomm), 1<<MM_newindex, DtB(->next));
-    dasm_put(Dst, 12140, Dt6(->metatable), Dt6(->nomm), 1<<MM_newindex, LJ_TSTR, Dt1(->base), Dt1(->base), Dt6(->marked), cast_byte(~LJ_GC_BLACK), DISPATCH_GL(gc.grayagain), DISPATCH_GL(gc.grayagain), Dt6(->gclist));
+    dasm_put(Dst, 12060, LJ_TTAB, Dt6(->hmask), Dt5(->hash), sizeof(Node), Dt6(->nomm), Dt6(->node), DtB(->key.it), LJ_TSTR, DtB(->key.gcr), LJ_TNIL);
+    dasm_put(Dst, 12136, Dt6(->marked), LJ_GC_BLACK, Dt6(->metatable), Dt6(->metatable), Dt6(->nomm), 1<<MM_newindex, DtB(->next));
+    dasm_put(Dst, 12224, Dt6(->metatable), Dt6(->nomm), 1<<MM_newindex, LJ_TSTR, Dt1(->base), Dt1(->base), Dt6(->marked), cast_byte(~LJ_GC_BLACK), DISPATCH_GL(gc.grayagain), DISPATCH_GL(gc.grayagain), Dt6(->gclist));
     break;
   case BC_TSETB:
-    dasm_put(Dst, 12231, LJ_TTAB, Dt6(->asize), Dt6(->array), LJ_TNIL, Dt6(->marked), LJ_GC_BLACK, Dt6(->metatable));
-    dasm_put(Dst, 12325, Dt6(->metatable), Dt6(->nomm), 1<<MM_newindex, Dt6(->marked), cast_byte(~LJ_GC_BLACK), DISPATCH_GL(gc.grayagain), DISPATCH_GL(gc.grayagain), Dt6(->gclist));
+    dasm_put(Dst, 12315, LJ_TTAB, Dt6(->asize), Dt6(->array), LJ_TNIL, Dt6(->marked), LJ_GC_BLACK, Dt6(->metatable));
+    dasm_put(Dst, 12409, Dt6(->metatable), Dt6(->nomm), 1<<MM_newindex, Dt6(->marked), cast_byte(~LJ_GC_BLACK), DISPATCH_GL(gc.grayagain), DISPATCH_GL(gc.grayagain), Dt6(->gclist));
     break;
 
   case BC_TSETM:
-    dasm_put(Dst, 12371, Dt6(->marked), LJ_GC_BLACK, Dt6(->asize), Dt6(->array), Dt1(->base), Dt1(->base));
-    dasm_put(Dst, 12514, Dt6(->marked), cast_byte(~LJ_GC_BLACK), DISPATCH_GL(gc.grayagain), DISPATCH_GL(gc.grayagain), Dt6(->gclist));
+    dasm_put(Dst, 12455, Dt6(->marked), LJ_GC_BLACK, Dt6(->asize), Dt6(->array), Dt1(->base), Dt1(->base));
+    dasm_put(Dst, 12598, Dt6(->marked), cast_byte(~LJ_GC_BLACK), DISPATCH_GL(gc.grayagain), DISPATCH_GL(gc.grayagain), Dt6(->gclist));
     break;
 
   /* -- Calls and vararg handling ----------------------------------------- */
 
   case BC_CALL: case BC_CALLM:
-    dasm_put(Dst, 10056);
+    dasm_put(Dst, 10140);
     if (op == BC_CALLM) {
-      dasm_put(Dst, 12532);
+      dasm_put(Dst, 12616);
     }
-    dasm_put(Dst, 12537, LJ_TFUNC, Dt7(->pc));
+    dasm_put(Dst, 12621, LJ_TFUNC, Dt7(->pc));
     break;
 
   case BC_CALLMT:
-    dasm_put(Dst, 12532);
+    dasm_put(Dst, 12616);
     break;
   case BC_CALLT:
-    dasm_put(Dst, 12579, LJ_TFUNC, FRAME_TYPE, Dt7(->ffid), Dt7(->pc));
-    dasm_put(Dst, 12694, FRAME_TYPE, Dt7(->pc), PC2PROTO(k), FRAME_VARG, FRAME_TYPEP, FRAME_VARG);
+    dasm_put(Dst, 12663, LJ_TFUNC, FRAME_TYPE, Dt7(->ffid), Dt7(->pc));
+    dasm_put(Dst, 12778, FRAME_TYPE, Dt7(->pc), PC2PROTO(k), FRAME_VARG, FRAME_TYPEP, FRAME_VARG);
     break;
 
   case BC_ITERC:
-    dasm_put(Dst, 12765, LJ_TFUNC, 2+1, Dt7(->pc));
+    dasm_put(Dst, 12849, LJ_TFUNC, 2+1, Dt7(->pc));
     break;
 
   case BC_ITERN:
-#if LJ_HASJIT
-#endif
-    dasm_put(Dst, 12836, Dt6(->asize), Dt6(->array), LJ_TNIL);
+    dasm_put(Dst, 12920, Dt6(->asize), Dt6(->array), LJ_TNIL);
     if (sse) {
-      dasm_put(Dst, 12882);
+      dasm_put(Dst, 12966);
     } else {
-      dasm_put(Dst, 12888);
+      dasm_put(Dst, 12972);
     }
-    dasm_put(Dst, 12894);
+    dasm_put(Dst, 12978);
     if (sse) {
-      dasm_put(Dst, 9935);
+      dasm_put(Dst, 10019);
     } else {
-      dasm_put(Dst, 9947);
+      dasm_put(Dst, 10031);
     }
-    dasm_put(Dst, 12907, -BCBIAS_J*4);
+    dasm_put(Dst, 12991);
+#if LJ_HASJIT
+    dasm_put(Dst, 13007, BC_ITERL, DISPATCH_J(flags), JIT_F_ON, HOTCOUNT_PCMASK, GG_DISP2HOT);
+#endif
+    dasm_put(Dst, 13048, -BCBIAS_J*4);
     if (!sse) {
-      dasm_put(Dst, 12959);
+      dasm_put(Dst, 13112);
     }
-    dasm_put(Dst, 12965, Dt6(->hmask), sizeof(Node), Dt6(->node), DtB(->val.it), LJ_TNIL, DtB(->key), DtB(->val));
+    dasm_put(Dst, 13118, Dt6(->hmask), sizeof(Node), Dt6(->node), DtB(->val.it), LJ_TNIL, DtB(->key), DtB(->val));
+#if LJ_HASJIT
+    dasm_put(Dst, 13190, BC_JITERL, BC_JLOOP);
+#endif
     break;
 
   case BC_ISNEXT:
-    dasm_put(Dst, 13037, LJ_TFUNC, LJ_TTAB, LJ_TNIL, Dt8(->ffid), FF_next_N, -BCBIAS_J*4, BC_JMP, -BCBIAS_J*4, BC_ITERC);
+    dasm_put(Dst, 13210, LJ_TFUNC, LJ_TTAB, LJ_TNIL, Dt8(->ffid), FF_next_N, -BCBIAS_J*4, BC_JMP, -BCBIAS_J*4, BC_ITERC);
     break;
 
   case BC_VARG:
-    dasm_put(Dst, 13137, (8+FRAME_VARG), LJ_TNIL, Dt1(->maxstack));
-    dasm_put(Dst, 13297, Dt1(->base), Dt1(->top), Dt1(->base), Dt1(->top));
+    dasm_put(Dst, 13310, (8+FRAME_VARG), LJ_TNIL, Dt1(->maxstack));
+    dasm_put(Dst, 13470, Dt1(->base), Dt1(->top), Dt1(->base), Dt1(->top));
     break;
 
   /* -- Returns ----------------------------------------------------------- */
 
   case BC_RETM:
-    dasm_put(Dst, 12532);
+    dasm_put(Dst, 12616);
     break;
 
   case BC_RET: case BC_RET0: case BC_RET1:
     if (op != BC_RET0) {
-      dasm_put(Dst, 13363);
+      dasm_put(Dst, 13536);
     }
-    dasm_put(Dst, 13367, FRAME_TYPE);
+    dasm_put(Dst, 13540, FRAME_TYPE);
     switch (op) {
     case BC_RET:
-      dasm_put(Dst, 13386);
+      dasm_put(Dst, 13559);
       break;
     case BC_RET1:
-      dasm_put(Dst, 13438);
+      dasm_put(Dst, 13611);
       /* fallthrough */
     case BC_RET0:
-      dasm_put(Dst, 13448);
+      dasm_put(Dst, 13621);
     default:
       break;
     }
-    dasm_put(Dst, 13459, Dt7(->pc), PC2PROTO(k));
+    dasm_put(Dst, 13632, Dt7(->pc), PC2PROTO(k));
     if (op == BC_RET) {
-      dasm_put(Dst, 13503, LJ_TNIL);
+      dasm_put(Dst, 13676, LJ_TNIL);
     } else {
-      dasm_put(Dst, 13512, LJ_TNIL);
+      dasm_put(Dst, 13685, LJ_TNIL);
     }
-    dasm_put(Dst, 13519, -FRAME_VARG, FRAME_TYPEP);
+    dasm_put(Dst, 13692, -FRAME_VARG, FRAME_TYPEP);
     if (op != BC_RET0) {
-      dasm_put(Dst, 13543);
+      dasm_put(Dst, 13716);
     }
     dasm_put(Dst, 4522);
     break;
@@ -2079,7 +2097,7 @@ static void build_ins(BuildCtx *ctx, BCOp op, int defop, int cmov, int sse)
 
   case BC_FORL:
 #if LJ_HASJIT
-    dasm_put(Dst, 13547, HOTCOUNT_PCMASK, GG_DISP2HOT);
+    dasm_put(Dst, 13720, HOTCOUNT_PCMASK, GG_DISP2HOT);
 #endif
     break;
 
@@ -2091,57 +2109,57 @@ static void build_ins(BuildCtx *ctx, BCOp op, int defop, int cmov, int sse)
   case BC_FORI:
   case BC_IFORL:
     vk = (op == BC_IFORL || op == BC_JFORL);
-    dasm_put(Dst, 13568);
+    dasm_put(Dst, 13741);
     if (!vk) {
-      dasm_put(Dst, 13572, LJ_TISNUM, LJ_TISNUM);
+      dasm_put(Dst, 13745, LJ_TISNUM, LJ_TISNUM);
     }
-    dasm_put(Dst, 13591);
+    dasm_put(Dst, 13764);
     if (!vk) {
-      dasm_put(Dst, 13595, LJ_TISNUM);
+      dasm_put(Dst, 13768, LJ_TISNUM);
     }
     if (sse) {
-      dasm_put(Dst, 13604);
+      dasm_put(Dst, 13777);
       if (vk) {
-	dasm_put(Dst, 13616);
+	dasm_put(Dst, 13789);
       } else {
-	dasm_put(Dst, 13635);
+	dasm_put(Dst, 13808);
       }
-      dasm_put(Dst, 13640);
+      dasm_put(Dst, 13813);
     } else {
-      dasm_put(Dst, 13653);
+      dasm_put(Dst, 13826);
       if (vk) {
-	dasm_put(Dst, 13659);
+	dasm_put(Dst, 13832);
       } else {
-	dasm_put(Dst, 13675);
+	dasm_put(Dst, 13848);
       }
-      dasm_put(Dst, 13683);
+      dasm_put(Dst, 13856);
       if (cmov) {
-      dasm_put(Dst, 9485);
+      dasm_put(Dst, 9569);
       } else {
-      dasm_put(Dst, 9491);
+      dasm_put(Dst, 9575);
       }
       if (!cmov) {
-	dasm_put(Dst, 13688);
+	dasm_put(Dst, 13861);
       }
     }
     if (op == BC_FORI) {
-      dasm_put(Dst, 13694, -BCBIAS_J*4);
+      dasm_put(Dst, 13867, -BCBIAS_J*4);
     } else if (op == BC_JFORI) {
-      dasm_put(Dst, 13704, -BCBIAS_J*4, BC_JLOOP);
+      dasm_put(Dst, 13877, -BCBIAS_J*4, BC_JLOOP);
     } else if (op == BC_IFORL) {
-      dasm_put(Dst, 13718, -BCBIAS_J*4);
+      dasm_put(Dst, 13891, -BCBIAS_J*4);
     } else {
-      dasm_put(Dst, 13714, BC_JLOOP);
+      dasm_put(Dst, 13887, BC_JLOOP);
     }
-    dasm_put(Dst, 9520);
+    dasm_put(Dst, 9604);
     if (sse) {
-      dasm_put(Dst, 13728);
+      dasm_put(Dst, 13901);
     }
     break;
 
   case BC_ITERL:
 #if LJ_HASJIT
-    dasm_put(Dst, 13547, HOTCOUNT_PCMASK, GG_DISP2HOT);
+    dasm_put(Dst, 13720, HOTCOUNT_PCMASK, GG_DISP2HOT);
 #endif
     break;
 
@@ -2150,33 +2168,33 @@ static void build_ins(BuildCtx *ctx, BCOp op, int defop, int cmov, int sse)
     break;
 #endif
   case BC_IITERL:
-    dasm_put(Dst, 13739, LJ_TNIL);
+    dasm_put(Dst, 13912, LJ_TNIL);
     if (op == BC_JITERL) {
-      dasm_put(Dst, 13754, BC_JLOOP);
+      dasm_put(Dst, 13927, BC_JLOOP);
     } else {
-      dasm_put(Dst, 13768, -BCBIAS_J*4);
+      dasm_put(Dst, 13941, -BCBIAS_J*4);
     }
-    dasm_put(Dst, 9820);
+    dasm_put(Dst, 9904);
     break;
 
   case BC_LOOP:
 #if LJ_HASJIT
-    dasm_put(Dst, 13547, HOTCOUNT_PCMASK, GG_DISP2HOT);
+    dasm_put(Dst, 13720, HOTCOUNT_PCMASK, GG_DISP2HOT);
 #endif
     break;
 
   case BC_ILOOP:
-    dasm_put(Dst, 9522);
+    dasm_put(Dst, 7211);
     break;
 
   case BC_JLOOP:
 #if LJ_HASJIT
-    dasm_put(Dst, 13784, DISPATCH_J(trace), DtD(->mcode), DISPATCH_GL(jit_base), DISPATCH_GL(jit_L), 9*16+4*8, -1*16, -2*16, -3*16, -4*16, -5*16, -6*16, -7*16, -8*16, -9*16);
+    dasm_put(Dst, 13957, DISPATCH_J(trace), DtD(->mcode), DISPATCH_GL(jit_base), DISPATCH_GL(jit_L), 9*16+4*8, -1*16, -2*16, -3*16, -4*16, -5*16, -6*16, -7*16, -8*16, -9*16);
 #endif
     break;
 
   case BC_JMP:
-    dasm_put(Dst, 13893, -BCBIAS_J*4);
+    dasm_put(Dst, 7206, -BCBIAS_J*4);
     break;
 
   /* -- Function headers -------------------------------------------------- */
@@ -2190,7 +2208,7 @@ static void build_ins(BuildCtx *ctx, BCOp op, int defop, int cmov, int sse)
 
   case BC_FUNCF:
 #if LJ_HASJIT
-    dasm_put(Dst, 13918, HOTCOUNT_PCMASK, GG_DISP2HOT);
+    dasm_put(Dst, 14066, HOTCOUNT_PCMASK, GG_DISP2HOT);
 #endif
   case BC_FUNCV:  /* NYI: compiled vararg functions. */
     break;
@@ -2200,47 +2218,47 @@ static void build_ins(BuildCtx *ctx, BCOp op, int defop, int cmov, int sse)
     break;
 #endif
   case BC_IFUNCF:
-    dasm_put(Dst, 13939, -4+PC2PROTO(k), Dt1(->maxstack), -4+PC2PROTO(numparams));
+    dasm_put(Dst, 14087, -4+PC2PROTO(k), Dt1(->maxstack), -4+PC2PROTO(numparams));
     if (op == BC_JFUNCF) {
-      dasm_put(Dst, 13969, BC_JLOOP);
+      dasm_put(Dst, 13201, BC_JLOOP);
     } else {
-      dasm_put(Dst, 9522);
+      dasm_put(Dst, 7211);
     }
-    dasm_put(Dst, 13978, LJ_TNIL);
+    dasm_put(Dst, 14117, LJ_TNIL);
     break;
 
   case BC_JFUNCV:
 #if !LJ_HASJIT
     break;
 #endif
-    dasm_put(Dst, 8997);
+    dasm_put(Dst, 9081);
     break;  /* NYI: compiled vararg functions. */
 
   case BC_IFUNCV:
-    dasm_put(Dst, 14000, FRAME_VARG, Dt1(->maxstack), -4+PC2PROTO(numparams), LJ_TNIL);
+    dasm_put(Dst, 14139, FRAME_VARG, Dt1(->maxstack), -4+PC2PROTO(numparams), LJ_TNIL);
     if (op == BC_JFUNCV) {
-      dasm_put(Dst, 13969, BC_JLOOP);
+      dasm_put(Dst, 13201, BC_JLOOP);
     } else {
-      dasm_put(Dst, 14091, -4+PC2PROTO(k));
+      dasm_put(Dst, 14230, -4+PC2PROTO(k));
     }
-    dasm_put(Dst, 14114, LJ_TNIL);
+    dasm_put(Dst, 14253, LJ_TNIL);
     break;
 
   case BC_FUNCC:
   case BC_FUNCCW:
-    dasm_put(Dst, 14136, Dt8(->f), Dt1(->base), 8*LUA_MINSTACK, Dt1(->maxstack), Dt1(->top));
+    dasm_put(Dst, 14275, Dt8(->f), Dt1(->base), 8*LUA_MINSTACK, Dt1(->maxstack), Dt1(->top));
     if (op == BC_FUNCC) {
-      dasm_put(Dst, 14166);
+      dasm_put(Dst, 14305);
     } else {
-      dasm_put(Dst, 14170);
+      dasm_put(Dst, 14309);
     }
-    dasm_put(Dst, 14178, DISPATCH_GL(vmstate), ~LJ_VMST_C);
+    dasm_put(Dst, 14317, DISPATCH_GL(vmstate), ~LJ_VMST_C);
     if (op == BC_FUNCC) {
-      dasm_put(Dst, 14187);
+      dasm_put(Dst, 14326);
     } else {
-      dasm_put(Dst, 14191, DISPATCH_GL(wrapf));
+      dasm_put(Dst, 14330, DISPATCH_GL(wrapf));
     }
-    dasm_put(Dst, 14196, DISPATCH_GL(vmstate), ~LJ_VMST_INTERP, Dt1(->base), Dt1(->top));
+    dasm_put(Dst, 14335, DISPATCH_GL(vmstate), ~LJ_VMST_INTERP, Dt1(->base), Dt1(->top));
     break;
 
   /* ---------------------------------------------------------------------- */
@@ -2268,7 +2286,7 @@ static int build_backend(BuildCtx *ctx)
 
   build_subroutines(ctx, cmov, sse);
 
-  dasm_put(Dst, 14221);
+  dasm_put(Dst, 14360);
   for (op = 0; op < BC__MAX; op++)
     build_ins(ctx, (BCOp)op, op, cmov, sse);
 
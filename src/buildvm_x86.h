@@ -12,7 +12,7 @@
 #define DASM_SECTION_CODE_OP	0
 #define DASM_SECTION_CODE_SUB	1
 #define DASM_MAXSECTION		2
-static const unsigned char build_actionlist[15591] = {
+static const unsigned char build_actionlist[15728] = {
   254,1,248,10,252,247,198,237,15,132,244,11,131,230,252,248,41,252,242,141,
   76,49,252,248,139,114,252,252,199,68,10,4,237,248,12,131,192,1,137,68,36,
   20,252,247,198,237,15,132,244,13,248,14,129,252,246,239,252,247,198,237,15,
@@ -402,49 +402,53 @@ static const unsigned char build_actionlist[15591] = {
   131,233,168,235,15,133,244,251,168,235,15,133,244,247,168,235,15,132,244,
   247,252,255,139,233,252,233,244,247,255,248,137,15,182,131,233,168,235,15,
   133,244,251,252,233,244,247,248,138,15,182,131,233,168,235,15,133,244,251,
-  168,235,15,132,244,251,252,255,139,233,15,132,244,247,168,235,15,132,244,
-  251,248,1,255,139,108,36,48,137,149,233,137,252,242,137,252,233,232,251,1,
-  20,248,3,139,149,233,248,4,15,182,78,252,253,248,5,15,182,110,252,252,15,
-  183,70,252,254,252,255,164,253,171,233,248,139,131,198,4,139,77,232,137,76,
-  36,20,252,233,244,4,248,140,255,139,106,252,248,139,173,233,15,182,133,233,
-  141,4,194,139,108,36,48,137,149,233,137,133,233,137,252,242,141,139,233,137,
-  171,233,137,116,36,24,232,251,1,21,252,233,244,3,255,248,141,137,116,36,24,
-  255,248,142,255,137,116,36,24,131,206,1,248,1,255,141,68,194,252,248,139,
-  108,36,48,137,149,233,137,133,233,137,252,242,137,252,233,232,251,1,22,199,
-  68,36,24,0,0,0,0,255,131,230,252,254,255,139,149,233,137,193,139,133,233,
-  41,208,137,205,15,182,78,252,253,193,232,3,131,192,1,252,255,229,248,143,
-  255,85,141,108,36,12,85,83,82,81,80,15,182,69,252,252,138,101,252,248,137,
-  125,252,252,137,117,252,248,139,93,0,139,139,233,199,131,233,237,137,131,
-  233,137,139,233,129,252,236,239,252,242,15,17,125,216,252,242,15,17,117,208,
-  252,242,15,17,109,200,252,242,15,17,101,192,252,242,15,17,93,184,252,242,
-  15,17,85,176,252,242,15,17,77,168,252,242,15,17,69,160,139,171,233,139,147,
-  233,137,171,233,199,131,233,0,0,0,0,137,149,233,141,84,36,16,141,139,233,
-  232,251,1,23,139,141,233,129,225,239,137,204,137,169,233,139,149,233,139,
-  177,233,255,248,144,255,133,192,15,136,244,249,137,68,36,20,139,122,252,248,
-  139,191,233,139,191,233,199,131,233,0,0,0,0,199,131,233,237,139,6,15,182,
-  204,15,182,232,131,198,4,193,232,16,129,252,253,239,15,130,244,248,139,68,
-  36,20,248,2,252,255,36,171,248,3,252,247,216,137,252,233,137,194,232,251,
-  1,24,255,248,82,255,217,124,36,4,137,68,36,8,102,184,0,4,102,11,68,36,4,102,
-  37,252,255,252,247,102,137,68,36,6,217,108,36,6,217,252,252,217,108,36,4,
-  139,68,36,8,195,255,248,145,102,15,252,239,210,102,15,118,210,102,15,115,
-  210,1,184,0,0,48,67,102,15,110,216,102,15,112,219,81,15,40,200,102,15,84,
-  202,102,15,46,217,15,134,244,247,102,15,85,208,252,242,15,88,203,252,242,
+  168,235,15,133,244,247,168,235,15,132,244,251,252,255,139,233,15,132,244,
+  247,255,168,235,15,132,244,251,248,1,139,108,36,48,137,149,233,137,252,242,
+  137,252,233,232,251,1,20,248,3,139,149,233,248,4,15,182,78,252,253,248,5,
+  15,182,110,252,252,15,183,70,252,254,252,255,164,253,171,233,248,139,131,
+  198,4,139,77,232,137,76,36,20,252,233,244,4,248,140,255,139,106,252,248,139,
+  173,233,15,182,133,233,141,4,194,139,108,36,48,137,149,233,137,133,233,137,
+  252,242,141,139,233,137,171,233,137,116,36,24,232,251,1,21,252,233,244,3,
+  255,248,141,255,139,106,252,248,139,173,233,15,182,133,233,141,4,194,139,
+  108,36,48,137,149,233,137,133,233,137,252,242,141,139,233,137,171,233,137,
+  116,36,24,232,251,1,21,139,149,233,15,183,70,252,254,141,180,253,134,233,
+  139,6,15,182,204,15,182,232,131,198,4,193,232,16,252,255,36,171,255,248,142,
+  137,116,36,24,255,248,143,255,137,116,36,24,131,206,1,248,1,255,141,68,194,
+  252,248,139,108,36,48,137,149,233,137,133,233,137,252,242,137,252,233,232,
+  251,1,22,199,68,36,24,0,0,0,0,255,131,230,252,254,255,139,149,233,137,193,
+  139,133,233,41,208,137,205,15,182,78,252,253,193,232,3,131,192,1,252,255,
+  229,248,144,255,85,141,108,36,12,85,83,82,81,80,15,182,69,252,252,138,101,
+  252,248,137,125,252,252,137,117,252,248,139,93,0,139,139,233,199,131,233,
+  237,137,131,233,137,139,233,129,252,236,239,252,242,15,17,125,216,252,242,
+  15,17,117,208,252,242,15,17,109,200,252,242,15,17,101,192,252,242,15,17,93,
+  184,252,242,15,17,85,176,252,242,15,17,77,168,252,242,15,17,69,160,139,171,
+  233,139,147,233,137,171,233,199,131,233,0,0,0,0,137,149,233,141,84,36,16,
+  141,139,233,232,251,1,23,139,141,233,129,225,239,137,204,137,169,233,139,
+  149,233,139,177,233,255,248,145,255,133,192,15,136,244,249,137,68,36,20,139,
+  122,252,248,139,191,233,139,191,233,199,131,233,0,0,0,0,199,131,233,237,139,
+  6,15,182,204,15,182,232,131,198,4,193,232,16,129,252,253,239,15,130,244,248,
+  139,68,36,20,248,2,252,255,36,171,248,3,252,247,216,137,252,233,137,194,232,
+  251,1,24,255,248,82,255,217,124,36,4,137,68,36,8,102,184,0,4,102,11,68,36,
+  4,102,37,252,255,252,247,102,137,68,36,6,217,108,36,6,217,252,252,217,108,
+  36,4,139,68,36,8,195,255,248,146,102,15,252,239,210,102,15,118,210,102,15,
+  115,210,1,184,0,0,48,67,102,15,110,216,102,15,112,219,81,15,40,200,102,15,
+  84,202,102,15,46,217,15,134,244,247,102,15,85,208,252,242,15,88,203,252,242,
   15,92,203,102,15,86,202,184,0,0,252,240,63,102,15,110,208,102,15,112,210,
   81,252,242,15,194,193,1,102,15,84,194,252,242,15,92,200,15,40,193,248,1,195,
   248,84,255,217,124,36,4,137,68,36,8,102,184,0,8,102,11,68,36,4,102,37,252,
   255,252,251,102,137,68,36,6,217,108,36,6,217,252,252,217,108,36,4,139,68,
-  36,8,195,255,248,146,102,15,252,239,210,102,15,118,210,102,15,115,210,1,184,
+  36,8,195,255,248,147,102,15,252,239,210,102,15,118,210,102,15,115,210,1,184,
   0,0,48,67,102,15,110,216,102,15,112,219,81,15,40,200,102,15,84,202,102,15,
   46,217,15,134,244,247,102,15,85,208,252,242,15,88,203,252,242,15,92,203,102,
   15,86,202,184,0,0,252,240,191,102,15,110,208,102,15,112,210,81,252,242,15,
   194,193,6,102,15,84,194,252,242,15,92,200,15,40,193,248,1,195,248,104,255,
   217,124,36,4,137,68,36,8,102,184,0,12,102,11,68,36,4,102,137,68,36,6,217,
-  108,36,6,217,252,252,217,108,36,4,139,68,36,8,195,255,248,147,102,15,252,
+  108,36,6,217,252,252,217,108,36,4,139,68,36,8,195,255,248,148,102,15,252,
   239,210,102,15,118,210,102,15,115,210,1,184,0,0,48,67,102,15,110,216,102,
   15,112,219,81,15,40,200,102,15,84,202,102,15,46,217,15,134,244,247,102,15,
   85,208,15,40,193,252,242,15,88,203,252,242,15,92,203,184,0,0,252,240,63,102,
   15,110,216,102,15,112,219,81,252,242,15,194,193,1,102,15,84,195,252,242,15,
-  92,200,102,15,86,202,15,40,193,248,1,195,248,148,255,15,40,232,252,242,15,
+  92,200,102,15,86,202,15,40,193,248,1,195,248,149,255,15,40,232,252,242,15,
   94,193,102,15,252,239,210,102,15,118,210,102,15,115,210,1,184,0,0,48,67,102,
   15,110,216,102,15,112,219,81,15,40,224,102,15,84,226,102,15,46,220,15,134,
   244,247,102,15,85,208,252,242,15,88,227,252,242,15,92,227,102,15,86,226,184,
@@ -453,8 +457,8 @@ static const unsigned char build_actionlist[15591] = {
   195,248,1,252,242,15,89,200,15,40,197,252,242,15,92,193,195,255,217,193,216,
   252,241,217,124,36,4,102,184,0,4,102,11,68,36,4,102,37,252,255,252,247,102,
   137,68,36,6,217,108,36,6,217,252,252,217,108,36,4,222,201,222,252,233,195,
-  255,248,88,217,252,234,222,201,248,149,217,84,36,4,129,124,36,4,0,0,128,127,
-  15,132,244,247,129,124,36,4,0,0,128,252,255,15,132,244,248,248,150,217,192,
+  255,248,88,217,252,234,222,201,248,150,217,84,36,4,129,124,36,4,0,0,128,127,
+  15,132,244,247,129,124,36,4,0,0,128,252,255,15,132,244,248,248,151,217,192,
   217,252,252,220,252,233,217,201,217,252,240,217,232,222,193,217,252,253,221,
   217,248,1,195,248,2,221,216,217,252,238,195,255,248,107,219,84,36,4,219,68,
   36,4,255,223,252,233,255,221,252,233,223,224,158,255,15,133,244,254,15,138,
@@ -465,14 +469,14 @@ static const unsigned char build_actionlist[15591] = {
   222,252,241,252,247,216,131,252,248,1,15,132,244,5,252,233,244,1,248,7,221,
   216,217,232,195,248,8,217,84,36,4,217,201,217,84,36,8,139,68,36,4,209,224,
   61,0,0,0,252,255,15,132,244,248,139,68,36,8,209,224,15,132,244,250,61,0,0,
-  0,252,255,15,132,244,250,217,252,241,252,233,244,150,248,9,255,217,232,255,
+  0,252,255,15,132,244,250,217,252,241,252,233,244,151,248,9,255,217,232,255,
   223,252,234,255,221,252,234,223,224,158,255,15,132,244,247,217,201,248,1,
   221,216,195,248,2,217,225,217,232,255,15,132,244,249,221,216,217,225,217,
   252,238,184,0,0,0,0,15,146,208,209,200,51,68,36,4,15,137,244,249,217,201,
   248,3,221,217,217,225,195,248,4,131,124,36,4,0,15,141,244,3,221,216,221,216,
   133,192,15,132,244,251,217,252,238,195,248,5,199,68,36,4,0,0,128,127,217,
-  68,36,4,195,255,248,107,255,248,151,252,242,15,45,193,252,242,15,42,208,102,
-  15,46,202,15,133,244,254,15,138,244,255,248,152,131,252,248,1,15,142,244,
+  68,36,4,195,255,248,107,255,248,152,252,242,15,45,193,252,242,15,42,208,102,
+  15,46,202,15,133,244,254,15,138,244,255,248,153,131,252,248,1,15,142,244,
   252,248,1,169,1,0,0,0,15,133,244,248,252,242,15,89,192,209,232,252,233,244,
   1,248,2,209,232,15,132,244,251,15,40,200,248,3,252,242,15,89,192,209,232,
   15,132,244,250,15,131,244,3,255,252,242,15,89,200,252,233,244,3,248,4,252,
@@ -491,29 +495,29 @@ static const unsigned char build_actionlist[15591] = {
   102,15,112,210,81,102,15,46,194,15,132,244,1,102,15,80,193,15,87,192,136,
   196,15,146,208,48,224,15,133,244,1,248,3,184,0,0,252,240,127,102,15,110,192,
   102,15,112,192,81,195,248,4,102,15,80,193,133,192,15,133,244,3,255,15,87,
-  192,195,248,5,102,15,80,193,133,192,15,132,244,3,15,87,192,195,248,153,255,
+  192,195,248,5,102,15,80,193,133,192,15,132,244,3,15,87,192,195,248,154,255,
   139,68,36,12,252,242,15,16,68,36,4,131,252,248,1,15,132,244,247,15,135,244,
   248,232,244,82,252,233,244,253,248,1,232,244,84,252,233,244,253,248,2,131,
   252,248,3,15,132,244,247,15,135,244,248,232,244,104,255,252,233,244,253,248,
   1,252,242,15,81,192,248,7,252,242,15,17,68,36,4,221,68,36,4,195,248,2,221,
-  68,36,4,131,252,248,5,15,130,244,88,15,132,244,149,248,2,131,252,248,7,15,
+  68,36,4,131,252,248,5,15,130,244,88,15,132,244,150,248,2,131,252,248,7,15,
   132,244,247,15,135,244,248,217,252,237,217,201,217,252,241,195,248,1,217,
   232,217,201,217,252,241,195,248,2,131,252,248,9,15,132,244,247,15,135,244,
   248,255,217,252,236,217,201,217,252,241,195,248,1,217,252,254,195,248,2,131,
   252,248,11,15,132,244,247,15,135,244,255,217,252,255,195,248,1,217,252,242,
   221,216,195,255,139,68,36,12,221,68,36,4,131,252,248,1,15,130,244,82,15,132,
   244,84,131,252,248,3,15,130,244,104,15,135,244,248,217,252,250,195,248,2,
-  131,252,248,5,15,130,244,88,15,132,244,149,131,252,248,7,15,132,244,247,15,
+  131,252,248,5,15,130,244,88,15,132,244,150,131,252,248,7,15,132,244,247,15,
   135,244,248,217,252,237,217,201,217,252,241,195,248,1,217,232,217,201,217,
   252,241,195,248,2,131,252,248,9,15,132,244,247,255,15,135,244,248,217,252,
   236,217,201,217,252,241,195,248,1,217,252,254,195,248,2,131,252,248,11,15,
   132,244,247,15,135,244,255,217,252,255,195,248,1,217,252,242,221,216,195,
-  255,248,9,204,255,248,154,255,139,68,36,20,252,242,15,16,68,36,4,252,242,
+  255,248,9,204,255,248,155,255,139,68,36,20,252,242,15,16,68,36,4,252,242,
   15,16,76,36,12,131,252,248,1,15,132,244,247,15,135,244,248,252,242,15,88,
   193,248,7,252,242,15,17,68,36,4,221,68,36,4,195,248,1,252,242,15,92,193,252,
   233,244,7,248,2,131,252,248,3,15,132,244,247,15,135,244,248,252,242,15,89,
   193,252,233,244,7,248,1,252,242,15,94,193,252,233,244,7,248,2,131,252,248,
-  5,15,132,244,247,255,15,135,244,248,232,244,148,252,233,244,7,248,1,90,232,
+  5,15,132,244,247,255,15,135,244,248,232,244,149,252,233,244,7,248,1,90,232,
   244,107,82,252,233,244,7,248,2,131,252,248,7,15,132,244,247,15,135,244,248,
   184,0,0,0,128,102,15,110,200,102,15,112,201,81,15,87,193,252,233,244,7,248,
   1,102,15,252,239,201,102,15,118,201,102,15,115,209,1,15,84,193,252,233,244,
@@ -523,14 +527,14 @@ static const unsigned char build_actionlist[15591] = {
   1,252,242,15,95,193,252,233,244,7,248,9,204,255,139,68,36,20,221,68,36,4,
   221,68,36,12,131,252,248,1,15,132,244,247,15,135,244,248,222,193,195,248,
   1,222,252,233,195,248,2,131,252,248,3,15,132,244,247,15,135,244,248,222,201,
-  195,248,1,222,252,249,195,248,2,131,252,248,5,15,130,244,148,15,132,244,107,
+  195,248,1,222,252,249,195,248,2,131,252,248,5,15,130,244,149,15,132,244,107,
   131,252,248,7,15,132,244,247,15,135,244,248,255,221,216,217,224,195,248,1,
   221,216,217,225,195,248,2,131,252,248,9,15,132,244,247,15,135,244,248,217,
   252,243,195,248,1,217,201,217,252,253,221,217,195,248,2,131,252,248,11,15,
   132,244,247,15,135,244,255,255,219,252,233,219,209,221,217,195,248,1,219,
   252,233,218,209,221,217,195,255,221,225,223,224,252,246,196,1,15,132,244,
   248,217,201,248,2,221,216,195,248,1,221,225,223,224,252,246,196,1,15,133,
-  244,248,217,201,248,2,221,216,195,255,248,155,156,90,137,209,129,252,242,
+  244,248,217,201,248,2,221,216,195,255,248,156,156,90,137,209,129,252,242,
   0,0,32,0,82,157,156,90,49,192,57,209,15,132,244,247,139,68,36,4,87,83,15,
   162,139,124,36,16,137,7,137,95,4,137,79,8,137,87,12,91,95,248,1,195,255,249,
   255,129,124,253,202,4,239,15,135,244,41,129,124,253,194,4,239,15,135,244,
@@ -581,8 +585,8 @@ static const unsigned char build_actionlist[15591] = {
   221,4,252,234,220,52,194,255,252,242,15,16,4,252,234,252,242,15,16,12,199,
   255,221,4,252,234,221,4,199,255,252,242,15,16,4,199,252,242,15,16,12,252,
   234,255,221,4,199,221,4,252,234,255,252,242,15,16,4,252,234,252,242,15,16,
-  12,194,255,221,4,252,234,221,4,194,255,248,156,232,244,148,255,252,233,244,
-  156,255,232,244,107,255,15,182,252,236,15,182,192,141,12,194,41,232,137,76,
+  12,194,255,221,4,252,234,221,4,194,255,248,157,232,244,149,255,252,233,244,
+  157,255,232,244,107,255,15,182,252,236,15,182,192,141,12,194,41,232,137,76,
   36,4,137,68,36,8,248,33,139,108,36,48,137,44,36,137,149,233,137,116,36,24,
   232,251,1,25,139,149,233,133,192,15,133,244,42,15,182,110,252,255,15,182,
   78,252,253,139,68,252,234,4,139,44,252,234,137,68,202,4,137,44,202,139,6,
@@ -625,8 +629,8 @@ static const unsigned char build_actionlist[15591] = {
   20,135,137,252,233,232,251,1,31,139,149,233,15,182,78,252,253,137,4,202,199,
   68,202,4,237,139,6,15,182,204,15,182,232,131,198,4,193,232,16,252,255,36,
   171,248,3,137,252,233,232,251,1,30,15,183,70,252,254,252,247,208,252,233,
-  244,2,255,252,247,208,139,106,252,248,139,173,233,139,4,135,252,233,244,157,
-  255,252,247,208,139,106,252,248,139,173,233,139,4,135,252,233,244,158,255,
+  244,2,255,252,247,208,139,106,252,248,139,173,233,139,4,135,252,233,244,158,
+  255,252,247,208,139,106,252,248,139,173,233,139,4,135,252,233,244,159,255,
   15,182,252,236,15,182,192,129,124,253,252,234,4,239,15,133,244,36,139,44,
   252,234,129,124,253,194,4,239,15,135,244,251,255,252,242,15,16,4,194,252,
   242,15,45,192,252,242,15,42,200,102,15,46,193,255,221,4,194,219,20,36,219,
@@ -635,9 +639,9 @@ static const unsigned char build_actionlist[15591] = {
   6,15,182,204,15,182,232,131,198,4,193,232,16,252,255,36,171,248,2,131,189,
   233,0,15,132,244,249,139,141,233,252,246,129,233,235,15,132,244,36,15,182,
   78,252,253,248,3,255,199,68,202,4,237,252,233,244,1,248,5,129,124,253,194,
-  4,239,15,133,244,36,139,4,194,252,233,244,157,255,15,182,252,236,15,182,192,
+  4,239,15,133,244,36,139,4,194,252,233,244,158,255,15,182,252,236,15,182,192,
   252,247,208,139,4,135,129,124,253,252,234,4,239,15,133,244,34,139,44,252,
-  234,248,157,139,141,233,35,136,233,105,201,239,3,141,233,248,1,129,185,233,
+  234,248,158,139,141,233,35,136,233,105,201,239,3,141,233,248,1,129,185,233,
   239,15,133,244,250,57,129,233,15,133,244,250,129,121,253,4,239,15,132,244,
   251,15,182,70,252,253,139,41,139,73,4,137,44,194,137,76,194,4,248,2,255,139,
   6,15,182,204,15,182,232,131,198,4,193,232,16,252,255,36,171,248,3,15,182,
@@ -656,10 +660,10 @@ static const unsigned char build_actionlist[15591] = {
   139,6,15,182,204,15,182,232,131,198,4,193,232,16,252,255,36,171,248,3,131,
   189,233,0,15,132,244,1,139,141,233,255,252,246,129,233,235,15,132,244,39,
   15,182,78,252,253,252,233,244,1,248,5,129,124,253,194,4,239,15,133,244,39,
-  139,4,194,252,233,244,158,248,7,128,165,233,235,139,139,233,137,171,233,137,
+  139,4,194,252,233,244,159,248,7,128,165,233,235,139,139,233,137,171,233,137,
   141,233,15,182,78,252,253,252,233,244,2,255,15,182,252,236,15,182,192,252,
   247,208,139,4,135,129,124,253,252,234,4,239,15,133,244,37,139,44,252,234,
-  248,158,139,141,233,35,136,233,105,201,239,198,133,233,0,3,141,233,248,1,
+  248,159,139,141,233,35,136,233,105,201,239,198,133,233,0,3,141,233,248,1,
   129,185,233,239,15,133,244,251,57,129,233,15,133,244,251,129,121,253,4,239,
   15,132,244,250,248,2,255,252,246,133,233,235,15,133,244,253,248,3,15,182,
   70,252,253,139,108,194,4,139,4,194,137,105,4,137,1,139,6,15,182,204,15,182,
@@ -704,68 +708,71 @@ static const unsigned char build_actionlist[15591] = {
   108,202,252,240,139,68,202,252,248,139,157,233,131,198,4,139,189,233,248,
   1,57,216,15,131,244,251,129,124,253,199,4,239,15,132,244,250,255,252,242,
   15,42,192,255,219,68,202,252,248,255,139,108,199,4,137,108,202,12,139,44,
-  199,137,108,202,8,131,192,1,255,137,68,202,252,248,248,2,15,183,70,252,254,
-  141,180,253,134,233,248,3,139,92,36,20,139,124,36,16,139,6,15,182,204,15,
-  182,232,131,198,4,193,232,16,252,255,36,171,248,4,131,192,1,255,137,68,202,
-  252,248,255,252,233,244,1,248,5,41,216,248,6,59,133,233,15,135,244,3,105,
-  252,248,239,3,189,233,129,191,233,239,15,132,244,253,141,92,24,1,139,175,
-  233,139,135,233,137,44,202,137,68,202,4,139,175,233,139,135,233,137,108,202,
-  8,137,68,202,12,137,92,202,252,248,252,233,244,2,248,7,255,131,192,1,252,
-  233,244,6,255,129,124,253,202,252,236,239,15,133,244,251,139,108,202,232,
-  129,124,253,202,252,244,239,15,133,244,251,129,124,253,202,252,252,239,15,
-  133,244,251,128,189,233,235,15,133,244,251,141,180,253,134,233,199,68,202,
-  252,248,0,0,0,0,248,1,139,6,15,182,204,15,182,232,131,198,4,193,232,16,252,
-  255,36,171,248,5,198,70,252,252,235,141,180,253,134,233,198,6,235,252,233,
-  244,1,255,15,182,252,236,15,182,192,137,124,36,16,141,188,253,194,233,141,
-  12,202,43,122,252,252,133,252,237,15,132,244,251,141,108,252,233,252,248,
-  57,215,15,131,244,248,248,1,139,71,252,248,137,1,139,71,252,252,131,199,8,
-  137,65,4,131,193,8,57,252,233,15,131,244,249,57,215,15,130,244,1,248,2,199,
-  65,4,237,131,193,8,57,252,233,15,130,244,2,248,3,139,124,36,16,139,6,15,182,
-  204,15,182,232,131,198,4,193,232,16,252,255,36,171,248,5,199,68,36,20,1,0,
-  0,0,137,208,41,252,248,15,134,244,3,137,197,193,252,237,3,131,197,1,137,108,
-  36,20,139,108,36,48,1,200,59,133,233,15,135,244,253,248,6,255,139,71,252,
-  248,137,1,139,71,252,252,131,199,8,137,65,4,131,193,8,57,215,15,130,244,6,
-  252,233,244,3,248,7,137,149,233,137,141,233,137,116,36,24,41,215,139,84,36,
-  20,131,252,234,1,137,252,233,232,251,1,0,139,149,233,139,141,233,1,215,252,
-  233,244,6,255,193,225,3,255,248,1,139,114,252,252,137,68,36,20,252,247,198,
-  237,15,133,244,253,255,248,13,137,215,131,232,1,15,132,244,249,248,2,139,
-  44,15,137,111,252,248,139,108,15,4,137,111,252,252,131,199,8,131,232,1,15,
-  133,244,2,248,3,139,68,36,20,15,182,110,252,255,248,5,57,197,15,135,244,252,
-  255,139,108,10,4,137,106,252,252,139,44,10,137,106,252,248,255,248,5,56,70,
-  252,255,15,135,244,252,255,15,182,78,252,253,252,247,209,141,20,202,139,122,
-  252,248,139,191,233,139,191,233,139,6,15,182,204,15,182,232,131,198,4,193,
-  232,16,252,255,36,171,248,6,255,199,71,252,252,237,131,199,8,255,199,68,194,
-  252,244,237,255,131,192,1,252,233,244,5,248,7,141,174,233,252,247,197,237,
-  15,133,244,14,41,252,234,255,1,252,233,255,137,252,245,209,252,237,129,229,
-  239,102,131,172,253,43,233,1,15,132,244,140,255,141,12,202,255,129,121,253,
-  4,239,15,135,244,53,129,121,253,12,239,15,135,244,53,255,139,105,20,255,129,
-  252,253,239,15,135,244,53,255,252,242,15,16,1,252,242,15,16,73,8,255,252,
-  242,15,88,65,16,252,242,15,17,1,133,252,237,15,136,244,249,255,15,140,244,
-  249,255,102,15,46,200,248,1,252,242,15,17,65,24,255,221,65,8,221,1,255,220,
-  65,16,221,17,221,81,24,133,252,237,15,136,244,247,255,221,81,24,15,140,244,
-  247,255,217,201,248,1,255,15,183,70,252,254,255,15,131,244,248,141,180,253,
-  134,233,255,141,180,253,134,233,15,183,70,252,254,15,131,245,255,15,130,244,
-  248,141,180,253,134,233,255,248,3,102,15,46,193,252,233,244,1,255,141,12,
-  202,139,105,4,129,252,253,239,15,132,244,247,255,137,105,252,252,139,41,137,
-  105,252,248,252,233,245,255,141,180,253,134,233,139,1,137,105,252,252,137,
-  65,252,248,255,139,139,233,139,4,129,139,128,233,139,108,36,48,137,147,233,
-  137,171,233,252,255,224,255,141,180,253,134,233,139,6,15,182,204,15,182,232,
-  131,198,4,193,232,16,252,255,36,171,255,137,252,245,209,252,237,129,229,239,
-  102,131,172,253,43,233,1,15,132,244,142,255,139,190,233,139,108,36,48,141,
-  12,202,59,141,233,15,135,244,23,15,182,142,233,57,200,15,134,244,249,248,
-  2,255,15,183,70,252,254,252,233,245,255,248,3,199,68,194,252,252,237,131,
-  192,1,57,200,15,134,244,3,252,233,244,2,255,141,44,197,237,141,4,194,139,
-  122,252,248,137,104,252,252,137,120,252,248,139,108,36,48,141,12,200,59,141,
-  233,15,135,244,22,137,209,137,194,15,182,174,233,133,252,237,15,132,244,248,
-  248,1,131,193,8,57,209,15,131,244,249,139,121,252,248,137,56,139,121,252,
-  252,137,120,4,131,192,8,199,65,252,252,237,131,252,237,1,15,133,244,1,248,
-  2,255,139,190,233,139,6,15,182,204,15,182,232,131,198,4,193,232,16,252,255,
-  36,171,255,248,3,199,64,4,237,131,192,8,131,252,237,1,15,133,244,3,252,233,
-  244,2,255,139,106,252,248,139,189,233,139,108,36,48,141,68,194,252,248,137,
-  149,233,141,136,233,59,141,233,137,133,233,255,137,44,36,255,137,124,36,4,
-  137,44,36,255,15,135,244,21,199,131,233,237,255,252,255,215,255,252,255,147,
-  233,255,199,131,233,237,139,149,233,141,12,194,252,247,217,3,141,233,139,
-  114,252,252,252,233,244,12,255,254,0
+  199,137,108,202,8,131,192,1,255,137,68,202,252,248,248,2,139,92,36,20,139,
+  124,36,16,255,128,126,252,252,235,15,133,244,254,252,246,131,233,235,15,132,
+  244,255,137,252,245,209,252,237,129,229,239,102,131,172,253,43,233,1,15,132,
+  244,141,248,9,255,15,183,70,252,254,141,180,253,134,233,139,6,15,182,204,
+  15,182,232,131,198,4,193,232,16,252,255,36,171,248,3,139,92,36,20,139,124,
+  36,16,139,6,15,182,204,15,182,232,131,198,4,193,232,16,252,255,36,171,248,
+  4,131,192,1,255,137,68,202,252,248,255,252,233,244,1,248,5,41,216,248,6,59,
+  133,233,15,135,244,3,105,252,248,239,3,189,233,129,191,233,239,15,132,244,
+  253,141,92,24,1,139,175,233,139,135,233,137,44,202,137,68,202,4,139,175,233,
+  139,135,233,137,108,202,8,137,68,202,12,137,92,202,252,248,252,233,244,2,
+  248,7,255,131,192,1,252,233,244,6,255,248,8,128,126,252,252,235,15,133,244,
+  9,15,183,70,252,254,252,233,245,255,129,124,253,202,252,236,239,15,133,244,
+  251,139,108,202,232,129,124,253,202,252,244,239,15,133,244,251,129,124,253,
+  202,252,252,239,15,133,244,251,128,189,233,235,15,133,244,251,141,180,253,
+  134,233,199,68,202,252,248,0,0,0,0,248,1,139,6,15,182,204,15,182,232,131,
+  198,4,193,232,16,252,255,36,171,248,5,198,70,252,252,235,141,180,253,134,
+  233,198,6,235,252,233,244,1,255,15,182,252,236,15,182,192,137,124,36,16,141,
+  188,253,194,233,141,12,202,43,122,252,252,133,252,237,15,132,244,251,141,
+  108,252,233,252,248,57,215,15,131,244,248,248,1,139,71,252,248,137,1,139,
+  71,252,252,131,199,8,137,65,4,131,193,8,57,252,233,15,131,244,249,57,215,
+  15,130,244,1,248,2,199,65,4,237,131,193,8,57,252,233,15,130,244,2,248,3,139,
+  124,36,16,139,6,15,182,204,15,182,232,131,198,4,193,232,16,252,255,36,171,
+  248,5,199,68,36,20,1,0,0,0,137,208,41,252,248,15,134,244,3,137,197,193,252,
+  237,3,131,197,1,137,108,36,20,139,108,36,48,1,200,59,133,233,15,135,244,253,
+  248,6,255,139,71,252,248,137,1,139,71,252,252,131,199,8,137,65,4,131,193,
+  8,57,215,15,130,244,6,252,233,244,3,248,7,137,149,233,137,141,233,137,116,
+  36,24,41,215,139,84,36,20,131,252,234,1,137,252,233,232,251,1,0,139,149,233,
+  139,141,233,1,215,252,233,244,6,255,193,225,3,255,248,1,139,114,252,252,137,
+  68,36,20,252,247,198,237,15,133,244,253,255,248,13,137,215,131,232,1,15,132,
+  244,249,248,2,139,44,15,137,111,252,248,139,108,15,4,137,111,252,252,131,
+  199,8,131,232,1,15,133,244,2,248,3,139,68,36,20,15,182,110,252,255,248,5,
+  57,197,15,135,244,252,255,139,108,10,4,137,106,252,252,139,44,10,137,106,
+  252,248,255,248,5,56,70,252,255,15,135,244,252,255,15,182,78,252,253,252,
+  247,209,141,20,202,139,122,252,248,139,191,233,139,191,233,139,6,15,182,204,
+  15,182,232,131,198,4,193,232,16,252,255,36,171,248,6,255,199,71,252,252,237,
+  131,199,8,255,199,68,194,252,244,237,255,131,192,1,252,233,244,5,248,7,141,
+  174,233,252,247,197,237,15,133,244,14,41,252,234,255,1,252,233,255,137,252,
+  245,209,252,237,129,229,239,102,131,172,253,43,233,1,15,132,244,140,255,141,
+  12,202,255,129,121,253,4,239,15,135,244,53,129,121,253,12,239,15,135,244,
+  53,255,139,105,20,255,129,252,253,239,15,135,244,53,255,252,242,15,16,1,252,
+  242,15,16,73,8,255,252,242,15,88,65,16,252,242,15,17,1,133,252,237,15,136,
+  244,249,255,15,140,244,249,255,102,15,46,200,248,1,252,242,15,17,65,24,255,
+  221,65,8,221,1,255,220,65,16,221,17,221,81,24,133,252,237,15,136,244,247,
+  255,221,81,24,15,140,244,247,255,217,201,248,1,255,15,183,70,252,254,255,
+  15,131,244,248,141,180,253,134,233,255,141,180,253,134,233,15,183,70,252,
+  254,15,131,245,255,15,130,244,248,141,180,253,134,233,255,248,3,102,15,46,
+  193,252,233,244,1,255,141,12,202,139,105,4,129,252,253,239,15,132,244,247,
+  255,137,105,252,252,139,41,137,105,252,248,252,233,245,255,141,180,253,134,
+  233,139,1,137,105,252,252,137,65,252,248,255,139,139,233,139,4,129,139,128,
+  233,139,108,36,48,137,147,233,137,171,233,252,255,224,255,137,252,245,209,
+  252,237,129,229,239,102,131,172,253,43,233,1,15,132,244,143,255,139,190,233,
+  139,108,36,48,141,12,202,59,141,233,15,135,244,23,15,182,142,233,57,200,15,
+  134,244,249,248,2,255,248,3,199,68,194,252,252,237,131,192,1,57,200,15,134,
+  244,3,252,233,244,2,255,141,44,197,237,141,4,194,139,122,252,248,137,104,
+  252,252,137,120,252,248,139,108,36,48,141,12,200,59,141,233,15,135,244,22,
+  137,209,137,194,15,182,174,233,133,252,237,15,132,244,248,248,1,131,193,8,
+  57,209,15,131,244,249,139,121,252,248,137,56,139,121,252,252,137,120,4,131,
+  192,8,199,65,252,252,237,131,252,237,1,15,133,244,1,248,2,255,139,190,233,
+  139,6,15,182,204,15,182,232,131,198,4,193,232,16,252,255,36,171,255,248,3,
+  199,64,4,237,131,192,8,131,252,237,1,15,133,244,3,252,233,244,2,255,139,106,
+  252,248,139,189,233,139,108,36,48,141,68,194,252,248,137,149,233,141,136,
+  233,59,141,233,137,133,233,255,137,44,36,255,137,124,36,4,137,44,36,255,15,
+  135,244,21,199,131,233,237,255,252,255,215,255,252,255,147,233,255,199,131,
+  233,237,139,149,233,141,12,194,252,247,217,3,141,233,139,114,252,252,252,
+  233,244,12,255,254,0
 };
 
 enum {
@@ -900,6 +907,7 @@ enum {
   GLOB_vm_inshook,
   GLOB_cont_hook,
   GLOB_vm_hotloop,
+  GLOB_vm_hotitern,
   GLOB_vm_callhook,
   GLOB_vm_hotcall,
   GLOB_vm_exit_handler,
@@ -1052,6 +1060,7 @@ static const char *const globnames[] = {
   "vm_inshook",
   "cont_hook",
   "vm_hotloop",
+  "vm_hotitern",
   "vm_callhook",
   "vm_hotcall",
   "vm_exit_handler",
@@ -1463,113 +1472,117 @@ static void build_subroutines(BuildCtx *ctx, int cmov, int sse)
 #if LJ_HASJIT
   dasm_put(Dst, 7992, DISPATCH_GL(hookmask), HOOK_VMEVENT, HOOK_ACTIVE, LUA_MASKLINE|LUA_MASKCOUNT, DISPATCH_GL(hookcount));
 #endif
-  dasm_put(Dst, 8023, DISPATCH_GL(hookmask), HOOK_ACTIVE, DISPATCH_GL(hookmask), HOOK_ACTIVE, LUA_MASKLINE|LUA_MASKCOUNT, DISPATCH_GL(hookcount), LUA_MASKLINE);
-  dasm_put(Dst, 8074, Dt1(->base), Dt1(->base), GG_DISP2STATIC);
+  dasm_put(Dst, 8023, DISPATCH_GL(hookmask), HOOK_ACTIVE, DISPATCH_GL(hookmask), HOOK_ACTIVE, HOOK_PROFILE, LUA_MASKLINE|LUA_MASKCOUNT, DISPATCH_GL(hookcount));
+  dasm_put(Dst, 8072, LUA_MASKLINE, Dt1(->base), Dt1(->base), GG_DISP2STATIC);
 #if LJ_HASJIT
-  dasm_put(Dst, 8140, Dt7(->pc), PC2PROTO(framesize), Dt1(->base), Dt1(->top), GG_DISP2J, DISPATCH_J(L));
+  dasm_put(Dst, 8146, Dt7(->pc), PC2PROTO(framesize), Dt1(->base), Dt1(->top), GG_DISP2J, DISPATCH_J(L));
 #endif
-  dasm_put(Dst, 8186);
+  dasm_put(Dst, 8192);
+#if LJ_HASJIT
+  dasm_put(Dst, 8195, Dt7(->pc), PC2PROTO(framesize), Dt1(->base), Dt1(->top), GG_DISP2J, DISPATCH_J(L), Dt1(->base), -BCBIAS_J*4);
+#endif
+  dasm_put(Dst, 8268);
 #if LJ_HASJIT
   dasm_put(Dst, 8018);
 #endif
-  dasm_put(Dst, 8193);
+  dasm_put(Dst, 8275);
 #if LJ_HASJIT
-  dasm_put(Dst, 8196);
+  dasm_put(Dst, 8278);
 #endif
-  dasm_put(Dst, 8206, Dt1(->base), Dt1(->top));
+  dasm_put(Dst, 8288, Dt1(->base), Dt1(->top));
 #if LJ_HASJIT
-  dasm_put(Dst, 8240);
+  dasm_put(Dst, 8322);
 #endif
-  dasm_put(Dst, 8245, Dt1(->base), Dt1(->top));
+  dasm_put(Dst, 8327, Dt1(->base), Dt1(->top));
 #if LJ_HASJIT
-  dasm_put(Dst, 8274, DISPATCH_GL(vmstate), DISPATCH_GL(vmstate), ~LJ_VMST_EXIT, DISPATCH_J(exitno), DISPATCH_J(parent), 8*8+16, DISPATCH_GL(jit_L), DISPATCH_GL(jit_base), DISPATCH_J(L), DISPATCH_GL(jit_L), Dt1(->base), GG_DISP2J, Dt1(->cframe), CFRAME_RAWMASK, CFRAME_OFS_L, Dt1(->base), CFRAME_OFS_PC);
+  dasm_put(Dst, 8356, DISPATCH_GL(vmstate), DISPATCH_GL(vmstate), ~LJ_VMST_EXIT, DISPATCH_J(exitno), DISPATCH_J(parent), 8*8+16, DISPATCH_GL(jit_L), DISPATCH_GL(jit_base), DISPATCH_J(L), DISPATCH_GL(jit_L), Dt1(->base), GG_DISP2J, Dt1(->cframe), CFRAME_RAWMASK, CFRAME_OFS_L, Dt1(->base), CFRAME_OFS_PC);
 #endif
-  dasm_put(Dst, 8417);
+  dasm_put(Dst, 8499);
 #if LJ_HASJIT
-  dasm_put(Dst, 8420, Dt7(->pc), PC2PROTO(k), DISPATCH_GL(jit_L), DISPATCH_GL(vmstate), ~LJ_VMST_INTERP, BC_FUNCF);
+  dasm_put(Dst, 8502, Dt7(->pc), PC2PROTO(k), DISPATCH_GL(jit_L), DISPATCH_GL(vmstate), ~LJ_VMST_INTERP, BC_FUNCF);
 #endif
-  dasm_put(Dst, 8498);
+  dasm_put(Dst, 8580);
   if (!sse) {
-  dasm_put(Dst, 8501);
+  dasm_put(Dst, 8583);
   }
-  dasm_put(Dst, 8546);
+  dasm_put(Dst, 8628);
   if (!sse) {
-  dasm_put(Dst, 8648);
+  dasm_put(Dst, 8730);
   }
-  dasm_put(Dst, 8693);
+  dasm_put(Dst, 8775);
   if (!sse) {
-  dasm_put(Dst, 8795);
+  dasm_put(Dst, 8877);
   }
-  dasm_put(Dst, 8834);
+  dasm_put(Dst, 8916);
   if (sse) {
-    dasm_put(Dst, 8939);
+    dasm_put(Dst, 9021);
   } else {
-    dasm_put(Dst, 9069);
+    dasm_put(Dst, 9151);
   }
-  dasm_put(Dst, 9116);
+  dasm_put(Dst, 9198);
   if (!sse) {
-  dasm_put(Dst, 9190);
+  dasm_put(Dst, 9272);
   if (cmov) {
-  dasm_put(Dst, 9201);
+  dasm_put(Dst, 9283);
   } else {
-  dasm_put(Dst, 9205);
+  dasm_put(Dst, 9287);
   }
-  dasm_put(Dst, 9212);
-  dasm_put(Dst, 9286);
-  dasm_put(Dst, 9386);
+  dasm_put(Dst, 9294);
+  dasm_put(Dst, 9368);
+  dasm_put(Dst, 9468);
   if (cmov) {
-  dasm_put(Dst, 9389);
+  dasm_put(Dst, 9471);
   } else {
-  dasm_put(Dst, 9393);
+  dasm_put(Dst, 9475);
   }
-  dasm_put(Dst, 9400);
+  dasm_put(Dst, 9482);
   if (cmov) {
-  dasm_put(Dst, 9201);
+  dasm_put(Dst, 9283);
   } else {
-  dasm_put(Dst, 9205);
+  dasm_put(Dst, 9287);
   }
-  dasm_put(Dst, 9418);
+  dasm_put(Dst, 9500);
   } else {
-    dasm_put(Dst, 9497);
+    dasm_put(Dst, 9579);
   }
-  dasm_put(Dst, 9500);
-  dasm_put(Dst, 9585);
-  dasm_put(Dst, 9716);
-  dasm_put(Dst, 9915);
+  dasm_put(Dst, 9582);
+  dasm_put(Dst, 9667);
+  dasm_put(Dst, 9798);
+  dasm_put(Dst, 9997);
 #if LJ_HASJIT
   if (sse) {
-    dasm_put(Dst, 9938);
-    dasm_put(Dst, 9995);
-    dasm_put(Dst, 10086);
+    dasm_put(Dst, 10020);
+    dasm_put(Dst, 10077);
+    dasm_put(Dst, 10168);
   } else {
-    dasm_put(Dst, 10128);
-    dasm_put(Dst, 10220);
+    dasm_put(Dst, 10210);
+    dasm_put(Dst, 10302);
   }
-  dasm_put(Dst, 10266);
+  dasm_put(Dst, 10348);
 #endif
-  dasm_put(Dst, 10270);
+  dasm_put(Dst, 10352);
   if (sse) {
-    dasm_put(Dst, 10273);
-    dasm_put(Dst, 10378);
-    dasm_put(Dst, 10461);
+    dasm_put(Dst, 10355);
+    dasm_put(Dst, 10460);
+    dasm_put(Dst, 10543);
   } else {
-    dasm_put(Dst, 10533);
-    dasm_put(Dst, 10616);
+    dasm_put(Dst, 10615);
+    dasm_put(Dst, 10698);
     if (cmov) {
-    dasm_put(Dst, 10671);
+    dasm_put(Dst, 10753);
     } else {
-    dasm_put(Dst, 10690);
+    dasm_put(Dst, 10772);
     }
-    dasm_put(Dst, 10266);
+    dasm_put(Dst, 10348);
   }
-  dasm_put(Dst, 10731);
+  dasm_put(Dst, 10813);
 }
 
 /* Generate the code for a single instruction. */
 static void build_ins(BuildCtx *ctx, BCOp op, int defop, int cmov, int sse)
 {
   int vk = 0;
-  dasm_put(Dst, 10785, defop);
+  dasm_put(Dst, 10867, defop);
 
   switch (op) {
 
@@ -1578,632 +1591,637 @@ static void build_ins(BuildCtx *ctx, BCOp op, int defop, int cmov, int sse)
   /* Remember: all ops branch for a true comparison, fall through otherwise. */
 
   case BC_ISLT: case BC_ISGE: case BC_ISLE: case BC_ISGT:
-    dasm_put(Dst, 10787, LJ_TISNUM, LJ_TISNUM);
+    dasm_put(Dst, 10869, LJ_TISNUM, LJ_TISNUM);
     if (sse) {
-      dasm_put(Dst, 10808);
+      dasm_put(Dst, 10890);
     } else {
-      dasm_put(Dst, 10823);
+      dasm_put(Dst, 10905);
       if (cmov) {
-      dasm_put(Dst, 10833);
+      dasm_put(Dst, 10915);
       } else {
-      dasm_put(Dst, 10839);
+      dasm_put(Dst, 10921);
       }
     }
     switch (op) {
     case BC_ISLT:
-      dasm_put(Dst, 10846);
+      dasm_put(Dst, 10928);
       break;
     case BC_ISGE:
-      dasm_put(Dst, 10081);
+      dasm_put(Dst, 10163);
       break;
     case BC_ISLE:
       dasm_put(Dst, 6207);
       break;
     case BC_ISGT:
-      dasm_put(Dst, 10851);
+      dasm_put(Dst, 10933);
       break;
     default: break;  /* Shut up GCC. */
     }
-    dasm_put(Dst, 10856, -BCBIAS_J*4);
+    dasm_put(Dst, 10938, -BCBIAS_J*4);
     break;
 
   case BC_ISEQV: case BC_ISNEV:
     vk = op == BC_ISEQV;
-    dasm_put(Dst, 10889, LJ_TISNUM, LJ_TISNUM);
+    dasm_put(Dst, 10971, LJ_TISNUM, LJ_TISNUM);
     if (sse) {
-      dasm_put(Dst, 10915);
+      dasm_put(Dst, 10997);
     } else {
-      dasm_put(Dst, 10927);
+      dasm_put(Dst, 11009);
       if (cmov) {
-      dasm_put(Dst, 10833);
+      dasm_put(Dst, 10915);
       } else {
-      dasm_put(Dst, 10839);
+      dasm_put(Dst, 10921);
       }
     }
   iseqne_fp:
     if (vk) {
-      dasm_put(Dst, 10934);
+      dasm_put(Dst, 11016);
     } else {
-      dasm_put(Dst, 10943);
+      dasm_put(Dst, 11025);
     }
   iseqne_end:
     if (vk) {
-      dasm_put(Dst, 10952, -BCBIAS_J*4);
+      dasm_put(Dst, 11034, -BCBIAS_J*4);
     } else {
-      dasm_put(Dst, 10967, -BCBIAS_J*4);
+      dasm_put(Dst, 11049, -BCBIAS_J*4);
     }
-    dasm_put(Dst, 10870);
+    dasm_put(Dst, 8249);
     if (op == BC_ISEQV || op == BC_ISNEV) {
-      dasm_put(Dst, 10982, LJ_TISPRI, LJ_TISTABUD, Dt6(->metatable), Dt6(->nomm), 1<<MM_eq);
+      dasm_put(Dst, 11064, LJ_TISPRI, LJ_TISTABUD, Dt6(->metatable), Dt6(->nomm), 1<<MM_eq);
       if (vk) {
-	dasm_put(Dst, 11040);
+	dasm_put(Dst, 11122);
       } else {
-	dasm_put(Dst, 11044);
+	dasm_put(Dst, 11126);
       }
-      dasm_put(Dst, 11050);
+      dasm_put(Dst, 11132);
     }
     break;
   case BC_ISEQS: case BC_ISNES:
     vk = op == BC_ISEQS;
-    dasm_put(Dst, 11055, LJ_TSTR);
+    dasm_put(Dst, 11137, LJ_TSTR);
   iseqne_test:
     if (vk) {
-      dasm_put(Dst, 10938);
+      dasm_put(Dst, 11020);
     } else {
       dasm_put(Dst, 2829);
     }
     goto iseqne_end;
   case BC_ISEQN: case BC_ISNEN:
     vk = op == BC_ISEQN;
-    dasm_put(Dst, 11078, LJ_TISNUM);
+    dasm_put(Dst, 11160, LJ_TISNUM);
     if (sse) {
-      dasm_put(Dst, 11092);
+      dasm_put(Dst, 11174);
     } else {
-      dasm_put(Dst, 11104);
+      dasm_put(Dst, 11186);
       if (cmov) {
-      dasm_put(Dst, 10833);
+      dasm_put(Dst, 10915);
       } else {
-      dasm_put(Dst, 10839);
+      dasm_put(Dst, 10921);
       }
     }
     goto iseqne_fp;
   case BC_ISEQP: case BC_ISNEP:
     vk = op == BC_ISEQP;
-    dasm_put(Dst, 11111);
+    dasm_put(Dst, 11193);
     goto iseqne_test;
 
   /* -- Unary test and copy ops ------------------------------------------- */
 
   case BC_ISTC: case BC_ISFC: case BC_IST: case BC_ISF:
-    dasm_put(Dst, 11122, LJ_TISTRUECOND);
+    dasm_put(Dst, 11204, LJ_TISTRUECOND);
     if (op == BC_IST || op == BC_ISTC) {
-      dasm_put(Dst, 11134);
+      dasm_put(Dst, 11216);
     } else {
-      dasm_put(Dst, 11139);
+      dasm_put(Dst, 11221);
     }
     if (op == BC_ISTC || op == BC_ISFC) {
-      dasm_put(Dst, 11144);
+      dasm_put(Dst, 11226);
     }
-    dasm_put(Dst, 11155, -BCBIAS_J*4);
+    dasm_put(Dst, 11237, -BCBIAS_J*4);
     break;
 
   /* -- Unary ops --------------------------------------------------------- */
 
   case BC_MOV:
-    dasm_put(Dst, 11186);
+    dasm_put(Dst, 11268);
     break;
   case BC_NOT:
-    dasm_put(Dst, 11219, LJ_TISTRUECOND, LJ_TTRUE);
+    dasm_put(Dst, 11301, LJ_TISTRUECOND, LJ_TTRUE);
     break;
   case BC_UNM:
-    dasm_put(Dst, 11254, LJ_TISNUM);
+    dasm_put(Dst, 11336, LJ_TISNUM);
     if (sse) {
-      dasm_put(Dst, 11265);
+      dasm_put(Dst, 11347);
     } else {
-      dasm_put(Dst, 11295);
+      dasm_put(Dst, 11377);
     }
-    dasm_put(Dst, 10870);
+    dasm_put(Dst, 8249);
     break;
   case BC_LEN:
-    dasm_put(Dst, 11304, LJ_TSTR);
+    dasm_put(Dst, 11386, LJ_TSTR);
     if (sse) {
-      dasm_put(Dst, 11318, Dt5(->len));
+      dasm_put(Dst, 11400, Dt5(->len));
     } else {
-      dasm_put(Dst, 11336, Dt5(->len));
+      dasm_put(Dst, 11418, Dt5(->len));
     }
-    dasm_put(Dst, 11345, LJ_TTAB);
+    dasm_put(Dst, 11427, LJ_TTAB);
     if (sse) {
-      dasm_put(Dst, 11385);
+      dasm_put(Dst, 11467);
     } else {
-      dasm_put(Dst, 11394);
+      dasm_put(Dst, 11476);
     }
-    dasm_put(Dst, 11404);
+    dasm_put(Dst, 11486);
     break;
 
   /* -- Binary ops -------------------------------------------------------- */
 
 
   case BC_ADDVN: case BC_ADDNV: case BC_ADDVV:
-    dasm_put(Dst, 11414);
+    dasm_put(Dst, 11496);
     vk = ((int)op - BC_ADDVN) / (BC_ADDNV-BC_ADDVN);
     switch (vk) {
     case 0:
-    dasm_put(Dst, 11422, LJ_TISNUM);
+    dasm_put(Dst, 11504, LJ_TISNUM);
     if (sse) {
-    dasm_put(Dst, 11434);
+    dasm_put(Dst, 11516);
     } else {
-    dasm_put(Dst, 11448);
+    dasm_put(Dst, 11530);
     }
       break;
     case 1:
-    dasm_put(Dst, 11456, LJ_TISNUM);
+    dasm_put(Dst, 11538, LJ_TISNUM);
     if (sse) {
-    dasm_put(Dst, 11468);
+    dasm_put(Dst, 11550);
     } else {
-    dasm_put(Dst, 11482);
+    dasm_put(Dst, 11564);
     }
       break;
     default:
-    dasm_put(Dst, 11490, LJ_TISNUM, LJ_TISNUM);
+    dasm_put(Dst, 11572, LJ_TISNUM, LJ_TISNUM);
     if (sse) {
-    dasm_put(Dst, 11512);
+    dasm_put(Dst, 11594);
     } else {
-    dasm_put(Dst, 11526);
+    dasm_put(Dst, 11608);
     }
       break;
     }
     if (sse) {
-    dasm_put(Dst, 11288);
+    dasm_put(Dst, 11370);
     } else {
-    dasm_put(Dst, 11300);
+    dasm_put(Dst, 11382);
     }
-    dasm_put(Dst, 10870);
+    dasm_put(Dst, 8249);
     break;
   case BC_SUBVN: case BC_SUBNV: case BC_SUBVV:
-    dasm_put(Dst, 11414);
+    dasm_put(Dst, 11496);
     vk = ((int)op - BC_ADDVN) / (BC_ADDNV-BC_ADDVN);
     switch (vk) {
     case 0:
-    dasm_put(Dst, 11422, LJ_TISNUM);
+    dasm_put(Dst, 11504, LJ_TISNUM);
     if (sse) {
-    dasm_put(Dst, 11534);
+    dasm_put(Dst, 11616);
     } else {
-    dasm_put(Dst, 11548);
+    dasm_put(Dst, 11630);
     }
       break;
     case 1:
-    dasm_put(Dst, 11456, LJ_TISNUM);
+    dasm_put(Dst, 11538, LJ_TISNUM);
     if (sse) {
-    dasm_put(Dst, 11556);
+    dasm_put(Dst, 11638);
     } else {
-    dasm_put(Dst, 11570);
+    dasm_put(Dst, 11652);
     }
       break;
     default:
-    dasm_put(Dst, 11490, LJ_TISNUM, LJ_TISNUM);
+    dasm_put(Dst, 11572, LJ_TISNUM, LJ_TISNUM);
     if (sse) {
-    dasm_put(Dst, 11578);
+    dasm_put(Dst, 11660);
     } else {
-    dasm_put(Dst, 11592);
+    dasm_put(Dst, 11674);
     }
       break;
     }
     if (sse) {
-    dasm_put(Dst, 11288);
+    dasm_put(Dst, 11370);
     } else {
-    dasm_put(Dst, 11300);
+    dasm_put(Dst, 11382);
     }
-    dasm_put(Dst, 10870);
+    dasm_put(Dst, 8249);
     break;
   case BC_MULVN: case BC_MULNV: case BC_MULVV:
-    dasm_put(Dst, 11414);
+    dasm_put(Dst, 11496);
     vk = ((int)op - BC_ADDVN) / (BC_ADDNV-BC_ADDVN);
     switch (vk) {
     case 0:
-    dasm_put(Dst, 11422, LJ_TISNUM);
+    dasm_put(Dst, 11504, LJ_TISNUM);
     if (sse) {
-    dasm_put(Dst, 11600);
+    dasm_put(Dst, 11682);
     } else {
-    dasm_put(Dst, 11614);
+    dasm_put(Dst, 11696);
     }
       break;
     case 1:
-    dasm_put(Dst, 11456, LJ_TISNUM);
+    dasm_put(Dst, 11538, LJ_TISNUM);
     if (sse) {
-    dasm_put(Dst, 11622);
+    dasm_put(Dst, 11704);
     } else {
-    dasm_put(Dst, 11636);
+    dasm_put(Dst, 11718);
     }
       break;
     default:
-    dasm_put(Dst, 11490, LJ_TISNUM, LJ_TISNUM);
+    dasm_put(Dst, 11572, LJ_TISNUM, LJ_TISNUM);
     if (sse) {
-    dasm_put(Dst, 11644);
+    dasm_put(Dst, 11726);
     } else {
-    dasm_put(Dst, 11658);
+    dasm_put(Dst, 11740);
     }
       break;
     }
     if (sse) {
-    dasm_put(Dst, 11288);
+    dasm_put(Dst, 11370);
     } else {
-    dasm_put(Dst, 11300);
+    dasm_put(Dst, 11382);
     }
-    dasm_put(Dst, 10870);
+    dasm_put(Dst, 8249);
     break;
   case BC_DIVVN: case BC_DIVNV: case BC_DIVVV:
-    dasm_put(Dst, 11414);
+    dasm_put(Dst, 11496);
     vk = ((int)op - BC_ADDVN) / (BC_ADDNV-BC_ADDVN);
     switch (vk) {
     case 0:
-    dasm_put(Dst, 11422, LJ_TISNUM);
+    dasm_put(Dst, 11504, LJ_TISNUM);
     if (sse) {
-    dasm_put(Dst, 11666);
+    dasm_put(Dst, 11748);
     } else {
-    dasm_put(Dst, 11680);
+    dasm_put(Dst, 11762);
     }
       break;
     case 1:
-    dasm_put(Dst, 11456, LJ_TISNUM);
+    dasm_put(Dst, 11538, LJ_TISNUM);
     if (sse) {
-    dasm_put(Dst, 11688);
+    dasm_put(Dst, 11770);
     } else {
-    dasm_put(Dst, 11702);
+    dasm_put(Dst, 11784);
     }
       break;
     default:
-    dasm_put(Dst, 11490, LJ_TISNUM, LJ_TISNUM);
+    dasm_put(Dst, 11572, LJ_TISNUM, LJ_TISNUM);
     if (sse) {
-    dasm_put(Dst, 11710);
+    dasm_put(Dst, 11792);
     } else {
-    dasm_put(Dst, 11724);
+    dasm_put(Dst, 11806);
     }
       break;
     }
     if (sse) {
-    dasm_put(Dst, 11288);
+    dasm_put(Dst, 11370);
     } else {
-    dasm_put(Dst, 11300);
+    dasm_put(Dst, 11382);
     }
-    dasm_put(Dst, 10870);
+    dasm_put(Dst, 8249);
     break;
   case BC_MODVN:
-    dasm_put(Dst, 11414);
+    dasm_put(Dst, 11496);
     vk = ((int)op - BC_ADDVN) / (BC_ADDNV-BC_ADDVN);
     switch (vk) {
     case 0:
-    dasm_put(Dst, 11422, LJ_TISNUM);
+    dasm_put(Dst, 11504, LJ_TISNUM);
     if (sse) {
-    dasm_put(Dst, 11732);
+    dasm_put(Dst, 11814);
     } else {
-    dasm_put(Dst, 11746);
+    dasm_put(Dst, 11828);
     }
       break;
     case 1:
-    dasm_put(Dst, 11456, LJ_TISNUM);
+    dasm_put(Dst, 11538, LJ_TISNUM);
     if (sse) {
-    dasm_put(Dst, 11754);
+    dasm_put(Dst, 11836);
     } else {
-    dasm_put(Dst, 11768);
+    dasm_put(Dst, 11850);
     }
       break;
     default:
-    dasm_put(Dst, 11490, LJ_TISNUM, LJ_TISNUM);
+    dasm_put(Dst, 11572, LJ_TISNUM, LJ_TISNUM);
     if (sse) {
-    dasm_put(Dst, 11776);
+    dasm_put(Dst, 11858);
     } else {
-    dasm_put(Dst, 11790);
+    dasm_put(Dst, 11872);
     }
       break;
     }
-    dasm_put(Dst, 11798);
+    dasm_put(Dst, 11880);
     if (sse) {
-    dasm_put(Dst, 11288);
+    dasm_put(Dst, 11370);
     } else {
-    dasm_put(Dst, 11300);
+    dasm_put(Dst, 11382);
     }
-    dasm_put(Dst, 10870);
+    dasm_put(Dst, 8249);
     break;
   case BC_MODNV: case BC_MODVV:
-    dasm_put(Dst, 11414);
+    dasm_put(Dst, 11496);
     vk = ((int)op - BC_ADDVN) / (BC_ADDNV-BC_ADDVN);
     switch (vk) {
     case 0:
-    dasm_put(Dst, 11422, LJ_TISNUM);
+    dasm_put(Dst, 11504, LJ_TISNUM);
     if (sse) {
-    dasm_put(Dst, 11732);
+    dasm_put(Dst, 11814);
     } else {
-    dasm_put(Dst, 11746);
+    dasm_put(Dst, 11828);
     }
       break;
     case 1:
-    dasm_put(Dst, 11456, LJ_TISNUM);
+    dasm_put(Dst, 11538, LJ_TISNUM);
     if (sse) {
-    dasm_put(Dst, 11754);
+    dasm_put(Dst, 11836);
     } else {
-    dasm_put(Dst, 11768);
+    dasm_put(Dst, 11850);
     }
       break;
     default:
-    dasm_put(Dst, 11490, LJ_TISNUM, LJ_TISNUM);
+    dasm_put(Dst, 11572, LJ_TISNUM, LJ_TISNUM);
     if (sse) {
-    dasm_put(Dst, 11776);
+    dasm_put(Dst, 11858);
     } else {
-    dasm_put(Dst, 11790);
+    dasm_put(Dst, 11872);
     }
       break;
     }
-    dasm_put(Dst, 11804);
+    dasm_put(Dst, 11886);
     break;
   case BC_POW:
-    dasm_put(Dst, 11414);
+    dasm_put(Dst, 11496);
     vk = ((int)op - BC_ADDVN) / (BC_ADDNV-BC_ADDVN);
     switch (vk) {
     case 0:
-    dasm_put(Dst, 11422, LJ_TISNUM);
+    dasm_put(Dst, 11504, LJ_TISNUM);
     if (sse) {
-    dasm_put(Dst, 11732);
+    dasm_put(Dst, 11814);
     } else {
-    dasm_put(Dst, 11746);
+    dasm_put(Dst, 11828);
     }
       break;
     case 1:
-    dasm_put(Dst, 11456, LJ_TISNUM);
+    dasm_put(Dst, 11538, LJ_TISNUM);
     if (sse) {
-    dasm_put(Dst, 11754);
+    dasm_put(Dst, 11836);
     } else {
-    dasm_put(Dst, 11768);
+    dasm_put(Dst, 11850);
     }
       break;
     default:
-    dasm_put(Dst, 11490, LJ_TISNUM, LJ_TISNUM);
+    dasm_put(Dst, 11572, LJ_TISNUM, LJ_TISNUM);
     if (sse) {
-    dasm_put(Dst, 11776);
+    dasm_put(Dst, 11858);
     } else {
-    dasm_put(Dst, 11790);
+    dasm_put(Dst, 11872);
     }
       break;
     }
-    dasm_put(Dst, 11809);
+    dasm_put(Dst, 11891);
     if (sse) {
-    dasm_put(Dst, 11288);
+    dasm_put(Dst, 11370);
     } else {
-    dasm_put(Dst, 11300);
+    dasm_put(Dst, 11382);
     }
-    dasm_put(Dst, 10870);
+    dasm_put(Dst, 8249);
     break;
 
   case BC_CAT:
-    dasm_put(Dst, 11813, Dt1(->base), Dt1(->base));
+    dasm_put(Dst, 11895, Dt1(->base), Dt1(->base));
     break;
 
   /* -- Constant ops ------------------------------------------------------ */
 
   case BC_KSTR:
-    dasm_put(Dst, 11907, LJ_TSTR);
+    dasm_put(Dst, 11989, LJ_TSTR);
     break;
   case BC_KSHORT:
     if (sse) {
-      dasm_put(Dst, 11940);
+      dasm_put(Dst, 12022);
     } else {
-      dasm_put(Dst, 11955);
+      dasm_put(Dst, 12037);
     }
-    dasm_put(Dst, 10870);
+    dasm_put(Dst, 8249);
     break;
   case BC_KNUM:
     if (sse) {
-      dasm_put(Dst, 11963);
+      dasm_put(Dst, 12045);
     } else {
-      dasm_put(Dst, 11976);
+      dasm_put(Dst, 12058);
     }
-    dasm_put(Dst, 10870);
+    dasm_put(Dst, 8249);
     break;
   case BC_KPRI:
-    dasm_put(Dst, 11983);
+    dasm_put(Dst, 12065);
     break;
   case BC_KNIL:
-    dasm_put(Dst, 12009, LJ_TNIL);
+    dasm_put(Dst, 12091, LJ_TNIL);
     break;
 
   /* -- Upvalue and function ops ------------------------------------------ */
 
   case BC_UGET:
-    dasm_put(Dst, 12055, offsetof(GCfuncL, uvptr), DtA(->v));
+    dasm_put(Dst, 12137, offsetof(GCfuncL, uvptr), DtA(->v));
     break;
   case BC_USETV:
 #define TV2MARKOFS \
  ((int32_t)offsetof(GCupval, marked)-(int32_t)offsetof(GCupval, tv))
-    dasm_put(Dst, 12099, offsetof(GCfuncL, uvptr), DtA(->closed), DtA(->v), TV2MARKOFS, LJ_GC_BLACK, LJ_TISGCV, LJ_TISNUM - LJ_TISGCV, Dt4(->gch.marked), LJ_GC_WHITES, GG_DISP2G);
-    dasm_put(Dst, 12189);
+    dasm_put(Dst, 12181, offsetof(GCfuncL, uvptr), DtA(->closed), DtA(->v), TV2MARKOFS, LJ_GC_BLACK, LJ_TISGCV, LJ_TISNUM - LJ_TISGCV, Dt4(->gch.marked), LJ_GC_WHITES, GG_DISP2G);
+    dasm_put(Dst, 12271);
     break;
 #undef TV2MARKOFS
   case BC_USETS:
-    dasm_put(Dst, 12201, offsetof(GCfuncL, uvptr), DtA(->v), LJ_TSTR, DtA(->marked), LJ_GC_BLACK, Dt4(->gch.marked), LJ_GC_WHITES, DtA(->closed), GG_DISP2G);
+    dasm_put(Dst, 12283, offsetof(GCfuncL, uvptr), DtA(->v), LJ_TSTR, DtA(->marked), LJ_GC_BLACK, Dt4(->gch.marked), LJ_GC_WHITES, DtA(->closed), GG_DISP2G);
     break;
   case BC_USETN:
-    dasm_put(Dst, 12292);
+    dasm_put(Dst, 12374);
     if (sse) {
-      dasm_put(Dst, 12297);
+      dasm_put(Dst, 12379);
     } else {
-      dasm_put(Dst, 11107);
+      dasm_put(Dst, 11189);
     }
-    dasm_put(Dst, 12304, offsetof(GCfuncL, uvptr), DtA(->v));
+    dasm_put(Dst, 12386, offsetof(GCfuncL, uvptr), DtA(->v));
     if (sse) {
-      dasm_put(Dst, 12313);
+      dasm_put(Dst, 12395);
     } else {
-      dasm_put(Dst, 12319);
+      dasm_put(Dst, 12401);
     }
-    dasm_put(Dst, 10870);
+    dasm_put(Dst, 8249);
     break;
   case BC_USETP:
-    dasm_put(Dst, 12322, offsetof(GCfuncL, uvptr), DtA(->v));
+    dasm_put(Dst, 12404, offsetof(GCfuncL, uvptr), DtA(->v));
     break;
   case BC_UCLO:
-    dasm_put(Dst, 12359, -BCBIAS_J*4, Dt1(->openupval), Dt1(->base), Dt1(->base));
+    dasm_put(Dst, 12441, -BCBIAS_J*4, Dt1(->openupval), Dt1(->base), Dt1(->base));
     break;
 
   case BC_FNEW:
-    dasm_put(Dst, 12413, Dt1(->base), Dt1(->base), LJ_TFUNC);
+    dasm_put(Dst, 12495, Dt1(->base), Dt1(->base), LJ_TFUNC);
     break;
 
   /* -- Table ops --------------------------------------------------------- */
 
   case BC_TNEW:
-    dasm_put(Dst, 12484, Dt1(->base), DISPATCH_GL(gc.total), DISPATCH_GL(gc.threshold), Dt1(->base), LJ_TTAB);
+    dasm_put(Dst, 12566, Dt1(->base), DISPATCH_GL(gc.total), DISPATCH_GL(gc.threshold), Dt1(->base), LJ_TTAB);
     break;
   case BC_TDUP:
-    dasm_put(Dst, 12610, DISPATCH_GL(gc.total), DISPATCH_GL(gc.threshold), Dt1(->base), Dt1(->base), LJ_TTAB);
+    dasm_put(Dst, 12692, DISPATCH_GL(gc.total), DISPATCH_GL(gc.threshold), Dt1(->base), Dt1(->base), LJ_TTAB);
     break;
 
   case BC_GGET:
-    dasm_put(Dst, 12702, Dt7(->env));
+    dasm_put(Dst, 12784, Dt7(->env));
     break;
   case BC_GSET:
-    dasm_put(Dst, 12720, Dt7(->env));
+    dasm_put(Dst, 12802, Dt7(->env));
     break;
 
   case BC_TGETV:
-    dasm_put(Dst, 12738, LJ_TTAB, LJ_TISNUM);
+    dasm_put(Dst, 12820, LJ_TTAB, LJ_TISNUM);
     if (sse) {
-      dasm_put(Dst, 12771);
+      dasm_put(Dst, 12853);
     } else {
-      dasm_put(Dst, 12792);
+      dasm_put(Dst, 12874);
       if (cmov) {
-      dasm_put(Dst, 10833);
+      dasm_put(Dst, 10915);
       } else {
-      dasm_put(Dst, 10839);
+      dasm_put(Dst, 10921);
       }
       dasm_put(Dst, 2539);
     }
-    dasm_put(Dst, 12802, Dt6(->asize), Dt6(->array), LJ_TNIL, Dt6(->metatable), Dt6(->metatable), Dt6(->nomm), 1<<MM_index);
-    dasm_put(Dst, 12890, LJ_TNIL, LJ_TSTR);
+    dasm_put(Dst, 12884, Dt6(->asize), Dt6(->array), LJ_TNIL, Dt6(->metatable), Dt6(->metatable), Dt6(->nomm), 1<<MM_index);
+    dasm_put(Dst, 12972, LJ_TNIL, LJ_TSTR);
     break;
   case BC_TGETS:
-    dasm_put(Dst, 12919, LJ_TTAB, Dt6(->hmask), Dt5(->hash), sizeof(Node), Dt6(->node), DtB(->key.it), LJ_TSTR, DtB(->key.gcr), LJ_TNIL);
-    dasm_put(Dst, 13007, LJ_TNIL, DtB(->next), Dt6(->metatable), Dt6(->nomm), 1<<MM_index);
+    dasm_put(Dst, 13001, LJ_TTAB, Dt6(->hmask), Dt5(->hash), sizeof(Node), Dt6(->node), DtB(->key.it), LJ_TSTR, DtB(->key.gcr), LJ_TNIL);
+    dasm_put(Dst, 13089, LJ_TNIL, DtB(->next), Dt6(->metatable), Dt6(->nomm), 1<<MM_index);
     break;
   case BC_TGETB:
-    dasm_put(Dst, 13077, LJ_TTAB, Dt6(->asize), Dt6(->array), LJ_TNIL, Dt6(->metatable), Dt6(->metatable), Dt6(->nomm), 1<<MM_index);
-    dasm_put(Dst, 13176, LJ_TNIL);
+    dasm_put(Dst, 13159, LJ_TTAB, Dt6(->asize), Dt6(->array), LJ_TNIL, Dt6(->metatable), Dt6(->metatable), Dt6(->nomm), 1<<MM_index);
+    dasm_put(Dst, 13258, LJ_TNIL);
     break;
 
   case BC_TSETV:
-    dasm_put(Dst, 13193, LJ_TTAB, LJ_TISNUM);
+    dasm_put(Dst, 13275, LJ_TTAB, LJ_TISNUM);
     if (sse) {
-      dasm_put(Dst, 12771);
+      dasm_put(Dst, 12853);
     } else {
-      dasm_put(Dst, 12792);
+      dasm_put(Dst, 12874);
       if (cmov) {
-      dasm_put(Dst, 10833);
+      dasm_put(Dst, 10915);
       } else {
-      dasm_put(Dst, 10839);
+      dasm_put(Dst, 10921);
       }
       dasm_put(Dst, 2539);
     }
-    dasm_put(Dst, 13226, Dt6(->asize), Dt6(->array), LJ_TNIL, Dt6(->marked), LJ_GC_BLACK, Dt6(->metatable), Dt6(->metatable));
-    dasm_put(Dst, 13309, Dt6(->nomm), 1<<MM_newindex, LJ_TSTR, Dt6(->marked), cast_byte(~LJ_GC_BLACK), DISPATCH_GL(gc.grayagain), DISPATCH_GL(gc.grayagain), Dt6(->gclist));
+    dasm_put(Dst, 13308, Dt6(->asize), Dt6(->array), LJ_TNIL, Dt6(->marked), LJ_GC_BLACK, Dt6(->metatable), Dt6(->metatable));
+    dasm_put(Dst, 13391, Dt6(->nomm), 1<<MM_newindex, LJ_TSTR, Dt6(->marked), cast_byte(~LJ_GC_BLACK), DISPATCH_GL(gc.grayagain), DISPATCH_GL(gc.grayagain), Dt6(->gclist));
     break;
   case BC_TSETS:
-    dasm_put(Dst, 13371, LJ_TTAB, Dt6(->hmask), Dt5(->hash), sizeof(Node), Dt6(->nomm), Dt6(->node), DtB(->key.it), LJ_TSTR, DtB(->key.gcr), LJ_TNIL);
-    dasm_put(Dst, 13446, Dt6(->marked), LJ_GC_BLACK, Dt6(->metatable), Dt6(->metatable), Dt6(->nomm), 1<<MM_newindex, DtB(->next));
-    dasm_put(Dst, 13538, Dt6(->metatable), Dt6(->nomm), 1<<MM_newindex, LJ_TSTR, Dt1(->base), Dt1(->base), Dt6(->marked), cast_byte(~LJ_GC_BLACK), DISPATCH_GL(gc.grayagain), DISPATCH_GL(gc.grayagain), Dt6(->gclist));
+    dasm_put(Dst, 13453, LJ_TTAB, Dt6(->hmask), Dt5(->hash), sizeof(Node), Dt6(->nomm), Dt6(->node), DtB(->key.it), LJ_TSTR, DtB(->key.gcr), LJ_TNIL);
+    dasm_put(Dst, 13528, Dt6(->marked), LJ_GC_BLACK, Dt6(->metatable), Dt6(->metatable), Dt6(->nomm), 1<<MM_newindex, DtB(->next));
+    dasm_put(Dst, 13620, Dt6(->metatable), Dt6(->nomm), 1<<MM_newindex, LJ_TSTR, Dt1(->base), Dt1(->base), Dt6(->marked), cast_byte(~LJ_GC_BLACK), DISPATCH_GL(gc.grayagain), DISPATCH_GL(gc.grayagain), Dt6(->gclist));
     break;
   case BC_TSETB:
-    dasm_put(Dst, 13634, LJ_TTAB, Dt6(->asize), Dt6(->array), LJ_TNIL, Dt6(->marked), LJ_GC_BLACK, Dt6(->metatable));
-    dasm_put(Dst, 13732, Dt6(->metatable), Dt6(->nomm), 1<<MM_newindex, Dt6(->marked), cast_byte(~LJ_GC_BLACK), DISPATCH_GL(gc.grayagain), DISPATCH_GL(gc.grayagain), Dt6(->gclist));
+    dasm_put(Dst, 13716, LJ_TTAB, Dt6(->asize), Dt6(->array), LJ_TNIL, Dt6(->marked), LJ_GC_BLACK, Dt6(->metatable));
+    dasm_put(Dst, 13814, Dt6(->metatable), Dt6(->nomm), 1<<MM_newindex, Dt6(->marked), cast_byte(~LJ_GC_BLACK), DISPATCH_GL(gc.grayagain), DISPATCH_GL(gc.grayagain), Dt6(->gclist));
     break;
 
   case BC_TSETM:
-    dasm_put(Dst, 13778, Dt6(->marked), LJ_GC_BLACK, Dt6(->asize), Dt6(->array), Dt1(->base), Dt1(->base));
-    dasm_put(Dst, 13927, Dt6(->marked), cast_byte(~LJ_GC_BLACK), DISPATCH_GL(gc.grayagain), DISPATCH_GL(gc.grayagain), Dt6(->gclist));
+    dasm_put(Dst, 13860, Dt6(->marked), LJ_GC_BLACK, Dt6(->asize), Dt6(->array), Dt1(->base), Dt1(->base));
+    dasm_put(Dst, 14009, Dt6(->marked), cast_byte(~LJ_GC_BLACK), DISPATCH_GL(gc.grayagain), DISPATCH_GL(gc.grayagain), Dt6(->gclist));
     break;
 
   /* -- Calls and vararg handling ----------------------------------------- */
 
   case BC_CALL: case BC_CALLM:
-    dasm_put(Dst, 11418);
+    dasm_put(Dst, 11500);
     if (op == BC_CALLM) {
-      dasm_put(Dst, 13945);
+      dasm_put(Dst, 14027);
     }
-    dasm_put(Dst, 13950, LJ_TFUNC, Dt7(->pc));
+    dasm_put(Dst, 14032, LJ_TFUNC, Dt7(->pc));
     break;
 
   case BC_CALLMT:
-    dasm_put(Dst, 13945);
+    dasm_put(Dst, 14027);
     break;
   case BC_CALLT:
-    dasm_put(Dst, 13991, LJ_TFUNC, FRAME_TYPE, Dt7(->ffid), Dt7(->pc));
-    dasm_put(Dst, 14109, FRAME_TYPE, Dt7(->pc), PC2PROTO(k), FRAME_VARG, FRAME_TYPEP, FRAME_VARG);
+    dasm_put(Dst, 14073, LJ_TFUNC, FRAME_TYPE, Dt7(->ffid), Dt7(->pc));
+    dasm_put(Dst, 14191, FRAME_TYPE, Dt7(->pc), PC2PROTO(k), FRAME_VARG, FRAME_TYPEP, FRAME_VARG);
     break;
 
   case BC_ITERC:
-    dasm_put(Dst, 14179, LJ_TFUNC, 2+1, Dt7(->pc));
+    dasm_put(Dst, 14261, LJ_TFUNC, 2+1, Dt7(->pc));
     break;
 
   case BC_ITERN:
-#if LJ_HASJIT
-#endif
-    dasm_put(Dst, 14259, Dt6(->asize), Dt6(->array), LJ_TNIL);
+    dasm_put(Dst, 14341, Dt6(->asize), Dt6(->array), LJ_TNIL);
     if (sse) {
-      dasm_put(Dst, 14305);
+      dasm_put(Dst, 14387);
     } else {
-      dasm_put(Dst, 14311);
+      dasm_put(Dst, 14393);
     }
-    dasm_put(Dst, 14317);
+    dasm_put(Dst, 14399);
     if (sse) {
-      dasm_put(Dst, 11288);
+      dasm_put(Dst, 11370);
     } else {
-      dasm_put(Dst, 11300);
+      dasm_put(Dst, 11382);
     }
-    dasm_put(Dst, 14336, -BCBIAS_J*4);
+    dasm_put(Dst, 14418);
+#if LJ_HASJIT
+    dasm_put(Dst, 14434, BC_ITERL, DISPATCH_J(flags), JIT_F_ON, HOTCOUNT_PCMASK, GG_DISP2HOT);
+#endif
+    dasm_put(Dst, 14475, -BCBIAS_J*4);
     if (!sse) {
-      dasm_put(Dst, 14387);
+      dasm_put(Dst, 14537);
     }
-    dasm_put(Dst, 14393, Dt6(->hmask), sizeof(Node), Dt6(->node), DtB(->val.it), LJ_TNIL, DtB(->key.gcr), DtB(->key.it), DtB(->val.gcr), DtB(->val.it));
-    dasm_put(Dst, 14468);
+    dasm_put(Dst, 14543, Dt6(->hmask), sizeof(Node), Dt6(->node), DtB(->val.it), LJ_TNIL, DtB(->key.gcr), DtB(->key.it), DtB(->val.gcr), DtB(->val.it));
+    dasm_put(Dst, 14618);
+#if LJ_HASJIT
+    dasm_put(Dst, 14626, BC_JITERL, BC_JLOOP);
+#endif
     break;
 
   case BC_ISNEXT:
-    dasm_put(Dst, 14476, LJ_TFUNC, LJ_TTAB, LJ_TNIL, Dt8(->ffid), FF_next_N, -BCBIAS_J*4, BC_JMP, -BCBIAS_J*4, BC_ITERC);
+    dasm_put(Dst, 14646, LJ_TFUNC, LJ_TTAB, LJ_TNIL, Dt8(->ffid), FF_next_N, -BCBIAS_J*4, BC_JMP, -BCBIAS_J*4, BC_ITERC);
     break;
 
   case BC_VARG:
-    dasm_put(Dst, 14575, (8+FRAME_VARG), LJ_TNIL, Dt1(->maxstack));
-    dasm_put(Dst, 14739, Dt1(->base), Dt1(->top), Dt1(->base), Dt1(->top));
+    dasm_put(Dst, 14745, (8+FRAME_VARG), LJ_TNIL, Dt1(->maxstack));
+    dasm_put(Dst, 14909, Dt1(->base), Dt1(->top), Dt1(->base), Dt1(->top));
     break;
 
   /* -- Returns ----------------------------------------------------------- */
 
   case BC_RETM:
-    dasm_put(Dst, 13945);
+    dasm_put(Dst, 14027);
     break;
 
   case BC_RET: case BC_RET0: case BC_RET1:
     if (op != BC_RET0) {
-      dasm_put(Dst, 14810);
+      dasm_put(Dst, 14980);
     }
-    dasm_put(Dst, 14814, FRAME_TYPE);
+    dasm_put(Dst, 14984, FRAME_TYPE);
     switch (op) {
     case BC_RET:
-      dasm_put(Dst, 14833);
+      dasm_put(Dst, 15003);
       break;
     case BC_RET1:
-      dasm_put(Dst, 14891);
+      dasm_put(Dst, 15061);
       /* fallthrough */
     case BC_RET0:
-      dasm_put(Dst, 14907);
+      dasm_put(Dst, 15077);
     default:
       break;
     }
-    dasm_put(Dst, 14918, Dt7(->pc), PC2PROTO(k));
+    dasm_put(Dst, 15088, Dt7(->pc), PC2PROTO(k));
     if (op == BC_RET) {
-      dasm_put(Dst, 14960, LJ_TNIL);
+      dasm_put(Dst, 15130, LJ_TNIL);
     } else {
-      dasm_put(Dst, 14969, LJ_TNIL);
+      dasm_put(Dst, 15139, LJ_TNIL);
     }
-    dasm_put(Dst, 14976, -FRAME_VARG, FRAME_TYPEP);
+    dasm_put(Dst, 15146, -FRAME_VARG, FRAME_TYPEP);
     if (op != BC_RET0) {
-      dasm_put(Dst, 15000);
+      dasm_put(Dst, 15170);
     }
     dasm_put(Dst, 4704);
     break;
@@ -2213,7 +2231,7 @@ static void build_ins(BuildCtx *ctx, BCOp op, int defop, int cmov, int sse)
 
   case BC_FORL:
 #if LJ_HASJIT
-    dasm_put(Dst, 15004, HOTCOUNT_PCMASK, GG_DISP2HOT);
+    dasm_put(Dst, 15174, HOTCOUNT_PCMASK, GG_DISP2HOT);
 #endif
     break;
 
@@ -2225,57 +2243,57 @@ static void build_ins(BuildCtx *ctx, BCOp op, int defop, int cmov, int sse)
   case BC_FORI:
   case BC_IFORL:
     vk = (op == BC_IFORL || op == BC_JFORL);
-    dasm_put(Dst, 15025);
+    dasm_put(Dst, 15195);
     if (!vk) {
-      dasm_put(Dst, 15029, LJ_TISNUM, LJ_TISNUM);
+      dasm_put(Dst, 15199, LJ_TISNUM, LJ_TISNUM);
     }
-    dasm_put(Dst, 15048);
+    dasm_put(Dst, 15218);
     if (!vk) {
-      dasm_put(Dst, 15052, LJ_TISNUM);
+      dasm_put(Dst, 15222, LJ_TISNUM);
     }
     if (sse) {
-      dasm_put(Dst, 15061);
+      dasm_put(Dst, 15231);
       if (vk) {
-	dasm_put(Dst, 15073);
+	dasm_put(Dst, 15243);
       } else {
-	dasm_put(Dst, 15092);
+	dasm_put(Dst, 15262);
       }
-      dasm_put(Dst, 15097);
+      dasm_put(Dst, 15267);
     } else {
-      dasm_put(Dst, 15110);
+      dasm_put(Dst, 15280);
       if (vk) {
-	dasm_put(Dst, 15116);
+	dasm_put(Dst, 15286);
       } else {
-	dasm_put(Dst, 15132);
+	dasm_put(Dst, 15302);
       }
-      dasm_put(Dst, 15140);
+      dasm_put(Dst, 15310);
       if (cmov) {
-      dasm_put(Dst, 10833);
+      dasm_put(Dst, 10915);
       } else {
-      dasm_put(Dst, 10839);
+      dasm_put(Dst, 10921);
       }
       if (!cmov) {
-	dasm_put(Dst, 15145);
+	dasm_put(Dst, 15315);
       }
     }
     if (op == BC_FORI) {
-      dasm_put(Dst, 15151, -BCBIAS_J*4);
+      dasm_put(Dst, 15321, -BCBIAS_J*4);
     } else if (op == BC_JFORI) {
-      dasm_put(Dst, 15161, -BCBIAS_J*4, BC_JLOOP);
+      dasm_put(Dst, 15331, -BCBIAS_J*4, BC_JLOOP);
     } else if (op == BC_IFORL) {
-      dasm_put(Dst, 15175, -BCBIAS_J*4);
+      dasm_put(Dst, 15345, -BCBIAS_J*4);
     } else {
-      dasm_put(Dst, 15171, BC_JLOOP);
+      dasm_put(Dst, 15341, BC_JLOOP);
     }
-    dasm_put(Dst, 10868);
+    dasm_put(Dst, 10950);
     if (sse) {
-      dasm_put(Dst, 15185);
+      dasm_put(Dst, 15355);
     }
     break;
 
   case BC_ITERL:
 #if LJ_HASJIT
-    dasm_put(Dst, 15004, HOTCOUNT_PCMASK, GG_DISP2HOT);
+    dasm_put(Dst, 15174, HOTCOUNT_PCMASK, GG_DISP2HOT);
 #endif
     break;
 
@@ -2284,33 +2302,33 @@ static void build_ins(BuildCtx *ctx, BCOp op, int defop, int cmov, int sse)
     break;
 #endif
   case BC_IITERL:
-    dasm_put(Dst, 15196, LJ_TNIL);
+    dasm_put(Dst, 15366, LJ_TNIL);
     if (op == BC_JITERL) {
-      dasm_put(Dst, 15211, BC_JLOOP);
+      dasm_put(Dst, 15381, BC_JLOOP);
     } else {
-      dasm_put(Dst, 15225, -BCBIAS_J*4);
+      dasm_put(Dst, 15395, -BCBIAS_J*4);
     }
-    dasm_put(Dst, 11165);
+    dasm_put(Dst, 11247);
     break;
 
   case BC_LOOP:
 #if LJ_HASJIT
-    dasm_put(Dst, 15004, HOTCOUNT_PCMASK, GG_DISP2HOT);
+    dasm_put(Dst, 15174, HOTCOUNT_PCMASK, GG_DISP2HOT);
 #endif
     break;
 
   case BC_ILOOP:
-    dasm_put(Dst, 10870);
+    dasm_put(Dst, 8249);
     break;
 
   case BC_JLOOP:
 #if LJ_HASJIT
-    dasm_put(Dst, 15241, DISPATCH_J(trace), DtD(->mcode), DISPATCH_GL(jit_base), DISPATCH_GL(jit_L));
+    dasm_put(Dst, 15411, DISPATCH_J(trace), DtD(->mcode), DISPATCH_GL(jit_base), DISPATCH_GL(jit_L));
 #endif
     break;
 
   case BC_JMP:
-    dasm_put(Dst, 15264, -BCBIAS_J*4);
+    dasm_put(Dst, 8244, -BCBIAS_J*4);
     break;
 
   /* -- Function headers -------------------------------------------------- */
@@ -2324,7 +2342,7 @@ static void build_ins(BuildCtx *ctx, BCOp op, int defop, int cmov, int sse)
 
   case BC_FUNCF:
 #if LJ_HASJIT
-    dasm_put(Dst, 15288, HOTCOUNT_PCMASK, GG_DISP2HOT);
+    dasm_put(Dst, 15434, HOTCOUNT_PCMASK, GG_DISP2HOT);
 #endif
   case BC_FUNCV:  /* NYI: compiled vararg functions. */
     break;
@@ -2334,47 +2352,47 @@ static void build_ins(BuildCtx *ctx, BCOp op, int defop, int cmov, int sse)
     break;
 #endif
   case BC_IFUNCF:
-    dasm_put(Dst, 15309, -4+PC2PROTO(k), Dt1(->maxstack), -4+PC2PROTO(numparams));
+    dasm_put(Dst, 15455, -4+PC2PROTO(k), Dt1(->maxstack), -4+PC2PROTO(numparams));
     if (op == BC_JFUNCF) {
-      dasm_put(Dst, 15339, BC_JLOOP);
+      dasm_put(Dst, 14637, BC_JLOOP);
     } else {
-      dasm_put(Dst, 10870);
+      dasm_put(Dst, 8249);
     }
-    dasm_put(Dst, 15348, LJ_TNIL);
+    dasm_put(Dst, 15485, LJ_TNIL);
     break;
 
   case BC_JFUNCV:
 #if !LJ_HASJIT
     break;
 #endif
-    dasm_put(Dst, 10268);
+    dasm_put(Dst, 10350);
     break;  /* NYI: compiled vararg functions. */
 
   case BC_IFUNCV:
-    dasm_put(Dst, 15370, FRAME_VARG, Dt1(->maxstack), -4+PC2PROTO(numparams), LJ_TNIL);
+    dasm_put(Dst, 15507, FRAME_VARG, Dt1(->maxstack), -4+PC2PROTO(numparams), LJ_TNIL);
     if (op == BC_JFUNCV) {
-      dasm_put(Dst, 15339, BC_JLOOP);
+      dasm_put(Dst, 14637, BC_JLOOP);
     } else {
-      dasm_put(Dst, 15461, -4+PC2PROTO(k));
+      dasm_put(Dst, 15598, -4+PC2PROTO(k));
     }
-    dasm_put(Dst, 15483, LJ_TNIL);
+    dasm_put(Dst, 15620, LJ_TNIL);
     break;
 
   case BC_FUNCC:
   case BC_FUNCCW:
-    dasm_put(Dst, 15505, Dt8(->f), Dt1(->base), 8*LUA_MINSTACK, Dt1(->maxstack), Dt1(->top));
+    dasm_put(Dst, 15642, Dt8(->f), Dt1(->base), 8*LUA_MINSTACK, Dt1(->maxstack), Dt1(->top));
     if (op == BC_FUNCC) {
-      dasm_put(Dst, 15534);
+      dasm_put(Dst, 15671);
     } else {
-      dasm_put(Dst, 15538);
+      dasm_put(Dst, 15675);
     }
-    dasm_put(Dst, 15546, DISPATCH_GL(vmstate), ~LJ_VMST_C);
+    dasm_put(Dst, 15683, DISPATCH_GL(vmstate), ~LJ_VMST_C);
     if (op == BC_FUNCC) {
-      dasm_put(Dst, 15555);
+      dasm_put(Dst, 15692);
     } else {
-      dasm_put(Dst, 15559, DISPATCH_GL(wrapf));
+      dasm_put(Dst, 15696, DISPATCH_GL(wrapf));
     }
-    dasm_put(Dst, 15564, DISPATCH_GL(vmstate), ~LJ_VMST_INTERP, Dt1(->base), Dt1(->top));
+    dasm_put(Dst, 15701, DISPATCH_GL(vmstate), ~LJ_VMST_INTERP, Dt1(->base), Dt1(->top));
     break;
 
   /* ---------------------------------------------------------------------- */
@@ -2402,7 +2420,7 @@ static int build_backend(BuildCtx *ctx)
 
   build_subroutines(ctx, cmov, sse);
 
-  dasm_put(Dst, 15589);
+  dasm_put(Dst, 15726);
   for (op = 0; op < BC__MAX; op++)
     build_ins(ctx, (BCOp)op, op, cmov, sse);
 
@@ -243,7 +243,7 @@ LJLIB_ASM(tostring)		LJLIB_REC(.)
 /* This solves a circular dependency problem -- change FF_next_N as needed. */
 LJ_STATIC_ASSERT((int)FF_next == FF_next_N);
 
-LJLIB_ASM(next)
+LJLIB_ASM(next)			LJLIB_REC(.)
 {
   lj_lib_checktab(L, 1);
   return FFH_UNREACHABLE;
@@ -270,7 +270,7 @@ static int ffh_pairs(lua_State *L, MMS mm)
 #endif
 
 LJLIB_PUSH(lastcl)
-LJLIB_ASM(pairs)
+LJLIB_ASM(pairs)		LJLIB_REC(.)
 {
   return ffh_pairs(L, MM_pairs);
 }
@@ -386,10 +386,28 @@ LJLIB_CF(gcinfo)
 LJLIB_CF(collectgarbage)
 {
   int opt = lj_lib_checkopt(L, 1, LUA_GCCOLLECT,  /* ORDER LUA_GC* */
-    "\4stop\7restart\7collect\5count\1\377\4step\10setpause\12setstepmul");
+    "\4stop\7restart\7collect\5count\1\377\4step\10setpause\12setstepmul"
+    "\1\377\1\377\14generational\13incremental\4pace\10steptime");
   int32_t data = lj_lib_optint(L, 2, 0);
   if (opt == LUA_GCCOUNT) {
     setnumV(L->top, cast_num(G(L)->gc.total)/1024.0);
+  } else if (opt == LUA_GCPACE) {
+    int32_t over = lj_lib_optint(L, 3, -1);  /* Heap overhead in percent. */
+    if (over >= 0) G(L)->gc.pause = 100 + (MSize)over;
+    setintV(L->top, lua_gc(L, opt, data));
+  } else if (opt == LUA_GCSTEPTIME) {
+    GCState *gc = &G(L)->gc;
+    setintV(L->top++, (int32_t)gc->stepnum);
+    setnumV(L->top++, cast_num(gc->steptime) / 1000.0);
+    setnumV(L->top++, cast_num(gc->stepmax) / 1000.0);
+    setintV(L->top, (int32_t)gc->stepover);
+    if (data < 0) lua_gc(L, opt, data);  /* Reset the counters. */
+    L->top++;
+    return 4;
+  } else if (opt == LUA_GCGEN || opt == LUA_GCINC) {
+    int res = lua_gc(L, opt, data);
+    setstrV(L, L->top, lj_str_newz(L, res == LUA_GCGEN ? "generational" :
+							 "incremental"));
   } else {
     int res = lua_gc(L, opt, data);
     if (opt == LUA_GCSTEP)
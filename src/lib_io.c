@@ -20,14 +20,21 @@
 #include "lj_gc.h"
 #include "lj_err.h"
 #include "lj_str.h"
+#include "lj_char.h"
 #include "lj_ff.h"
 #include "lj_trace.h"
 #include "lj_lib.h"
 
+#if LJ_TARGET_POSIX
+#include <sys/stat.h>
+#endif
+
 /* Userdata payload for I/O file. */
 typedef struct IOFileUD {
   FILE *fp;		/* File handle. */
   uint32_t type;	/* File type. */
+  char *rbuf;		/* Read-ahead buffer of io.lines(fname) or NULL. */
+  MSize rpos, rlen;	/* Position and end of data in read-ahead buffer. */
 } IOFileUD;
 
 #define IOFILE_TYPE_FILE	0	/* Regular file. */
@@ -37,6 +44,9 @@ typedef struct IOFileUD {
 
 #define IOFILE_FLAG_CLOSE	4	/* Close after io.lines() iterator. */
 
+#define IOFILE_RBUFSIZE		65536	/* Read-ahead size for io.lines(fname). */
+#define IOFILE_LINECHUNK	256	/* Initial chunk size for reading lines. */
+
 #define IOSTDF_UD(L, id)	(&gcref(G(L)->gcroot[(id)])->ud)
 #define IOSTDF_IOF(L, id)	((IOFileUD *)uddata(IOSTDF_UD(L, (id))))
 
@@ -70,11 +80,21 @@ static IOFileUD *io_tofilep(lua_State *L)
   return (IOFileUD *)uddata(udataV(L->base));
 }
 
+/* Return unconsumed read-ahead to the FILE and stop using the buffer. */
+static void io_file_unread(IOFileUD *iof)
+{
+  if (iof->rlen > iof->rpos)
+    fseek(iof->fp, -(long)(iof->rlen - iof->rpos), SEEK_CUR);
+  iof->rbuf = NULL;
+}
+
 static IOFileUD *io_tofile(lua_State *L)
 {
   IOFileUD *iof = io_tofilep(L);
   if (iof->fp == NULL)
     lj_err_caller(L, LJ_ERR_IOCLFL);
+  if (LJ_UNLIKELY(iof->rbuf != NULL))  /* Other uses of an io.lines file. */
+    io_file_unread(iof);
   return iof;
 }
 
@@ -86,22 +106,24 @@ static FILE *io_stdfile(lua_State *L, ptrdiff_t id)
   return iof->fp;
 }
 
-static IOFileUD *io_file_new(lua_State *L)
+/* New file object. Space for a read-ahead buffer of rsz bytes follows it. */
+static IOFileUD *io_file_new(lua_State *L, MSize rsz)
 {
-  IOFileUD *iof = (IOFileUD *)lua_newuserdata(L, sizeof(IOFileUD));
+  IOFileUD *iof = (IOFileUD *)lua_newuserdata(L, sizeof(IOFileUD) + rsz);
   GCudata *ud = udataV(L->top-1);
   ud->udtype = UDTYPE_IO_FILE;
   /* NOBARRIER: The GCudata is new (marked white). */
   setgcrefr(ud->metatable, curr_func(L)->c.env);
   iof->fp = NULL;
   iof->type = IOFILE_TYPE_FILE;
+  iof->rbuf = NULL;
   return iof;
 }
 
-static IOFileUD *io_file_open(lua_State *L, const char *mode)
+static IOFileUD *io_file_open(lua_State *L, const char *mode, MSize rsz)
 {
   const char *fname = strdata(lj_lib_checkstr(L, 1));
-  IOFileUD *iof = io_file_new(L);
+  IOFileUD *iof = io_file_new(L, rsz);
   iof->fp = fopen(fname, mode);
   if (iof->fp == NULL)
     luaL_argerror(L, 1, lj_str_pushf(L, "%s: %s", fname, strerror(errno)));
@@ -133,11 +155,66 @@ static int io_file_close(lua_State *L, IOFileUD *iof)
 
 /* -- Read/write helpers -------------------------------------------------- */
 
+#define IO_MAXNUMLEN	200	/* Max. length of a numeral read by *n. */
+
+/* State for reading a numeral. */
+typedef struct IONumState {
+  FILE *fp;		/* File handle. */
+  int c;		/* Current char. */
+  MSize n;		/* Length of numeral. */
+  char buf[IO_MAXNUMLEN+1];  /* Numeral. */
+} IONumState;
+
+/* Accept the current char if it's in set. */
+static int io_num_accept(IONumState *ns, const char *set)
+{
+  if (ns->c != EOF && ns->c != '\0' && strchr(set, ns->c) != NULL &&
+      ns->n < IO_MAXNUMLEN) {
+    ns->buf[ns->n++] = (char)ns->c;
+    ns->c = getc(ns->fp);
+    return 1;
+  }
+  return 0;
+}
+
+/* Accept a run of digits. Returns the number of digits. */
+static int io_num_digits(IONumState *ns, int hex)
+{
+  int count = 0;
+  while ((hex ? lj_char_isxdigit(ns->c) : lj_char_isdigit(ns->c)) &&
+	 ns->n < IO_MAXNUMLEN) {
+    ns->buf[ns->n++] = (char)ns->c;
+    ns->c = getc(ns->fp);
+    count++;
+  }
+  return count;
+}
+
+/* Read the longest prefix of a numeral and convert it with lj_str_numconv.
+** This is independent of the locale, unlike fscanf.
+*/
 static int io_file_readnum(lua_State *L, FILE *fp)
 {
-  lua_Number d;
-  if (fscanf(fp, LUA_NUMBER_SCAN, &d) == 1) {
-    setnumV(L->top++, d);
+  IONumState ns;
+  int hex = 0, count = 0;
+  ns.fp = fp;
+  ns.n = 0;
+  do { ns.c = getc(fp); } while (lj_char_isspace(ns.c));
+  io_num_accept(&ns, "+-");
+  if (io_num_accept(&ns, "0")) {
+    if (io_num_accept(&ns, "xX")) hex = 1; else count = 1;
+  }
+  count += io_num_digits(&ns, hex);
+  if (io_num_accept(&ns, "."))
+    count += io_num_digits(&ns, hex);
+  if (count > 0 && io_num_accept(&ns, hex ? "pP" : "eE")) {
+    io_num_accept(&ns, "+-");
+    io_num_digits(&ns, 0);
+  }
+  ungetc(ns.c, fp);
+  ns.buf[ns.n] = '\0';
+  if (lj_str_numconv(ns.buf, L->top)) {
+    L->top++;
     return 1;
   } else {
     setnilV(L->top++);
@@ -153,44 +230,120 @@ static int io_file_testeof(lua_State *L, FILE *fp)
   return (c != EOF);
 }
 
+/* Read a line into the temporary buffer and intern it without the EOL.
+** The buffer of the FILE serves as the read-ahead buffer, which is
+** scanned for the EOL by fgets.
+*/
 static int io_file_readline(lua_State *L, FILE *fp)
 {
-  luaL_Buffer b;
-  luaL_buffinit(L, &b);
+  SBuf *sb = &G(L)->tmpbuf;
+  MSize m = IOFILE_LINECHUNK, n = 0;
+  int eol = 0;
   for (;;) {
-    size_t len;
-    char *p = luaL_prepbuffer(&b);
-    if (fgets(p, LUAL_BUFFERSIZE, fp) == NULL) {  /* EOF? */
-      luaL_pushresult(&b);
-      return (strV(L->top-1)->len > 0);  /* Anything read? */
+    char *buf = lj_str_needbuf(L, sb, m), *e;
+    /* Pre-fill with EOLs to find the end of data with embedded NULs. */
+    memset(buf+n, '\n', m-n);
+    if (fgets(buf+n, (int)(m-n), fp) == NULL)  /* EOF? */
+      break;
+    e = (char *)memchr(buf+n, '\n', m-n);
+    if (e == NULL) {  /* Partial line filled the chunk. */
+      n = m-1;
+      m += m;
+    } else if (e+1 < buf+m && e[1] == '\0') {  /* Got an EOL. */
+      n = (MSize)(e - buf);
+      eol = 1;
+      break;
+    } else {  /* Got EOF. The NUL terminator precedes the first fill. */
+      n = (MSize)(e - buf) - 1;
+      break;
     }
-    len = strlen(p);
-    if (len == 0 || p[len-1] != '\n') {  /* Partial line? */
-      luaL_addsize(&b, len);
-    } else {
-      luaL_addsize(&b, len - 1);  /* Don't include EOL. */
-      luaL_pushresult(&b);
-      return 1;  /* Got at least an EOL. */
+  }
+  setstrV(L, L->top++, lj_str_new(L, sb->buf, (size_t)n));
+  lj_gc_check(L);
+  return (eol || n > 0);  /* Anything read? */
+}
+
+/* Read a line via the read-ahead buffer of io.lines(fname). Lines which
+** are completely inside the buffer are interned directly from it.
+*/
+static int io_file_readlinebuf(lua_State *L, IOFileUD *iof)
+{
+  SBuf *sb = &G(L)->tmpbuf;
+  int ok = 0;
+  lj_str_resetbuf(sb);
+  for (;;) {
+    char *p = iof->rbuf + iof->rpos;
+    MSize len = iof->rlen - iof->rpos;
+    char *e = (char *)memchr(p, '\n', len);
+    if (e) {  /* Got an EOL. */
+      len = (MSize)(e - p);
+      iof->rpos += len+1;
+      if (sb->n == 0) {
+	setstrV(L, L->top++, lj_str_new(L, p, (size_t)len));
+	lj_gc_check(L);
+	return 1;
+      }
+      lj_str_bufputmem(L, sb, p, len);
+      ok = 1;
+      break;
+    }
+    if (len) {  /* Keep partial line and refill. */
+      lj_str_bufputmem(L, sb, p, len);
+      ok = 1;
     }
+    iof->rpos = 0;
+    iof->rlen = (MSize)fread(iof->rbuf, 1, IOFILE_RBUFSIZE, iof->fp);
+    if (iof->rlen == 0)  /* EOF or error. */
+      break;
   }
+  setstrV(L, L->top++, lj_str_new(L, sb->buf, (size_t)sb->n));
+  lj_gc_check(L);
+  return ok;
 }
 
-static int io_file_readchars(lua_State *L, FILE *fp, size_t n)
+/* Read up to len chars. The buffer grows geometrically up to len. */
+static int io_file_readchars(lua_State *L, FILE *fp, MSize len)
 {
-  size_t rlen;  /* how much to read */
-  size_t nr;  /* number of chars actually read */
-  luaL_Buffer b;
-  luaL_buffinit(L, &b);
-  rlen = LUAL_BUFFERSIZE;  /* try to read that much each time */
-  do {
-    char *p = luaL_prepbuffer(&b);
-    if (rlen > n) rlen = n;  /* cannot read more than asked */
-    nr = fread(p, 1, rlen, fp);
-    luaL_addsize(&b, nr);
-    n -= nr;  /* still have to read `n' chars */
-  } while (n > 0 && nr == rlen);  /* until end of count or eof */
-  luaL_pushresult(&b);  /* close buffer */
-  return (n == 0 || strV(L->top-1)->len > 0);
+  SBuf *sb = &G(L)->tmpbuf;
+  MSize m = len < LUAL_BUFFERSIZE ? len : LUAL_BUFFERSIZE, n = 0;
+  char *buf;
+  for (;;) {
+    buf = lj_str_needbuf(L, sb, m);
+    n += (MSize)fread(buf+n, 1, m-n, fp);
+    if (n != m || m == len) break;
+    m = len - m > m ? m + m : len;
+  }
+  setstrV(L, L->top++, lj_str_new(L, buf, (size_t)n));
+  lj_gc_check(L);
+  return (n > 0);
+}
+
+/* Read the rest of the file. Regular files are read with a single fread,
+** sized from the remaining length of the file.
+*/
+static void io_file_readall(lua_State *L, FILE *fp)
+{
+  SBuf *sb = &G(L)->tmpbuf;
+  MSize m = LUAL_BUFFERSIZE, n = 0;
+  char *buf;
+#if LJ_TARGET_POSIX
+  struct stat st;
+  long pos;
+  if (fstat(fileno(fp), &st) == 0 && S_ISREG(st.st_mode) &&
+      (pos = ftell(fp)) >= 0 && (uint64_t)st.st_size > (uint64_t)pos &&
+      (uint64_t)st.st_size - (uint64_t)pos < (uint64_t)(LJ_MAX_STR >> 1))
+    m = (MSize)(st.st_size - pos) + 1;  /* One more to detect the EOF. */
+#endif
+  for (;; m += m) {
+    buf = lj_str_needbuf(L, sb, m);
+    n += (MSize)fread(buf+n, 1, m-n, fp);
+    if (n != m) break;
+  }
+  setstrV(L, L->top++, lj_str_new(L, buf, (size_t)n));
+  /* Don't let the shared buffer keep the size of the file. */
+  if (sb->sz > LUAL_BUFFERSIZE)
+    lj_str_resizebuf(L, sb, LUAL_BUFFERSIZE);
+  lj_gc_check(L);
 }
 
 static int io_file_read(lua_State *L, FILE *fp, int start)
@@ -214,11 +367,11 @@ static int io_file_read(lua_State *L, FILE *fp, int start)
 	else if (p[1] == 'l')
 	  ok = io_file_readline(L, fp);
 	else if (p[1] == 'a')
-	  io_file_readchars(L, fp, ~((size_t)0));
+	  io_file_readall(L, fp);
 	else
 	  lj_err_arg(L, n+1, LJ_ERR_INVFMT);
       } else if (tvisnum(L->base+n)) {
-	size_t len = (size_t)lj_lib_checkint(L, n+1);
+	MSize len = (MSize)lj_lib_checkint(L, n+1);
 	ok = len ? io_file_readchars(L, fp, len) : io_file_testeof(L, fp);
       } else {
 	lj_err_arg(L, n+1, LJ_ERR_INVOPT);
@@ -242,6 +395,9 @@ static int io_file_write(lua_State *L, FILE *fp, int start)
       status = status && (fwrite(strVdata(tv), 1, len, fp) == len);
     } else if (tvisnum(tv)) {
       status = status && (fprintf(fp, LUA_NUMBER_FMT, numV(tv)) > 0);
+    } else if (tvisudata(tv) && udataV(tv)->udtype == UDTYPE_BUFFER) {
+      SBuf *sb = (SBuf *)uddata(udataV(tv));  /* Write buffer in-place. */
+      status = status && (fwrite(sb->buf, 1, sb->n, fp) == sb->n);
     } else {
       lj_err_argt(L, cast_int(tv - L->base) + 1, LUA_TSTRING);
     }
@@ -367,7 +523,7 @@ LJLIB_CF(io_open)
   const char *fname = strdata(lj_lib_checkstr(L, 1));
   GCstr *s = lj_lib_optstr(L, 2);
   const char *mode = s ? strdata(s) : "r";
-  IOFileUD *iof = io_file_new(L);
+  IOFileUD *iof = io_file_new(L, 0);
   iof->fp = fopen(fname, mode);
   return iof->fp != NULL ? 1 : io_pushresult(L, 0, fname);
 }
@@ -378,7 +534,7 @@ LJLIB_CF(io_popen)
   const char *fname = strdata(lj_lib_checkstr(L, 1));
   GCstr *s = lj_lib_optstr(L, 2);
   const char *mode = s ? strdata(s) : "r";
-  IOFileUD *iof = io_file_new(L);
+  IOFileUD *iof = io_file_new(L, 0);
   iof->type = IOFILE_TYPE_PIPE;
 #if LJ_TARGET_POSIX
   fflush(NULL);
@@ -394,7 +550,7 @@ LJLIB_CF(io_popen)
 
 LJLIB_CF(io_tmpfile)
 {
-  IOFileUD *iof = io_file_new(L);
+  IOFileUD *iof = io_file_new(L, 0);
   iof->fp = tmpfile();
   return iof->fp != NULL ? 1 : io_pushresult(L, 0, NULL);
 }
@@ -426,7 +582,7 @@ static int io_std_getset(lua_State *L, ptrdiff_t id, const char *mode)
       io_tofile(L);
       L->top = L->base+1;
     } else {
-      io_file_open(L, mode);
+      io_file_open(L, mode, 0);
     }
     /* NOBARRIER: The standard I/O handles are GC roots. */
     setgcref(G(L)->gcroot[id], gcV(L->top-1));
@@ -448,8 +604,14 @@ LJLIB_CF(io_output)
 
 LJLIB_NOREG LJLIB_CF(io_lines_iter)
 {
-  IOFileUD *iof = io_tofile(L);
-  int ok = io_file_readline(L, iof->fp);
+  IOFileUD *iof = io_tofilep(L);
+  int ok;
+  if (iof->fp == NULL)
+    lj_err_caller(L, LJ_ERR_IOCLFL);
+  if (iof->rbuf != NULL)
+    ok = io_file_readlinebuf(L, iof);
+  else
+    ok = io_file_readline(L, iof->fp);
   if (ferror(iof->fp))
     lj_err_callermsg(L, strerror(errno));
   if (!ok && (iof->type & IOFILE_FLAG_CLOSE))
@@ -461,8 +623,17 @@ LJLIB_PUSH(top-3)  /* io_lines_iter */
 LJLIB_CF(io_lines)
 {
   if (L->base < L->top && !tvisnil(L->base)) {  /* io.lines(fname) */
-    IOFileUD *iof = io_file_open(L, "r");
+    IOFileUD *iof = io_file_open(L, "r", IOFILE_RBUFSIZE);
     iof->type = IOFILE_TYPE_FILE|IOFILE_FLAG_CLOSE;
+#if LJ_TARGET_POSIX
+    {  /* Only regular files can give back unconsumed read-ahead. */
+      struct stat st;
+      if (fstat(fileno(iof->fp), &st) == 0 && S_ISREG(st.st_mode)) {
+	iof->rbuf = (char *)(iof+1);
+	iof->rpos = iof->rlen = 0;
+      }
+    }
+#endif
     setfuncV(L, L->top-2, funcV(lj_lib_upvalue(L, 1)));
   } else {  /* io.lines() iterates over stdin. */
     setfuncV(L, L->top, funcV(lj_lib_upvalue(L, 1)));
@@ -497,6 +668,7 @@ static GCobj *io_std_new(lua_State *L, FILE *fp, const char *name)
   setgcref(ud->metatable, gcV(L->top-3));
   iof->fp = fp;
   iof->type = IOFILE_TYPE_STDF;
+  iof->rbuf = NULL;
   lua_setfield(L, -2, name);
   return obj2gco(ud);
 }
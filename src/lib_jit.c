@@ -21,9 +21,13 @@
 #include "lj_jit.h"
 #include "lj_iropt.h"
 #endif
+#include "lj_frame.h"
 #include "lj_dispatch.h"
 #include "lj_vm.h"
 #include "lj_vmevent.h"
+#if LJ_HASPROFILE
+#include "lj_profile.h"
+#endif
 #include "lj_lib.h"
 
 #include "luajit.h"
@@ -278,12 +282,15 @@ LJLIB_CF(jit_util_traceinfo)
   GCtrace *T = jit_checktrace(L);
   if (T) {
     GCtab *t;
-    lua_createtable(L, 0, 4);  /* Increment hash size if fields are added. */
+    lua_createtable(L, 0, 8);  /* Increment hash size if fields are added. */
     t = tabV(L->top-1);
     setintfield(L, t, "nins", (int32_t)T->nins - REF_BIAS - 1);
     setintfield(L, t, "nk", REF_BIAS - (int32_t)T->nk);
     setintfield(L, t, "link", T->link);
     setintfield(L, t, "nexit", T->nsnap);
+    setintfield(L, t, "szmcode", (int32_t)T->szmcode);
+    setintfield(L, t, "nspill", T->nspill);
+    setintfield(L, t, "nrestore", T->nrestore);
     /* There are many more fields. Add them only when needed. */
     return 1;
   }
@@ -503,6 +510,221 @@ LJLIB_CF(jit_opt_start)
 
 #include "lj_libdef.h"
 
+/* -- jit.profile module -------------------------------------------------- */
+
+#define LJLIB_MODULE_jit_profile
+
+#if LJ_HASPROFILE
+/* Registry keys for the profiler callback and the thread it runs on. */
+#define PROFILE_REGKEY_FUNC	"_PROFILE_FUNC"
+#define PROFILE_REGKEY_THREAD	"_PROFILE_THREAD"
+
+/* Run the Lua callback on its own thread to keep the sampled stack intact. */
+static void jit_profile_callback(void *data, lua_State *L, int samples,
+				 int vmstate)
+{
+  lua_State *L2 = (lua_State *)data;
+  lua_checkstack(L2, 8);
+  lua_getfield(L2, LUA_REGISTRYINDEX, PROFILE_REGKEY_FUNC);
+  if (lua_isfunction(L2, -1)) {
+    char vmst = vmstate >= 0 ? 'N' :
+		vmstate == ~LJ_VMST_INTERP ? 'I' :
+		vmstate == ~LJ_VMST_C ? 'C' :
+		vmstate == ~LJ_VMST_GC ? 'G' : 'J';
+    int nargs = 3;
+    setgcV(L2, L2->top++, obj2gco(L), LJ_TTHREAD);
+    lua_pushinteger(L2, samples);
+    lua_pushlstring(L2, &vmst, 1);
+    if (vmstate >= 0) {  /* Add trace number and location, if known. */
+      GCproto *pt;
+      BCPos pos;
+      lua_pushinteger(L2, vmstate);
+      nargs++;
+      if (lj_profile_traceframes(L, vmstate, &pt, &pos, 1)) {
+	lj_err_pushloc(L2, pt, pos);
+	nargs++;
+      }
+    }
+    /* callback(thread, samples, vmstate [, trace [, loc]]) */
+    if (lua_pcall(L2, nargs, 0, 0)) {
+      /* Really shouldn't use stderr here, but where else to complain? */
+      fprintf(stderr, "Profiler callback failed: %s\n",
+	      lua_isstring(L2, -1) ? lua_tostring(L2, -1) : "?");
+      lua_pop(L2, 1);
+    }
+  } else {
+    lua_pop(L2, 1);
+  }
+}
+
+/* Max. number of frames recovered from a trace sample. */
+#define PROFILE_MAXTRFRAMES	64
+
+/* Get the info for frame j of a dumped stack. The frames of the sampled
+** trace come first, followed by the interpreter frames below the start
+** frame of the trace.
+*/
+static void jit_profile_getframe(lua_State *L1, int j, GCproto **pts,
+				 BCPos *pos, int ntr, int lev0, lua_Debug *ar)
+{
+  if (j < ntr) {
+    GCproto *pt = pts[j];
+    ar->source = strdata(proto_chunkname(pt));
+    ar->linedefined = (int)proto_line(pt, 0);
+    ar->what = ar->linedefined == 0 ? "main" : "Lua";
+    ar->currentline = pos[j] < pt->sizebc ? (int)proto_line(pt, pos[j]) : -1;
+    ar->name = NULL;
+    if (j+1 < ntr) {  /* Called from an outer frame of the trace. */
+      if (pos[j+1] < pts[j+1]->sizebc &&
+	  !lj_err_callname(L1, pts[j+1], pos[j+1], &ar->name))
+	ar->name = NULL;
+    } else if (lev0 > 0 && lua_getstack(L1, lev0-1, ar)) {
+      lua_getinfo(L1, "n", ar);  /* Start frame is still on the stack. */
+    }
+  } else {
+    lua_getstack(L1, lev0 + j - ntr, ar);
+    lua_getinfo(L1, "Snl", ar);
+  }
+}
+
+/* Add short source name and line, like lj_err_pushloc(). */
+static void jit_profile_addloc(luaL_Buffer *b, const char *s, int line)
+{
+  char buf[16];
+  if (*s == '@') {
+    const char *p;
+    for (p = ++s; *p; p++)
+      if (*p == '/' || *p == '\\') s = p+1;
+  } else if (*s == '=') {
+    s++;
+  }
+  luaL_addstring(b, s);
+  if (line >= 0) {
+    sprintf(buf, ":%d", line);
+    luaL_addstring(b, buf);
+  }
+}
+#endif
+
+/* jit.profile.start(mode, func) */
+LJLIB_CF(jit_profile_start)
+{
+#if LJ_HASPROFILE
+  GCstr *mode = lj_lib_optstr(L, 1);
+  int interval = 10;
+  lj_lib_checkfunc(L, 2);
+  if (mode) {  /* Only the sample interval can be set: "i<ms>". */
+    const char *m = strchr(strdata(mode), 'i');
+    if (m) interval = atoi(m+1);
+  }
+  lua_pushvalue(L, 2);
+  lua_setfield(L, LUA_REGISTRYINDEX, PROFILE_REGKEY_FUNC);
+  lua_newthread(L);
+  lua_pushvalue(L, -1);
+  lua_setfield(L, LUA_REGISTRYINDEX, PROFILE_REGKEY_THREAD);
+  if (!lj_profile_start(L, interval, jit_profile_callback,
+			threadV(L->top-1)))
+    lj_err_caller(L, LJ_ERR_PROFRUN);
+#else
+  lj_err_caller(L, LJ_ERR_NOPROF);
+#endif
+  return 0;
+}
+
+/* jit.profile.stop() */
+LJLIB_CF(jit_profile_stop)
+{
+#if LJ_HASPROFILE
+  lj_profile_stop(L);
+  lua_pushnil(L);
+  lua_setfield(L, LUA_REGISTRYINDEX, PROFILE_REGKEY_FUNC);
+  lua_pushnil(L);
+  lua_setfield(L, LUA_REGISTRYINDEX, PROFILE_REGKEY_THREAD);
+#endif
+  return 0;
+}
+
+/* local s = jit.profile.dumpstack([thread,] fmt, depth [, trace])
+**
+** Format characters, repeated for each frame:
+**   l  source:currentline   f  function name or source:linedefined
+**   Z  zap the last character at the end
+** Any other character is copied. A negative depth dumps the outermost
+** frame first, as needed for flame graphs. Passing the trace number of a
+** sample from inside the profiler callback dumps the frames of the trace
+** at the sampled location instead of the interpreter frames above them.
+*/
+LJLIB_CF(jit_profile_dumpstack)
+{
+#if LJ_HASPROFILE
+  lua_State *L1 = L;
+  int arg = 1, depth, tr, n, j, total, dir = 1, ntr = 0, lev0 = 0;
+  GCproto *pts[PROFILE_MAXTRFRAMES];
+  BCPos pos[PROFILE_MAXTRFRAMES];
+  const char *fmt;
+  luaL_Buffer b;
+  lua_Debug ar;
+  if (L->top > L->base && tvisthread(L->base)) {
+    L1 = threadV(L->base);
+    arg++;
+  }
+  fmt = luaL_optstring(L, arg, "f;");
+  depth = lj_lib_optint(L, arg+1, 1);
+  tr = lj_lib_optint(L, arg+2, 0);
+  if (tr > 0 &&
+      (ntr = (int)lj_profile_traceframes(L1, tr, pts, pos,
+					 PROFILE_MAXTRFRAMES)) > 0) {
+    /* Skip the interpreter frames down to the start frame of the trace. */
+    int size;
+    cTValue *frame;
+    for (n = 0; (frame = lj_err_getframe(L1, n, &size)) != NULL; n++)
+      if (isluafunc(frame_func(frame)) &&
+	  funcproto(frame_func(frame)) == pts[ntr-1]) {
+	lev0 = n+1;
+	break;
+      }
+  }
+  if (depth < 0) {  /* Start with the outermost frame. */
+    depth = -depth;
+    dir = -1;
+  }
+  for (total = ntr < depth ? ntr : depth;
+       total < depth && lua_getstack(L1, lev0 + total - ntr, &ar); total++) ;
+  luaL_buffinit(L, &b);
+  for (n = 0, j = dir > 0 ? 0 : total-1; n < total; n++, j += dir) {
+    const char *p;
+    jit_profile_getframe(L1, j, pts, pos, ntr, lev0, &ar);
+    for (p = fmt; *p; p++) {
+      if (*p == 'l') {
+	if (*ar.what == 'C')
+	  luaL_addstring(&b, ar.name ? ar.name : "[C]");
+	else
+	  jit_profile_addloc(&b, ar.source, ar.currentline);
+      } else if (*p == 'f') {
+	if (ar.name)
+	  luaL_addstring(&b, ar.name);
+	else if (*ar.what == 'C')
+	  luaL_addstring(&b, "[C]");
+	else if (*ar.what == 'm')
+	  jit_profile_addloc(&b, ar.source, -1);
+	else
+	  jit_profile_addloc(&b, ar.source, ar.linedefined);
+      } else if (*p != 'Z') {
+	luaL_addchar(&b, *p);
+      }
+    }
+  }
+  if (strchr(fmt, 'Z') && b.p > b.buffer) b.p--;
+  luaL_pushresult(&b);
+  return 1;
+#else
+  lj_err_caller(L, LJ_ERR_NOPROF);
+  return 0;
+#endif
+}
+
+#include "lj_libdef.h"
+
 /* -- JIT compiler initialization ----------------------------------------- */
 
 #if LJ_HASJIT
@@ -594,7 +816,8 @@ LUALIB_API int luaopen_jit(lua_State *L)
   LJ_LIB_REG_(L, "jit.util", jit_util);
 #endif
   LJ_LIB_REG_(L, "jit.opt", jit_opt);
-  L->top -= 2;
+  LJ_LIB_REG_(L, "jit.profile", jit_profile);
+  L->top -= 3;
   jit_init(L);
   return 1;
 }
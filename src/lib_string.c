@@ -20,9 +20,11 @@
 #include "lj_err.h"
 #include "lj_str.h"
 #include "lj_tab.h"
+#include "lj_udata.h"
 #include "lj_state.h"
 #include "lj_ff.h"
 #include "lj_char.h"
+#include "lj_bcdump.h"
 #include "lj_lib.h"
 
 /* ------------------------------------------------------------------------ */
@@ -114,10 +116,30 @@ LJLIB_ASM_(string_upper)
 
 /* ------------------------------------------------------------------------ */
 
+/* Writer for string.dump. Appends to the temporary buffer. */
+static int writer_buf(lua_State *L, const void *p, size_t size, void *sb)
+{
+  SBuf *b = (SBuf *)sb;
+  MSize n = b->n + (MSize)size;
+  if (n > b->sz)
+    lj_str_needbuf(L, b, n < 2*b->sz ? 2*b->sz : n);
+  memcpy(b->buf + b->n, p, size);
+  b->n = n;
+  return 0;
+}
+
 LJLIB_CF(string_dump)
 {
-  lj_err_caller(L, LJ_ERR_STRDUMP);
-  return 0;  /* unreachable */
+  GCfunc *fn = lj_lib_checkfunc(L, 1);
+  int strip = L->base+1 < L->top && tvistruecond(L->base+1);
+  SBuf *sb = &G(L)->tmpbuf;
+  L->top = L->base+1;
+  lj_str_resetbuf(sb);
+  if (!isluafunc(fn) || lj_bcwrite(L, funcproto(fn), writer_buf, sb, strip))
+    lj_err_caller(L, LJ_ERR_STRDUMP);
+  setstrV(L, L->top-1, lj_str_new(L, sb->buf, sb->n));
+  lj_gc_check(L);
+  return 1;
 }
 
 /* ------------------------------------------------------------------------ */
@@ -235,15 +257,11 @@ static int singlematch(int c, const char *p, const char *ep)
 
 static const char *match(MatchState *ms, const char *s, const char *p);
 
-static const char *matchbalance(MatchState *ms, const char *s, const char *p)
+static const char *balance(MatchState *ms, const char *s, int b, int e)
 {
-  if (*p == 0 || *(p+1) == 0)
-    lj_err_caller(ms->L, LJ_ERR_STRPATU);
-  if (*s != *p) {
+  if (*s != b) {
     return NULL;
   } else {
-    int b = *p;
-    int e = *(p+1);
     int cont = 1;
     while (++s < ms->src_end) {
       if (*s == e) {
@@ -256,6 +274,13 @@ static const char *matchbalance(MatchState *ms, const char *s, const char *p)
   return NULL;  /* string ends out of balance */
 }
 
+static const char *matchbalance(MatchState *ms, const char *s, const char *p)
+{
+  if (*p == 0 || *(p+1) == 0)
+    lj_err_caller(ms->L, LJ_ERR_STRPATU);
+  return balance(ms, s, *p, *(p+1));
+}
+
 static const char *max_expand(MatchState *ms, const char *s,
 			      const char *p, const char *ep)
 {
@@ -394,30 +419,324 @@ static const char *match(MatchState *ms, const char *s, const char *p)
   }
 }
 
-static const char *lmemfind(const char *s1, size_t l1,
-			    const char *s2, size_t l2)
+/* ------------------------------------------------------------------------ */
+
+/* Compiled patterns.
+**
+** A pattern is compiled to an array of items, once. Single char items get
+** a bitmap of the chars they match, so classes and brackets are not parsed
+** again at every step of the backtracking matcher. Repetitions skip the
+** positions where the following item cannot match. Unanchored searches
+** scan for the first char of a match with memchr() or the bitmap.
+**
+** Compiled patterns are cached by pattern string in the GC roots. A
+** malformed pattern is cached as a negative entry and left to match(),
+** which throws the same errors at the same point as before. Patterns
+** longer than LJ_MAX_PATLEN are not compiled, either.
+*/
+
+enum {
+  PAT_CHAR, PAT_ANY, PAT_SET,	/* Single char items. */
+  PAT_OPEN, PAT_OPENPOS, PAT_CLOSE, PAT_BALANCE, PAT_FRONTIER, PAT_BACKREF,
+  PAT_EOS, PAT_END
+};
+
+typedef struct PatItem {
+  uint8_t op;		/* Item type (PAT_*). */
+  uint8_t rep;		/* Repetition: 0, '?', '*', '+' or '-'. */
+  uint8_t a, b;		/* Char, balance chars or capture index char. */
+  uint32_t set[8];	/* Bitmap of matching chars. */
+} PatItem;
+
+typedef struct PatProg {
+  uint32_t anchor;	/* Pattern starts with '^'. */
+  uint32_t scan;	/* Index of item to scan for or ~0u. */
+  PatItem item[1];	/* Items, up to PAT_END. */
+} PatProg;
+
+#define pat_test(pi, c)	(((pi)->set[(c) >> 5] >> ((c) & 31)) & 1)
+
+/* Single char item which must match at least once. */
+#define pat_mustmatch(pi) \
+  ((pi)->op <= PAT_SET && ((pi)->rep == 0 || (pi)->rep == '+'))
+
+/* Like classend(), but returns NULL for a malformed class. */
+static const char *pat_classend(const char *p)
+{
+  switch (*p++) {
+  case L_ESC:
+    return *p == '\0' ? NULL : p+1;
+  case '[':
+    if (*p == '^') p++;
+    do {
+      if (*p == '\0')
+	return NULL;
+      if (*(p++) == L_ESC && *p != '\0')
+	p++;
+    } while (*p != ']');
+    return p+1;
+  default:
+    return p;
+  }
+}
+
+/* Compile a pattern. Returns the number of items, including PAT_END, or
+** 0 for a malformed pattern. With pp = NULL, only the items are counted.
+*/
+static MSize pat_compile(PatProg *pp, const char *p)
 {
-  if (l2 == 0) {
-    return s1;  /* empty strings are everywhere */
-  } else if (l2 > l1) {
-    return NULL;  /* avoids a negative `l1' */
-  } else {
-    const char *init;  /* to search for a `*s2' inside `s1' */
-    l2--;  /* 1st char will be checked by `memchr' */
-    l1 = l1-l2;  /* `s2' cannot be found after that */
-    while (l1 > 0 && (init = (const char *)memchr(s1, *s2, l1)) != NULL) {
-      init++;   /* 1st char is already checked */
-      if (memcmp(init, s2+1, l2) == 0) {
-	return init-1;
-      } else {  /* correct `l1' and `s1' to try again */
-	l1 -= (size_t)(init-s1);
-	s1 = init;
+  PatProg tmp;
+  PatItem *pi;
+  MSize n = 1, count = (pp == NULL);
+  if (count) pp = &tmp;  /* Compile every item to item[0]. */
+  pi = pp->item;
+  pp->anchor = (*p == '^');
+  p += pp->anchor;
+  pp->scan = ~0u;
+  for (;; pi += !count, n++) {
+    const char *ep;
+    int c, k;
+    pi->rep = 0;
+    switch (*p) {
+    case '(':
+      if (*(p+1) == ')') { pi->op = PAT_OPENPOS; p += 2; }
+      else { pi->op = PAT_OPEN; p++; }
+      continue;
+    case ')':
+      pi->op = PAT_CLOSE; p++;
+      continue;
+    case '\0':
+      pi->op = PAT_END;
+      return n;
+    case '$':
+      if (*(p+1) == '\0') { pi->op = PAT_EOS; p++; continue; }
+      break;
+    case L_ESC:
+      if (*(p+1) == 'b') {
+	if (*(p+2) == '\0' || *(p+3) == '\0')
+	  return 0;
+	pi->op = PAT_BALANCE; pi->a = uchar(*(p+2)); pi->b = uchar(*(p+3));
+	p += 4;
+	continue;
+      } else if (*(p+1) == 'f') {
+	p += 2;
+	if (*p != '[' || (ep = pat_classend(p)) == NULL)
+	  return 0;
+	pi->op = PAT_FRONTIER;
+	memset(pi->set, 0, sizeof(pi->set));
+	for (c = 0; c < 256; c++)
+	  if (matchbracketclass(c, p, ep-1))
+	    pi->set[c >> 5] |= 1u << (c & 31);
+	p = ep;
+	continue;
+      } else if (lj_char_isdigit(uchar(*(p+1)))) {
+	pi->op = PAT_BACKREF; pi->a = uchar(*(p+1));
+	p += 2;
+	continue;
+      }
+      break;
+    default:
+      break;
+    }
+    /* Single char item with optional repetition. */
+    if ((ep = pat_classend(p)) == NULL)
+      return 0;
+    memset(pi->set, 0, sizeof(pi->set));
+    for (c = k = 0; c < 256; c++)
+      if (singlematch(c, p, ep)) {
+	pi->set[c >> 5] |= 1u << (c & 31);
+	pi->a = (uint8_t)c;
+	k++;
+      }
+    pi->op = k == 256 ? PAT_ANY : k == 1 ? PAT_CHAR : PAT_SET;
+    if (*ep == '?' || *ep == '*' || *ep == '+' || *ep == '-')
+      pi->rep = uchar(*ep++);
+    if (pp->scan == ~0u && pi->op != PAT_ANY && pat_mustmatch(pi)) {
+      const PatItem *pj = pp->item;
+      while (pj->op == PAT_OPEN || pj->op == PAT_OPENPOS) pj++;
+      if (pj == pi)  /* Only captures before the first item? */
+	pp->scan = (uint32_t)(pi - pp->item);
+    }
+    p = ep;
+  }
+}
+
+/* Get the compiled pattern for a pattern string. Returns NULL if the
+** pattern is malformed or too long. Note: the result is only anchored by
+** the cache.
+*/
+static GCudata *pat_get(lua_State *L, GCstr *ps)
+{
+  global_State *g = G(L);
+  GCRef *ref = &g->gcroot[GCROOT_PATCACHE + 2*(ps->hash&(LJ_MAX_PATCACHE-1))];
+  GCudata *ud = NULL;
+  MSize n;
+  if (gcref(ref[0]) == obj2gco(ps))
+    return gcref(ref[1]) ? gco2ud(gcref(ref[1])) : NULL;
+  if (ps->len > LJ_MAX_PATLEN)
+    return NULL;
+  if ((n = pat_compile(NULL, strdata(ps))) != 0) {
+    ud = lj_udata_new(L, (MSize)(sizeof(PatProg) + (n-1)*sizeof(PatItem)),
+		      tabref(L->env));
+    pat_compile((PatProg *)uddata(ud), strdata(ps));
+  }
+  setgcref(ref[0], obj2gco(ps));
+  setgcrefp(ref[1], ud);
+  return ud;
+}
+
+/* Find the next position where a match may start. Returns NULL if none. */
+static const char *pat_scan(const PatProg *pp, const char *s, const char *e)
+{
+  const PatItem *pi = &pp->item[pp->scan];
+  if (pi->op == PAT_CHAR)
+    return (const char *)memchr(s, pi->a, (size_t)(e - s));
+  for (; s < e; s++)
+    if (pat_test(pi, uchar(*s)))
+      return s;
+  return NULL;
+}
+
+static const char *pmatch(MatchState *ms, const char *s, const PatItem *pi);
+
+static const char *pmax_expand(MatchState *ms, const char *s,
+			       const PatItem *pi)
+{
+  const PatItem *nx = pi+1;
+  int skip = pat_mustmatch(nx);
+  ptrdiff_t i = 0;  /* counts maximum expand for item */
+  if (pi->op == PAT_ANY)
+    i = ms->src_end - s;
+  else
+    while ((s+i)<ms->src_end && pat_test(pi, uchar(*(s+i))))
+      i++;
+  /* keeps trying to match with the maximum repetitions */
+  for (; i >= 0; i--) {
+    const char *res;
+    if (skip && ((s+i) >= ms->src_end || !pat_test(nx, uchar(*(s+i)))))
+      continue;  /* next item cannot match here */
+    if ((res = pmatch(ms, s+i, nx)) != NULL)
+      return res;
+  }
+  return NULL;
+}
+
+static const char *pmin_expand(MatchState *ms, const char *s,
+			       const PatItem *pi)
+{
+  const PatItem *nx = pi+1;
+  int skip = pat_mustmatch(nx);
+  for (;;) {
+    if (skip) {  /* skip ahead to where the next item can match */
+      if (pi->op == PAT_ANY && nx->op == PAT_CHAR) {
+	s = (const char *)memchr(s, nx->a, (size_t)(ms->src_end - s));
+	if (s == NULL) return NULL;
+      } else {
+	while (s<ms->src_end && !pat_test(nx, uchar(*s))) {
+	  if (!pat_test(pi, uchar(*s))) return NULL;
+	  s++;
+	}
+	if (s >= ms->src_end) return NULL;
       }
     }
-    return NULL;  /* not found */
+    {
+      const char *res = pmatch(ms, s, nx);
+      if (res != NULL)
+	return res;
+      else if (s<ms->src_end && pat_test(pi, uchar(*s)))
+	s++;  /* try with one more repetition */
+      else
+	return NULL;
+    }
   }
 }
 
+static const char *pstart_capture(MatchState *ms, const char *s,
+				  const PatItem *pi, int what)
+{
+  const char *res;
+  int level = ms->level;
+  if (level >= LUA_MAXCAPTURES) lj_err_caller(ms->L, LJ_ERR_STRCAPN);
+  ms->capture[level].init = s;
+  ms->capture[level].len = what;
+  ms->level = level+1;
+  if ((res=pmatch(ms, s, pi)) == NULL)  /* match failed? */
+    ms->level--;  /* undo capture */
+  return res;
+}
+
+static const char *pend_capture(MatchState *ms, const char *s,
+				const PatItem *pi)
+{
+  int l = capture_to_close(ms);
+  const char *res;
+  ms->capture[l].len = s - ms->capture[l].init;  /* close capture */
+  if ((res = pmatch(ms, s, pi)) == NULL)  /* match failed? */
+    ms->capture[l].len = CAP_UNFINISHED;  /* undo capture */
+  return res;
+}
+
+/* Same as match(), but for a compiled pattern. */
+static const char *pmatch(MatchState *ms, const char *s, const PatItem *pi)
+{
+  for (;;) {
+    switch (pi->op) {
+    case PAT_OPEN:
+      return pstart_capture(ms, s, pi+1, CAP_UNFINISHED);
+    case PAT_OPENPOS:
+      return pstart_capture(ms, s, pi+1, CAP_POSITION);
+    case PAT_CLOSE:
+      return pend_capture(ms, s, pi+1);
+    case PAT_BALANCE:
+      s = balance(ms, s, pi->a, pi->b);
+      if (s == NULL) return NULL;
+      break;
+    case PAT_FRONTIER: {
+      int previous = (s == ms->src_init) ? 0 : uchar(*(s-1));
+      if (pat_test(pi, previous) || !pat_test(pi, uchar(*s))) return NULL;
+      break;
+      }
+    case PAT_BACKREF:
+      s = match_capture(ms, s, pi->a);
+      if (s == NULL) return NULL;
+      break;
+    case PAT_EOS:
+      return (s == ms->src_end) ? s : NULL;
+    case PAT_END:
+      return s;  /* match succeeded */
+    default: {  /* single char item */
+      int m = s<ms->src_end && pat_test(pi, uchar(*s));
+      switch (pi->rep) {
+      case '?': {
+	const char *res;
+	if (m && ((res=pmatch(ms, s+1, pi+1)) != NULL))
+	  return res;
+	break;
+	}
+      case '*':
+	return pmax_expand(ms, s, pi);
+      case '+':
+	return (m ? pmax_expand(ms, s+1, pi) : NULL);
+      case '-':
+	return pmin_expand(ms, s, pi);
+      default:
+	if (!m) return NULL;
+	s++;
+	break;
+      }
+      }
+    }
+    pi++;
+  }
+}
+
+/* Match a compiled pattern or fall back to match(). */
+static LJ_AINLINE const char *str_match(MatchState *ms, const char *s,
+					const PatProg *pp, const char *p)
+{
+  return pp ? pmatch(ms, s, pp->item) : match(ms, s, p);
+}
+
 static void push_onecapture(MatchState *ms, int i, const char *s, const char *e)
 {
   if (i >= ms->level) {
@@ -465,14 +784,17 @@ static int str_find_aux(lua_State *L, int find)
   if (find && (lua_toboolean(L, 4) ||  /* explicit request? */
       strpbrk(p, SPECIALS) == NULL)) {  /* or no special characters? */
     /* do a plain search */
-    const char *s2 = lmemfind(s+init, l1-(size_t)init, p, l2);
-    if (s2) {
-      lua_pushinteger(L, s2-s+1);
-      lua_pushinteger(L, s2-s+(ptrdiff_t)l2);
+    int32_t pos = lj_str_find(s+init, p, (MSize)(l1-(size_t)init),
+			      (MSize)l2);
+    if (pos >= 0) {
+      lua_pushinteger(L, init+pos+1);
+      lua_pushinteger(L, init+pos+(ptrdiff_t)l2);
       return 2;
     }
   } else {
     MatchState ms;
+    GCudata *ud = pat_get(L, strV(L->base+1));
+    const PatProg *pp = ud ? (const PatProg *)uddata(ud) : NULL;
     int anchor = (*p == '^') ? (p++, 1) : 0;
     const char *s1=s+init;
     ms.L = L;
@@ -480,8 +802,11 @@ static int str_find_aux(lua_State *L, int find)
     ms.src_end = s+l1;
     do {
       const char *res;
+      if (pp && pp->scan != ~0u && !anchor &&
+	  (s1 = pat_scan(pp, s1, ms.src_end)) == NULL)
+	break;
       ms.level = 0;
-      if ((res=match(&ms, s1, p)) != NULL) {
+      if ((res=str_match(&ms, s1, pp, p)) != NULL) {
 	if (find) {
 	  lua_pushinteger(L, s1-s+1);  /* start */
 	  lua_pushinteger(L, res-s);   /* end */
@@ -496,7 +821,7 @@ static int str_find_aux(lua_State *L, int find)
   return 1;
 }
 
-LJLIB_CF(string_find)
+LJLIB_CF(string_find)		LJLIB_REC(.)
 {
   return str_find_aux(L, 1);
 }
@@ -508,19 +833,26 @@ LJLIB_CF(string_match)
 
 LJLIB_NOREG LJLIB_CF(string_gmatch_aux)
 {
-  const char *p = strVdata(lj_lib_upvalue(L, 2));
+  GCstr *ps = strV(lj_lib_upvalue(L, 2));
+  const char *p = strdata(ps);
   GCstr *str = strV(lj_lib_upvalue(L, 1));
   const char *s = strdata(str);
   TValue *tvpos = lj_lib_upvalue(L, 3);
   const char *src = s + tvpos->u32.lo;
+  GCudata *ud = pat_get(L, ps);
+  const PatProg *pp = ud ? (const PatProg *)uddata(ud) : NULL;
   MatchState ms;
+  if (pp && pp->anchor) pp = NULL;  /* '^' is not special for gmatch. */
   ms.L = L;
   ms.src_init = s;
   ms.src_end = s + str->len;
   for (; src <= ms.src_end; src++) {
     const char *e;
+    if (pp && pp->scan != ~0u &&
+	(src = pat_scan(pp, src, ms.src_end)) == NULL)
+      break;
     ms.level = 0;
-    if ((e = match(&ms, src, p)) != NULL) {
+    if ((e = str_match(&ms, src, pp, p)) != NULL) {
       int32_t pos = (int32_t)(e - s);
       if (e == src) pos++;  /* Ensure progress for empty match. */
       tvpos->u32.lo = (uint32_t)pos;
@@ -602,19 +934,33 @@ LJLIB_CF(string_gsub)
   int max_s = luaL_optint(L, 4, (int)(srcl+1));
   int anchor = (*p == '^') ? (p++, 1) : 0;
   int n = 0;
+  GCudata *ud;
+  const PatProg *pp = NULL;
   MatchState ms;
   luaL_Buffer b;
   if (!(tr == LUA_TNUMBER || tr == LUA_TSTRING ||
 	tr == LUA_TFUNCTION || tr == LUA_TTABLE))
     lj_err_arg(L, 3, LJ_ERR_NOSFT);
+  if ((ud = pat_get(L, strV(L->base+1))) != NULL) {
+    /* Anchor it, since a replacement function may evict it. */
+    setudataV(L, L->top++, ud);
+    pp = (const PatProg *)uddata(ud);
+  }
   luaL_buffinit(L, &b);
   ms.L = L;
   ms.src_init = src;
   ms.src_end = src+srcl;
   while (n < max_s) {
     const char *e;
+    if (pp && pp->scan != ~0u && !anchor) {
+      const char *s1 = pat_scan(pp, src, ms.src_end);
+      if (s1 == NULL)
+	break;
+      luaL_addlstring(&b, src, (size_t)(s1-src));  /* copy skipped chars */
+      src = s1;
+    }
     ms.level = 0;
-    e = match(&ms, src, p);
+    e = str_match(&ms, src, pp, p);
     if (e) {
       n++;
       add_value(&ms, &b, src, e);
@@ -636,39 +982,40 @@ LJLIB_CF(string_gsub)
 
 /* ------------------------------------------------------------------------ */
 
-/* maximum size of each formatted item (> len(format('%99.99f', -1e308))) */
-#define MAX_FMTITEM	512
 /* valid flags in a format specification */
 #define FMT_FLAGS	"-+ #0"
-/*
-** maximum size of each format specification (such as '%-099.99d')
-** (+10 accounts for %99.99x plus margin of error)
-*/
-#define MAX_FMTSPEC	(sizeof(FMT_FLAGS) + sizeof(LUA_INTFRMLEN) + 10)
 
-static void addquoted(lua_State *L, luaL_Buffer *b, int arg)
+/* Append a single character to a buffer. */
+static LJ_AINLINE void str_putc(lua_State *L, SBuf *sb, int c)
+{
+  if (LJ_UNLIKELY(sb->n >= sb->sz))
+    lj_str_bufmore(L, sb, 1);
+  sb->buf[sb->n++] = (char)c;
+}
+
+static void addquoted(lua_State *L, SBuf *sb, int arg)
 {
   GCstr *str = lj_lib_checkstr(L, arg);
   int32_t len = (int32_t)str->len;
   const char *s = strdata(str);
-  luaL_addchar(b, '"');
+  str_putc(L, sb, '"');
   while (len--) {
     if (*s == '"' || *s == '\\' || *s == '\n') {
-      luaL_addchar(b, '\\');
-      luaL_addchar(b, *s);
+      str_putc(L, sb, '\\');
+      str_putc(L, sb, *s);
     } else if (lj_char_iscntrl(uchar(*s))) {
       uint32_t c1, c2, c3;
-      luaL_addchar(b, '\\');
+      str_putc(L, sb, '\\');
       c1 = uchar(*s); c3 = c1 % 10; c1 /= 10; c2 = c1 % 10; c1 /= 10;
-      if (c1 + lj_char_isdigit(uchar(s[1]))) luaL_addchar(b, '0' + c1);
-      if (c2 + (c1 + lj_char_isdigit(uchar(s[1])))) luaL_addchar(b, '0' + c2);
-      luaL_addchar(b, '0' + c3);
+      if (c1 + lj_char_isdigit(uchar(s[1]))) str_putc(L, sb, '0' + c1);
+      if (c2 + (c1 + lj_char_isdigit(uchar(s[1])))) str_putc(L, sb, '0' + c2);
+      str_putc(L, sb, '0' + c3);
     } else {
-      luaL_addchar(b, *s);
+      str_putc(L, sb, *s);
     }
     s++;
   }
-  luaL_addchar(b, '"');
+  str_putc(L, sb, '"');
 }
 
 static const char *scanformat(lua_State *L, const char *strfrmt, char *form)
@@ -693,93 +1040,151 @@ static const char *scanformat(lua_State *L, const char *strfrmt, char *form)
   return p;
 }
 
-static void addintlen(char *form)
-{
-  size_t l = strlen(form);
-  char spec = form[l - 1];
-  strcpy(form + l - 1, LUA_INTFRMLEN);
-  form[l + sizeof(LUA_INTFRMLEN) - 2] = spec;
-  form[l + sizeof(LUA_INTFRMLEN) - 1] = '\0';
-}
-
-LJLIB_CF(string_format)
+/* Append formatted arguments to a buffer. The format is at argument arg. */
+static void str_format(lua_State *L, SBuf *sb, int arg)
 {
-  int arg = 1;
   GCstr *fmt = lj_lib_checkstr(L, arg);
   const char *strfrmt = strdata(fmt);
   const char *strfrmt_end = strfrmt + fmt->len;
-  luaL_Buffer b;
-  luaL_buffinit(L, &b);
   while (strfrmt < strfrmt_end) {
     if (*strfrmt != L_ESC) {
-      luaL_addchar(&b, *strfrmt++);
+      const char *p = strfrmt;
+      while (++p < strfrmt_end && *p != L_ESC) ;
+      lj_str_bufputmem(L, sb, strfrmt, (MSize)(p - strfrmt));
+      strfrmt = p;
     } else if (*++strfrmt == L_ESC) {
-      luaL_addchar(&b, *strfrmt++);  /* %% */
+      str_putc(L, sb, *strfrmt++);  /* %% */
     } else { /* format item */
-      char form[MAX_FMTSPEC];  /* to store the format (`%...') */
-      char buff[MAX_FMTITEM];  /* to store the formatted item */
+      char form[LJ_MAX_FMTSPEC];  /* to store the format (`%...') */
       arg++;
       strfrmt = scanformat(L, strfrmt, form);
       switch (*strfrmt++) {
-      case 'c':
-	sprintf(buff, form, lj_lib_checkint(L, arg));
-	break;
-      case 'd':  case 'i':
-	addintlen(form);
-	sprintf(buff, form, (LUA_INTFRM_T)lj_lib_checknum(L, arg));
-	break;
-      case 'o':  case 'u':  case 'x':  case 'X':
-	addintlen(form);
-	sprintf(buff, form, (unsigned LUA_INTFRM_T)lj_lib_checknum(L, arg));
+      case 'c': case 'd': case 'i': case 'o': case 'u': case 'x': case 'X':
+      case 'e': case 'E': case 'f': case 'g': case 'G':
+	lj_str_bufputfmt(L, sb, form, lj_lib_checknum(L, arg));
 	break;
-      case 'e':  case 'E': case 'f': case 'g': case 'G': {
-	TValue tv;
-	tv.n = lj_lib_checknum(L, arg);
-	if (LJ_UNLIKELY((tv.u32.hi << 1) >= 0xffe00000)) {
-	  /* Canonicalize output of non-finite values. */
-	  char *p, nbuf[LUAI_MAXNUMBER2STR];
-	  size_t len = lj_str_bufnum(nbuf, &tv);
-	  if (strfrmt[-1] == 'E' || strfrmt[-1] == 'G') {
-	    nbuf[len-3] = nbuf[len-3] - 0x20;
-	    nbuf[len-2] = nbuf[len-2] - 0x20;
-	    nbuf[len-1] = nbuf[len-1] - 0x20;
-	  }
-	  nbuf[len] = '\0';
-	  for (p = form; *p < 'e' && *p != '.'; p++) ;
-	  *p++ = 's'; *p = '\0';
-	  sprintf(buff, form, nbuf);
-	  break;
-	}
-	sprintf(buff, form, (double)tv.n);
-	break;
-	}
       case 'q':
-	addquoted(L, &b, arg);
-	continue;
+	addquoted(L, sb, arg);
+	break;
       case 'p':
-	lj_str_pushf(L, "%p", lua_topointer(L, arg));
-	luaL_addvalue(&b);
-	continue;
+	lj_str_bufputptr(L, sb, lua_topointer(L, arg));
+	break;
       case 's': {
 	GCstr *str = lj_lib_checkstr(L, arg);
-	if (!strchr(form, '.') && str->len >= 100) {
-	  /* no precision and string is too long to be formatted;
-	     keep original string */
-	  setstrV(L, L->top++, str);
-	  luaL_addvalue(&b);
-	  continue;
+	if (form[2] == '\0' || (!strchr(form, '.') && str->len >= 100)) {
+	  /* plain %s, or no precision and string is too long to be
+	     formatted; keep original string */
+	  lj_str_bufput(L, sb, str);
+	} else {
+	  char buff[LJ_MAX_FMTITEM];  /* to store the formatted item */
+	  sprintf(buff, form, strdata(str));
+	  lj_str_bufputmem(L, sb, buff, (MSize)strlen(buff));
 	}
-	sprintf(buff, form, strdata(str));
 	break;
 	}
       default:
 	lj_err_callerv(L, LJ_ERR_STRFMTO, *(strfrmt -1));
 	break;
       }
-      luaL_addlstring(&b, buff, strlen(buff));
     }
   }
-  luaL_pushresult(&b);
+}
+
+LJLIB_CF(string_format)	LJLIB_REC(.)
+{
+  SBuf *sb = &G(L)->tmpbuf;
+  lj_str_resetbuf(sb);
+  str_format(L, sb, 1);
+  setstrV(L, L->top++, lj_str_buftostr(L, sb));
+  lj_gc_check(L);
+  return 1;
+}
+
+/* -- String buffers ------------------------------------------------------ */
+
+static SBuf *buffer_tosbuf(lua_State *L, int narg)
+{
+  cTValue *o = L->base + narg-1;
+  if (!(o < L->top && tvisudata(o) && udataV(o)->udtype == UDTYPE_BUFFER))
+    lj_err_argtype(L, narg, "buffer");
+  return (SBuf *)uddata(udataV(o));
+}
+
+#define LJLIB_MODULE_string_buffer_method
+
+LJLIB_CF(string_buffer_method_put)	LJLIB_REC(buffer_put)
+{
+  SBuf *sb = buffer_tosbuf(L, 1);
+  cTValue *o;
+  for (o = L->base+1; o < L->top; o++) {
+    if (tvisstr(o)) {
+      lj_str_bufput(L, sb, strV(o));
+    } else if (tvisnum(o)) {
+      lj_str_bufputnum(L, sb, &o->n);
+    } else if (tvisudata(o) && udataV(o)->udtype == UDTYPE_BUFFER) {
+      SBuf *sbx = (SBuf *)uddata(udataV(o));
+      MSize len = sbx->n;
+      char *p = lj_str_bufmore(L, sb, len);
+      memcpy(p, sbx->buf, len);  /* sbx may be sb, so get buf after growing. */
+      sb->n += len;
+    } else {
+      lj_err_argt(L, (int)(o - L->base) + 1, LUA_TSTRING);
+    }
+  }
+  L->top = L->base+1;
+  return 1;
+}
+
+LJLIB_CF(string_buffer_method_putf)	LJLIB_REC(buffer_putf)
+{
+  str_format(L, buffer_tosbuf(L, 1), 2);
+  L->top = L->base+1;
+  return 1;
+}
+
+LJLIB_CF(string_buffer_method_reset)	LJLIB_REC(buffer_reset)
+{
+  lj_str_resetbuf(buffer_tosbuf(L, 1));
+  L->top = L->base+1;
+  return 1;
+}
+
+LJLIB_CF(string_buffer_method_tostring)	LJLIB_REC(buffer_tostring)
+{
+  SBuf *sb = buffer_tosbuf(L, 1);
+  setstrV(L, L->top++, lj_str_buftostr(L, sb));
+  lj_gc_check(L);
+  return 1;
+}
+
+LJLIB_PUSH(lastcl) LJLIB_SET(__tostring)
+
+LJLIB_CF(string_buffer_method___len)
+{
+  setintV(L->top++, (int32_t)buffer_tosbuf(L, 1)->n);
+  return 1;
+}
+
+LJLIB_PUSH(top-1) LJLIB_SET(__index)
+
+/* ------------------------------------------------------------------------ */
+
+#define LJLIB_MODULE_string_buffer
+
+LJLIB_PUSH(top-2) LJLIB_SET(!)  /* Set environment. */
+
+LJLIB_CF(string_buffer_new)
+{
+  int32_t sz = lj_lib_optint(L, 1, 0);
+  SBuf *sb = (SBuf *)lua_newuserdata(L, sizeof(SBuf));
+  GCudata *ud = udataV(L->top-1);
+  ud->udtype = UDTYPE_BUFFER;
+  /* NOBARRIER: The GCudata is new (marked white). */
+  setgcrefr(ud->metatable, curr_func(L)->c.env);
+  lj_str_initbuf(L, sb);
+  lj_str_resetbuf(sb);
+  if (sz > 0)
+    lj_str_needbuf(L, sb, (MSize)sz);
   return 1;
 }
 
@@ -802,6 +1207,9 @@ LUALIB_API int luaopen_string(lua_State *L)
   setgcref(basemt_it(g, LJ_TSTR), obj2gco(mt));
   settabV(L, lj_tab_setstr(L, mt, mmname_str(g, MM_index)), tabV(L->top-1));
   mt->nomm = cast_byte(~(1u<<MM_index));
+  LJ_LIB_REG_(L, NULL, string_buffer_method);
+  LJ_LIB_REG_(L, "string.buffer", string_buffer);
+  L->top -= 2;
   return 1;
 }
 
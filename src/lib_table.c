@@ -266,6 +266,24 @@ LJLIB_CF(table_sort)
 
 /* ------------------------------------------------------------------------ */
 
+LJLIB_CF(table_new)		LJLIB_REC(.)
+{
+  int32_t a = lj_lib_checkint(L, 1);
+  int32_t h = lj_lib_checkint(L, 2);
+  settabV(L, L->top++, lj_tab_new(L, a > 0 ? (uint32_t)a+1 : 0,
+				  h > 0 ? hsize2hbits(h) : 0));
+  lj_gc_check(L);
+  return 1;
+}
+
+LJLIB_CF(table_clear)		LJLIB_REC(.)
+{
+  lj_tab_clear(lj_lib_checktab(L, 1));
+  return 0;
+}
+
+/* ------------------------------------------------------------------------ */
+
 #include "lj_libdef.h"
 
 LUALIB_API int luaopen_table(lua_State *L)
@@ -24,6 +24,7 @@
 #include "lj_vm.h"
 #include "lj_lex.h"
 #include "lj_parse.h"
+#include "lj_bcdump.h"
 
 /* -- Common helper functions --------------------------------------------- */
 
@@ -1109,11 +1110,12 @@ LUA_API int lua_resume(lua_State *L, int nargs)
 static TValue *cpparser(lua_State *L, lua_CFunction dummy, void *ud)
 {
   LexState *ls = cast(LexState *, ud);
+  GCproto *pt;
   GCfunc *fn;
   UNUSED(dummy);
   cframe_errfunc(L->cframe) = -1;  /* Inherit error function. */
-  lj_lex_setup(L, ls);
-  fn = lj_func_newL(L, lj_parse(ls), tabref(L->env));
+  pt = lj_lex_setup(L, ls) ? lj_bcread(ls) : lj_parse(ls);
+  fn = lj_func_newL(L, pt, tabref(L->env));
   /* Parser may realloc stack. Don't combine above/below into one statement. */
   setfuncV(L, L->top++, fn);
   return NULL;
@@ -1136,9 +1138,12 @@ LUA_API int lua_load(lua_State *L, lua_Reader reader, void *data,
 
 LUA_API int lua_dump(lua_State *L, lua_Writer writer, void *data)
 {
+  cTValue *o = L->top-1;
   api_checknelems(L, 1);
-  UNUSED(L); UNUSED(writer); UNUSED(data);
-  return 1;  /* Error, not supported. */
+  if (tvisfunc(o) && isluafunc(funcV(o)))
+    return lj_bcwrite(L, funcproto(funcV(o)), writer, data, 0);
+  else
+    return 1;
 }
 
 /* -- GC and memory management -------------------------------------------- */
@@ -1181,6 +1186,29 @@ LUA_API int lua_gc(lua_State *L, int what, int data)
     res = cast_int(g->gc.stepmul);
     g->gc.stepmul = (MSize)data;
     break;
+  case LUA_GCGEN:
+  case LUA_GCINC:
+    if (what == LUA_GCGEN && data > 0)
+      g->gc.genminor = (MSize)data;
+    res = lj_gc_setkind(L, what == LUA_GCGEN ? GCKgenerational :
+					       GCKincremental);
+    res = res == GCKgenerational ? LUA_GCGEN : LUA_GCINC;
+    break;
+  case LUA_GCPACE:
+    res = cast_int(lj_gc_setpace(g, data > 0 ? (MSize)data : 0));
+    break;
+  case LUA_GCSTEPTIME:
+    switch (data) {
+    case 0: res = cast_int(g->gc.stepnum); break;
+    case 1: res = cast_int(g->gc.steptime / 1000); break;
+    case 2: res = cast_int(g->gc.stepmax / 1000); break;
+    case 3: res = cast_int(g->gc.stepover); break;
+    default:  /* Reset the counters. */
+      g->gc.stepnum = g->gc.stepover = g->gc.stepmax = 0;
+      g->gc.steptime = 0;
+      break;
+    }
+    break;
   default:
     res = -1;  /* Invalid option. */
   }
@@ -1201,3 +1229,32 @@ LUA_API void lua_setallocf(lua_State *L, lua_Alloc f, void *ud)
   g->allocf = f;
 }
 
+/* -- String buffers ------------------------------------------------------ */
+
+static SBuf *api_tosbuf(lua_State *L, int idx)
+{
+  cTValue *o = index2adr(L, idx);
+  if (tvisudata(o) && udataV(o)->udtype == UDTYPE_BUFFER)
+    return (SBuf *)uddata(udataV(o));
+  return NULL;
+}
+
+LUA_API char *luaJIT_bufreserve(lua_State *L, int idx, size_t sz, size_t *len)
+{
+  SBuf *sb = api_tosbuf(L, idx);
+  char *p;
+  if (sb == NULL)
+    return NULL;
+  if (sz >= LJ_MAX_STR)
+    lj_err_msg(L, LJ_ERR_STROV);
+  p = lj_str_bufmore(L, sb, sz ? (MSize)sz : 1);  /* Never NULL. */
+  if (len) *len = sb->sz - sb->n;
+  return p;
+}
+
+LUA_API void luaJIT_bufcommit(lua_State *L, int idx, size_t len)
+{
+  SBuf *sb = api_tosbuf(L, idx);
+  api_check(L, sb != NULL && len <= sb->sz - sb->n);
+  sb->n += (MSize)len;
+}
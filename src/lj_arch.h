@@ -186,6 +186,35 @@
 #define LJ_HASJIT		1
 #endif
 
+/* Disable or enable the sampling profiler. */
+#if defined(LUAJIT_DISABLE_PROFILE) || !LJ_TARGET_POSIX
+#define LJ_HASPROFILE		0
+#else
+#define LJ_HASPROFILE		1
+#endif
+
+/* Hash all bytes of a string with a per-state key or only sample a few. */
+#if defined(LUAJIT_SPARSE_STRHASH)
+#define LJ_STRHASH_FULL		0
+#else
+#define LJ_STRHASH_FULL		1
+#endif
+
+/* Disable or enable the slab allocator for small GC objects. */
+#if defined(LUAJIT_DISABLE_SLAB) || defined(LUAJIT_USE_SYSMALLOC) || \
+    defined(LUAJIT_USE_VALGRIND)
+#define LJ_HASSLAB		0
+#else
+#define LJ_HASSLAB		1
+#endif
+
+/* Use open addressing with linear probing for the hash part of tables. */
+#if defined(LUAJIT_OPEN_TABHASH)
+#define LJ_TABHASH_OPEN		1
+#else
+#define LJ_TABHASH_OPEN		0
+#endif
+
 #if LJ_ARCH_ENDIAN == LUAJIT_BE
 #define LJ_ENDIAN_SELECT(le, be)	be
 #define LJ_ENDIAN_LOHI(lo, hi)		hi lo
@@ -50,6 +50,12 @@ typedef struct ASMState {
 
   int32_t evenspill;	/* Next even spill slot. */
   int32_t oddspill;	/* Next odd spill slot (or 0). */
+  MSize nspill;		/* Number of IR values with a spill slot. */
+  MSize nrestore;	/* Number of restores from spill slots. */
+
+  uint32_t *livestart;	/* Index of first use position for each ref. */
+  uint32_t *livecur;	/* Index past next use position for each ref. */
+  IRRef1 *liveuse;	/* Ascending use positions of all refs. */
 
   IRRef curins;		/* Reference of current instruction. */
   IRRef stopins;	/* Stop assembly before hitting this instruction. */
@@ -65,7 +71,7 @@ typedef struct ASMState {
   IRRef loopref;	/* Reference of LOOP instruction (or 0). */
 
   BCReg topslot;	/* Number of slots for stack check (unless 0). */
-  MSize gcsteps;	/* Accumulated number of GC steps (per section). */
+  int32_t gcsteps;	/* Accumulated number of GC steps (per section). */
 
   GCtrace *T;		/* Trace to assemble. */
   GCtrace *parent;	/* Parent trace (or NULL). */
@@ -631,7 +637,10 @@ static int32_t ra_spill(ASMState *as, IRIns *ir)
 {
   int32_t slot = ir->s;
   if (!ra_hasspill(slot)) {
-    if (irt_isnum(ir->t) || (LJ_64 && irt_islightud(ir->t))) {
+    if (irt_isv2num(ir->t)) {  /* Needs 16 bytes. */
+      slot = as->evenspill;
+      as->evenspill += 4;
+    } else if (irt_isnum(ir->t) || (LJ_64 && irt_islightud(ir->t))) {
       slot = as->evenspill;
       as->evenspill += 2;
     } else if (as->oddspill) {
@@ -645,6 +654,7 @@ static int32_t ra_spill(ASMState *as, IRIns *ir)
     if (as->evenspill > 256)
       lj_trace_err(as->J, LJ_TRERR_SPILLOV);
     ir->s = (uint8_t)slot;
+    as->nspill++;
   }
   return sps_scale(slot);
 }
@@ -668,7 +678,9 @@ static Reg ra_releasetmp(ASMState *as, IRRef ref)
 /* Generic move between two regs. */
 static void ra_movrr(ASMState *as, IRIns *ir, Reg r1, Reg r2)
 {
-  emit_rr(as, r1 < RID_MAX_GPR ? XO_MOV : XMM_MOVRR(as), REX_64LU(ir, r1), r2);
+  emit_rr(as, r1 < RID_MAX_GPR ? XO_MOV :
+	      irt_isv2num(ir->t) ? XO_MOVAPS : XMM_MOVRR(as),
+	  REX_64LU(ir, r1), r2);
 }
 
 /* Restore a register (marked as free). Rematerialize or force a spill. */
@@ -685,8 +697,10 @@ static Reg ra_restore(ASMState *as, IRRef ref)
     ra_free(as, r);
     if (!rset_test(as->weakset, r)) {  /* Only restore non-weak references. */
       ra_modified(as, r);
+      as->nrestore++;
       RA_DBGX((as, "restore   $i $r", ir, r));
-      emit_rmro(as, r < RID_MAX_GPR ? XO_MOV : XMM_MOVRM(as),
+      emit_rmro(as, r < RID_MAX_GPR ? XO_MOV :
+		    irt_isv2num(ir->t) ? XO_MOVUPD : XMM_MOVRM(as),
 		REX_64LU(ir, r), RID_ESP, ofs);
     }
     return r;
@@ -697,10 +711,37 @@ static Reg ra_restore(ASMState *as, IRRef ref)
 static void ra_save(ASMState *as, IRIns *ir, Reg r)
 {
   RA_DBGX((as, "save      $i $r", ir, r));
-  emit_rmro(as, r < RID_MAX_GPR ? XO_MOVto : XO_MOVSDto,
+  emit_rmro(as, r < RID_MAX_GPR ? XO_MOVto :
+		irt_isv2num(ir->t) ? XO_MOVUPDto : XO_MOVSDto,
 	    REX_64LU(ir, r), RID_ESP, sps_scale(ir->s));
 }
 
+/* Get the next use of a ref at or above the current instruction.
+** The use positions are consumed in step with the backwards assembly.
+** Returns the ref itself if there are no more uses up to its definition.
+*/
+static IRRef ra_nextuse(ASMState *as, IRRef ref)
+{
+  uint32_t i = ref - REF_FIRST;
+  uint32_t start = as->livestart[i], cur = as->livecur[i];
+  while (cur > start && as->liveuse[cur-1] > as->curins)
+    cur--;
+  as->livecur[i] = cur;
+  return cur > start ? as->liveuse[cur-1] : ref;
+}
+
+/* Cost of a register based on the live range of its ref.
+** The ref whose next use is farthest away is the cheapest to evict.
+*/
+static RegCost ra_livecost(ASMState *as, Reg r)
+{
+  RegCost cost = as->cost[r];
+  IRRef ref = regcost_ref(cost);
+  if (ref >= REF_FIRST && ref < as->orignins)
+    cost = REGCOST(ra_nextuse(as, ref), ref) + REGCOST_T(irt_t(IR(ref)->t));
+  return cost;
+}
+
 #define MINCOST(r) \
   if (LJ_LIKELY(allow&RID2RSET(r)) && as->cost[r] < cost) \
     cost = as->cost[r]
@@ -711,7 +752,15 @@ static Reg ra_evict(ASMState *as, RegSet allow)
   IRRef ref;
   RegCost cost = ~(RegCost)0;
   lua_assert(allow != RSET_EMPTY);
-  if (allow < RID2RSET(RID_MAX_GPR)) {
+  if ((as->flags & JIT_F_OPT_LIVE)) {
+    RegSet work = allow & ~as->freeset;
+    while (work) {
+      Reg r = rset_pickbot(work);
+      RegCost c = ra_livecost(as, r);
+      if (c < cost) cost = c;
+      rset_clear(work, r);
+    }
+  } else if (allow < RID2RSET(RID_MAX_GPR)) {
     MINCOST(RID_EAX);MINCOST(RID_ECX);MINCOST(RID_EDX);MINCOST(RID_EBX);
     MINCOST(RID_EBP);MINCOST(RID_ESI);MINCOST(RID_EDI);
 #if LJ_64
@@ -990,7 +1039,30 @@ static int asm_snap_canremat(ASMState *as)
   return 0;
 }
 
-/* Allocate registers or spill slots for refs escaping to a snapshot. */
+/* Allocate register or spill slot for a ref that escapes to a snapshot. */
+static void asm_snap_alloc1(ASMState *as, IRRef ref)
+{
+  IRIns *ir = IR(ref);
+  if (!ra_used(ir)) {
+    RegSet allow = irt_isnum(ir->t) ? RSET_FPR : RSET_GPR;
+    /* Get a weak register if we have a free one or can rematerialize. */
+    if ((as->freeset & allow) ||
+	(allow == RSET_FPR && asm_snap_canremat(as))) {
+      Reg r = ra_allocref(as, ref, allow);  /* Allocate a register. */
+      if (!irt_isphi(ir->t))
+	ra_weak(as, r);  /* But mark it as weakly referenced. */
+      checkmclim(as);
+      RA_DBGX((as, "snapreg   $f $r", ref, ir->r));
+    } else {
+      ra_spill(as, ir);  /* Otherwise force a spill slot. */
+      RA_DBGX((as, "snapspill $f $s", ref, ir->s));
+    }
+  }
+}
+
+/* Allocate refs escaping to a snapshot.
+** The stored values of a sunk allocation escape in its place.
+*/
 static void asm_snap_alloc(ASMState *as)
 {
   SnapShot *snap = &as->T->snap[as->snapno];
@@ -999,26 +1071,38 @@ static void asm_snap_alloc(ASMState *as)
   for (n = 0; n < nent; n++) {
     IRRef ref = snap_ref(map[n]);
     if (!irref_isk(ref)) {
-      IRIns *ir = IR(ref);
-      if (!ra_used(ir)) {
-	RegSet allow = irt_isnum(ir->t) ? RSET_FPR : RSET_GPR;
-	/* Get a weak register if we have a free one or can rematerialize. */
-	if ((as->freeset & allow) ||
-	    (allow == RSET_FPR && asm_snap_canremat(as))) {
-	  Reg r = ra_allocref(as, ref, allow);  /* Allocate a register. */
-	  if (!irt_isphi(ir->t))
-	    ra_weak(as, r);  /* But mark it as weakly referenced. */
-	  checkmclim(as);
-	  RA_DBGX((as, "snapreg   $f $r", ref, ir->r));
-	} else {
-	  ra_spill(as, ir);  /* Otherwise force a spill slot. */
-	  RA_DBGX((as, "snapspill $f $s", ref, ir->s));
+      if (IR(ref)->r == RID_SINK) {
+	IRRef irs;
+	lua_assert(as->T->sinktags);
+	for (irs = snap->ref-1; irs > ref; irs--) {
+	  IRIns *ir = IR(irs);
+	  if (ir->r == RID_SINK &&
+	      (ir->o == IR_ASTORE || ir->o == IR_HSTORE) &&
+	      lj_snap_sunkalloc(as->T, ir) == ref && !irref_isk(ir->op2))
+	    asm_snap_alloc1(as, ir->op2);
 	}
+      } else {
+	asm_snap_alloc1(as, ref);
       }
     }
   }
 }
 
+/* Check whether a ref is a value stored to a sunk allocation of a snapshot. */
+static int asm_snap_sunkval(ASMState *as, SnapShot *snap, IRRef alloc,
+			    IRRef ren)
+{
+  IRRef irs;
+  for (irs = snap->ref-1; irs > alloc; irs--) {
+    IRIns *ir = IR(irs);
+    if (ir->r == RID_SINK && ir->op2 == ren &&
+	(ir->o == IR_ASTORE || ir->o == IR_HSTORE) &&
+	lj_snap_sunkalloc(as->T, ir) == alloc)
+      return 1;
+  }
+  return 0;
+}
+
 /* All guards for a snapshot use the same exitno. This is currently the
 ** same as the snapshot number. Since the exact origin of the exit cannot
 ** be determined, all guards for the same snapshot must exit with the same
@@ -1033,10 +1117,12 @@ static int asm_snap_checkrename(ASMState *as, IRRef ren)
   MSize n, nent = snap->nent;
   for (n = 0; n < nent; n++) {
     IRRef ref = snap_ref(map[n]);
-    if (ref == ren) {
-      IRIns *ir = IR(ref);
+    if (ref == ren ||
+	(!irref_isk(ref) && IR(ref)->r == RID_SINK &&
+	 asm_snap_sunkval(as, snap, ref, ren))) {
+      IRIns *ir = IR(ren);
       ra_spill(as, ir);  /* Register renamed, so force a spill slot. */
-      RA_DBGX((as, "snaprensp $f $s", ref, ir->s));
+      RA_DBGX((as, "snaprensp $f $s", ren, ir->s));
       return 1;  /* Found. */
     }
   }
@@ -1048,7 +1134,15 @@ static void asm_snap_prep(ASMState *as)
 {
   if (as->curins < as->snapref) {
     do {
-      lua_assert(as->snapno != 0);
+      if (as->snapno == 0) {
+	/* Only allocations replayed by a side trace precede snapshot #0. */
+	lua_assert(as->parent != NULL);
+	return;
+      }
+      if (as->snapno < as->T->nsnap) {  /* Remember distance to mcode end. */
+	MSize ofs = (MSize)(as->mctop - as->mcp);
+	as->T->snap[as->snapno].mcofs = (uint16_t)(ofs < 0xffff ? ofs : 0xffff);
+      }
       as->snapno--;
       as->snapref = as->T->snap[as->snapno].ref;
     } while (as->curins < as->snapref);
@@ -1064,6 +1158,19 @@ static void asm_snap_prep(ASMState *as)
   }
 }
 
+/* Convert the snapshot mcode offsets to be relative to the trace start. */
+static void asm_snap_fixmcofs(ASMState *as)
+{
+  GCtrace *T = as->T;
+  MSize sz = (MSize)(as->mctop - as->mcp);
+  SnapNo i;
+  for (i = 0; i < T->nsnap; i++) {
+    SnapShot *snap = &T->snap[i];
+    MSize ofs = i > as->snapno ? sz - snap->mcofs : 0;
+    snap->mcofs = (uint16_t)(ofs < 0xffff ? ofs : 0xffff);
+  }
+}
+
 /* Emit conditional branch to exit for guard.
 ** It's important to emit this *after* all registers have been allocated,
 ** because rematerializations may invalidate the flags.
@@ -1194,7 +1301,8 @@ static void asm_fuseahuref(ASMState *as, IRRef ref, RegSet allow)
       }
       break;
     default:
-      lua_assert(ir->o == IR_HREF || ir->o == IR_NEWREF || ir->o == IR_UREFO);
+      lua_assert(ir->o == IR_HREF || ir->o == IR_NEWREF || ir->o == IR_UREFO ||
+		 ir->o == IR_NREF);
       break;
     }
   }
@@ -1482,14 +1590,29 @@ static void asm_call(ASMState *as, IRIns *ir)
 static void asm_retf(ASMState *as, IRIns *ir)
 {
   Reg base = ra_alloc1(as, REF_BASE, RSET_GPR);
-  void *pc = ir_kptr(IR(ir->op2));
-  int32_t delta = 1+bc_a(*((const BCIns *)pc - 1));
+  IRIns *irk = IR(ir->op2);
+  int32_t delta, link;
+  if (irk->o == IR_KINT) {  /* Return from pcall, vararg or cont. frame. */
+    link = irk->i;
+    delta = link >> 3;
+  } else {
+    void *pc = ir_kptr(irk);
+    link = ptr2addr(pc);
+    delta = 1+bc_a(*((const BCIns *)pc - 1));
+  }
   as->topslot -= (BCReg)delta;
   if ((int32_t)as->topslot < 0) as->topslot = 0;
-  emit_setgl(as, base, jit_base);
+  /* Pcall and vararg frames: the RETF of the next Lua frame does it. */
+  if (irk->o != IR_KINT || (link & FRAME_TYPEP) == FRAME_CONT)
+    emit_setgl(as, base, jit_base);
   emit_addptr(as, base, -8*delta);
+  if (irk->o == IR_KINT && IR(ir->op1)->o == IR_KPTR) {
+    asm_guardcc(as, CC_NE);  /* Check PC of continuation frame, too. */
+    emit_gmroi(as, XG_ARITHi(XOg_CMP), base, -12,
+	       ptr2addr(ir_kptr(IR(ir->op1))));
+  }
   asm_guardcc(as, CC_NE);
-  emit_gmroi(as, XG_ARITHi(XOg_CMP), base, -4, ptr2addr(pc));
+  emit_gmroi(as, XG_ARITHi(XOg_CMP), base, -4, link);
 }
 
 /* -- Type conversions ---------------------------------------------------- */
@@ -1563,11 +1686,15 @@ static void asm_tostr(ASMState *as, IRIns *ir)
   as->gcsteps++;
   if (irt_isnum(irl->t)) {
     const CCallInfo *ci = &lj_ir_callinfo[IRCALL_lj_str_fromnum];
+    Reg tmp;
     args[1] = ASMREF_TMP1;  /* const lua_Number * */
     asm_setupresult(as, ir, ci);  /* GCstr * */
     asm_gencall(as, ci, args);
-    emit_rmro(as, XO_LEA, ra_releasetmp(as, ASMREF_TMP1)|REX_64,
-	      RID_ESP, ra_spill(as, irl));
+    tmp = ra_releasetmp(as, ASMREF_TMP1);
+    if (irref_isk(ir->op1))  /* Constants are never spilled. */
+      emit_loada(as, tmp, ir_knum(irl));
+    else
+      emit_rmro(as, XO_LEA, tmp|REX_64, RID_ESP, ra_spill(as, irl));
   } else {
     const CCallInfo *ci = &lj_ir_callinfo[IRCALL_lj_str_fromint];
     args[1] = ir->op1;  /* int32_t k */
@@ -1826,6 +1953,22 @@ static void asm_hrefk(ASMState *as, IRIns *ir)
 #endif
 }
 
+/* Node reference for table traversal: &node[idx]. */
+static void asm_nref(ASMState *as, IRIns *ir)
+{
+  Reg dest = ra_dest(as, ir, RSET_GPR);
+  Reg node = ra_alloc1(as, ir->op1, rset_exclude(RSET_GPR, dest));
+  Reg idx = ra_alloc1(as, ir->op2, rset_exclude(RSET_GPR, node));
+  emit_rr(as, XO_ARITH(XOg_ADD), dest, node);
+  if ((as->flags & JIT_F_PREFER_IMUL)) {
+    emit_i8(as, sizeof(Node));
+    emit_rr(as, XO_IMULi8, dest, idx);
+  } else {
+    emit_shifti(as, XOg_SHL, dest, 3);
+    emit_rmrxo(as, XO_LEA, dest, idx, idx, XM_SCALE2, 0);
+  }
+}
+
 static void asm_newref(ASMState *as, IRIns *ir)
 {
   const CCallInfo *ci = &lj_ir_callinfo[IRCALL_lj_tab_newkey];
@@ -1992,12 +2135,15 @@ static Reg asm_load_lightud64(ASMState *as, IRIns *ir, int typecheck)
 
 static void asm_ahuvload(ASMState *as, IRIns *ir)
 {
+  /* HKLOAD loads the key of the node referenced by NREF. */
+  int32_t kofs = ir->o == IR_HKLOAD ? (int32_t)offsetof(Node, key) : 0;
   lua_assert(irt_isnum(ir->t) || irt_ispri(ir->t) || irt_isaddr(ir->t));
 #if LJ_64
   if (irt_islightud(ir->t)) {
     Reg dest = asm_load_lightud64(as, ir, 1);
     if (ra_hasreg(dest)) {
       asm_fuseahuref(as, ir->op1, RSET_GPR);
+      as->mrm.ofs += kofs;
       emit_mrm(as, XO_MOV, dest|REX_64, RID_MRM);
     }
     return;
@@ -2007,9 +2153,11 @@ static void asm_ahuvload(ASMState *as, IRIns *ir)
     RegSet allow = irt_isnum(ir->t) ? RSET_FPR : RSET_GPR;
     Reg dest = ra_dest(as, ir, allow);
     asm_fuseahuref(as, ir->op1, RSET_GPR);
+    as->mrm.ofs += kofs;
     emit_mrm(as, dest < RID_MAX_GPR ? XO_MOV : XMM_MOVRM(as), dest, RID_MRM);
   } else {
     asm_fuseahuref(as, ir->op1, RSET_GPR);
+    as->mrm.ofs += kofs;
   }
   /* Always do the type check, even if the load result is unused. */
   as->mrm.ofs += 4;
@@ -2064,7 +2212,8 @@ static void asm_sload(ASMState *as, IRIns *ir)
   Reg base;
   lua_assert(!(ir->op2 & IRSLOAD_PARENT));  /* Handled by asm_head_side(). */
   lua_assert(irt_isguard(t) || !(ir->op2 & IRSLOAD_TYPECHECK));
-  lua_assert(!irt_isint(t) || (ir->op2 & (IRSLOAD_CONVERT|IRSLOAD_FRAME)));
+  lua_assert(!irt_isint(t) ||
+	     (ir->op2 & (IRSLOAD_CONVERT|IRSLOAD_FRAME|IRSLOAD_KEYINDEX)));
   if ((ir->op2 & IRSLOAD_CONVERT) && irt_isguard(t)) {
     Reg left = ra_scratch(as, RSET_FPR);
     asm_tointg(as, ir, left);  /* Frees dest reg. Do this before base alloc. */
@@ -2103,7 +2252,8 @@ static void asm_sload(ASMState *as, IRIns *ir)
       emit_u32(as, LJ_TISNUM);
       emit_rmro(as, XO_ARITHi, XOg_CMP, base, ofs+4);
     } else {
-      emit_i8(as, ~irt_type(t));
+      /* A traversal index is stored with a nil tag. */
+      emit_i8(as, (ir->op2 & IRSLOAD_KEYINDEX) ? ~IRT_NIL : ~irt_type(t));
       emit_rmro(as, XO_ARITHi8, XOg_CMP, base, ofs+4);
     }
   }
@@ -2146,8 +2296,93 @@ static void asm_tdup(ASMState *as, IRIns *ir)
   asm_gencall(as, ci, args);
 }
 
+static void asm_tclear(ASMState *as, IRIns *ir)
+{
+  const CCallInfo *ci = &lj_ir_callinfo[IRCALL_lj_tab_clear];
+  IRRef args[1];
+  args[0] = ir->op1;  /* GCtab *t */
+  ra_evictset(as, RSET_SCRATCH);
+  asm_gencall(as, ci, args);
+}
+
+static void asm_fnew(ASMState *as, IRIns *ir)
+{
+  const CCallInfo *ci = &lj_ir_callinfo[IRCALL_lj_func_newL_uv];
+  IRIns *irc = IR(ir->op2);
+  IRRef args[4];
+  args[0] = ASMREF_L;   /* lua_State *L     */
+  args[1] = ir->op1;    /* GCproto *pt      */
+  args[2] = irc->op1;   /* GCfuncL *parent  */
+  args[3] = irc->op2;   /* TValue *base     */
+  as->gcsteps++;
+  asm_setupresult(as, ir, ci);  /* GCfunc * */
+  asm_gencall(as, ci, args);
+}
+
+/* -- String buffer ops --------------------------------------------------- */
+
+static void asm_bufhdr(ASMState *as, IRIns *ir)
+{
+  Reg sb = ra_dest(as, ir, RSET_GPR);
+  if (ir->op2 == IRBUFHDR_RESET)
+    emit_movmroi(as, sb, offsetof(SBuf, n), 0);  /* Reset buffer. */
+  if (irref_isk(ir->op1)) {
+    emit_loada(as, sb, ir_kptr(IR(ir->op1)));
+  } else {  /* The SBuf is the payload of a buffer udata. */
+    Reg ud = ra_alloc1(as, ir->op1, RSET_GPR);
+    emit_rmro(as, XO_LEA, sb|REX_64, ud, sizeof(GCudata));
+  }
+}
+
+static void asm_bufput(ASMState *as, IRIns *ir)
+{
+  IRIns *irs = IR(ir->op2);
+  const CCallInfo *ci;
+  IRRef args[4];
+  args[0] = ASMREF_L;  /* lua_State *L */
+  args[1] = ir->op1;   /* SBuf *sb     */
+  if (irs->o == IR_CARG) {  /* Numeric format item of string.format. */
+    ci = &lj_ir_callinfo[IRCALL_lj_str_bufputfmt];
+    args[2] = irs->op1;  /* const char *form */
+    args[3] = irs->op2;  /* lua_Number n     */
+    asm_setupresult(as, ir, ci);  /* SBuf * */
+    asm_gencall(as, ci, args);
+  } else if (irt_isnum(irs->t)) {
+    Reg tmp;
+    ci = &lj_ir_callinfo[IRCALL_lj_str_bufputnum];
+    args[2] = ASMREF_TMP1;  /* const lua_Number * */
+    asm_setupresult(as, ir, ci);  /* SBuf * */
+    asm_gencall(as, ci, args);
+    tmp = ra_releasetmp(as, ASMREF_TMP1);
+    if (irref_isk(ir->op2))
+      emit_loada(as, tmp, ir_knum(irs));
+    else
+      emit_rmro(as, XO_LEA, tmp|REX_64, RID_ESP, ra_spill(as, irs));
+  } else {
+    ci = &lj_ir_callinfo[irt_isint(irs->t) ? IRCALL_lj_str_bufputint :
+					      IRCALL_lj_str_bufput];
+    args[2] = ir->op2;  /* int32_t k or GCstr *s */
+    asm_setupresult(as, ir, ci);  /* SBuf * */
+    asm_gencall(as, ci, args);
+  }
+}
+
+static void asm_bufstr(ASMState *as, IRIns *ir)
+{
+  const CCallInfo *ci = &lj_ir_callinfo[IRCALL_lj_str_buftostr];
+  IRRef args[2];
+  args[0] = ASMREF_L;  /* lua_State *L */
+  args[1] = ir->op1;   /* SBuf *sb     */
+  as->gcsteps++;
+  asm_setupresult(as, ir, ci);  /* GCstr * */
+  asm_gencall(as, ci, args);
+}
+
 /* -- Write barriers ------------------------------------------------------ */
 
+/* Back barrier for tables: a black table turns gray and goes to grayagain.
+** This is the same for old tables in generational mode, which stay black.
+*/
 static void asm_tbar(ASMState *as, IRIns *ir)
 {
   Reg tab = ra_alloc1(as, ir->op1, RSET_GPR);
@@ -2163,6 +2398,9 @@ static void asm_tbar(ASMState *as, IRIns *ir)
   emit_rmro(as, XO_GROUP3b, XOg_TEST, tab, offsetof(GCtab, marked));
 }
 
+/* Forward barrier for closed upvalues. Only the slow path depends on the
+** GC kind, which is handled by lj_gc_barrieruv.
+*/
 static void asm_obar(ASMState *as, IRIns *ir)
 {
   const CCallInfo *ci = &lj_ir_callinfo[IRCALL_lj_gc_barrieruv];
@@ -2382,6 +2620,31 @@ static void asm_fparith(ASMState *as, IRIns *ir, x86Op xo)
   ra_left(as, dest, lref);
 }
 
+/* Packed arithmetic. Never fuses loads, since the operands are unaligned. */
+static void asm_vparith(ASMState *as, IRIns *ir, x86Op xo)
+{
+  IRRef lref = ir->op1;
+  IRRef rref = ir->op2;
+  RegSet allow = RSET_FPR;
+  Reg dest;
+  Reg right = IR(rref)->r;
+  if (ra_hasreg(right)) {
+    rset_clear(allow, right);
+    ra_noweak(as, right);
+  }
+  dest = ra_dest(as, ir, allow);
+  if (lref == rref) {
+    right = dest;
+  } else if (ra_noreg(right)) {
+    if (swapops(as, ir)) {
+      IRRef tmp = lref; lref = rref; rref = tmp;
+    }
+    right = ra_alloc1(as, rref, rset_clear(allow, dest));
+  }
+  emit_rr(as, xo, dest, right);
+  ra_left(as, dest, lref);
+}
+
 static void asm_intarith(ASMState *as, IRIns *ir, x86Arith xa)
 {
   IRRef lref = ir->op1;
@@ -2491,7 +2754,9 @@ static int asm_lea(ASMState *as, IRIns *ir)
 
 static void asm_add(ASMState *as, IRIns *ir)
 {
-  if (irt_isnum(ir->t))
+  if (irt_isv2num(ir->t))
+    asm_vparith(as, ir, XO_ADDPD);
+  else if (irt_isnum(ir->t))
     asm_fparith(as, ir, XO_ADDSD);
   else if ((as->flags & JIT_F_LEA_AGU) || as->testmcp == as->mcp ||
 	   !asm_lea(as, ir))
@@ -2555,6 +2820,59 @@ static void asm_bitshift(ASMState *as, IRIns *ir, x86Shift xs)
   */
 }
 
+/* -- Packed number operations ------------------------------------------- */
+
+/* Load a pair of numbers from the array part. */
+static void asm_vload(ASMState *as, IRIns *ir)
+{
+  lua_assert(ir->o == IR_ALOAD);
+  if (ra_used(ir)) {
+    Reg dest = ra_dest(as, ir, RSET_FPR);
+    asm_fuseahuref(as, ir->op1, RSET_GPR);
+    emit_mrm(as, XO_MOVUPD, dest, RID_MRM);
+  } else {
+    asm_fuseahuref(as, ir->op1, RSET_GPR);
+  }
+  if (!irt_isguard(ir->t))
+    return;  /* Reloaded elements have already been checked. */
+  /* Check the types of both elements. */
+  as->mrm.ofs += 8+4;
+  asm_guardcc(as, CC_A);
+#if LJ_64
+  emit_u32(as, LJ_TISNUM);
+  emit_mrm(as, XO_ARITHi, XOg_CMP, RID_MRM);
+#else
+  emit_i8(as, ~IRT_NUM);
+  emit_mrm(as, XO_ARITHi8, XOg_CMP, RID_MRM);
+#endif
+  as->mrm.ofs -= 8;
+  asm_guardcc(as, CC_A);
+#if LJ_64
+  emit_u32(as, LJ_TISNUM);
+  emit_mrm(as, XO_ARITHi, XOg_CMP, RID_MRM);
+#else
+  emit_i8(as, ~IRT_NUM);
+  emit_mrm(as, XO_ARITHi8, XOg_CMP, RID_MRM);
+#endif
+}
+
+/* Store a pair of numbers to the array part. */
+static void asm_vstore(ASMState *as, IRIns *ir)
+{
+  Reg src = ra_alloc1(as, ir->op2, RSET_FPR);
+  lua_assert(ir->o == IR_ASTORE);
+  asm_fuseahuref(as, ir->op1, RSET_GPR);
+  emit_mrm(as, XO_MOVUPDto, src, RID_MRM);
+}
+
+/* Copy a number into both halves of a register. */
+static void asm_vsplat(ASMState *as, IRIns *ir)
+{
+  Reg dest = ra_dest(as, ir, RSET_FPR);
+  emit_rr(as, XO_UNPCKLPD, dest, dest);
+  ra_left(as, dest, ir->op1);
+}
+
 /* -- Comparisons --------------------------------------------------------- */
 
 /* Virtual flags for unordered FP comparisons. */
@@ -2704,10 +3022,16 @@ static BCReg asm_stack_extent(ASMState *as, SnapShot *snap, BCReg *ptopslot)
     SnapEntry sn = map[n];
     if ((sn & SNAP_FRAME)) {
       IRIns *ir = IR(snap_ref(sn));
-      GCfunc *fn = ir_kfunc(ir);
-      if (isluafunc(fn)) {
+      GCproto *pt = NULL;
+      if (ir->o == IR_FNEW) {  /* New closure of a known prototype. */
+	pt = gco2pt(ir_kgc(IR(ir->op1)));
+      } else {
+	GCfunc *fn = ir_kfunc(ir);
+	if (isluafunc(fn)) pt = funcproto(fn);
+      }
+      if (pt) {
 	BCReg s = snap_slot(sn);
-	BCReg fs = s + funcproto(fn)->framesize;
+	BCReg fs = s + pt->framesize;
 	if (fs > topslot) topslot = fs;
 	baseslot = s;
       }
@@ -2740,12 +3064,13 @@ static void asm_stack_check(ASMState *as, BCReg topslot,
     emit_rmro(as, XO_MOVto, r|REX_64, RID_ESP, 0);
 }
 
-/* Restore Lua stack from on-trace state. */
-static void asm_stack_restore(ASMState *as, SnapShot *snap)
+/* Restore Lua stack from on-trace state. Only slots >= minslot. */
+static void asm_stack_restore(ASMState *as, SnapShot *snap, BCReg minslot)
 {
   SnapEntry *map = &as->T->snapmap[snap->mapofs];
   MSize n, nent = snap->nent;
   SnapEntry *flinks = map + nent + snap->depth;
+  Reg base = ra_alloc1(as, REF_BASE, RSET_GPR);
   /* Store the value of all modified slots to the Lua stack. */
   for (n = 0; n < nent; n++) {
     SnapEntry sn = map[n];
@@ -2753,30 +3078,46 @@ static void asm_stack_restore(ASMState *as, SnapShot *snap)
     int32_t ofs = 8*((int32_t)s-1);
     IRRef ref = snap_ref(sn);
     IRIns *ir = IR(ref);
-    if ((sn & SNAP_NORESTORE))
+    if ((sn & SNAP_NORESTORE) || s < minslot)
       continue;
     if (irt_isnum(ir->t)) {
       Reg src = ra_alloc1(as, ref, RSET_FPR);
-      emit_rmro(as, XO_MOVSDto, src, RID_BASE, ofs);
+      emit_rmro(as, XO_MOVSDto, src, base, ofs);
     } else {
-      lua_assert(irt_ispri(ir->t) || irt_isaddr(ir->t));
+      lua_assert(irt_ispri(ir->t) || irt_isaddr(ir->t) ||
+		 (irt_isint(ir->t) && (sn & SNAP_KEYINDEX)));
       if (!irref_isk(ref)) {
-	Reg src = ra_alloc1(as, ref, rset_exclude(RSET_GPR, RID_BASE));
-	emit_movtomro(as, REX_64LU(ir, src), RID_BASE, ofs);
+	Reg src = ra_alloc1(as, ref, rset_exclude(RSET_GPR, base));
+	emit_movtomro(as, REX_64LU(ir, src), base, ofs);
       } else if (!irt_ispri(ir->t)) {
-	emit_movmroi(as, RID_BASE, ofs, ir->i);
+	emit_movmroi(as, base, ofs, ir->i);
       }
       if ((sn & (SNAP_CONT|SNAP_FRAME))) {
 	if (s != 0)  /* Do not overwrite link to previous frame. */
-	  emit_movmroi(as, RID_BASE, ofs+4, (int32_t)(*flinks--));
+	  emit_movmroi(as, base, ofs+4, (int32_t)(*flinks--));
+      } else if ((sn & SNAP_KEYINDEX)) {
+	emit_movmroi(as, base, ofs+4, LJ_TNIL);
       } else {
 	if (!(LJ_64 && irt_islightud(ir->t)))
-	  emit_movmroi(as, RID_BASE, ofs+4, irt_toitype(ir->t));
+	  emit_movmroi(as, base, ofs+4, irt_toitype(ir->t));
       }
     }
     checkmclim(as);
   }
-  lua_assert(map + nent == flinks);
+  lua_assert(minslot || map + nent == flinks);
+}
+
+/* Close upvalues. */
+static void asm_uclo(ASMState *as, IRIns *ir)
+{
+  const CCallInfo *ci = &lj_ir_callinfo[IRCALL_lj_func_closeuv];
+  IRRef args[2];
+  args[0] = ASMREF_L;  /* lua_State *L  */
+  args[1] = ir->op1;   /* TValue *level */
+  ra_evictset(as, RSET_SCRATCH);
+  asm_gencall(as, ci, args);
+  /* Closing copies the stack slots, so sync them with the snapshot first. */
+  asm_stack_restore(as, &as->T->snap[as->snapno], ir->op2);
 }
 
 /* -- GC handling --------------------------------------------------------- */
@@ -2798,7 +3139,7 @@ static void asm_gc_check(ASMState *as)
   asm_gencall(as, ci, args);
   tmp = ra_releasetmp(as, ASMREF_TMP1);
   emit_loada(as, tmp, J2G(as->J));
-  emit_loadi(as, ra_releasetmp(as, ASMREF_TMP2), (int32_t)as->gcsteps);
+  emit_loadi(as, ra_releasetmp(as, ASMREF_TMP2), as->gcsteps);
   /* Jump around GC step if GC total < GC threshold. */
   emit_sjcc(as, CC_B, l_end);
   emit_opgl(as, XO_ARITH(XOg_CMP), tmp, gc.threshold);
@@ -2807,6 +3148,18 @@ static void asm_gc_check(ASMState *as)
   checkmclim(as);
 }
 
+/* Explicit GC check after the allocations replayed by a side trace. */
+static void asm_gcstep(ASMState *as, IRIns *ir)
+{
+  IRIns *ira;
+  for (ira = IR(as->stopins+1); ira < ir; ira++)
+    if ((ira->o == IR_TNEW || ira->o == IR_TDUP) && ra_used(ira))
+      as->gcsteps++;
+  if (as->gcsteps)
+    asm_gc_check(as);
+  as->gcsteps = (int32_t)0x80000000;  /* Prevent implicit GC check above. */
+}
+
 /* -- PHI and loop handling ----------------------------------------------- */
 
 /* Break a PHI cycle by renaming to a free register (evict if needed). */
@@ -2826,6 +3179,26 @@ static void asm_phi_break(ASMState *as, RegSet blocked, RegSet blockedby,
   }
 }
 
+/* Move an invariant out of a register needed at the loop start.
+** With live range guided allocation, the invariant is kept in a register
+** which is unmodified inside the loop and copied at the loop start.
+** Otherwise (or if there's none) it's restored from a spill slot.
+*/
+static void asm_phi_moveinv(ASMState *as, Reg r)
+{
+  IRRef ref = regcost_ref(as->cost[r]);
+  if ((as->flags & JIT_F_OPT_LIVE) && !irref_isk(ref) && ref != REF_BASE &&
+      !rset_test(as->weakset, r)) {
+    RegSet pick = as->freeset & ~(as->modset | as->phiset) &
+		  (r < RID_MAX_GPR ? RSET_GPR : RSET_FPR);
+    if (pick) {
+      ra_rename(as, r, rset_pickbot(pick));
+      return;
+    }
+  }
+  ra_restore(as, ref);
+}
+
 /* PHI register shuffling.
 **
 ** The allocator tries hard to preserve PHI register assignments across
@@ -2866,7 +3239,7 @@ static void asm_phi_shuffle(ASMState *as)
 	      rset_set(blockedby, left);
 	    left = RID_NONE;
 	  } else {  /* Otherwise grab register from invariant. */
-	    ra_restore(as, ref);
+	    asm_phi_moveinv(as, r);
 	    checkmclim(as);
 	  }
 	}
@@ -2889,7 +3262,7 @@ static void asm_phi_shuffle(ASMState *as)
   work = as->modset & ~(as->freeset | as->phiset);
   while (work) {
     Reg r = rset_picktop(work);
-    ra_restore(as, regcost_ref(as->cost[r]));
+    asm_phi_moveinv(as, r);
     rset_clear(work, r);
     checkmclim(as);
   }
@@ -3016,7 +3389,7 @@ static void asm_loop(ASMState *as)
 {
   /* LOOP is a guard, so the snapno is up to date. */
   as->loopsnapno = as->snapno;
-  if (as->gcsteps)
+  if (as->gcsteps > 0)
     asm_gc_check(as);
   /* LOOP marks the transition from the variant to the invariant part. */
   as->testmcp = as->invmcp = NULL;
@@ -3087,6 +3460,14 @@ static RegSet asm_head_side_base(ASMState *as, Reg pbase, RegSet allow)
   return allow;
 }
 
+/* Get RegSP of parent slot or of value of a sunk parent allocation. */
+static RegSP asm_head_parentrs(ASMState *as, IRIns *ir)
+{
+  if (ir->o == IR_PVAL)
+    return lj_snap_regspref(as->parent, as->J->exitno, ir->op1 + REF_BIAS);
+  return as->parentmap[ir->op1];
+}
+
 /* Head of a side trace.
 **
 ** The current simplistic algorithm requires that all slots inherited
@@ -3112,8 +3493,9 @@ static void asm_head_side(ASMState *as)
   for (i = as->stopins; i > REF_BASE; i--) {
     IRIns *ir = IR(i);
     RegSP rs;
-    lua_assert(ir->o == IR_SLOAD && (ir->op2 & IRSLOAD_PARENT));
-    rs = as->parentmap[ir->op1];
+    lua_assert((ir->o == IR_SLOAD && (ir->op2 & IRSLOAD_PARENT)) ||
+	       ir->o == IR_PVAL);
+    rs = asm_head_parentrs(as, ir);
     if (ra_hasreg(ir->r)) {
       rset_clear(allow, ir->r);
       if (ra_hasspill(ir->s))
@@ -3151,7 +3533,7 @@ static void asm_head_side(ASMState *as)
 	Reg r;
 	RegSP rs;
 	irt_clearmark(ir->t);
-	rs = as->parentmap[ir->op1];
+	rs = asm_head_parentrs(as, ir);
 	if (!ra_hasspill(regsp_spill(rs)))
 	  ra_sethint(ir->r, rs);  /* Hint may be gone, set it again. */
 	else if (sps_scale(regsp_spill(rs))+spdelta == sps_scale(ir->s))
@@ -3183,7 +3565,7 @@ static void asm_head_side(ASMState *as)
     while (work) {
       Reg r = rset_pickbot(work);
       IRIns *ir = IR(regcost_ref(as->cost[r]));
-      RegSP rs = as->parentmap[ir->op1];
+      RegSP rs = asm_head_parentrs(as, ir);
       rset_clear(work, r);
       if (ra_hasspill(regsp_spill(rs))) {
 	int32_t ofs = sps_scale(regsp_spill(rs));
@@ -3279,7 +3661,7 @@ static void asm_tail_link(ASMState *as)
   emit_addptr(as, RID_BASE, 8*(int32_t)baseslot);
 
   /* Sync the interpreter state with the on-trace state. */
-  asm_stack_restore(as, snap);
+  asm_stack_restore(as, snap, 0);
 
   /* Root traces that grow the stack need to check the stack at the end. */
   if (!as->parent && as->topslot)
@@ -3375,13 +3757,25 @@ static void asm_ir(ASMState *as, IRIns *ir)
   /* Arithmetic ops. */
   case IR_ADD: asm_add(as, ir); break;
   case IR_SUB:
-    if (irt_isnum(ir->t))
+    if (irt_isv2num(ir->t))
+      asm_vparith(as, ir, XO_SUBPD);
+    else if (irt_isnum(ir->t))
       asm_fparith(as, ir, XO_SUBSD);
     else  /* Note: no need for LEA trick here. i-k is encoded as i+(-k). */
       asm_intarith(as, ir, XOg_SUB);
     break;
-  case IR_MUL: asm_fparith(as, ir, XO_MULSD); break;
-  case IR_DIV: asm_fparith(as, ir, XO_DIVSD); break;
+  case IR_MUL:
+    if (irt_isv2num(ir->t))
+      asm_vparith(as, ir, XO_MULPD);
+    else
+      asm_fparith(as, ir, XO_MULSD);
+    break;
+  case IR_DIV:
+    if (irt_isv2num(ir->t))
+      asm_vparith(as, ir, XO_DIVPD);
+    else
+      asm_fparith(as, ir, XO_DIVSD);
+    break;
 
   case IR_NEG: asm_fparith(as, ir, XO_XORPS); break;
   case IR_ABS: asm_fparith(as, ir, XO_ANDPS); break;
@@ -3402,25 +3796,44 @@ static void asm_ir(ASMState *as, IRIns *ir)
   case IR_AREF: asm_aref(as, ir); break;
   case IR_HREF: asm_href(as, ir); break;
   case IR_HREFK: asm_hrefk(as, ir); break;
+  case IR_NREF: asm_nref(as, ir); break;
   case IR_NEWREF: asm_newref(as, ir); break;
   case IR_UREFO: case IR_UREFC: asm_uref(as, ir); break;
   case IR_FREF: asm_fref(as, ir); break;
   case IR_STRREF: asm_strref(as, ir); break;
 
   /* Loads and stores. */
-  case IR_ALOAD: case IR_HLOAD: case IR_ULOAD: case IR_VLOAD:
-    asm_ahuvload(as, ir);
+  case IR_ALOAD: case IR_HLOAD: case IR_ULOAD: case IR_VLOAD: case IR_HKLOAD:
+    if (irt_isv2num(ir->t))
+      asm_vload(as, ir);
+    else
+      asm_ahuvload(as, ir);
     break;
   case IR_FLOAD: case IR_XLOAD: asm_fxload(as, ir); break;
   case IR_SLOAD: asm_sload(as, ir); break;
+  case IR_GCSTEP: asm_gcstep(as, ir); break;
 
-  case IR_ASTORE: case IR_HSTORE: case IR_USTORE: asm_ahustore(as, ir); break;
+  case IR_ASTORE: case IR_HSTORE: case IR_USTORE:
+    if (irt_isv2num(ir->t))
+      asm_vstore(as, ir);
+    else
+      asm_ahustore(as, ir);
+    break;
   case IR_FSTORE: asm_fstore(as, ir); break;
+  case IR_UCLO: asm_uclo(as, ir); break;
+  case IR_TCLEAR: asm_tclear(as, ir); break;
 
   /* Allocations. */
   case IR_SNEW: asm_snew(as, ir); break;
   case IR_TNEW: asm_tnew(as, ir); break;
   case IR_TDUP: asm_tdup(as, ir); break;
+  case IR_FNEW: asm_fnew(as, ir); break;
+
+  /* String buffer ops. */
+  case IR_BUFHDR: asm_bufhdr(as, ir); break;
+  case IR_BUFPUT: asm_bufput(as, ir); break;
+  case IR_BUFSTR: asm_bufstr(as, ir); break;
+  case IR_USE: ra_alloc1(as, ir->op1, RSET_GPR); break;
 
   /* Write barriers. */
   case IR_TBAR: asm_tbar(as, ir); break;
@@ -3442,6 +3855,9 @@ static void asm_ir(ASMState *as, IRIns *ir)
   case IR_CALLN: case IR_CALLL: case IR_CALLS: asm_call(as, ir); break;
   case IR_CARG: break;
 
+  /* Packed numbers. */
+  case IR_SPLAT: asm_vsplat(as, ir); break;
+
   default:
     setintV(&as->J->errinfo, ir->o);
     lj_trace_err_info(as->J, LJ_TRERR_NYIIR);
@@ -3456,6 +3872,8 @@ static void asm_trace(ASMState *as)
     IRIns *ir = IR(as->curins);
     if (!ra_used(ir) && !ir_sideeff(ir) && (as->flags & JIT_F_OPT_DCE))
       continue;  /* Dead-code elimination can be soooo easy. */
+    if (ir->r == RID_SINK)
+      continue;  /* Sunk allocations and stores are never emitted. */
     if (irt_isguard(ir->t))
       asm_snap_prep(as);
     RA_DBG_REF();
@@ -3466,11 +3884,64 @@ static void asm_trace(ASMState *as)
 
 /* -- Trace setup --------------------------------------------------------- */
 
+/* Count or record a use of a ref at position pos. */
+static LJ_AINLINE void asm_live_use(ASMState *as, uint32_t *cur, IRRef1 *use,
+				    IRRef ref, IRRef pos)
+{
+  if (ref >= REF_FIRST && ref < as->orignins) {
+    uint32_t k = cur[ref-REF_FIRST]++;
+    if (use) use[k] = (IRRef1)pos;
+  }
+}
+
+/* Scan all uses in ascending order: operands and snapshot entries. */
+static void asm_live_scan(ASMState *as, GCtrace *T, uint32_t *cur, IRRef1 *use)
+{
+  IRRef i, nins = as->orignins;
+  SnapNo s = 0;
+  for (i = REF_FIRST; i <= nins; i++) {
+    for (; s < T->nsnap && (T->snap[s].ref <= i || i == nins); s++) {
+      SnapShot *snap = &T->snap[s];
+      SnapEntry *map = &T->snapmap[snap->mapofs];
+      MSize n, nent = snap->nent;
+      for (n = 0; n < nent; n++)
+	asm_live_use(as, cur, use, snap_ref(map[n]), i);
+    }
+    if (i < nins) {
+      IRIns *ir = IR(i);
+      uint32_t mode = lj_ir_mode[ir->o];
+      if (irm_op1(mode) == IRMref) asm_live_use(as, cur, use, ir->op1, i);
+      if (irm_op2(mode) == IRMref) asm_live_use(as, cur, use, ir->op2, i);
+    }
+  }
+}
+
+/* Setup use positions for live range guided register allocation. */
+static void asm_setup_live(ASMState *as, GCtrace *T)
+{
+  MSize i, n = as->orignins - REF_FIRST;
+  MSize maxuse = 2*n + T->nsnapmap;
+  uint32_t *start = (uint32_t *)lj_str_needbuf(as->J->L, &J2G(as->J)->tmpbuf,
+			(2*n+1)*sizeof(uint32_t) + maxuse*sizeof(IRRef1));
+  uint32_t *cur = start + n+1;
+  memset(cur, 0, n*sizeof(uint32_t));
+  asm_live_scan(as, T, cur, NULL);  /* Count uses per ref. */
+  start[0] = 0;
+  for (i = 0; i < n; i++) {
+    start[i+1] = start[i] + cur[i];
+    cur[i] = start[i];
+  }
+  as->livestart = start;
+  as->livecur = cur;
+  as->liveuse = (IRRef1 *)(cur + n);
+  asm_live_scan(as, T, cur, as->liveuse);  /* Leaves cur past the last use. */
+}
+
 /* Clear reg/sp for all instructions and add register hints. */
 static void asm_setup_regsp(ASMState *as, GCtrace *T)
 {
   IRRef i, nins;
-  int inloop;
+  int inloop, sink = T->sinktags;
 
   ra_setup(as);
 
@@ -3496,8 +3967,11 @@ static void asm_setup_regsp(ASMState *as, GCtrace *T)
 
   inloop = 0;
   as->evenspill = SPS_FIRST;
+  as->nspill = as->nrestore = 0;
   for (i = REF_FIRST; i < nins; i++) {
     IRIns *ir = IR(i);
+    if (sink && ir->r == RID_SINK)
+      continue;  /* Keep the SINK tags. */
     switch (ir->o) {
     case IR_LOOP:
       inloop = 1;
@@ -3514,6 +3988,18 @@ static void asm_setup_regsp(ASMState *as, GCtrace *T)
 	}
       }
       break;
+    /* Set hints for values of sunk allocations from a parent trace. */
+    case IR_PVAL: {
+      RegSP rs = lj_snap_regspref(as->parent, as->J->exitno,
+				  ir->op1 + REF_BIAS);
+      lua_assert(regsp_used(rs));
+      as->stopins = i;
+      if (!ra_hasspill(regsp_spill(rs)) && ra_hasreg(regsp_reg(rs))) {
+	ir->prev = (uint16_t)REGSP_HINT(regsp_reg(rs));
+	continue;
+      }
+      break;
+      }
     case IR_CALLN: case IR_CALLL: case IR_CALLS: {
       const CCallInfo *ci = &lj_ir_callinfo[ir->op2];
 #if LJ_64
@@ -3532,17 +4018,27 @@ static void asm_setup_regsp(ASMState *as, GCtrace *T)
       continue;
       }
     /* C calls evict all scratch regs and return results in RID_RET. */
+    case IR_BUFPUT:
+#if !LJ_64
+      if (as->evenspill < 5)  /* lj_str_bufputfmt needs 5 slots for args. */
+	as->evenspill = 5;
+#endif
     case IR_SNEW: case IR_NEWREF:
 #if !LJ_64
       if (as->evenspill < 3)  /* lj_str_new and lj_tab_newkey need 3 args. */
 	as->evenspill = 3;
 #endif
-    case IR_TNEW: case IR_TDUP: case IR_TOSTR:
+    case IR_FNEW:
+#if !LJ_64
+      if (as->evenspill < 4)  /* lj_func_newL_uv needs 4 args. */
+	as->evenspill = 4;
+#endif
+    case IR_TNEW: case IR_TDUP: case IR_TOSTR: case IR_BUFSTR:
       ir->prev = REGSP_HINT(RID_RET);
       if (inloop)
 	as->modset = RSET_SCRATCH;
       continue;
-    case IR_STRTO: case IR_OBAR:
+    case IR_STRTO: case IR_OBAR: case IR_UCLO: case IR_TCLEAR:
       if (inloop)
 	as->modset = RSET_SCRATCH;
       break;
@@ -3578,7 +4074,8 @@ static void asm_setup_regsp(ASMState *as, GCtrace *T)
       break;
     default:
       /* Propagate hints across likely 'op reg, imm' or 'op reg'. */
-      if (irref_isk(ir->op2) && !irref_isk(ir->op1)) {
+      if (irref_isk(ir->op2) && !irref_isk(ir->op1) &&
+	  !(sink && IR(ir->op1)->r == RID_SINK)) {
 	ir->prev = IR(ir->op1)->prev;
 	continue;
       }
@@ -3590,6 +4087,8 @@ static void asm_setup_regsp(ASMState *as, GCtrace *T)
     as->oddspill = as->evenspill++;
   else
     as->oddspill = 0;
+  if ((as->flags & JIT_F_OPT_LIVE))
+    asm_setup_live(as, T);
 }
 
 /* -- Assembler core ------------------------------------------------------ */
@@ -3666,7 +4165,7 @@ void lj_asm_trace(jit_State *J, GCtrace *T)
 
   RA_DBG_REF();
   checkmclim(as);
-  if (as->gcsteps) {
+  if (as->gcsteps > 0) {
     as->curins = as->T->snap[0].ref;
     asm_snap_prep(as);  /* The GC check is a guard. */
     asm_gc_check(as);
@@ -3686,9 +4185,12 @@ void lj_asm_trace(jit_State *J, GCtrace *T)
   /* Set trace entry point before fixing up tail to allow link to self. */
   T->mcode = as->mcp;
   T->mcloop = as->mcloop ? (MSize)(as->mcloop - as->mcp) : 0;
+  asm_snap_fixmcofs(as);
   if (!as->loopref)
     asm_tail_fixup(as, T->link);  /* Note: this may change as->mctop! */
   T->szmcode = (MSize)(as->mctop - as->mcp);
+  T->nspill = (uint16_t)as->nspill;
+  T->nrestore = (uint16_t)(as->nrestore > 0xffff ? 0xffff : as->nrestore);
   VG_INVALIDATE(T->mcode, T->szmcode);
 }
 
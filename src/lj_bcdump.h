@@ -0,0 +1,77 @@
+/*
+** Bytecode dump definitions.
+** Copyright (C) 2005-2010 Mike Pall. See Copyright Notice in luajit.h
+*/
+
+#ifndef _LJ_BCDUMP_H
+#define _LJ_BCDUMP_H
+
+#include "lj_obj.h"
+#include "lj_lex.h"
+
+/* -- Bytecode dump format ------------------------------------------------ */
+
+/*
+** dump   = header proto+ 0U
+** header = ESC 'L' 'J' versionB flagsU [namelenU nameB*]
+** proto  = lengthU pdata
+** pdata  = phead bcinsW* uvdataH* kgc* knum* [debugB*]
+** phead  = flagsB numparamsB framesizeB numuvB numkgcU numknU numbcU
+**          firstlineU lastlineU [debuglenU numvarU]
+** kgc    = kgctypeU { ktab | strB* }
+** knum   = intU0 | (loU1 hiU)
+** ktab   = narrayU nhashU karray* khash*
+** karray = ktabk
+** khash  = ktabk ktabk
+** ktabk  = ktabtypeU { intU | (loU hiU) | strB* }
+** debug  = lineU* uvname* varinfo*
+** uvname = namelenU nameB*
+** varinfo= namelenU nameB* startpcU endpcU
+**
+** B = 8 bit, H = 16 bit, W = 32 bit, U = ULEB128 of W,
+** U0/U1 = ULEB128 of W shifted left by one, with the lowest bit 0/1.
+**
+** The bytecode excludes the leading FUNCF/FUNCV instruction, which is
+** reconstructed from the flags and the frame size. The child prototypes
+** of a prototype precede it, in order of increasing constant index. Their
+** kgc entries are written in decreasing order of the constant index.
+*/
+
+/* Bytecode dump header. */
+#define BCDUMP_HEAD1		0x1b
+#define BCDUMP_HEAD2		0x4c
+#define BCDUMP_HEAD3		0x4a
+
+/* Bump the version whenever the bytecode or the dump format changes. */
+#define BCDUMP_VERSION		1
+
+/* Compatibility flags. */
+#define BCDUMP_F_BE		0x01
+#define BCDUMP_F_STRIP		0x02
+
+#define BCDUMP_F_KNOWN		(BCDUMP_F_STRIP*2-1)
+
+#if LJ_ARCH_ENDIAN == LUAJIT_BE
+#define BCDUMP_F_NATIVE		BCDUMP_F_BE
+#else
+#define BCDUMP_F_NATIVE		0
+#endif
+
+/* Type codes for the GC constants of a prototype. Plus length for strings. */
+enum {
+  BCDUMP_KGC_CHILD, BCDUMP_KGC_TAB, BCDUMP_KGC_STR
+};
+
+/* Type codes for the keys/values of a constant table. */
+enum {
+  BCDUMP_KTAB_NIL, BCDUMP_KTAB_FALSE, BCDUMP_KTAB_TRUE,
+  BCDUMP_KTAB_INT, BCDUMP_KTAB_NUM, BCDUMP_KTAB_STR
+};
+
+/* -- Bytecode reader/writer ---------------------------------------------- */
+
+LJ_FUNC int lj_bcwrite(lua_State *L, GCproto *pt, lua_Writer writer,
+		       void *data, int strip);
+LJ_FUNC GCproto *lj_bcread(LexState *ls);
+
+#endif
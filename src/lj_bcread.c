@@ -0,0 +1,452 @@
+/*
+** Bytecode reader.
+** Copyright (C) 2005-2010 Mike Pall. See Copyright Notice in luajit.h
+*/
+
+#define lj_bcread_c
+#define LUA_CORE
+
+#include "lj_obj.h"
+#include "lj_gc.h"
+#include "lj_err.h"
+#include "lj_str.h"
+#include "lj_tab.h"
+#include "lj_bc.h"
+#include "lj_lex.h"
+#include "lj_bcdump.h"
+#include "lj_state.h"
+#include "lj_vm.h"
+#include "lj_vmevent.h"
+
+/* Reuse some lexer fields for our own purposes. */
+#define bcread_flags(ls)	ls->level
+#define bcread_swap(ls) \
+  ((bcread_flags(ls) & BCDUMP_F_BE) != BCDUMP_F_NATIVE)
+
+/* -- Input buffer handling ----------------------------------------------- */
+
+/* Throw reader error. */
+static LJ_NOINLINE void bcread_error(LexState *ls, ErrMsg em)
+{
+  lua_State *L = ls->L;
+  const char *name = ls->chunkarg;
+  if (*name == BCDUMP_HEAD1) name = "(binary)";
+  else if (*name == '@' || *name == '=') name++;
+  lj_str_pushf(L, "%s: %s", name, strdata(lj_err_str(L, em)));
+  lj_err_throw(L, LUA_ERRSYNTAX);
+}
+
+/* Refill buffer until at least len bytes are available. */
+static LJ_NOINLINE void bcread_fill(LexState *ls, MSize len, int need)
+{
+  lua_assert(len != 0);
+  if (len > LJ_MAX_MEM || ls->current < 0)
+    bcread_error(ls, LJ_ERR_BCBAD);
+  do {
+    const char *buf;
+    size_t size;
+    if (ls->n) {  /* Copy remainder to buffer. */
+      if (ls->sb.n) {  /* Move down in buffer. */
+	lua_assert(ls->p + ls->n == ls->sb.buf + ls->sb.n);
+	if (ls->n != ls->sb.n)
+	  memmove(ls->sb.buf, ls->p, ls->n);
+      } else {  /* Copy from buffer provided by reader. */
+	memcpy(lj_str_needbuf(ls->L, &ls->sb, len), ls->p, ls->n);
+      }
+      ls->p = ls->sb.buf;
+    }
+    ls->sb.n = ls->n;
+    buf = ls->rfunc(ls->L, ls->rdata, &size);  /* Get more data from reader. */
+    if (buf == NULL || size == 0) {  /* EOF? */
+      if (need) bcread_error(ls, LJ_ERR_BCBAD);
+      ls->current = -1;  /* Only bad if we get called again. */
+      break;
+    }
+    if (ls->sb.n) {  /* Append to buffer. */
+      MSize n = ls->sb.n + (MSize)size;
+      lj_str_needbuf(ls->L, &ls->sb, n < len ? len : n);
+      memcpy(ls->sb.buf + ls->sb.n, buf, size);
+      ls->n = ls->sb.n = n;
+      ls->p = ls->sb.buf;
+    } else {  /* Return buffer provided by reader. */
+      ls->n = (MSize)size;
+      ls->p = buf;
+    }
+  } while (ls->n < len);
+}
+
+/* Need a certain number of bytes. */
+static LJ_AINLINE void bcread_need(LexState *ls, MSize len)
+{
+  if (LJ_UNLIKELY(ls->n < len))
+    bcread_fill(ls, len, 1);
+}
+
+/* Want to read up to a certain number of bytes, but may need less. */
+static LJ_AINLINE void bcread_want(LexState *ls, MSize len)
+{
+  if (LJ_UNLIKELY(ls->n < len))
+    bcread_fill(ls, len, 0);
+}
+
+/* Return memory block from buffer. */
+static uint8_t *bcread_mem(LexState *ls, MSize len)
+{
+  uint8_t *p = (uint8_t *)ls->p;
+  if (LJ_UNLIKELY(ls->n < len))
+    bcread_error(ls, LJ_ERR_BCBAD);
+  ls->n -= len;
+  ls->p = (char *)p + len;
+  return p;
+}
+
+/* Copy memory block from buffer. */
+static void bcread_block(LexState *ls, void *q, MSize len)
+{
+  memcpy(q, bcread_mem(ls, len), len);
+}
+
+/* Read byte from buffer. */
+static LJ_AINLINE uint32_t bcread_byte(LexState *ls)
+{
+  if (LJ_UNLIKELY(ls->n == 0))
+    bcread_error(ls, LJ_ERR_BCBAD);
+  ls->n--;
+  return (uint32_t)(uint8_t)*ls->p++;
+}
+
+/* Read ULEB128 value from buffer. */
+static uint32_t bcread_uleb128(LexState *ls)
+{
+  uint32_t v = bcread_byte(ls);
+  if (LJ_UNLIKELY(v >= 0x80)) {
+    int sh = 0;
+    v &= 0x7f;
+    do {
+      uint32_t b = bcread_byte(ls);
+      if ((sh += 7) > 28)  /* More than 5 bytes? */
+	bcread_error(ls, LJ_ERR_BCBAD);
+      v |= ((b & 0x7f) << sh);
+      if (b < 0x80) break;
+    } while (1);
+  }
+  return v;
+}
+
+/* Read top 32 bits of 33 bit ULEB128 value from buffer. */
+static uint32_t bcread_uleb128_33(LexState *ls)
+{
+  uint32_t v = (bcread_byte(ls) >> 1);
+  if (LJ_UNLIKELY(v >= 0x40)) {
+    int sh = -1;
+    v &= 0x3f;
+    do {
+      uint32_t b = bcread_byte(ls);
+      if ((sh += 7) > 27)  /* More than 5 bytes? */
+	bcread_error(ls, LJ_ERR_BCBAD);
+      v |= ((b & 0x7f) << sh);
+      if (b < 0x80) break;
+    } while (1);
+  }
+  return v;
+}
+
+/* -- Bytecode reader ----------------------------------------------------- */
+
+/* Read debug info of a prototype. */
+static void bcread_dbg(LexState *ls, GCproto *pt)
+{
+  MSize i;
+  BCLine *lineinfo = proto_lineinfo(pt);
+  VarInfo *vi = proto_varinfo(pt);
+  GCRef *uvname = mref(pt->uvname, GCRef);
+  for (i = 0; i < pt->sizebc; i++)
+    lineinfo[i] = (BCLine)bcread_uleb128(ls);
+  for (i = 0; i < pt->sizeuv; i++) {
+    MSize len = bcread_uleb128(ls);
+    setgcref(uvname[i], obj2gco(lj_str_new(ls->L,
+			  (const char *)bcread_mem(ls, len), len)));
+  }
+  for (i = 0; i < pt->sizevarinfo; i++) {
+    MSize len = bcread_uleb128(ls);
+    setgcref(vi[i].name, obj2gco(lj_str_new(ls->L,
+			  (const char *)bcread_mem(ls, len), len)));
+    vi[i].startpc = bcread_uleb128(ls);
+    vi[i].endpc = bcread_uleb128(ls);
+  }
+}
+
+/* Read a single constant key/value of a template table. */
+static void bcread_ktabk(LexState *ls, TValue *o)
+{
+  MSize tp = bcread_uleb128(ls);
+  if (tp >= BCDUMP_KTAB_STR) {
+    MSize len = tp - BCDUMP_KTAB_STR;
+    const char *p = (const char *)bcread_mem(ls, len);
+    setstrV(ls->L, o, lj_str_new(ls->L, p, len));
+  } else if (tp == BCDUMP_KTAB_INT) {
+    setintV(o, (int32_t)bcread_uleb128(ls));
+  } else if (tp == BCDUMP_KTAB_NUM) {
+    o->u32.lo = bcread_uleb128(ls);
+    o->u32.hi = bcread_uleb128(ls);
+  } else {
+    if (tp > BCDUMP_KTAB_TRUE)
+      bcread_error(ls, LJ_ERR_BCBAD);
+    setitype(o, ~tp);
+  }
+}
+
+/* Read a template table. */
+static GCtab *bcread_ktab(LexState *ls)
+{
+  MSize narray = bcread_uleb128(ls);
+  MSize nhash = bcread_uleb128(ls);
+  GCtab *t;
+  /* Each array entry takes at least one byte, each hash entry two. */
+  if (narray > ls->n || nhash > (ls->n >> 1))
+    bcread_error(ls, LJ_ERR_BCBAD);
+  t = lj_tab_new(ls->L, narray, nhash > 0 ? lj_fls(nhash)+1 : 0);
+  if (narray) {  /* Read array entries. */
+    MSize i;
+    TValue *o = tvref(t->array);
+    for (i = 0; i < narray; i++, o++)
+      bcread_ktabk(ls, o);
+  }
+  if (nhash) {  /* Read hash entries. */
+    MSize i;
+    for (i = 0; i < nhash; i++) {
+      TValue key;
+      bcread_ktabk(ls, &key);
+      if (tvisnil(&key))
+	bcread_error(ls, LJ_ERR_BCBAD);
+      bcread_ktabk(ls, lj_tab_set(ls->L, t, &key));
+    }
+  }
+  return t;
+}
+
+/* Read GC constants of a prototype. */
+static void bcread_kgc(LexState *ls, GCproto *pt, ptrdiff_t oldtop)
+{
+  lua_State *L = ls->L;
+  MSize i = pt->sizekgc;
+  GCRef *kr = mref(pt->k, GCRef);
+  while (i-- > 0) {
+    MSize tp = bcread_uleb128(ls);
+    GCobj *o;
+    if (tp >= BCDUMP_KGC_STR) {
+      MSize len = tp - BCDUMP_KGC_STR;
+      const char *p = (const char *)bcread_mem(ls, len);
+      o = obj2gco(lj_str_new(L, p, len));
+    } else if (tp == BCDUMP_KGC_TAB) {
+      o = obj2gco(bcread_ktab(ls));
+    } else {
+      if (tp != BCDUMP_KGC_CHILD || L->top <= restorestack(L, oldtop))
+	bcread_error(ls, LJ_ERR_BCBAD);
+      L->top--;
+      o = obj2gco(protoV(L->top));
+    }
+    setgcref(kr[~(ptrdiff_t)i], o);
+    lj_gc_objbarrier(L, pt, o);
+  }
+}
+
+/* Read number constants of a prototype. */
+static void bcread_knum(LexState *ls, GCproto *pt)
+{
+  MSize i;
+  lua_Number *kn = mref(pt->k, lua_Number);
+  for (i = 0; i < pt->sizekn; i++) {
+    int isnum = ls->n > 0 && (*ls->p & 1);
+    uint32_t lo = bcread_uleb128_33(ls);
+    if (isnum) {
+      TValue o;
+      o.u32.lo = lo;
+      o.u32.hi = bcread_uleb128(ls);
+      kn[i] = o.n;
+    } else {
+      kn[i] = (lua_Number)(int32_t)lo;
+    }
+  }
+}
+
+/* Read bytecode instructions. */
+static void bcread_bytecode(LexState *ls, GCproto *pt)
+{
+  BCIns *bc = proto_bc(pt);
+  MSize sizebc = pt->sizebc;
+  bc[sizebc] = ~0u;  /* Close potentially uninitialized gap between bc and kgc. */
+  bc[0] = BCINS_AD((pt->flags & PROTO_IS_VARARG) ? BC_FUNCV : BC_FUNCF,
+		   pt->framesize, 0);
+  bcread_block(ls, bc+1, (sizebc-1)*(MSize)sizeof(BCIns));
+  if (bcread_swap(ls)) {
+    MSize i;
+    for (i = 1; i < sizebc; i++) bc[i] = lj_bswap(bc[i]);
+  }
+}
+
+/* Read upvalue refs. */
+static void bcread_uv(LexState *ls, GCproto *pt)
+{
+  MSize sizeuv = pt->sizeuv;
+  if (sizeuv) {
+    uint16_t *uv = proto_uv(pt);
+    bcread_block(ls, uv, sizeuv*2);
+    if (bcread_swap(ls)) {
+      MSize i;
+      for (i = 0; i < sizeuv; i++)
+	uv[i] = (uint16_t)((uv[i] >> 8)|(uv[i] << 8));
+    }
+  }
+}
+
+/* Read a prototype. Returns NULL at the end of the dump. */
+static GCproto *bcread_proto(LexState *ls, ptrdiff_t oldtop)
+{
+  lua_State *L = ls->L;
+  GCproto *pt;
+  MSize len, startn, flags, numparams, framesize, sizeuv, sizekgc, sizekn;
+  MSize sizebc, sizevi = 0, sizedbg = 0, i;
+  BCLine firstline, lastline;
+  size_t sizept, ofsk, ofsuv, ofsdbg, ofsli;
+
+  bcread_want(ls, 5);
+  if (ls->n == 0)
+    bcread_error(ls, LJ_ERR_BCBAD);
+  len = bcread_uleb128(ls);
+  if (len == 0)
+    return NULL;  /* EOF */
+  bcread_need(ls, len);
+  startn = ls->n;
+
+  /* Read prototype header. */
+  flags = bcread_byte(ls);
+  numparams = bcread_byte(ls);
+  framesize = bcread_byte(ls);
+  sizeuv = bcread_byte(ls);
+  sizekgc = bcread_uleb128(ls);
+  sizekn = bcread_uleb128(ls);
+  sizebc = bcread_uleb128(ls);
+  firstline = (BCLine)bcread_uleb128(ls);
+  lastline = (BCLine)bcread_uleb128(ls);
+  if (!(bcread_flags(ls) & BCDUMP_F_STRIP)) {
+    sizedbg = bcread_uleb128(ls);
+    sizevi = bcread_uleb128(ls);
+  }
+  /* Every item takes at least one byte, every instruction four. */
+  if (sizebc == 0 || sizebc-1 > (len >> 2) || numparams > framesize ||
+      framesize > LJ_MAX_SLOTS || sizekgc > BCMAX_D+1 || sizekgc > len ||
+      sizekn > BCMAX_D+1 || sizekn > len || sizedbg > len || sizevi > len)
+    bcread_error(ls, LJ_ERR_BCBAD);
+
+  /* Calculate total size of prototype including all colocated arrays. */
+  sizept = sizeof(GCproto) + sizebc*sizeof(BCIns) + sizekgc*sizeof(GCRef);
+  sizept = (sizept + sizeof(lua_Number)-1) & ~(sizeof(lua_Number)-1);
+  ofsk = sizept;
+  sizept += sizekn*sizeof(lua_Number);
+  ofsuv = sizept;
+  sizept += ((sizeuv+1)&~1)*2;
+  ofsdbg = sizept;
+  sizept += sizevi*sizeof(VarInfo) + sizeuv*sizeof(GCRef);
+  ofsli = sizept;
+  sizept += sizebc*sizeof(BCLine);
+  if (sizept > LJ_MAX_MEM)
+    bcread_error(ls, LJ_ERR_BCBAD);
+
+  /* Allocate prototype and initialize its fields. */
+  pt = (GCproto *)lj_mem_newgco(L, (MSize)sizept);
+  pt->gct = ~LJ_TPROTO;
+  pt->numparams = (uint8_t)numparams;
+  pt->framesize = (uint8_t)framesize;
+  pt->sizebc = sizebc;
+  setmref(pt->k, (char *)pt + ofsk);
+  setmref(pt->uv, (char *)pt + ofsuv);
+  pt->sizekgc = 0;  /* Set to zero until fully initialized. */
+  pt->sizekn = sizekn;
+  pt->sizept = (MSize)sizept;
+  pt->sizeuv = (uint8_t)sizeuv;
+  pt->flags = (uint8_t)flags;
+  pt->trace = 0;
+  setgcref(pt->chunkname, obj2gco(ls->chunkname));
+  pt->lastlinedefined = lastline;
+  pt->sizevarinfo = sizevi;
+  setmref(pt->varinfo, (char *)pt + ofsdbg);
+  setmref(pt->uvname, (char *)pt + ofsdbg + sizevi*sizeof(VarInfo));
+  setmref(pt->lineinfo, (char *)pt + ofsli);
+  for (i = 0; i < sizeuv; i++)  /* Anchor before reading any strings. */
+    setgcref(mref(pt->uvname, GCRef)[i], obj2gco(&G(L)->strempty));
+  for (i = 0; i < sizevi; i++)
+    setgcref(proto_varinfo(pt)[i].name, obj2gco(&G(L)->strempty));
+
+  /* Read the rest of the prototype. */
+  bcread_bytecode(ls, pt);
+  bcread_uv(ls, pt);
+  for (i = 0; i < sizekgc; i++)  /* Clear before the GC can see them. */
+    setgcref(mref(pt->k, GCRef)[~(ptrdiff_t)i], obj2gco(&G(L)->strempty));
+  pt->sizekgc = sizekgc;
+  bcread_kgc(ls, pt, oldtop);
+  bcread_knum(ls, pt);
+  if (sizedbg) {
+    bcread_dbg(ls, pt);
+  } else {  /* Stripped: only the first line is known. */
+    BCLine *lineinfo = proto_lineinfo(pt);
+    lineinfo[0] = firstline;
+    for (i = 1; i < sizebc; i++)
+      lineinfo[i] = 0;
+  }
+  if (startn - ls->n != len)
+    bcread_error(ls, LJ_ERR_BCBAD);
+
+  lj_vmevent_send(L, BC,
+    setprotoV(L, L->top++, pt);
+  );
+  return pt;
+}
+
+/* Read and check header of bytecode dump. */
+static void bcread_header(LexState *ls)
+{
+  uint32_t flags;
+  bcread_want(ls, 3+5+5);
+  if (ls->n < 3 || bcread_byte(ls) != BCDUMP_HEAD2 ||
+      bcread_byte(ls) != BCDUMP_HEAD3)
+    bcread_error(ls, LJ_ERR_XBCLOAD);
+  if (bcread_byte(ls) != BCDUMP_VERSION)
+    bcread_error(ls, LJ_ERR_BCFMT);
+  bcread_flags(ls) = flags = bcread_uleb128(ls);
+  if ((flags & ~(uint32_t)BCDUMP_F_KNOWN) != 0)
+    bcread_error(ls, LJ_ERR_BCFMT);
+  if ((flags & BCDUMP_F_STRIP)) {
+    const char *name = ls->chunkarg;
+    ls->chunkname = lj_str_newz(ls->L, *name == BCDUMP_HEAD1 ? "=?" : name);
+  } else {
+    MSize len = bcread_uleb128(ls);
+    bcread_need(ls, len);
+    ls->chunkname = lj_str_new(ls->L, (const char *)bcread_mem(ls, len), len);
+  }
+}
+
+/* Read a bytecode dump. */
+GCproto *lj_bcread(LexState *ls)
+{
+  lua_State *L = ls->L;
+  ptrdiff_t oldtop;
+  GCproto *pt;
+  lua_assert(ls->current == BCDUMP_HEAD1);
+  ls->sb.n = 0;
+  bcread_header(ls);
+  setstrV(L, L->top, ls->chunkname);  /* Anchor chunkname string. */
+  incr_top(L);
+  oldtop = savestack(L, L->top);
+  for (;;) {  /* Process all prototypes in the bytecode dump. */
+    pt = bcread_proto(ls, oldtop);
+    if (!pt) break;
+    setprotoV(L, L->top, pt);
+    incr_top(L);
+  }
+  if (ls->n != 0 || L->top != restorestack(L, oldtop) + 1)
+    bcread_error(ls, LJ_ERR_BCBAD);
+  pt = protoV(L->top-1);
+  L->top -= 2;  /* Drop prototype and chunkname. */
+  return pt;
+}
@@ -0,0 +1,358 @@
+/*
+** Bytecode writer.
+** Copyright (C) 2005-2010 Mike Pall. See Copyright Notice in luajit.h
+*/
+
+#define lj_bcwrite_c
+#define LUA_CORE
+
+#include "lj_obj.h"
+#include "lj_gc.h"
+#include "lj_str.h"
+#include "lj_bc.h"
+#if LJ_HASJIT
+#include "lj_dispatch.h"
+#include "lj_jit.h"
+#endif
+#include "lj_bcdump.h"
+#include "lj_vm.h"
+
+/* Context for bytecode writer. */
+typedef struct BCWriteCtx {
+  SBuf sb;			/* Output buffer. */
+  lua_State *L;			/* Lua state. */
+  GCproto *pt;			/* Root prototype. */
+  lua_Writer wfunc;		/* Writer callback. */
+  void *wdata;			/* Writer callback data. */
+  int strip;			/* Strip debug info. */
+  int status;			/* Status from writer callback. */
+} BCWriteCtx;
+
+/* -- Output buffer handling ---------------------------------------------- */
+
+/* Ensure a minimum free space in the buffer. Returns the write position. */
+static char *bcwrite_more(BCWriteCtx *ctx, MSize len)
+{
+  MSize n = ctx->sb.n;
+  if (LJ_UNLIKELY(n + len > ctx->sb.sz)) {
+    MSize sz = ctx->sb.sz * 2;
+    if (sz < n + len) sz = n + len;
+    if (sz < LJ_MIN_SBUF) sz = LJ_MIN_SBUF;
+    lj_str_resizebuf(ctx->L, &ctx->sb, sz);
+  }
+  return ctx->sb.buf + n;
+}
+
+/* Set the end of the buffer after writing up to p. */
+#define bcwrite_done(ctx, p)	((ctx)->sb.n = (MSize)((p) - (ctx)->sb.buf))
+
+/* Write ULEB128 value. Needs up to 5 bytes. */
+static char *bcwrite_uleb128(char *p, uint32_t v)
+{
+  for (; v >= 0x80; v >>= 7)
+    *p++ = (char)((v & 0x7f) | 0x80);
+  *p++ = (char)v;
+  return p;
+}
+
+/* Write 33 bit ULEB128 value with the lowest bit from isnum. */
+static char *bcwrite_uleb128_33(char *p, uint32_t v, int isnum)
+{
+  *p = (char)(((v & 0x3f) << 1) | isnum);
+  v >>= 6;
+  if (v) {
+    *p++ |= 0x80;
+    for (; v >= 0x80; v >>= 7)
+      *p++ = (char)((v & 0x7f) | 0x80);
+    *p = (char)v;
+  }
+  return p+1;
+}
+
+/* Write a string with its length plus a type code. */
+static void bcwrite_str(BCWriteCtx *ctx, GCstr *s, uint32_t add)
+{
+  MSize len = s->len;
+  char *p = bcwrite_more(ctx, 5+len);
+  p = bcwrite_uleb128(p, len+add);
+  memcpy(p, strdata(s), len);
+  bcwrite_done(ctx, p+len);
+}
+
+/* -- Constants ----------------------------------------------------------- */
+
+/* Write a key or value of a constant table. */
+static void bcwrite_ktabk(BCWriteCtx *ctx, cTValue *o)
+{
+  char *p;
+  if (tvisstr(o)) {
+    bcwrite_str(ctx, strV(o), BCDUMP_KTAB_STR);
+    return;
+  }
+  p = bcwrite_more(ctx, 1+2*5);
+  if (tvisnum(o)) {
+    lua_Number n = numV(o);
+    int32_t k = lj_num2int(n);
+    if (n == (lua_Number)k && !(k == 0 && o->u32.hi != 0)) {
+      *p++ = BCDUMP_KTAB_INT;
+      p = bcwrite_uleb128(p, (uint32_t)k);
+    } else {
+      *p++ = BCDUMP_KTAB_NUM;
+      p = bcwrite_uleb128(p, o->u32.lo);
+      p = bcwrite_uleb128(p, o->u32.hi);
+    }
+  } else {
+    lua_assert(tvispri(o));
+    *p++ = (char)(~itype(o));  /* Same order as BCDUMP_KTAB_NIL/FALSE/TRUE. */
+  }
+  bcwrite_done(ctx, p);
+}
+
+/* Write a template table. */
+static void bcwrite_ktab(BCWriteCtx *ctx, GCtab *t)
+{
+  MSize i, narray = 0, nhash = 0;
+  char *p;
+  if (t->asize > 0) {  /* Trailing nils of the array part are omitted. */
+    TValue *array = tvref(t->array);
+    for (narray = t->asize; narray > 0; narray--)
+      if (!tvisnil(&array[narray-1]))
+	break;
+  }
+  if (t->hmask > 0) {  /* Count the used hash slots. */
+    Node *node = noderef(t->node);
+    for (i = 0; i <= t->hmask; i++)
+      nhash += !tvisnil(&node[i].val);
+  }
+  p = bcwrite_more(ctx, 2*5);
+  p = bcwrite_uleb128(p, narray);
+  p = bcwrite_uleb128(p, nhash);
+  bcwrite_done(ctx, p);
+  for (i = 0; i < narray; i++)
+    bcwrite_ktabk(ctx, &tvref(t->array)[i]);
+  if (nhash) {
+    Node *node = noderef(t->node);
+    for (i = 0; i <= t->hmask; i++) {
+      Node *n = &node[i];
+      if (!tvisnil(&n->val)) {
+	bcwrite_ktabk(ctx, &n->key);
+	bcwrite_ktabk(ctx, &n->val);
+      }
+    }
+  }
+}
+
+/* Write GC constants of a prototype. */
+static void bcwrite_kgc(BCWriteCtx *ctx, GCproto *pt)
+{
+  MSize i = pt->sizekgc;
+  while (i-- > 0) {
+    GCobj *o = proto_kgc(pt, ~(ptrdiff_t)i);
+    if (o->gch.gct == ~LJ_TSTR) {
+      bcwrite_str(ctx, gco2str(o), BCDUMP_KGC_STR);
+    } else if (o->gch.gct == ~LJ_TPROTO) {
+      char *p = bcwrite_more(ctx, 1);
+      *p++ = BCDUMP_KGC_CHILD;  /* The child has been written before. */
+      bcwrite_done(ctx, p);
+    } else {
+      char *p;
+      lua_assert(o->gch.gct == ~LJ_TTAB);
+      p = bcwrite_more(ctx, 1);
+      *p++ = BCDUMP_KGC_TAB;
+      bcwrite_done(ctx, p);
+      bcwrite_ktab(ctx, gco2tab(o));
+    }
+  }
+}
+
+/* Write number constants of a prototype. */
+static void bcwrite_knum(BCWriteCtx *ctx, GCproto *pt)
+{
+  MSize i, sizekn = pt->sizekn;
+  char *p = bcwrite_more(ctx, 10*sizekn);
+  for (i = 0; i < sizekn; i++) {
+    TValue o;
+    int32_t k;
+    o.n = proto_knum(pt, i);
+    k = lj_num2int(o.n);
+    if (o.n == (lua_Number)k && !(k == 0 && o.u32.hi != 0)) {
+      p = bcwrite_uleb128_33(p, (uint32_t)k, 0);
+    } else {
+      p = bcwrite_uleb128_33(p, o.u32.lo, 1);
+      p = bcwrite_uleb128(p, o.u32.hi);
+    }
+  }
+  bcwrite_done(ctx, p);
+}
+
+/* -- Bytecode and debug info --------------------------------------------- */
+
+/* Write bytecode instructions, undoing any modifications by the JIT. */
+static void bcwrite_bytecode(BCWriteCtx *ctx, GCproto *pt)
+{
+  MSize i, sizebc = pt->sizebc;
+  BCIns *bc = proto_bc(pt);
+  char *p = bcwrite_more(ctx, (sizebc-1)*sizeof(BCIns));
+#if LJ_HASJIT
+  jit_State *J = L2J(ctx->L);
+#endif
+  for (i = 1; i < sizebc; i++) {  /* Skip FUNCF/FUNCV. */
+    BCIns ins = bc[i];
+#if LJ_HASJIT
+    BCOp op = bc_op(ins);
+    if (op == BC_IFORL || op == BC_IITERL || op == BC_ILOOP)
+      setbc_op(&ins, (int)op+(int)BC_LOOP-(int)BC_ILOOP);
+    else if (op == BC_JFORI)
+      setbc_op(&ins, BC_FORI);
+    else if (op == BC_JFORL || op == BC_JITERL || op == BC_JLOOP)
+      ins = traceref(J, bc_d(ins))->startins;
+#endif
+    memcpy(p, &ins, sizeof(BCIns));
+    p += sizeof(BCIns);
+  }
+  bcwrite_done(ctx, p);
+}
+
+/* Write debug info of a prototype. */
+static void bcwrite_debug(BCWriteCtx *ctx, GCproto *pt)
+{
+  MSize i;
+  VarInfo *vi = proto_varinfo(pt);
+  char *p = bcwrite_more(ctx, 5*pt->sizebc);
+  for (i = 0; i < pt->sizebc; i++)
+    p = bcwrite_uleb128(p, proto_line(pt, i));
+  bcwrite_done(ctx, p);
+  for (i = 0; i < pt->sizeuv; i++)
+    bcwrite_str(ctx, proto_uvname(pt, i), 0);
+  for (i = 0; i < pt->sizevarinfo; i++) {
+    bcwrite_str(ctx, gco2str(gcref(vi[i].name)), 0);
+    p = bcwrite_more(ctx, 2*5);
+    p = bcwrite_uleb128(p, vi[i].startpc);
+    p = bcwrite_uleb128(p, vi[i].endpc);
+    bcwrite_done(ctx, p);
+  }
+}
+
+/* -- Prototypes ---------------------------------------------------------- */
+
+/* Room for the length and the header of a prototype. */
+#define BCWRITE_HEADROOM	(5+4+7*5)
+
+/* Write a prototype, preceded by all of its children. */
+static void bcwrite_proto(BCWriteCtx *ctx, GCproto *pt)
+{
+  char head[BCWRITE_HEADROOM], *p;
+  MSize i, ofsdbg, len, hlen;
+
+  /* Recursively write the children first. */
+  for (i = 0; i < pt->sizekgc; i++) {
+    GCobj *o = proto_kgc(pt, ~(ptrdiff_t)i);
+    if (o->gch.gct == ~LJ_TPROTO)
+      bcwrite_proto(ctx, gco2pt(o));
+  }
+  if (ctx->status)
+    return;
+
+  /* Write the body after the room for the header. */
+  ctx->sb.n = 0;
+  bcwrite_done(ctx, bcwrite_more(ctx, BCWRITE_HEADROOM) + BCWRITE_HEADROOM);
+  bcwrite_bytecode(ctx, pt);
+  p = bcwrite_more(ctx, pt->sizeuv*2);
+  memcpy(p, proto_uv(pt), pt->sizeuv*2);
+  bcwrite_done(ctx, p + pt->sizeuv*2);
+  bcwrite_kgc(ctx, pt);
+  bcwrite_knum(ctx, pt);
+  ofsdbg = ctx->sb.n;
+  if (!ctx->strip)
+    bcwrite_debug(ctx, pt);
+
+  /* Write the header and prepend it together with the total length. */
+  p = head;
+  *p++ = (char)(pt->flags & (PROTO_IS_VARARG|PROTO_HAS_FNEW|
+			     PROTO_HAS_RETURN|PROTO_FIXUP_RETURN));
+  *p++ = (char)pt->numparams;
+  *p++ = (char)pt->framesize;
+  *p++ = (char)pt->sizeuv;
+  p = bcwrite_uleb128(p, pt->sizekgc);
+  p = bcwrite_uleb128(p, pt->sizekn);
+  p = bcwrite_uleb128(p, pt->sizebc);
+  p = bcwrite_uleb128(p, proto_line(pt, 0));
+  p = bcwrite_uleb128(p, pt->lastlinedefined);
+  if (!ctx->strip) {
+    p = bcwrite_uleb128(p, ctx->sb.n - ofsdbg);
+    p = bcwrite_uleb128(p, pt->sizevarinfo);
+  }
+  hlen = (MSize)(p - head);
+  len = hlen + ctx->sb.n - BCWRITE_HEADROOM;
+  p = bcwrite_uleb128(p, len);
+  i = (MSize)(p - head) - hlen;  /* Size of the length. */
+  p = ctx->sb.buf + BCWRITE_HEADROOM - hlen - i;
+  memcpy(p, head + hlen, i);
+  memcpy(p + i, head, hlen);
+
+  /* Pass the prototype to the writer. */
+  ctx->status = ctx->wfunc(ctx->L, p, len + i, ctx->wdata);
+}
+
+/* Write the header of a bytecode dump. */
+static void bcwrite_header(BCWriteCtx *ctx)
+{
+  GCstr *chunkname = proto_chunkname(ctx->pt);
+  char *p;
+  ctx->sb.n = 0;
+  p = bcwrite_more(ctx, 4+5+5+chunkname->len);
+  *p++ = BCDUMP_HEAD1;
+  *p++ = BCDUMP_HEAD2;
+  *p++ = BCDUMP_HEAD3;
+  *p++ = BCDUMP_VERSION;
+  p = bcwrite_uleb128(p, (ctx->strip ? BCDUMP_F_STRIP : 0) + BCDUMP_F_NATIVE);
+  if (!ctx->strip) {
+    p = bcwrite_uleb128(p, chunkname->len);
+    memcpy(p, strdata(chunkname), chunkname->len);
+    p += chunkname->len;
+  }
+  bcwrite_done(ctx, p);
+  ctx->status = ctx->wfunc(ctx->L, ctx->sb.buf, ctx->sb.n, ctx->wdata);
+}
+
+/* Write the footer of a bytecode dump. */
+static void bcwrite_footer(BCWriteCtx *ctx)
+{
+  if (ctx->status == 0) {
+    char zero = 0;
+    ctx->status = ctx->wfunc(ctx->L, &zero, 1, ctx->wdata);
+  }
+}
+
+/* Protected callback for bytecode writer. */
+static TValue *cpwriter(lua_State *L, lua_CFunction dummy, void *ud)
+{
+  BCWriteCtx *ctx = (BCWriteCtx *)ud;
+  UNUSED(dummy);
+  lj_str_resizebuf(L, &ctx->sb, 1024);  /* Avoids resize for most prototypes. */
+  bcwrite_header(ctx);
+  if (ctx->status == 0)
+    bcwrite_proto(ctx, ctx->pt);
+  bcwrite_footer(ctx);
+  return NULL;
+}
+
+/* Write bytecode for a prototype. */
+int lj_bcwrite(lua_State *L, GCproto *pt, lua_Writer writer, void *data,
+	       int strip)
+{
+  BCWriteCtx ctx;
+  int status;
+  ctx.L = L;
+  ctx.pt = pt;
+  ctx.wfunc = writer;
+  ctx.wdata = data;
+  ctx.strip = strip;
+  ctx.status = 0;
+  lj_str_initbuf(L, &ctx.sb);
+  lj_str_resetbuf(&ctx.sb);
+  status = lj_vm_cpcall(L, NULL, &ctx, cpwriter);
+  if (status == 0) status = ctx.status;
+  lj_str_freebuf(G(ctx.L), &ctx.sb);
+  return status;
+}
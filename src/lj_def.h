@@ -53,6 +53,10 @@ typedef unsigned __int32 uintptr_t;
 #define LJ_MAX_UPVAL	60		/* Max. # of upvalues. */
 
 #define LJ_MAX_IDXCHAIN	100		/* __index/__newindex chain limit. */
+#define LJ_MAX_PATCACHE	32		/* Max. # of compiled patterns (pow2). */
+#define LJ_MAX_PATLEN	256		/* Max. length of compiled patterns. */
+#define LJ_MAX_FMTITEM	512		/* Max. size of a formatted item. */
+#define LJ_MAX_FMTSPEC	32		/* Max. size of a format spec. */
 #define LJ_STACK_EXTRA	5		/* Extra stack space (metamethods). */
 
 /* Minimum table/buffer sizes. */
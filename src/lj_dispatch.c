@@ -18,6 +18,9 @@
 #include "lj_trace.h"
 #include "lj_dispatch.h"
 #include "lj_vm.h"
+#if LJ_HASPROFILE
+#include "lj_profile.h"
+#endif
 #include "luajit.h"
 
 /* Bump GG_NUM_ASMFF in lj_dispatch.h as needed. Ugly. */
@@ -74,7 +77,8 @@ void lj_dispatch_update(global_State *g)
   mode |= G2J(g)->state != LJ_TRACE_IDLE ?
 	    (DISPMODE_REC|DISPMODE_INS|DISPMODE_CALL) : 0;
 #endif
-  mode |= (g->hookmask & (LUA_MASKLINE|LUA_MASKCOUNT)) ? DISPMODE_INS : 0;
+  mode |= (g->hookmask & (LUA_MASKLINE|LUA_MASKCOUNT|HOOK_PROFILE)) ?
+	  DISPMODE_INS : 0;
   mode |= (g->hookmask & LUA_MASKCALL) ? DISPMODE_CALL : 0;
   mode |= (g->hookmask & LUA_MASKRET) ? DISPMODE_RET : 0;
   if (oldmode != mode) {  /* Mode changed? */
@@ -365,6 +369,17 @@ void LJ_FASTCALL lj_dispatch_ins(lua_State *L, const BCIns *pc)
       lj_trace_ins(J, pc-1);  /* The interpreter bytecode PC is offset by 1. */
     }
   }
+#endif
+#if LJ_HASPROFILE
+  /* Deliver profiler samples, but not while recording a trace. */
+  if ((g->hookmask & HOOK_PROFILE) && !hook_active(g)
+#if LJ_HASJIT
+      && G2J(g)->state == LJ_TRACE_IDLE
+#endif
+      ) {
+    lj_profile_interpreter(L);
+    L->top = L->base + slots;  /* Fix top again. */
+  }
 #endif
   if ((g->hookmask & LUA_MASKCOUNT) && g->hookcount == 0) {
     g->hookcount = g->hookcstart;
@@ -183,27 +183,19 @@ restart:
   return NULL;
 }
 
-static const char *getfuncname(lua_State *L, TValue *frame, const char **name)
+/* Name of the function called by the instruction at pc of a prototype. */
+const char *lj_err_callname(lua_State *L, GCproto *pt, BCPos pc,
+			    const char **name)
 {
   MMS mm;
   const BCIns *ip;
-  TValue *pframe;
-  GCfunc *fn;
-  BCPos pc;
-  if (frame_isvarg(frame))
-    frame = frame_prevd(frame);
-  pframe = frame_prev(frame);
-  fn = frame_func(pframe);
-  pc = currentpc(L, fn, frame);
-  if (pc == ~(BCPos)0)
-    return NULL;
-  lua_assert(pc < funcproto(fn)->sizebc);
-  ip = &proto_bc(funcproto(fn))[pc];
+  lua_assert(pc < pt->sizebc);
+  ip = &proto_bc(pt)[pc];
   mm = bcmode_mm(bc_op(*ip));
   if (mm == MM_call) {
     BCReg slot = bc_a(*ip);
     if (bc_op(*ip) == BC_ITERC) slot -= 3;
-    return getobjname(funcproto(fn), ip, slot, name);
+    return getobjname(pt, ip, slot, name);
   } else if (mm != MM_MAX) {
     *name = strdata(mmname_str(G(L), mm));
     return "metamethod";
@@ -212,6 +204,21 @@ static const char *getfuncname(lua_State *L, TValue *frame, const char **name)
   }
 }
 
+static const char *getfuncname(lua_State *L, TValue *frame, const char **name)
+{
+  TValue *pframe;
+  GCfunc *fn;
+  BCPos pc;
+  if (frame_isvarg(frame))
+    frame = frame_prevd(frame);
+  pframe = frame_prev(frame);
+  fn = frame_func(pframe);
+  pc = currentpc(L, fn, frame);
+  if (pc == ~(BCPos)0)
+    return NULL;
+  return lj_err_callname(L, funcproto(fn), pc, name);
+}
+
 void lj_err_pushloc(lua_State *L, GCproto *pt, BCPos pc)
 {
   GCstr *name = proto_chunkname(pt);
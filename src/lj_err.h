@@ -36,6 +36,8 @@ LJ_FUNC_NORET void lj_err_argtype(lua_State *L, int narg, const char *xname);
 LJ_FUNC_NORET void lj_err_argt(lua_State *L, int narg, int tt);
 
 LJ_FUNC void lj_err_pushloc(lua_State *L, GCproto *pt, BCPos pc);
+LJ_FUNC const char *lj_err_callname(lua_State *L, GCproto *pt, BCPos pc,
+				    const char **name);
 LJ_FUNC cTValue *lj_err_getframe(lua_State *L, int level, int *size);
 
 #endif
@@ -19,7 +19,7 @@
 
 void LJ_FASTCALL lj_func_freeproto(global_State *g, GCproto *pt)
 {
-  lj_mem_free(g, pt, pt->sizept);
+  lj_mem_freegco(g, pt, pt->sizept);
 }
 
 /* -- Upvalues ------------------------------------------------------------ */
@@ -49,7 +49,7 @@ static GCupval *func_finduv(lua_State *L, TValue *slot)
     pp = &p->nextgc;
   }
   /* No matching upvalue found. Create a new one. */
-  uv = lj_mem_newt(L, sizeof(GCupval), GCupval);
+  uv = lj_mem_newgcot(L, sizeof(GCupval), GCupval);
   newwhite(g, uv);
   uv->gct = ~LJ_TUPVAL;
   uv->closed = 0;  /* Still open. */
@@ -88,7 +88,7 @@ void LJ_FASTCALL lj_func_freeuv(global_State *g, GCupval *uv)
 {
   if (!uv->closed)
     unlinkuv(uv);
-  lj_mem_freet(g, uv);
+  lj_mem_freegcot(g, uv);
 }
 
 /* -- Functions (closures) ------------------------------------------------ */
@@ -117,19 +117,14 @@ GCfunc *lj_func_newL(lua_State *L, GCproto *pt, GCtab *env)
   return fn;
 }
 
-/* Do a GC check and create a new Lua function with inherited upvalues. */
-GCfunc *lj_func_newL_gc(lua_State *L, GCproto *pt, GCfuncL *parent)
+/* Create a new Lua function with inherited upvalues. */
+GCfunc *lj_func_newL_uv(lua_State *L, GCproto *pt, GCfuncL *parent,
+			TValue *base)
 {
-  GCfunc *fn;
-  GCRef *puv;
-  uint32_t i, nuv;
-  TValue *base;
-  lj_gc_check_fixtop(L);
-  fn = lj_func_newL(L, pt, tabref(parent->env));
+  GCfunc *fn = lj_func_newL(L, pt, tabref(parent->env));
+  GCRef *puv = parent->uvptr;
+  uint32_t i, nuv = fn->l.nupvalues;
   /* NOBARRIER: The GCfunc is new (marked white). */
-  puv = parent->uvptr;
-  nuv = fn->l.nupvalues;
-  base = L->base;
   for (i = 0; i < nuv; i++) {
     uint32_t v = proto_uv(pt)[i];
     GCupval *uv;
@@ -144,10 +139,17 @@ GCfunc *lj_func_newL_gc(lua_State *L, GCproto *pt, GCfuncL *parent)
   return fn;
 }
 
+/* Do a GC check and create a new Lua function with inherited upvalues. */
+GCfunc *lj_func_newL_gc(lua_State *L, GCproto *pt, GCfuncL *parent)
+{
+  lj_gc_check_fixtop(L);
+  return lj_func_newL_uv(L, pt, parent, L->base);
+}
+
 void LJ_FASTCALL lj_func_free(global_State *g, GCfunc *fn)
 {
   MSize size = isluafunc(fn) ? sizeLfunc((MSize)fn->l.nupvalues) :
 			       sizeCfunc((MSize)fn->c.nupvalues);
-  lj_mem_free(g, fn, size);
+  lj_mem_freegco(g, fn, size);
 }
 
@@ -21,18 +21,34 @@
 #include "lj_frame.h"
 #include "lj_trace.h"
 #include "lj_vm.h"
+#include "lj_slab.h"
+
+#if LJ_TARGET_WINDOWS
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#elif LJ_TARGET_LINUX
+#include <time.h>
+#else
+#include <sys/time.h>
+#endif
 
 #define GCSTEPSIZE	1024u
 #define GCSWEEPMAX	40
 #define GCSWEEPCOST	10
 #define GCFINALIZECOST	100
+#define GCTRAVMAX	256
+#define GCPACECHECK	1024
+#define GCTRIMMAX	4
+#define GCTRIMCOST	100
+#define GCSWEEPSTR	16
 
 /* Macros to set GCobj colors and flags. */
 #define white2gray(x)		((x)->gch.marked &= cast_byte(~LJ_GC_WHITES))
 #define black2gray(x)		((x)->gch.marked &= cast_byte(~LJ_GC_BLACK))
 #define gray2black(x)		((x)->gch.marked |= LJ_GC_BLACK)
 #define makewhite(g, x) \
-  ((x)->gch.marked = ((x)->gch.marked & cast_byte(~LJ_GC_COLORS)) | curwhite(g))
+  ((x)->gch.marked = ((x)->gch.marked & cast_byte(~(LJ_GC_COLORS|LJ_GC_OLD))) | \
+		     curwhite(g))
 #define isfinalized(u)		((u)->marked & LJ_GC_FINALIZED)
 #define markfinalized(u)	((u)->marked |= LJ_GC_FINALIZED)
 
@@ -85,13 +101,27 @@ static void gc_mark_gcroot(global_State *g)
 /* Start a GC cycle and mark the root set. */
 static void gc_mark_start(global_State *g)
 {
-  setgcrefnull(g->gc.gray);
-  setgcrefnull(g->gc.grayagain);
-  setgcrefnull(g->gc.weak);
+  if (g->gc.sticky) {  /* Minor collection. Old objects are still black. */
+    GCobj *o = gcref(g->gc.weak);
+    /* Keep the objects queued by the barriers. Re-traverse weak tables. */
+    setgcrefnull(g->gc.weak);
+    while (o) {
+      GCobj *next = gcref(gco2tab(o)->gclist);
+      setgcrefr(gco2tab(o)->gclist, g->gc.gray);
+      setgcref(g->gc.gray, o);
+      o = next;
+    }
+  } else {  /* All objects are white, so this cycle marks everything. */
+    setgcrefnull(g->gc.gray);
+    setgcrefnull(g->gc.grayagain);
+    setgcrefnull(g->gc.weak);
+    g->gc.genmajor = 0;
+  }
   gc_markobj(g, mainthread(g));
   gc_markobj(g, tabref(mainthread(g)->env));
   gc_marktv(g, &g->registrytv);
   gc_mark_gcroot(g);
+  g->gc.pacebase = g->gc.total;
   g->gc.state = GCSpropagate;
 }
 
@@ -127,6 +157,8 @@ size_t lj_gc_separateudata(global_State *g, int all)
   GCRef *p = &mainthread(g)->nextgc;
   GCobj *o;
   while ((o = gcref(*p)) != NULL) {
+    if ((o->gch.marked & LJ_GC_OLD) && !all)
+      break;  /* Only old userdata follow, none of them white. */
     if (!(iswhite(o) || all) || isfinalized(gco2ud(o))) {
       p = &o->gch.nextgc;  /* Nothing to do. */
     } else if (!lj_meta_fastg(g, tabref(gco2ud(o)->metatable), MM_gc)) {
@@ -176,6 +208,12 @@ static int gc_traverse_tab(global_State *g, GCtab *t)
   }
   if (weak == LJ_GC_WEAK)  /* Nothing to mark if both keys/values are weak. */
     return 1;
+  if (!weak && t->asize + t->hmask >= GCTRAVMAX &&
+      g->gc.state == GCSpropagate) {  /* Traverse big tables in chunks. */
+    setgcref(g->gc.travtab, obj2gco(t));
+    g->gc.travpos = 0;
+    return 0;
+  }
   if (!(weak & LJ_GC_WEAKVAL)) {  /* Mark array part. */
     MSize i, asize = t->asize;
     for (i = 0; i < asize; i++)
@@ -196,6 +234,44 @@ static int gc_traverse_tab(global_State *g, GCtab *t)
   return weak;
 }
 
+/* Traverse the next chunk of a big table.
+**
+** The table is already black, so the write barrier catches any store to
+** the part that has been traversed. A resize triggers the barrier, too.
+** Then the table is gray, the cursor is dropped and the table is traversed
+** again in the atomic phase.
+*/
+static size_t gc_traverse_tabpart(global_State *g)
+{
+  GCtab *t = gco2tab(gcref(g->gc.travtab));
+  Node *node = noderef(t->node);
+  MSize i = g->gc.travpos, asize = t->asize, n = asize + t->hmask + 1, lim;
+  size_t m;
+  if (!isblack(obj2gco(t))) {  /* Hit by the write barrier? */
+    setgcrefnull(g->gc.travtab);  /* It's on the grayagain list now. */
+    return 0;
+  }
+  lua_assert(i < n);
+  lim = n - i > GCTRAVMAX ? i + GCTRAVMAX : n;
+  m = (lim - i) * sizeof(TValue);
+  for (; i < lim && i < asize; i++)  /* Mark array part. */
+    gc_marktv(g, arrayslot(t, i));
+  for (; i < lim; i++) {  /* Mark hash part. */
+    Node *nd = &node[i - asize];
+    if (!tvisnil(&nd->val)) {  /* Mark non-empty slot. */
+      lua_assert(!tvisnil(&nd->key));
+      gc_marktv(g, &nd->key);
+      gc_marktv(g, &nd->val);
+      m += sizeof(Node) - sizeof(TValue);
+    }
+  }
+  if (i == n)
+    setgcrefnull(g->gc.travtab);  /* Done. */
+  else
+    g->gc.travpos = i;
+  return m;
+}
+
 /* Traverse a function. */
 static void gc_traverse_func(global_State *g, GCfunc *fn)
 {
@@ -307,6 +383,8 @@ static size_t propagatemark(global_State *g)
     GCtab *t = gco2tab(o);
     if (gc_traverse_tab(g, t))
       black2gray(o);  /* Keep weak tables gray. */
+    else if (gcref(g->gc.travtab) == o)
+      return sizeof(GCtab);  /* Slots are traversed in the next steps. */
     return sizeof(GCtab) + sizeof(TValue) * t->asize +
 			   sizeof(Node) * (t->hmask + 1);
   } else if (LJ_LIKELY(o->gch.gct == ~LJ_TFUNC)) {
@@ -356,6 +434,9 @@ static void gc_shrink(global_State *g, lua_State *L)
     lj_str_resize(L, g->strmask >> 1);  /* Shrink string table. */
   if (g->tmpbuf.sz > LJ_MIN_SBUF*2)
     lj_str_resizebuf(L, &g->tmpbuf, g->tmpbuf.sz >> 1);  /* Shrink temp buf. */
+#if LJ_HASSLAB
+  lj_slab_trim(g, GCTRIMMAX);  /* Return arenas with only empty pages. */
+#endif
 }
 
 /* Type of GC free functions. */
@@ -380,18 +461,31 @@ static const GCFreeFunc gc_freefunc[] = {
 /* Full sweep of a GC list. */
 #define gc_fullsweep(g, p)	gc_sweep(g, (p), LJ_MAX_MEM)
 
-/* Partial sweep of a GC list. */
+/* Partial sweep of a GC list.
+**
+** With sticky marks, survivors stay black and are flagged as old. New
+** objects are always added in front, so the sweep stops at the first old
+** object. Open upvalues are never flagged, since their list is not in
+** allocation order.
+*/
 static GCRef *gc_sweep(global_State *g, GCRef *p, uint32_t lim)
 {
   /* Mask with other white and LJ_GC_FIXED. Or LJ_GC_SFIXED on shutdown. */
   int ow = otherwhite(g);
+  int stop = g->gc.sticky ? LJ_GC_OLD : 0;
   GCobj *o;
   while ((o = gcref(*p)) != NULL && lim-- > 0) {
+    if ((o->gch.marked & stop))
+      break;  /* Only old objects follow. */
     if (o->gch.gct == ~LJ_TTHREAD)  /* Need to sweep open upvalues, too. */
       gc_fullsweep(g, &gco2th(o)->openupval);
     if (((o->gch.marked ^ LJ_GC_WHITES) & ow)) {  /* Black or current white? */
       lua_assert(!isdead(g, o) || (o->gch.marked & LJ_GC_FIXED));
-      makewhite(g, o);  /* Value is alive, change to the current white. */
+      if (!stop)
+	makewhite(g, o);  /* Value is alive, change to the current white. */
+      else if ((!iswhite(o) || (o->gch.marked & LJ_GC_FIXED)) &&
+	       o->gch.gct != ~LJ_TUPVAL)
+	o->gch.marked |= LJ_GC_OLD;  /* Value is alive and keeps its mark. */
       p = &o->gch.nextgc;
     } else {  /* Otherwise value is dead, free it. */
       lua_assert(isdead(g, o) || ow == LJ_GC_SFIXED);
@@ -404,6 +498,20 @@ static GCRef *gc_sweep(global_State *g, GCRef *p, uint32_t lim)
   return p;
 }
 
+/* Find the next string hash chain that may hold young strings. */
+static MSize gc_nextdirty(global_State *g, MSize i)
+{
+  MSize w = i >> 5, nw = lj_str_dirtysz(g->strmask);
+  uint32_t m;
+  if (w >= nw) return i;
+  m = g->strdirty[w] & (~0u << (i & 31));
+  while (m == 0) {
+    if (++w >= nw) return g->strmask+1;
+    m = g->strdirty[w];
+  }
+  return (w << 5) + lj_ffs(m);
+}
+
 /* Check whether we can clear a key or a value slot from a table. */
 static int gc_mayclear(cTValue *o, int val)
 {
@@ -503,7 +611,10 @@ void lj_gc_freeall(global_State *g)
   MSize i, strmask;
   /* Free everything, except super-fixed objects (the main thread). */
   g->gc.currentwhite = LJ_GC_WHITES | LJ_GC_SFIXED;
+  g->gc.sticky = 0;
   gc_fullsweep(g, &g->gc.root);
+  if (g->stroldhash)
+    lj_str_migrate(g, ~(MSize)0);
   strmask = g->strmask;
   for (i = 0; i <= strmask; i++)  /* Free all string hash chains. */
     gc_fullsweep(g, &g->strhash[i]);
@@ -537,14 +648,32 @@ static void atomic(global_State *g, lua_State *L)
 
   /* All marking done, clear weak tables. */
   gc_clearweak(gcref(g->gc.weak));
+  g->gc.pacegrow = g->gc.total > g->gc.pacebase ?
+		   g->gc.total - g->gc.pacebase : 0;
 
-  /* Prepare for sweep phase. */
+  /* Prepare for sweep phase. Generational mode keeps the marks, unless the
+  ** heap has grown enough since the last major collection. Then the sweep
+  ** makes everything white and the next cycle is a major collection.
+  */
+  g->gc.sticky = (g->gc.kind == GCKgenerational &&
+		  (g->gc.genmajor == 0 || g->gc.estimate < g->gc.genmajor));
   g->gc.currentwhite = cast_byte(otherwhite(g));  /* Flip current white. */
   g->strempty.marked = g->gc.currentwhite;
   setmref(g->gc.sweep, &g->gc.root);
   g->gc.estimate = g->gc.total - (MSize)udsize;  /* Initial estimate. */
 }
 
+/* End of sweep phase. */
+static void gc_endsweep(global_State *g)
+{
+  if (gcref(g->gc.mmudata)) {  /* Need any finalizations? */
+    g->gc.state = GCSfinalize;
+  } else {  /* Otherwise skip this phase to help the JIT. */
+    g->gc.state = GCSpause;  /* End of GC cycle. */
+    g->gc.debt = 0;
+  }
+}
+
 /* GC state machine. Returns a cost estimate for each step performed. */
 static size_t gc_onestep(lua_State *L)
 {
@@ -554,6 +683,10 @@ static size_t gc_onestep(lua_State *L)
     gc_mark_start(g);  /* Start a new GC cycle by marking all GC roots. */
     return 0;
   case GCSpropagate:
+    if (g->stroldhash != NULL)  /* Continue string table resize. */
+      return lj_str_migrate(g, GCSWEEPSTR)*GCSWEEPCOST;
+    if (gcref(g->gc.travtab) != NULL)
+      return gc_traverse_tabpart(g);  /* Continue with a big table. */
     if (gcref(g->gc.gray) != NULL)
       return propagatemark(g);  /* Propagate one gray object. */
     g->gc.state = GCSatomic;  /* End of mark phase. */
@@ -567,7 +700,21 @@ static size_t gc_onestep(lua_State *L)
     return 0;
   case GCSsweepstring: {
     MSize old = g->gc.total;
-    gc_fullsweep(g, &g->strhash[g->gc.sweepstr++]);  /* Sweep one chain. */
+    MSize i = g->gc.sweepstr;
+    if (g->stroldhash != NULL)  /* Must finish string table resize first. */
+      return lj_str_migrate(g, GCSWEEPSTR)*GCSWEEPCOST;
+    if (g->gc.sticky)  /* Skip chains with only old strings. */
+      i = gc_nextdirty(g, i);
+    if (i <= g->strmask) {
+      GCobj *o;
+      gc_fullsweep(g, &g->strhash[i]);  /* Sweep one chain. */
+      o = gcref(g->strhash[i]);
+      if (o && !(o->gch.marked & LJ_GC_OLD))  /* Young strings are in front. */
+	lj_str_setdirty(g, i);
+      else
+	lj_str_cleardirty(g, i);
+    }
+    g->gc.sweepstr = i+1;
     if (g->gc.sweepstr > g->strmask)
       g->gc.state = GCSsweep;  /* All string hash chains sweeped. */
     lua_assert(old >= g->gc.total);
@@ -576,18 +723,35 @@ static size_t gc_onestep(lua_State *L)
     }
   case GCSsweep: {
     MSize old = g->gc.total;
-    setmref(g->gc.sweep, gc_sweep(g, mref(g->gc.sweep, GCRef), GCSWEEPMAX));
-    if (gcref(*mref(g->gc.sweep, GCRef)) == NULL) {
-      gc_shrink(g, L);
-      if (gcref(g->gc.mmudata)) {  /* Need any finalizations? */
-	g->gc.state = GCSfinalize;
-      } else {  /* Otherwise skip this phase to help the JIT. */
-	g->gc.state = GCSpause;  /* End of GC cycle. */
-	g->gc.debt = 0;
-      }
+    GCRef *p;
+    GCobj *o;
+#if LJ_HASSLAB
+    if (g->slab.trim) {  /* Continue returning empty arenas. */
+      if (!lj_slab_trim(g, GCTRIMMAX))
+	gc_endsweep(g);
+      return GCTRIMMAX*GCTRIMCOST;
     }
+#endif
+    p = gc_sweep(g, mref(g->gc.sweep, GCRef), GCSWEEPMAX);
+    o = gcref(*p);
+    setmref(g->gc.sweep, p);
     lua_assert(old >= g->gc.total);
     g->gc.estimate -= old - g->gc.total;
+    if (o && g->gc.sticky && (o->gch.marked & LJ_GC_OLD) &&
+	o->gch.gct != ~LJ_TUDATA) {
+      /* Old objects reached. Continue with new userdata after main thread. */
+      setmref(g->gc.sweep, &mainthread(g)->nextgc);
+    } else if (o == NULL || (g->gc.sticky && (o->gch.marked & LJ_GC_OLD))) {
+      old = g->gc.total;
+      gc_shrink(g, L);
+      /* A string table resize keeps the old table for a while. */
+      g->gc.estimate += g->gc.total - old;
+#if LJ_HASSLAB
+      if (g->slab.trim)  /* More arenas to return in the next steps. */
+	return GCSWEEPMAX*GCSWEEPCOST + GCTRIMMAX*GCTRIMCOST;
+#endif
+      gc_endsweep(g);
+    }
     return GCSWEEPMAX*GCSWEEPCOST;
     }
   case GCSfinalize:
@@ -608,36 +772,153 @@ static size_t gc_onestep(lua_State *L)
   }
 }
 
-/* Perform a limited amount of incremental GC steps. */
-int LJ_FASTCALL lj_gc_step(lua_State *L)
+/* -- Pacing ------------------------------------------------------------- */
+
+/* With a target step time the work per step is adapted to the measured
+** speed of the collector. The allocations between steps follow from the
+** work per step and the step multiplier. The multiplier is raised, if
+** needed, so a cycle finishes within half of the allowed heap overhead
+** (the pause). The next cycle starts early enough to leave room for the
+** growth during the mark phase of the last cycle.
+*/
+
+/* Monotonic clock in ns. */
+static uint64_t gc_clock(void)
+{
+#if LJ_TARGET_WINDOWS
+  static LARGE_INTEGER freq;
+  LARGE_INTEGER cnt;
+  if (freq.QuadPart == 0)
+    QueryPerformanceFrequency(&freq);
+  QueryPerformanceCounter(&cnt);
+  return (uint64_t)((double)cnt.QuadPart * 1e9 / (double)freq.QuadPart);
+#elif LJ_TARGET_LINUX
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+#else
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  return (uint64_t)tv.tv_sec * 1000000000u + (uint64_t)tv.tv_usec * 1000u;
+#endif
+}
+
+/* Allocations between paced steps. */
+static MSize gc_pacestep(global_State *g)
+{
+  MSize mul = g->gc.stepmul, over = g->gc.pause > 100 ? g->gc.pause-100 : 1;
+  if (mul < 20000/over) mul = 20000/over;
+  return (MSize)(((uint64_t)g->gc.pacework * 100) / mul);
+}
+
+/* Update the step time counters. With pacing, adapt the work per step. */
+static void gc_pace(global_State *g, uint64_t start, int32_t work)
+{
+  uint64_t t = gc_clock() - start, target = (uint64_t)g->gc.pacetime * 1000;
+  g->gc.stepnum++;
+  g->gc.steptime += t;
+  if (t > g->gc.stepmax)
+    g->gc.stepmax = t < LJ_MAX_MEM ? (MSize)t : LJ_MAX_MEM;
+  if (!target) return;
+  if (t > target) g->gc.stepover++;
+  if (work > 0 && t > 0) {  /* Aim for 7/8 of the target, smoothed. */
+    uint64_t w = ((uint64_t)work * target * 7) / (t * 8);
+    w = ((uint64_t)g->gc.pacework * 3 + w) / 4;
+    if (w < GCSTEPSIZE/4) w = GCSTEPSIZE/4;
+    else if (w > LJ_MAX_MEM/2) w = LJ_MAX_MEM/2;
+    g->gc.pacework = (MSize)w;
+  }
+}
+
+/* Set the target step time in us (0 = off). Returns the previous one. */
+MSize lj_gc_setpace(global_State *g, MSize us)
+{
+  MSize old = g->gc.pacetime;
+  if (us && !old)  /* Start with the regular amount of work per step. */
+    g->gc.pacework = (GCSTEPSIZE/100) * (g->gc.stepmul ? g->gc.stepmul : 100);
+  g->gc.pacetime = us;
+  return old;
+}
+
+/* -- Collector ----------------------------------------------------------- */
+
+/* Set the threshold for the next GC cycle. */
+static void gc_setthreshold(global_State *g)
+{
+  MSize est = g->gc.estimate;
+  if (g->gc.kind != GCKgenerational) {
+    MSize th = (est/100) * g->gc.pause;
+    if (g->gc.pacetime) {  /* Leave room for the growth during marking. */
+      MSize lo = est + gc_pacestep(g);
+      th = th > lo + g->gc.pacegrow ? th - g->gc.pacegrow : lo;
+    }
+    g->gc.threshold = th;
+  } else if (g->gc.sticky) {  /* Next cycle is a minor collection. */
+    MSize young = (est/100) * g->gc.genminor;
+    if (g->gc.genmajor == 0)  /* Just finished a major collection? */
+      g->gc.genmajor = (est/100) * g->gc.pause;
+    g->gc.threshold = est + (young > GCSTEPSIZE ? young : GCSTEPSIZE);
+  } else {  /* All objects are white now. Start the major collection. */
+    g->gc.threshold = g->gc.total;
+  }
+}
+
+/* Perform GC steps until the work limit is reached or the cycle ends. */
+static int gc_step(lua_State *L, MSize lim, MSize stepsize, uint64_t deadline,
+		   int32_t *work)
 {
   global_State *g = G(L);
-  MSize lim;
-  int32_t ostate = g->vmstate;
-  setvmstate(g, GC);
-  lim = (GCSTEPSIZE/100) * g->gc.stepmul;
-  if (lim == 0)
-    lim = LJ_MAX_MEM;
+  MSize n = 0;
   g->gc.debt += g->gc.total - g->gc.threshold;
   do {
-    lim -= (MSize)gc_onestep(L);
+    size_t cost;
+    if (g->gc.state == GCSatomic)
+      *work = -1;  /* The atomic phase is not limited. Don't adapt to it. */
+    cost = gc_onestep(L);
+    lim -= (MSize)cost;
+    if (*work >= 0)
+      *work = cost < LJ_MAX_MEM - (MSize)*work ? *work + (int32_t)cost : -1;
     if (g->gc.state == GCSpause) {
       lua_assert(g->gc.total >= g->gc.estimate);
-      g->gc.threshold = (g->gc.estimate/100) * g->gc.pause;
-      g->vmstate = ostate;
+      gc_setthreshold(g);
       return 1;  /* Finished a GC cycle. */
     }
+    if (deadline && (n += (MSize)cost) >= GCPACECHECK) {
+      n = 0;
+      if (gc_clock() >= deadline)
+	break;  /* Out of time, even if the cost estimates say otherwise. */
+    }
   } while ((int32_t)lim > 0);
-  if (g->gc.debt < GCSTEPSIZE) {
-    g->gc.threshold = g->gc.total + GCSTEPSIZE;
+  if (g->gc.debt < stepsize) {
+    g->gc.threshold = g->gc.total + stepsize;
   } else {
-    g->gc.debt -= GCSTEPSIZE;
+    g->gc.debt -= stepsize;
     g->gc.threshold = g->gc.total;
   }
-  g->vmstate = ostate;
   return 0;
 }
 
+/* Perform a limited amount of incremental GC steps. */
+int LJ_FASTCALL lj_gc_step(lua_State *L)
+{
+  global_State *g = G(L);
+  int32_t ostate = g->vmstate;
+  int32_t work = 0;
+  uint64_t start = gc_clock();
+  int res;
+  setvmstate(g, GC);
+  if (g->gc.pacetime) {  /* Limit the work by the target step time. */
+    uint64_t deadline = start + (uint64_t)g->gc.pacetime * 875;
+    res = gc_step(L, g->gc.pacework, gc_pacestep(g), deadline, &work);
+  } else {
+    MSize lim = (GCSTEPSIZE/100) * g->gc.stepmul;
+    res = gc_step(L, lim ? lim : LJ_MAX_MEM, GCSTEPSIZE, 0, &work);
+  }
+  gc_pace(g, start, work);
+  g->vmstate = ostate;
+  return res;
+}
+
 /* Ditto, but fix the stack top first. */
 void LJ_FASTCALL lj_gc_step_fixtop(lua_State *L)
 {
@@ -652,6 +933,8 @@ int LJ_FASTCALL lj_gc_step_jit(global_State *g, MSize steps)
   lua_State *L = gco2th(gcref(g->jit_L));
   L->base = mref(G(L)->jit_base, TValue);
   L->top = curr_topL(L);
+  if (g->gc.pacetime)
+    steps = 1;  /* Keep the time limit. The debt triggers the next steps. */
   while (steps-- > 0 && lj_gc_step(L) == 0)
     ;
   /* Return 1 to force a trace exit. */
@@ -665,13 +948,19 @@ void lj_gc_fullgc(lua_State *L)
   global_State *g = G(L);
   int32_t ostate = g->vmstate;
   setvmstate(g, GC);
-  if (g->gc.state <= GCSatomic) {  /* Caught somewhere in the middle. */
+  /* Caught somewhere in the middle or old objects are still black? */
+  if (g->gc.state <= GCSatomic || g->gc.sticky) {
     setmref(g->gc.sweep, &g->gc.root);  /* Sweep everything (preserving it). */
     setgcrefnull(g->gc.gray);  /* Reset lists from partial propagation. */
     setgcrefnull(g->gc.grayagain);
     setgcrefnull(g->gc.weak);
+    setgcrefnull(g->gc.travtab);
     g->gc.state = GCSsweepstring;  /* Fast forward to the sweep phase. */
     g->gc.sweepstr = 0;
+    g->gc.sticky = 0;  /* Make all objects white. */
+#if LJ_HASSLAB
+    g->slab.trim = NULL;  /* The restarted sweep trims again. */
+#endif
   }
   while (g->gc.state == GCSsweepstring || g->gc.state == GCSsweep)
     gc_onestep(L);  /* Finish sweep. */
@@ -679,18 +968,36 @@ void lj_gc_fullgc(lua_State *L)
   /* Now perform a full GC. */
   g->gc.state = GCSpause;
   do { gc_onestep(L); } while (g->gc.state != GCSpause);
-  g->gc.threshold = (g->gc.estimate/100) * g->gc.pause;
+  gc_setthreshold(g);
   g->vmstate = ostate;
 }
 
+/* Switch between incremental and generational mode. Returns old kind. */
+int lj_gc_setkind(lua_State *L, int kind)
+{
+  global_State *g = G(L);
+  int okind = g->gc.kind;
+  if (kind != okind) {
+    g->gc.kind = (uint8_t)kind;
+    lj_gc_fullgc(L);  /* Start over with a full collection. */
+  }
+  return okind;
+}
+
 /* -- Write barriers ------------------------------------------------------ */
 
+/* Black objects must not point to white objects? */
+#define gc_keepinvariant(g) \
+  ((g)->gc.state == GCSpropagate || (g)->gc.state == GCSatomic || \
+   (g)->gc.sticky)
+
 /* Move the GC propagation frontier back for tables (make it gray again). */
 void lj_gc_barrierback(global_State *g, GCtab *t)
 {
   GCobj *o = obj2gco(t);
   lua_assert(isblack(o) && !isdead(g, o));
-  lua_assert(g->gc.state != GCSfinalize && g->gc.state != GCSpause);
+  lua_assert(g->gc.sticky ||
+	     (g->gc.state != GCSfinalize && g->gc.state != GCSpause));
   black2gray(o);
   setgcrefr(t->gclist, g->gc.grayagain);
   setgcref(g->gc.grayagain, o);
@@ -700,10 +1007,13 @@ void lj_gc_barrierback(global_State *g, GCtab *t)
 void lj_gc_barrierf(global_State *g, GCobj *o, GCobj *v)
 {
   lua_assert(isblack(o) && iswhite(v) && !isdead(g, v) && !isdead(g, o));
-  lua_assert(g->gc.state != GCSfinalize && g->gc.state != GCSpause);
+  lua_assert(g->gc.sticky ||
+	     (g->gc.state != GCSfinalize && g->gc.state != GCSpause));
   lua_assert(o->gch.gct != ~LJ_TTAB);
-  /* Preserve invariant during propagation. Otherwise it doesn't matter. */
-  if (g->gc.state == GCSpropagate || g->gc.state == GCSatomic)
+  /* Preserve invariant during propagation or while old objects stay black.
+  ** Otherwise it doesn't matter.
+  */
+  if (gc_keepinvariant(g))
     gc_mark(g, v);  /* Move frontier forward. */
   else
     makewhite(g, o);  /* Make it white to avoid the following barrier. */
@@ -714,10 +1024,11 @@ void LJ_FASTCALL lj_gc_barrieruv(global_State *g, TValue *tv)
 {
 #define TV2MARKED(x) \
   (*((uint8_t *)(x) - offsetof(GCupval, tv) + offsetof(GCupval, marked)))
-  if (g->gc.state == GCSpropagate || g->gc.state == GCSatomic)
+  if (gc_keepinvariant(g))
     gc_mark(g, gcV(tv));
   else
-    TV2MARKED(tv) = (TV2MARKED(tv) & cast_byte(~LJ_GC_COLORS)) | curwhite(g);
+    TV2MARKED(tv) = (TV2MARKED(tv) & cast_byte(~(LJ_GC_COLORS|LJ_GC_OLD))) |
+		    curwhite(g);
 #undef TV2MARKED
 }
 
@@ -732,7 +1043,7 @@ void lj_gc_closeuv(global_State *g, GCupval *uv)
   setgcrefr(o->gch.nextgc, g->gc.root);
   setgcref(g->gc.root, o);
   if (isgray(o)) {  /* A closed upvalue is never gray, so fix this. */
-    if (g->gc.state == GCSpropagate || g->gc.state == GCSatomic) {
+    if (gc_keepinvariant(g)) {
       gray2black(o);  /* Make it black and preserve invariant. */
       if (tviswhite(&uv->tv))
 	lj_gc_barrierf(g, o, gcV(&uv->tv));
@@ -747,7 +1058,7 @@ void lj_gc_closeuv(global_State *g, GCupval *uv)
 /* Mark a trace if it's saved during the propagation phase. */
 void lj_gc_barriertrace(global_State *g, uint32_t traceno)
 {
-  if (g->gc.state == GCSpropagate || g->gc.state == GCSatomic)
+  if (gc_keepinvariant(g))
     gc_marktrace(g, traceno);
 }
 #endif
@@ -768,15 +1079,42 @@ void *lj_mem_realloc(lua_State *L, void *p, MSize osz, MSize nsz)
   return p;
 }
 
-/* Allocate new GC object and link it to the root set. */
-void *lj_mem_newgco(lua_State *L, MSize size)
+/* Allocate memory for a GC object. Small objects come from the slab. */
+void *lj_mem_allocgco(lua_State *L, MSize size)
 {
   global_State *g = G(L);
-  GCobj *o = (GCobj *)g->allocf(g->allocd, NULL, 0, size);
-  if (o == NULL)
+  void *p;
+#if LJ_HASSLAB
+  if (size <= LJ_SLAB_MAXSIZE)
+    p = lj_slab_alloc(g, size);
+  else
+#endif
+    p = g->allocf(g->allocd, NULL, 0, size);
+  if (p == NULL)
     lj_err_mem(L);
-  lua_assert(checkptr32(o));
+  lua_assert(checkptr32(p));
   g->gc.total += size;
+  return p;
+}
+
+/* Free a GC object allocated with lj_mem_allocgco or lj_mem_newgco. */
+void lj_mem_freegco(global_State *g, void *p, MSize osize)
+{
+  g->gc.total -= osize;
+#if LJ_HASSLAB
+  if (osize <= LJ_SLAB_MAXSIZE) {
+    lj_slab_free(g, p, osize);
+    return;
+  }
+#endif
+  g->allocf(g->allocd, p, osize, 0);
+}
+
+/* Allocate new GC object and link it to the root set. */
+void *lj_mem_newgco(lua_State *L, MSize size)
+{
+  global_State *g = G(L);
+  GCobj *o = (GCobj *)lj_mem_allocgco(L, size);
   setgcrefr(o->gch.nextgc, g->gc.root);
   setgcref(g->gc.root, o);
   newwhite(g, o);
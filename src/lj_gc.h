@@ -13,6 +13,11 @@ enum {
   GCSpause, GCSpropagate, GCSatomic, GCSsweepstring, GCSsweep, GCSfinalize
 };
 
+/* Garbage collector kinds. */
+enum {
+  GCKincremental, GCKgenerational
+};
+
 /* Bitmasks for marked field of GCobj. */
 #define LJ_GC_WHITE0	0x01
 #define LJ_GC_WHITE1	0x02
@@ -22,6 +27,7 @@ enum {
 #define LJ_GC_WEAKVAL	0x10
 #define LJ_GC_FIXED	0x20
 #define LJ_GC_SFIXED	0x40
+#define LJ_GC_OLD	0x80
 
 #define LJ_GC_WHITES	(LJ_GC_WHITE0 | LJ_GC_WHITE1)
 #define LJ_GC_COLORS	(LJ_GC_WHITES | LJ_GC_BLACK)
@@ -50,6 +56,8 @@ LJ_FUNCA void LJ_FASTCALL lj_gc_step_fixtop(lua_State *L);
 LJ_FUNC int LJ_FASTCALL lj_gc_step_jit(global_State *g, MSize steps);
 #endif
 LJ_FUNC void lj_gc_fullgc(lua_State *L);
+LJ_FUNC int lj_gc_setkind(lua_State *L, int kind);
+LJ_FUNC MSize lj_gc_setpace(global_State *g, MSize us);
 
 /* GC check: drive collector forward if the GC threshold has been reached. */
 #define lj_gc_check(L) \
@@ -68,6 +76,12 @@ LJ_FUNC void lj_gc_closeuv(global_State *g, GCupval *uv);
 LJ_FUNC void lj_gc_barriertrace(global_State *g, uint32_t traceno);
 #endif
 
+/* Barrier for resizing a table, which may be traversed in chunks. */
+#define lj_gc_barrierresize(g, t) \
+  { if (LJ_UNLIKELY(gcref((g)->gc.travtab) == obj2gco(t)) && \
+	isblack(obj2gco(t))) \
+      lj_gc_barrierback((g), (t)); }
+
 /* Barrier for stores to table objects. TValue and GCobj variant. */
 #define lj_gc_anybarriert(L, t)  \
   { if (isblack(obj2gco(t))) lj_gc_barrierback(G(L), (t)); }
@@ -88,7 +102,9 @@ LJ_FUNC void lj_gc_barriertrace(global_State *g, uint32_t traceno);
 
 /* Allocator. */
 LJ_FUNC void *lj_mem_realloc(lua_State *L, void *p, MSize osz, MSize nsz);
+LJ_FUNC void *lj_mem_allocgco(lua_State *L, MSize size);
 LJ_FUNC void *lj_mem_newgco(lua_State *L, MSize size);
+LJ_FUNC void lj_mem_freegco(global_State *g, void *p, MSize osize);
 LJ_FUNC void *lj_mem_grow(lua_State *L, void *p,
 			  MSize *szp, MSize lim, MSize esz);
 
@@ -108,6 +124,8 @@ static LJ_AINLINE void lj_mem_free(global_State *g, void *p, size_t osize)
 #define lj_mem_freevec(g, p, n, t)	lj_mem_free(g, (p), (n)*sizeof(t))
 
 #define lj_mem_newobj(L, t)	((t *)lj_mem_newgco(L, sizeof(t)))
+#define lj_mem_newgcot(L, s, t)	((t *)lj_mem_allocgco(L, (s)))
+#define lj_mem_freegcot(g, p)	lj_mem_freegco(g, (p), (MSize)sizeof(*(p)))
 #define lj_mem_newt(L, s, t)	((t *)lj_mem_new(L, (s)))
 #define lj_mem_freet(g, p)	lj_mem_free(g, (p), sizeof(*(p)))
 
@@ -83,6 +83,7 @@
   /* Memory references. */ \
   _(AREF,	R , ref, ref) \
   _(HREFK,	R , ref, ref) \
+  _(NREF,	R , ref, ref) \
   _(HREF,	L , ref, ref) \
   _(NEWREF,	S , ref, ref) \
   _(UREFO,	LW, ref, lit) \
@@ -98,16 +99,26 @@
   _(XLOAD,	L , ref, lit) \
   _(SLOAD,	L , lit, lit) \
   _(VLOAD,	L , ref, ___) \
+  _(HKLOAD,	L , ref, ___) \
   \
   _(ASTORE,	S , ref, ref) \
   _(HSTORE,	S , ref, ref) \
   _(USTORE,	S , ref, ref) \
   _(FSTORE,	S , ref, ref) \
+  _(UCLO,	S , ref, lit) \
+  _(TCLEAR,	S , ref, ___) \
   \
   /* Allocations. */ \
   _(SNEW,	N , ref, ref) /* CSE is ok, so not marked as A. */ \
   _(TNEW,	AW, lit, lit) \
   _(TDUP,	AW, ref, ___) \
+  _(FNEW,	AW, ref, ref) \
+  \
+  /* String buffer ops. */ \
+  _(BUFHDR,	L , ref, lit) \
+  _(BUFPUT,	L , ref, ref) \
+  _(BUFSTR,	A , ref, ___) \
+  _(USE,	S , ref, ___) \
   \
   /* Write barriers. */ \
   _(TBAR,	S , ref, ___) \
@@ -126,6 +137,13 @@
   _(CALLS,	S , ref, lit) \
   _(CARG,	N , ref, ref) \
   \
+  /* Side trace support. */ \
+  _(PVAL,	N , lit, ___) \
+  _(GCSTEP,	S , ___, ___) \
+  \
+  /* Packed numbers. */ \
+  _(SPLAT,	N , ref, ___) \
+  \
   /* End of list. */
 
 /* IR opcodes (max. 256). */
@@ -196,11 +214,16 @@ IRFLDEF(FLENUM)
 #define IRSLOAD_CONVERT		0x08	/* Number to integer conversion. */
 #define IRSLOAD_READONLY	0x10	/* Read-only, omit slot store. */
 #define IRSLOAD_INHERIT		0x20	/* Inherited by exits/side traces. */
+#define IRSLOAD_KEYINDEX	0x40	/* Table traversal index in lo-word. */
 
 /* XLOAD mode, stored in op2. */
 #define IRXLOAD_READONLY	1	/* Load from read-only data. */
 #define IRXLOAD_UNALIGNED	2	/* Unaligned load. */
 
+/* BUFHDR mode, stored in op2. op1 is a KPTR to an SBuf or a buffer udata. */
+#define IRBUFHDR_RESET		0	/* Reset the buffer. */
+#define IRBUFHDR_APPEND		1	/* Append to the buffer contents. */
+
 /* TOINT mode, stored in op2. Ordered by strength of the checks. */
 #define IRTOINT_CHECK		0	/* Number checked for integerness. */
 #define IRTOINT_INDEX		1	/* Checked + special backprop rules. */
@@ -237,14 +260,24 @@ typedef struct CCallInfo {
 /* Function definitions for CALL* instructions. */
 #define IRCALLDEF(_) \
   _(lj_str_cmp,		2,  FN, INT, CCI_NOFPRCLOBBER) \
+  _(lj_str_find,	4,   N, INT, 0) \
   _(lj_str_new,		3,   S, STR, CCI_L) \
   _(lj_str_tonum,	2,  FN, INT, 0) \
   _(lj_str_fromint,	2,  FN, STR, CCI_L) \
   _(lj_str_fromnum,	2,  FN, STR, CCI_L) \
+  _(lj_str_bufput,	3,   L, PTR, CCI_L) \
+  _(lj_str_bufputint,	3,   L, PTR, CCI_L) \
+  _(lj_str_bufputnum,	3,   L, PTR, CCI_L) \
+  _(lj_str_bufputfmt,	4,   L, PTR, CCI_L) \
+  _(lj_str_buftostr,	2,  FL, STR, CCI_L) \
   _(lj_tab_new1,	2,  FS, TAB, CCI_L) \
   _(lj_tab_dup,		2,  FS, TAB, CCI_L) \
   _(lj_tab_newkey,	3,   S, PTR, CCI_L) \
   _(lj_tab_len,		1,  FL, INT, 0) \
+  _(lj_tab_nexti,	2,  FL, INT, 0) \
+  _(lj_tab_clear,	1,  FS, NIL, 0) \
+  _(lj_func_newL_uv,	4,   S, FUNC, CCI_L) \
+  _(lj_func_closeuv,	2,  FS, NIL, CCI_L) \
   _(lj_gc_step_jit,	2,  FS, NIL, CCI_L) \
   _(lj_gc_barrieruv,	2,  FS, NIL, 0) \
   _(lj_math_random_step, 1, FS, NUM, CCI_CASTU64|CCI_NOFPRCLOBBER) \
@@ -329,7 +362,9 @@ typedef enum {
   IRT_U8,
   IRT_I16,
   IRT_U16,
-  /* There is room for 14 more types. */
+  /* Pair of numbers in one register. Only used by the vectorizer. */
+  IRT_V2NUM,
+  /* There is room for 13 more types. */
 
   /* Additional flags. */
   IRT_MARK = 0x20,	/* Marker for misc. purposes. */
@@ -370,6 +405,7 @@ typedef struct IRType1 { uint8_t irt; } IRType1;
 #define irt_isu8(t)		(irt_type(t) == IRT_U8)
 #define irt_isi16(t)		(irt_type(t) == IRT_I16)
 #define irt_isu16(t)		(irt_type(t) == IRT_U16)
+#define irt_isv2num(t)		(irt_type(t) == IRT_V2NUM)
 
 #define irt_isinteger(t)	(irt_typerange((t), IRT_INT, IRT_U16))
 #define irt_isgcv(t)		(irt_typerange((t), IRT_STR, IRT_UDATA))
@@ -446,6 +482,7 @@ typedef uint32_t TRef;
 #define TREF_REFMASK		0x0000ffff
 #define TREF_FRAME		0x00010000
 #define TREF_CONT		0x00020000
+#define TREF_KEYINDEX		0x00080000
 
 #define TREF(ref, t)		((TRef)((ref) + ((t)<<24)))
 
@@ -322,8 +322,8 @@ static int llex(LexState *ls, TValue *tv)
 
 /* -- Lexer API ----------------------------------------------------------- */
 
-/* Setup lexer state. */
-void lj_lex_setup(lua_State *L, LexState *ls)
+/* Setup lexer state. Returns 1 for a bytecode dump, 0 for source code. */
+int lj_lex_setup(lua_State *L, LexState *ls)
 {
   ls->L = L;
   ls->fs = NULL;
@@ -348,14 +348,11 @@ void lj_lex_setup(lua_State *L, LexState *ls)
   if (ls->current == '#') {  /* Skip POSIX #! header line. */
     do {
       next(ls);
-      if (ls->current == END_OF_STREAM) return;
+      if (ls->current == END_OF_STREAM) return 0;
     } while (!currIsNewline(ls));
     inclinenumber(ls);
   }
-  if (ls->current == LUA_SIGNATURE[0]) {
-    setstrV(L, L->top++, lj_err_str(L, LJ_ERR_XBCLOAD));
-    lj_err_throw(L, LUA_ERRSYNTAX);
-  }
+  return (ls->current == LUA_SIGNATURE[0]);  /* Checked by lj_bcread(). */
 }
 
 /* Cleanup lexer state. */
@@ -245,6 +245,7 @@ typedef struct GCudata {
 enum {
   UDTYPE_USERDATA,	/* Regular userdata. */
   UDTYPE_IO_FILE,	/* I/O library FILE. */
+  UDTYPE_BUFFER,	/* String buffer. */
   UDTYPE__MAX
 };
 
@@ -370,8 +371,12 @@ typedef union GCfunc {
 typedef struct Node {
   TValue val;		/* Value object. Must be first field. */
   TValue key;		/* Key object. */
-  MRef next;		/* Hash chain. */
+  MRef next;		/* Hash chain or next slot of the probe run. */
+#if LJ_TABHASH_OPEN
+  uint32_t hash;	/* Cached hash of the key. */
+#else
   MRef freetop;		/* Top of free elements (stored in t->node[0]). */
+#endif
 } Node;
 
 LJ_STATIC_ASSERT(offsetof(Node, val) == 0);
@@ -386,6 +391,10 @@ typedef struct GCtab {
   MRef node;		/* Hash part. */
   uint32_t asize;	/* Size of array part (keys [0, asize-1]). */
   uint32_t hmask;	/* Hash part mask (size of hash part - 1). */
+#if LJ_TABHASH_OPEN
+  uint32_t hfree;	/* Free hash slots left before a rehash. */
+  uint32_t unused1;
+#endif
 } GCtab;
 
 #define sizetabcolo(n)	((n)*sizeof(TValue) + sizeof(GCtab))
@@ -442,6 +451,8 @@ typedef enum {
   GCROOT_BASEMT_NUM = GCROOT_BASEMT + ~LJ_TNUMX,
   GCROOT_IO_INPUT,	/* Userdata for default I/O input file. */
   GCROOT_IO_OUTPUT,	/* Userdata for default I/O output file. */
+  GCROOT_PATCACHE,	/* Pattern strings and compiled patterns. */
+  GCROOT_PATCACHE_LAST = GCROOT_PATCACHE + 2*LJ_MAX_PATCACHE-1,
   GCROOT_MAX
 } GCRootID;
 
@@ -454,8 +465,8 @@ typedef struct GCState {
   MSize threshold;	/* Memory threshold. */
   uint8_t currentwhite;	/* Current white color. */
   uint8_t state;	/* GC state. */
-  uint8_t unused1;
-  uint8_t unused2;
+  uint8_t kind;		/* GC kind (incremental or generational). */
+  uint8_t sticky;	/* Survivors keep their marks (generational). */
   MSize sweepstr;	/* Sweep position in string table. */
   GCRef root;		/* List of all collectable objects. */
   MRef sweep;		/* Sweep position in root list. */
@@ -463,20 +474,55 @@ typedef struct GCState {
   GCRef grayagain;	/* List of objects for atomic traversal. */
   GCRef weak;		/* List of weak tables (to be cleared). */
   GCRef mmudata;	/* List of userdata (to be finalized). */
+  GCRef travtab;	/* Big table traversed in chunks. */
+  MSize travpos;	/* Traversal position in big table. */
   MSize stepmul;	/* Incremental GC step granularity. */
   MSize debt;		/* Debt (how much GC is behind schedule). */
   MSize estimate;	/* Estimate of memory actually in use. */
   MSize pause;		/* Pause between successive GC cycles. */
+  MSize genminor;	/* Size of young generation (generational). */
+  MSize genmajor;	/* Estimate for next major collection (generational). */
+  MSize pacetime;	/* Target max. step time in us (0 = no pacing). */
+  MSize pacework;	/* Work per step for the target step time (paced). */
+  MSize pacebase;	/* Memory allocated at the start of the cycle. */
+  MSize pacegrow;	/* Growth during mark phase of the last cycle. */
+  MSize stepnum;	/* Number of timed steps. */
+  MSize stepover;	/* Number of timed steps over the target step time. */
+  MSize stepmax;	/* Max. step time in ns. */
+  uint64_t steptime;	/* Total step time in ns. */
 } GCState;
 
+#if LJ_HASSLAB
+/* Slab allocator state. Size classes are multiples of 8 bytes. */
+#define LJ_SLAB_MAXSIZE		256
+#define LJ_SLAB_NCLASS		(LJ_SLAB_MAXSIZE >> 3)
+
+typedef struct SlabState {
+  struct SlabPage *page[LJ_SLAB_NCLASS];  /* Pages with free objects. */
+  struct SlabPage *freepage;	/* List of empty pages. */
+  struct SlabArena *arena;	/* List of arenas. First one grows. */
+  struct SlabArena **trim;	/* Link to next arena to trim or NULL. */
+} SlabState;
+#endif
+
 /* Global state, shared by all threads of a Lua universe. */
 typedef struct global_State {
   GCRef *strhash;	/* String hash table (hash chain anchors). */
   MSize strmask;	/* String hash mask (size of hash table - 1). */
   MSize strnum;		/* Number of strings in hash table. */
+  uint32_t *strdirty;	/* Bitmap of hash chains with young strings. */
+#if LJ_STRHASH_FULL
+  uint64_t strkey[2];	/* Key for string hashing. */
+#endif
+  GCRef *stroldhash;	/* Old string hash table during resizing or NULL. */
+  MSize stroldmask;	/* Old string hash mask. */
+  MSize strmigrate;	/* Next chain of old string hash table to move. */
   lua_Alloc allocf;	/* Memory allocator. */
   void *allocd;		/* Memory allocator data. */
   GCState gc;		/* Garbage collector. */
+#if LJ_HASSLAB
+  SlabState slab;	/* Slab allocator for small GC objects. */
+#endif
   SBuf tmpbuf;		/* Temporary buffer for string concatenation. */
   Node nilnode;		/* Fallback 1-element hash part (nil key and value). */
   GCstr strempty;	/* Empty string. */
@@ -513,6 +559,7 @@ typedef struct global_State {
 #define HOOK_ACTIVE_SHIFT	4
 #define HOOK_VMEVENT		0x20
 #define HOOK_GC			0x40
+#define HOOK_PROFILE		0x80
 #define hook_active(g)		((g)->hookmask & HOOK_ACTIVE)
 #define hook_enter(g)		((g)->hookmask |= HOOK_ACTIVE)
 #define hook_entergc(g)		((g)->hookmask |= (HOOK_ACTIVE|HOOK_GC))
@@ -520,7 +567,8 @@ typedef struct global_State {
 #define hook_leave(g)		((g)->hookmask &= ~HOOK_ACTIVE)
 #define hook_save(g)		((g)->hookmask & ~HOOK_EVENTMASK)
 #define hook_restore(g, h) \
-  ((g)->hookmask = ((g)->hookmask & HOOK_EVENTMASK) | (h))
+  ((g)->hookmask = ((g)->hookmask & (HOOK_EVENTMASK|HOOK_PROFILE)) | \
+		   ((h) & ~HOOK_PROFILE))
 
 /* Per-thread state object. */
 struct lua_State {
@@ -12,6 +12,7 @@
 
 #if LJ_HASJIT
 
+#include "lj_gc.h"
 #include "lj_str.h"
 #include "lj_tab.h"
 #include "lj_ir.h"
@@ -152,8 +153,8 @@ typedef IRRef (LJ_FASTCALL *FoldFunc)(jit_State *J);
 */
 #define gcstep_barrier(J, ref) \
   ((ref) < J->chain[IR_LOOP] && \
-   (J->chain[IR_TNEW] || J->chain[IR_TDUP] || \
-    J->chain[IR_SNEW] || J->chain[IR_TOSTR]))
+   (J->chain[IR_TNEW] || J->chain[IR_TDUP] || J->chain[IR_FNEW] || \
+    J->chain[IR_SNEW] || J->chain[IR_TOSTR] || J->chain[IR_BUFSTR]))
 
 /* -- Constant folding ---------------------------------------------------- */
 
@@ -308,7 +309,7 @@ LJFOLD(STRREF KGC KINT)
 LJFOLDF(kfold_strref)
 {
   GCstr *str = ir_kstr(fleft);
-  lua_assert((MSize)fright->i < str->len);
+  lua_assert((MSize)fright->i <= str->len);  /* Includes the trailing NUL. */
   return lj_ir_kptr(J, (char *)strdata(str) + fright->i);
 }
 
@@ -1160,6 +1161,98 @@ LJFOLDF(merge_eqne_snew_kgc)
   return NEXTFOLD;
 }
 
+/* -- String buffers ------------------------------------------------------ */
+
+/* A string concatenation is recorded as a chain of buffer ops:
+**
+**   hdr = BUFHDR kptr(&g->tmpbuf)
+**   p1  = BUFPUT hdr str1
+**   p2  = BUFPUT p1  str2
+**   str = BUFSTR p2
+**
+** The chain is emitted in one go by the recorder, with nothing else
+** touching the buffer inbetween. So BUFHDR and BUFPUT are never CSEd,
+** only the final BUFSTR may be CSEd as a whole (see below).
+**
+** Appending to a buffer object starts the chain with an APPEND header on
+** the udata and ends it with a USE, since there's no BUFSTR to keep it
+** alive. The result of BUFSTR then depends on the previous contents, too.
+*/
+
+/* Put the number itself, instead of converting it to a string first. */
+LJFOLD(BUFPUT any TOSTR)
+LJFOLDF(bufput_tostr)
+{
+  if (LJ_LIKELY(J->flags & JIT_F_OPT_FOLD)) {
+    PHIBARRIER(fright);
+    fins->op2 = fright->op1;
+    return RETRYFOLD;
+  }
+  return NEXTFOLD;
+}
+
+LJFOLD(BUFPUT any KGC)
+LJFOLDF(bufput_kgc)
+{
+  if (LJ_LIKELY(J->flags & JIT_F_OPT_FOLD)) {
+    GCstr *s2 = ir_kstr(fright);
+    if (s2->len == 0)  /* Drop empty string. */
+      return LEFTFOLD;
+    if (fleft->o == IR_BUFPUT && IR(fleft->op2)->o == IR_KGC) {
+      /* Join two constant strings in a row. */
+      GCstr *s1 = ir_kstr(IR(fleft->op2));
+      MSize len = s1->len + s2->len;
+      IRRef ref = fins->op1;
+      TRef kstr;
+      char *p = lj_mem_newvec(J->L, len, char);
+      memcpy(p, strdata(s1), s1->len);
+      memcpy(p + s1->len, strdata(s2), s2->len);
+      kstr = lj_ir_kstr(J, lj_str_new(J->L, p, len));
+      lj_mem_freevec(J2G(J), p, len, char);
+      IR(ref)->op2 = (IRRef1)tref_ref(kstr);  /* Modify previous BUFPUT. */
+      return ref;
+    }
+  }
+  return lj_ir_emit(J);
+}
+
+LJFOLD(BUFPUT any any)
+LJFOLDX(lj_ir_emit)
+
+LJFOLD(BUFSTR any)
+LJFOLDF(bufstr_kfold_cse)
+{
+  IRIns *hdr = fleft;
+  while (hdr->o != IR_BUFHDR) hdr = IR(hdr->op1);
+  if (hdr->op2 != IRBUFHDR_RESET)  /* Previous contents are unknown. */
+    return EMITFOLD;
+  if (LJ_LIKELY(J->flags & JIT_F_OPT_FOLD)) {
+    if (fleft->o == IR_BUFHDR)  /* No puts left. */
+      return lj_ir_kstr(J, &J2G(J)->strempty);
+    if (IR(fleft->op1)->o == IR_BUFHDR &&  /* Single put? */
+	IR(fleft->op2)->o != IR_CARG) {
+      if (irt_isstr(IR(fleft->op2)->t))
+	return fleft->op2;
+      return emitir(IRT(IR_TOSTR, IRT_STR), fleft->op2, 0);
+    }
+  }
+  /* Try to CSE the whole chain. */
+  if (LJ_LIKELY(J->flags & JIT_F_OPT_CSE)) {
+    IRRef ref = J->chain[IR_BUFSTR];
+    while (ref) {
+      IRIns *ira = fleft, *irb = IR(IR(ref)->op1);
+      while (ira->o == irb->o && ira->op2 == irb->op2) {
+	if (ira->o == IR_BUFHDR)
+	  return ref;  /* CSE succeeded. */
+	ira = IR(ira->op1);
+	irb = IR(irb->op1);
+      }
+      ref = IR(ref)->prev;
+    }
+  }
+  return EMITFOLD;
+}
+
 /* -- Loads --------------------------------------------------------------- */
 
 /* Loads cannot be folded or passed on to CSE in general.
@@ -1189,6 +1282,10 @@ LJFOLDX(lj_opt_fwd_uload)
 LJFOLD(CALLL any IRCALL_lj_tab_len)
 LJFOLDX(lj_opt_fwd_tab_len)
 
+LJFOLD(UREFO FNEW any)
+LJFOLD(UREFC FNEW any)
+LJFOLDX(lj_opt_fwd_uref)
+
 /* Upvalue refs are really loads, but there are no corresponding stores.
 ** So CSE is ok for them, except for UREFO across a GC step (see below).
 ** If the referenced function is const, its upvalue addresses are const, too.
@@ -1278,6 +1375,9 @@ LJFOLDF(fload_tab_tdup_hmask)
   return NEXTFOLD;
 }
 
+LJFOLD(HREFK any any)
+LJFOLDX(lj_opt_fwd_hrefk)
+
 LJFOLD(HREF any any)
 LJFOLD(FLOAD any IRFL_TAB_ARRAY)
 LJFOLD(FLOAD any IRFL_TAB_NODE)
@@ -1289,6 +1389,17 @@ LJFOLDF(fload_tab_ah)
   return lj_opt_fwd_tptr(J, tref_ref(tr)) ? tr : EMITFOLD;
 }
 
+/* A new closure inherits the environment of its parent function. */
+LJFOLD(FLOAD FNEW IRFL_FUNC_ENV)
+LJFOLDF(fload_func_fnew_env)
+{
+  if (LJ_LIKELY(J->flags & JIT_F_OPT_FOLD)) {
+    fins->op1 = IR(fleft->op2)->op1;  /* Parent function from CARG. */
+    return RETRYFOLD;
+  }
+  return NEXTFOLD;
+}
+
 /* Strings are immutable, so we can safely FOLD/CSE the related FLOAD. */
 LJFOLD(FLOAD KGC IRFL_STR_LEN)
 LJFOLDF(fload_str_len_kgc)
@@ -1310,6 +1421,7 @@ LJFOLDF(fload_str_len_snew)
 
 LJFOLD(FLOAD any IRFL_STR_LEN)
 LJFOLD(VLOAD any any)  /* Vararg loads have no corresponding stores. */
+LJFOLD(HKLOAD any)  /* Keys of live nodes are never overwritten. */
 LJFOLDX(lj_opt_cse)
 
 /* All other field loads need alias analysis. */
@@ -1406,6 +1518,11 @@ LJFOLD(CALLL any any)  /* Safeguard fallback. */
 LJFOLD(RETF any any)  /* Modifies BASE. */
 LJFOLD(TNEW any any)
 LJFOLD(TDUP any)
+LJFOLD(FNEW any any)
+LJFOLD(UCLO any any)
+LJFOLD(TCLEAR any)
+LJFOLD(BUFHDR any any)
+LJFOLD(USE any)
 LJFOLDX(lj_ir_emit)
 
 /* ------------------------------------------------------------------------ */
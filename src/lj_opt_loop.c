@@ -197,6 +197,7 @@ static void loop_subst_snap(jit_State *J, SnapShot *osnap,
   snap->depth = (uint8_t)depth;
   snap->nslots = nslots;
   snap->count = 0;
+  snap->mcofs = 0;
   nmap = &J->cur.snapmap[nmapofs];
   /* Substitute snapshot slots. */
   on = ln = nn = 0;
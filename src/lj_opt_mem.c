@@ -21,6 +21,7 @@
 /* Some local macros to save typing. Undef'd at the end. */
 #define IR(ref)		(&J->cur.ir[(ref)])
 #define fins		(&J->fold.ins)
+#define fleft		(&J->fold.left)
 #define fright		(&J->fold.right)
 
 /*
@@ -67,6 +68,19 @@ static AliasRet aa_table(jit_State *J, IRRef ta, IRRef tb)
   return ALIAS_NO;  /* Allocation doesn't alias the other reference. */
 }
 
+/* Check whether there's no TCLEAR for an aliased table above lim. */
+static int aa_tclear(jit_State *J, IRRef lim, IRRef ta)
+{
+  IRRef ref = J->chain[IR_TCLEAR];
+  while (ref > lim) {
+    IRIns *clr = IR(ref);
+    if (ta == clr->op1 || aa_table(J, ta, clr->op1) != ALIAS_NO)
+      return 0;  /* Conflict. */
+    ref = clr->prev;
+  }
+  return 1;  /* No conflict. */
+}
+
 /* Alias analysis for array and hash access using key-based disambiguation. */
 static AliasRet aa_ahref(jit_State *J, IRIns *refa, IRIns *refb)
 {
@@ -76,12 +90,18 @@ static AliasRet aa_ahref(jit_State *J, IRIns *refa, IRIns *refb)
   IRRef ta, tb;
   if (refa == refb)
     return ALIAS_MUST;  /* Shortcut for same refs. */
+  ta = (refa->o==IR_HREFK || refa->o==IR_AREF || refa->o==IR_NREF) ?
+       IR(refa->op1)->op1 : refa->op1;
+  tb = (refb->o==IR_HREFK || refb->o==IR_AREF || refb->o==IR_NREF) ?
+       IR(refb->op1)->op1 : refb->op1;
+  if (refa->o == IR_NREF || refb->o == IR_NREF) {
+    /* Node refs from a table traversal: no key to disambiguate. */
+    return ta == tb ? ALIAS_MAY : aa_table(J, ta, tb);
+  }
   keya = IR(ka);
   if (keya->o == IR_KSLOT) { ka = keya->op1; keya = IR(ka); }
   keyb = IR(kb);
   if (keyb->o == IR_KSLOT) { kb = keyb->op1; keyb = IR(kb); }
-  ta = (refa->o==IR_HREFK || refa->o==IR_AREF) ? IR(refa->op1)->op1 : refa->op1;
-  tb = (refb->o==IR_HREFK || refb->o==IR_AREF) ? IR(refb->op1)->op1 : refb->op1;
   if (ka == kb) {
     /* Same key. Check for same table with different ref (NEWREF vs. HREF). */
     if (ta == tb)
@@ -148,7 +168,8 @@ static TRef fwd_ahload(jit_State *J, IRRef xref)
     IRIns *ir = (xr->o == IR_HREFK || xr->o == IR_AREF) ? IR(xr->op1) : xr;
     IRRef tab = ir->op1;
     ir = IR(tab);
-    if (ir->o == IR_TNEW || (ir->o == IR_TDUP && irref_isk(xr->op2))) {
+    if ((ir->o == IR_TNEW || (ir->o == IR_TDUP && irref_isk(xr->op2))) &&
+	aa_tclear(J, tab, tab)) {
       /* A NEWREF with a number key may end up pointing to the array part.
       ** But it's referenced from HSTORE and not found in the ASTORE chain.
       ** For now simply consider this a conflict without forwarding anything.
@@ -250,6 +271,35 @@ TRef LJ_FASTCALL lj_opt_fwd_hload(jit_State *J)
   return EMITFOLD;
 }
 
+/* HREFK forwarding. A NEWREF for the same key and table returns the same
+** slot, unless another NEWREF caused a rehash inbetween. The slot of a key
+** in a TDUP is fixed by its template, so the HREFK guard can be dropped.
+*/
+TRef LJ_FASTCALL lj_opt_fwd_hrefk(jit_State *J)
+{
+  IRRef tab = fleft->op1;  /* Table reference from FLOAD tab.node. */
+  IRRef ref = J->chain[IR_NEWREF];
+  while (ref > tab) {
+    IRIns *newref = IR(ref);
+    if (tab == newref->op1) {
+      if (fright->op1 == newref->op2 && aa_tclear(J, ref, tab))
+	return ref;  /* Forward from NEWREF. */
+      else
+	goto docse;
+    } else if (aa_table(J, tab, newref->op1) != ALIAS_NO) {
+      goto docse;
+    }
+    ref = newref->prev;
+  }
+  /* No conflicting NEWREF: key location unchanged for HREFK of TDUP.
+  ** Unless the table has been cleared, which removes all keys.
+  */
+  if (IR(tab)->o == IR_TDUP && aa_tclear(J, tab, tab))
+    fins->t.irt &= ~IRT_GUARD;  /* Drop HREFK guard. */
+docse:
+  return CSEFOLD;
+}
+
 /* Check whether HREF of TNEW/TDUP can be folded to niltv. */
 int LJ_FASTCALL lj_opt_fwd_href_nokey(jit_State *J)
 {
@@ -289,7 +339,10 @@ int LJ_FASTCALL lj_opt_fwd_tptr(jit_State *J, IRRef lim)
       return 0;  /* Conflict. */
     ref = newref->prev;
   }
-  return 1;  /* No conflict. Can safely FOLD/CSE. */
+  /* TCLEAR keeps the pointers and sizes, but not the keys in the hash part.
+  ** Don't CSE the pointers, so refs and loads after it aren't CSEd either.
+  */
+  return aa_tclear(J, lim, ta);  /* No conflict? Can safely FOLD/CSE. */
 }
 
 /* ASTORE/HSTORE elimination. */
@@ -387,6 +440,24 @@ cselim:
   return lj_opt_cselim(J, lim);
 }
 
+/* Upvalue refs through a new closure. Inherited upvalues of a closure
+** created on-trace are the upvalues of its parent function. Redirect the
+** reference to the parent, so the load can be forwarded from the stores
+** and loads of the parent.
+*/
+TRef LJ_FASTCALL lj_opt_fwd_uref(jit_State *J)
+{
+  IRIns *ir = IR(fins->op1);
+  GCproto *pt = gco2pt(ir_kgc(IR(ir->op1)));
+  uint32_t v = proto_uv(pt)[(fins->op2 >> 8)];
+  if (!(v & 0x8000)) {  /* Not a captured local. */
+    fins->op1 = IR(ir->op2)->op1;  /* Parent function from CARG. */
+    fins->op2 = (IRRef1)((v << 8) | (fins->op2 & 0xff));
+    return RETRYFOLD;
+  }
+  return NEXTFOLD;
+}
+
 /* USTORE elimination. */
 TRef LJ_FASTCALL lj_opt_dse_ustore(jit_State *J)
 {
@@ -604,6 +675,7 @@ int lj_opt_fwd_wasnonnil(jit_State *J, IROpT loadop, IRRef xref)
 
 #undef IR
 #undef fins
+#undef fleft
 #undef fright
 
 #endif
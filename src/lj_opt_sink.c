@@ -0,0 +1,227 @@
+/*
+** SINK: Allocation Sinking and Store Sinking.
+** Copyright (C) 2005-2010 Mike Pall. See Copyright Notice in luajit.h
+*/
+
+#define lj_opt_sink_c
+#define LUA_CORE
+
+#include "lj_obj.h"
+
+#if LJ_HASJIT
+
+#include "lj_ir.h"
+#include "lj_jit.h"
+#include "lj_iropt.h"
+#include "lj_target.h"
+
+/* Some local macros to save typing. Undef'd at the end. */
+#define IR(ref)		(&J->cur.ir[(ref)])
+
+/* Check whether the store ref points to an eligible allocation. */
+static IRIns *sink_checkalloc(jit_State *J, IRIns *irs)
+{
+  IRIns *ir = IR(irs->op1);
+  if (!irref_isk(ir->op2))
+    return NULL;  /* Non-constant key. */
+  if (ir->o == IR_HREFK || ir->o == IR_AREF) {
+    ir = IR(ir->op1);
+    if (ir->o != IR_FLOAD)
+      return NULL;  /* Not a reference to the array or hash part. */
+  } else if (ir->o != IR_NEWREF) {
+    return NULL;  /* Unhandled reference type. */
+  }
+  ir = IR(ir->op1);
+  if (!(ir->o == IR_TNEW || ir->o == IR_TDUP))
+    return NULL;  /* Not an allocation. */
+  return ir;  /* Return allocation. */
+}
+
+/* Mark all instructions referenced by a snapshot. */
+static void sink_mark_snap(jit_State *J, SnapShot *snap)
+{
+  SnapEntry *map = &J->cur.snapmap[snap->mapofs];
+  MSize n, nent = snap->nent;
+  for (n = 0; n < nent; n++) {
+    IRRef ref = snap_ref(map[n]);
+    if (!irref_isk(ref))
+      irt_setmark(IR(ref)->t);
+  }
+}
+
+/* Mark the instructions referenced by a snapshot for slots in [lo, hi). */
+static void sink_mark_slots(jit_State *J, SnapShot *snap, BCReg lo, BCReg hi)
+{
+  SnapEntry *map = &J->cur.snapmap[snap->mapofs];
+  MSize n, nent = snap->nent;
+  for (n = 0; n < nent; n++) {
+    BCReg s = snap_slot(map[n]);
+    IRRef ref = snap_ref(map[n]);
+    if (s >= lo && s < hi && !irref_isk(ref))
+      irt_setmark(IR(ref)->t);
+  }
+}
+
+/* Mark the current values of the stack slots captured by a new closure. */
+static void sink_mark_fnew(jit_State *J, IRIns *ir, SnapShot *snap)
+{
+  GCproto *pt = gco2pt(ir_kgc(IR(ir->op1)));
+  IRIns *irb = IR(IR(ir->op2)->op2);  /* Pointer to the frame base. */
+  BCReg base;
+  MSize i;
+  if (IR(ir->op2)->op2 == REF_BASE) {
+    base = 1;
+  } else if (irb->o == IR_ADD && irb->op1 == REF_BASE &&
+	     IR(irb->op2)->o == IR_KINT) {
+    base = (BCReg)(IR(irb->op2)->i >> 3) + 1;
+  } else {  /* Unknown frame base: mark all slots. */
+    sink_mark_slots(J, snap, 0, ~(BCReg)0);
+    return;
+  }
+  for (i = 0; i < pt->sizeuv; i++) {
+    uint32_t v = proto_uv(pt)[i];
+    if ((v & 0x8000))  /* Captured local slot. */
+      sink_mark_slots(J, snap, base + (v & 0xff), base + (v & 0xff) + 1);
+  }
+}
+
+/* Backwards propagate marks for all uses which let an allocation escape.
+** Unmarked allocations are only referenced by their own eligible stores
+** and by snapshots of side exits.
+**
+** The values of the stack slots captured by FNEW or closed by UCLO escape,
+** too. UCLO writes them to the stack from the snapshot right before it,
+** and there's no way to rebuild a sunk allocation on-trace.
+*/
+static void sink_mark_ins(jit_State *J)
+{
+  IRRef ins;
+  SnapNo snapno = J->cur.nsnap;
+  for (ins = J->cur.nins-1; ins >= REF_FIRST; ins--) {
+    IRIns *ir = IR(ins);
+    while (snapno > 0 && J->cur.snap[snapno-1].ref > ins)
+      snapno--;  /* Find the last snapshot before this instruction. */
+    switch (ir->o) {
+    case IR_UCLO:
+      lua_assert(snapno > 0);
+      sink_mark_slots(J, &J->cur.snap[snapno-1], ir->op2, ~(BCReg)0);
+      if (!irref_isk(ir->op1)) irt_setmark(IR(ir->op1)->t);
+      break;
+    case IR_FNEW:
+      lua_assert(snapno > 0);
+      sink_mark_fnew(J, ir, &J->cur.snap[snapno-1]);
+      irt_setmark(IR(ir->op2)->t);
+      break;
+    case IR_ALOAD: case IR_HLOAD: case IR_VLOAD: case IR_HKLOAD:
+    case IR_TBAR:
+      irt_setmark(IR(ir->op1)->t);  /* Mark ref for remaining loads. */
+      break;
+    case IR_FLOAD:
+      if (irt_ismarked(ir->t) || ir->op2 == IRFL_TAB_META)
+	irt_setmark(IR(ir->op1)->t);  /* Mark table for remaining loads. */
+      break;
+    case IR_ASTORE: case IR_HSTORE:
+      if (!sink_checkalloc(J, ir))
+	irt_setmark(IR(ir->op1)->t);  /* Mark ineligible ref. */
+      if (!irref_isk(ir->op2))
+	irt_setmark(IR(ir->op2)->t);  /* Mark stored value. */
+      break;
+    case IR_NEWREF:
+      if (irt_ismarked(ir->t) || !irref_isk(ir->op2))
+	irt_setmark(IR(ir->op1)->t);  /* Mark table for ineligible key. */
+      if (!irref_isk(ir->op2))
+	irt_setmark(IR(ir->op2)->t);  /* Mark key. */
+      break;
+    case IR_PHI:  /* NYI: sinking of loop-carried allocations. */
+      irt_setmark(IR(ir->op1)->t);
+      irt_setmark(IR(ir->op2)->t);
+      break;
+    case IR_CALLN: case IR_CALLL: case IR_CALLS:
+      if (!irref_isk(ir->op1))
+	irt_setmark(IR(ir->op1)->t);  /* Mark args, even for unused results. */
+      break;
+    default:
+      if (irt_ismarked(ir->t) || irt_isguard(ir->t) || ir_sideeff(ir)) {
+	if (!irref_isk(ir->op1)) irt_setmark(IR(ir->op1)->t);
+	if (!irref_isk(ir->op2)) irt_setmark(IR(ir->op2)->t);
+      }
+      break;
+    }
+  }
+}
+
+/* Tag unmarked allocations and their stores with RID_SINK. */
+static void sink_sweep_ins(jit_State *J)
+{
+  IRRef ins;
+  for (ins = J->cur.nins-1; ins >= REF_FIRST; ins--) {
+    IRIns *ir = IR(ins);
+    switch (ir->o) {
+    case IR_ASTORE: case IR_HSTORE: {
+      IRIns *ira = sink_checkalloc(J, ir);
+      ir->prev = (ira && !irt_ismarked(ira->t)) ? REGSP(RID_SINK, 0) :
+						  REGSP_INIT;
+      break;
+      }
+    case IR_NEWREF: {
+      IRIns *ira = IR(ir->op1);
+      if ((ira->o == IR_TNEW || ira->o == IR_TDUP) &&
+	  !irt_ismarked(ira->t) && irref_isk(ir->op2)) {
+	ir->prev = REGSP(RID_SINK, 0);
+      } else {
+	irt_clearmark(ir->t);
+	ir->prev = REGSP_INIT;
+      }
+      break;
+      }
+    case IR_TNEW: case IR_TDUP:
+      if (!irt_ismarked(ir->t)) {
+	ir->t.irt &= ~IRT_GUARD;
+	ir->prev = REGSP(RID_SINK, 0);
+	J->cur.sinktags = 1;  /* Signal present SINK tags to assembler. */
+      } else {
+	irt_clearmark(ir->t);
+	ir->prev = REGSP_INIT;
+      }
+      break;
+    default:
+      irt_clearmark(ir->t);
+      ir->prev = REGSP_INIT;
+      break;
+    }
+  }
+}
+
+/* Allocation sinking.
+**
+** Tables which are created on-trace and never escape need not be allocated
+** at all. Their contents have already been forwarded to all loads, so only
+** side exits need the actual table. The allocation and its stores are
+** tagged with RID_SINK and skipped by the assembler. The snapshot restore
+** rebuilds the table from the stored values, which are kept alive in
+** registers or spill slots for each snapshot that references the table.
+**
+** An allocation escapes if it's referenced by the final snapshot of a
+** non-looping trace, by a PHI, by a remaining load, by any other use
+** with a side-effect or a guard or if a store to it is not eligible.
+** Eligible stores go to a constant key of the array or hash part.
+**
+** This pass must run after all other optimizations, since it overwrites
+** the instruction chains.
+*/
+void lj_opt_sink(jit_State *J)
+{
+  const uint32_t need = (JIT_F_OPT_SINK|JIT_F_OPT_FWD|
+			 JIT_F_OPT_DCE|JIT_F_OPT_CSE|JIT_F_OPT_FOLD);
+  if ((J->flags & need) == need &&
+      (J->chain[IR_TNEW] || J->chain[IR_TDUP])) {
+    if (!J->loopref)
+      sink_mark_snap(J, &J->cur.snap[J->cur.nsnap-1]);
+    sink_mark_ins(J);
+    sink_sweep_ins(J);
+  }
+}
+
+#undef IR
+
+#endif
@@ -0,0 +1,389 @@
+/*
+** VEC: Loop Vectorization.
+** Copyright (C) 2005-2010 Mike Pall. See Copyright Notice in luajit.h
+*/
+
+#define lj_opt_vec_c
+#define LUA_CORE
+
+#include "lj_obj.h"
+
+#if LJ_HASJIT
+
+#include "lj_str.h"
+#include "lj_ir.h"
+#include "lj_jit.h"
+#include "lj_iropt.h"
+
+/* Loop vectorization:
+**
+** Simple numeric kernels over arrays, e.g. 'c[i] = a[i]*k + b[i]', end up
+** with a very short loop body after LOOP optimization: the bounds checks
+** and the metatable checks have been hoisted into the pre-roll, only the
+** array references, the type-checking loads, the arithmetic and the
+** stores remain. This pass rewrites such a loop body to run two
+** iterations at once with packed SSE2 instructions.
+**
+** A loop body is eligible if:
+**
+** - The integer loop index is the only loop-carried value. It must be
+**   incremented by one and compared against an invariant end value.
+**   A numeric PHI is only allowed for a load which has been forwarded
+**   from the previous iteration, e.g. for 'a[i] + a[i+1]'. This is simply
+**   turned back into a load.
+**
+** - It only contains array references with an invariant base and the
+**   index plus a constant offset, loads and stores of numbers and
+**   number arithmetic (ADD, SUB, MUL, DIV). Calls, conversions, other
+**   guards and reductions (e.g. 's = s + a[i]*b[i]') are not eligible.
+**   Vectorizing a reduction would change the order of the floating-point
+**   operations and thus the result.
+**
+** - All loads precede all stores. A failing type check must not exit
+**   after the stores of the following iteration have been done.
+**
+** - Storing an element must not affect a load or store of the following
+**   iteration. Only the order of these pairs of memory references changes
+**   by running two iterations at once. For the same array this rejects
+**   the loop, e.g. for 'a[i+1] = a[i] + x'. For different arrays a runtime
+**   check that they do not alias is emitted before the loop.
+**
+** - Only the loop end guard has a snapshot in the loop body and it only
+**   references the index and invariants.
+**
+** The new loop body first checks that two more iterations can be run.
+** Otherwise it exits to the loop snapshot (like the pairwise type checks)
+** and the remaining iteration is handled by the interpreter or a side
+** trace. The loop end guard uses the original exit snapshot with the index
+** of the second iteration substituted.
+*/
+
+/* Some local macros to save typing. Undef'd at the end. */
+#define IR(ref)		(&J->cur.ir[(ref)])
+
+/* Emit raw IR without passing through optimizations. */
+#define emitir_raw(ot, a, b)	(lj_ir_set(J, (ot), (a), (b)), lj_ir_emit(J))
+
+/* Limits for eligible loop bodies. */
+#define VEC_MAXMEM	16	/* Max. number of loads and stores. */
+#define VEC_MAXPHI	4	/* Max. number of forwarded loads. */
+#define VEC_MAXALIAS	4	/* Max. number of runtime alias checks. */
+#define VEC_MAXOFS	0xffff	/* Max. absolute index offset. */
+
+/* Load or store in the loop body. */
+typedef struct VecMem {
+  IRRef1 base;		/* Invariant base of the array reference. */
+  uint8_t store;	/* 1 for a store, 0 for a load. */
+  int32_t ofs;		/* Index offset. */
+} VecMem;
+
+/* Vectorization state. */
+typedef struct VecState {
+  IRRef loop;		/* Reference of LOOP instruction. */
+  IRRef guard;		/* Reference of loop end guard. */
+  IRRef idx;		/* Loop index (left PHI operand). */
+  IRRef inc;		/* Incremented loop index (right PHI operand). */
+  IRRef stop;		/* Invariant loop end value. */
+  MSize nmem, nphi, nalias, nofs;
+  VecMem mem[VEC_MAXMEM];  /* Forwarded loads first, then program order. */
+  IRRef1 phi[VEC_MAXPHI];  /* Left operands of numeric PHIs. */
+  IRRef1 alias[VEC_MAXALIAS][2];  /* Array bases which must not alias. */
+  int32_t ofs[VEC_MAXMEM+2];  /* Cache for index plus offset. */
+  IRRef1 ofsref[VEC_MAXMEM+2];
+} VecState;
+
+/* -- Analysis ------------------------------------------------------------ */
+
+/* Get offset for the index plus a constant. Returns 0 if no match. */
+static int vec_index(jit_State *J, VecState *vs, IRIns *ir, IRRef ref,
+		     int32_t *ofs)
+{
+  if (ref == vs->idx) {
+    *ofs = 0;
+    return 1;
+  }
+  if (ref > vs->loop && ir->o == IR_ADD && irt_isint(ir->t) &&
+      ir->op1 == vs->idx && irref_isk(ir->op2) &&
+      IR(ir->op2)->o == IR_KINT) {
+    int32_t k = IR(ir->op2)->i;
+    if (k >= -VEC_MAXOFS && k <= VEC_MAXOFS) {
+      *ofs = k;
+      return 1;
+    }
+  }
+  return 0;
+}
+
+/* Check for a left operand of a numeric PHI. */
+static int vec_isphi(VecState *vs, IRRef ref)
+{
+  MSize i;
+  for (i = 0; i < vs->nphi; i++)
+    if (vs->phi[i] == ref)
+      return 1;
+  return 0;
+}
+
+/* Add array reference of a load or store. */
+static int vec_addmem(jit_State *J, VecState *vs, IRRef aref, int store)
+{
+  IRIns *ira = IR(aref);
+  VecMem *m;
+  int32_t ofs;
+  if (ira->o != IR_AREF || aref < vs->loop || ira->op1 > vs->loop ||
+      !vec_index(J, vs, IR(ira->op2), ira->op2, &ofs) ||
+      vs->nmem >= VEC_MAXMEM)
+    return 0;
+  m = &vs->mem[vs->nmem++];
+  m->base = ira->op1;
+  m->store = (uint8_t)store;
+  m->ofs = ofs;
+  return 1;
+}
+
+/* Check a numeric operand of an arithmetic instruction or a store. */
+static int vec_checkop(jit_State *J, VecState *vs, IRRef ref)
+{
+  IRIns *ir = IR(ref);
+  if (!irt_isnum(ir->t))
+    return 0;
+  if (ref > vs->loop)  /* Variant: must be a load or arithmetic. */
+    return (ir->o == IR_ALOAD || (ir->o >= IR_ADD && ir->o <= IR_DIV));
+  return 1;  /* Constant, invariant or forwarded load. */
+}
+
+/* Check the snapshot entries. */
+static int vec_checksnap(jit_State *J, VecState *vs, SnapShot *snap, int body)
+{
+  SnapEntry *map = &J->cur.snapmap[snap->mapofs];
+  MSize n, nent = snap->nent;
+  for (n = 0; n < nent; n++) {
+    IRRef ref = snap_ref(map[n]);
+    if (!irref_isk(ref) && (vec_isphi(vs, ref) ||
+	(body && ref > vs->loop && ref != vs->inc)))
+      return 0;
+  }
+  return 1;
+}
+
+/* Check whether the loop body is eligible for vectorization. */
+static int vec_check(jit_State *J, VecState *vs)
+{
+  SnapShot *snap = &J->cur.snap[J->cur.nsnap-1];
+  IRRef ref;
+  IRIns *ir;
+  MSize i, j;
+  int stored = 0;
+  /* Check the PHIs. */
+  for (ref = J->cur.nins-1; (ir = IR(ref))->o == IR_PHI; ref--) {
+    IRIns *irr = IR(ir->op2);
+    if (irt_isint(ir->t)) {
+      if (vs->idx || irr->o != IR_ADD || irr->op1 != ir->op1 ||
+	  !irref_isk(irr->op2) || IR(irr->op2)->o != IR_KINT ||
+	  IR(irr->op2)->i != 1)
+	return 0;
+      vs->idx = ir->op1;
+      vs->inc = ir->op2;
+    } else if (irt_isnum(ir->t)) {
+      if (irr->o != IR_ALOAD || ir->op2 < vs->loop || vs->nphi >= VEC_MAXPHI)
+	return 0;
+      vs->phi[vs->nphi++] = ir->op1;
+    } else {
+      return 0;
+    }
+  }
+  /* Check the loop end guard. */
+  vs->guard = ref;
+  if (!vs->idx || ir->o != IR_LE || !irt_isguard(ir->t) ||
+      !irt_isint(ir->t) || ir->op1 != vs->inc || ir->op2 > vs->loop)
+    return 0;
+  vs->stop = ir->op2;
+  /* Only the loop end guard may have a snapshot in the loop body. */
+  if (snap->ref != vs->guard || snap[-1].ref > vs->loop ||
+      !vec_checksnap(J, vs, snap, 1) || !vec_checksnap(J, vs, snap-1, 0))
+    return 0;
+  /* Forwarded loads are reloaded before all other loads. */
+  for (ref = J->cur.nins-1; (ir = IR(ref))->o == IR_PHI; ref--)
+    if (irt_isnum(ir->t)) {
+      if (!vec_addmem(J, vs, IR(ir->op2)->op1, 0))
+	return 0;
+      vs->mem[vs->nmem-1].ofs--;  /* Element of the previous iteration. */
+    }
+  /* Check the loop body. */
+  for (ref = vs->loop+1; ref < vs->guard; ref++) {
+    int32_t ofs;
+    ir = IR(ref);
+    switch (ir->o) {
+    case IR_AREF:
+      break;  /* Checked by the load or store. */
+    case IR_ALOAD:
+      if (!irt_isnum(ir->t) || stored || !vec_addmem(J, vs, ir->op1, 0))
+	return 0;
+      break;
+    case IR_ASTORE:
+      if (!irt_isnum(ir->t) || !vec_checkop(J, vs, ir->op2) ||
+	  !vec_addmem(J, vs, ir->op1, 1))
+	return 0;
+      stored = 1;
+      break;
+    case IR_ADD: case IR_SUB: case IR_MUL: case IR_DIV:
+      if (irt_isnum(ir->t)) {
+	if (!vec_checkop(J, vs, ir->op1) || !vec_checkop(J, vs, ir->op2))
+	  return 0;
+      } else if (!vec_index(J, vs, ir, ref, &ofs)) {
+	return 0;
+      }
+      break;
+    default:
+      return 0;
+    }
+  }
+  /* Check for stores affecting a load or store of the next iteration. */
+  for (i = 0; i < vs->nmem; i++) {
+    VecMem *ma = &vs->mem[i];
+    for (j = i+1; j < vs->nmem; j++) {
+      VecMem *mb = &vs->mem[j];
+      if ((ma->store || mb->store) && mb->ofs == ma->ofs+1) {
+	MSize k;
+	if (ma->base == mb->base)
+	  return 0;  /* Loop-carried dependency. */
+	for (k = 0; k < vs->nalias; k++)
+	  if ((vs->alias[k][0] == ma->base && vs->alias[k][1] == mb->base) ||
+	      (vs->alias[k][0] == mb->base && vs->alias[k][1] == ma->base))
+	    break;
+	if (k == vs->nalias) {
+	  if (vs->nalias >= VEC_MAXALIAS)
+	    return 0;
+	  vs->alias[k][0] = ma->base;
+	  vs->alias[k][1] = mb->base;
+	  vs->nalias++;
+	}
+      }
+    }
+  }
+  return 1;
+}
+
+/* -- Code generation ----------------------------------------------------- */
+
+/* Get the index plus a constant offset. Emitted on first use. */
+static IRRef vec_idxref(jit_State *J, VecState *vs, int32_t ofs)
+{
+  MSize i;
+  IRRef ref;
+  if (ofs == 0)
+    return vs->idx;
+  for (i = 0; i < vs->nofs; i++)
+    if (vs->ofs[i] == ofs)
+      return vs->ofsref[i];
+  ref = tref_ref(emitir_raw(IRTI(IR_ADD), vs->idx, lj_ir_kint(J, ofs)));
+  vs->ofs[vs->nofs] = ofs;
+  vs->ofsref[vs->nofs++] = (IRRef1)ref;
+  return ref;
+}
+
+/* Splat an invariant operand into both halves of a register. */
+static void vec_splat(jit_State *J, VecState *vs, IRRef1 *subst, IRRef ref)
+{
+  if (ref < vs->loop && !vec_isphi(vs, ref) && !subst[ref])
+    subst[ref] = (IRRef1)tref_ref(emitir_raw(IRT(IR_SPLAT, IRT_V2NUM),
+					     ref, 0));
+}
+
+/* Re-emit the loop body with packed instructions. */
+static void vec_emit(jit_State *J, VecState *vs, IRIns *body, IRRef1 *subst)
+{
+  IRRef loop = vs->loop, ref, inc2;
+  SnapShot *snap;
+  SnapEntry *map;
+  MSize i, n, nent;
+  lj_ir_rollback(J, loop);
+  /* Check that different arrays do not alias. */
+  for (i = 0; i < vs->nalias; i++)
+    emitir_raw(IRTG(IR_NE, IRT_PTR), vs->alias[i][0], vs->alias[i][1]);
+  /* Splat all invariant operands before the loop. */
+  for (ref = loop+1; ref < vs->guard; ref++) {
+    IRIns *ir = &body[ref-loop];
+    if (irt_isnum(ir->t) && ir->o != IR_ALOAD) {
+      if (ir->o != IR_ASTORE)
+	vec_splat(J, vs, subst, ir->op1);
+      vec_splat(J, vs, subst, ir->op2);
+    }
+  }
+  J->loopref = tref_ref(emitir_raw(IRTG(IR_LOOP, IRT_NIL), 0, 0));
+  /* Leave the loop if less than two iterations remain. */
+  emitir_raw(IRTGI(IR_LT), vs->idx, vs->stop);
+  /* Reload the forwarded values. No type check needed: the first element
+  ** has been checked by the previous iteration and the second one is checked
+  ** by the load it has been forwarded from, before any store.
+  */
+  for (i = 0; i < vs->nphi; i++) {
+    VecMem *m = &vs->mem[i];
+    IRRef aref = tref_ref(emitir_raw(IRT(IR_AREF, IRT_PTR), m->base,
+				     vec_idxref(J, vs, m->ofs)));
+    subst[vs->phi[i]] = (IRRef1)tref_ref(emitir_raw(IRT(IR_ALOAD, IRT_V2NUM),
+						     aref, 0));
+    irt_clearphi(IR(vs->phi[i])->t);
+  }
+  /* Copy-substitute the loop body. The index offsets are emitted lazily. */
+  for (ref = loop+1; ref < vs->guard; ref++) {
+    IRIns *ir = &body[ref-loop];
+    TRef tr;
+    if (ir->o == IR_AREF) {
+      IRRef iref = ir->op2;
+      int32_t ofs = iref == vs->idx ? 0 : IR(body[iref-loop].op2)->i;
+      tr = emitir_raw(ir->ot, ir->op1, vec_idxref(J, vs, ofs));
+    } else if (irt_isnum(ir->t)) {
+      IRRef op1 = subst[ir->op1], op2 = ir->op2 ? subst[ir->op2] : 0;
+      tr = emitir_raw(IRT(ir->o, (ir->t.irt & IRT_GUARD)|IRT_V2NUM), op1, op2);
+    } else {
+      continue;  /* Index plus offset. */
+    }
+    subst[ref] = (IRRef1)tref_ref(tr);
+  }
+  /* Substitute the index in the loop end snapshot. */
+  inc2 = tref_ref(emitir_raw(IRTI(IR_ADD), vs->idx, lj_ir_kint(J, 2)));
+  snap = &J->cur.snap[J->cur.nsnap-1];
+  map = &J->cur.snapmap[snap->mapofs];
+  nent = snap->nent;
+  for (n = 0; n < nent; n++) {
+    IRRef sref = snap_ref(map[n]);
+    if (sref == vs->inc)
+      map[n] = snap_setref(map[n], inc2);
+    else if (sref == vs->idx)
+      map[n] = snap_setref(map[n], vec_idxref(J, vs, 1));
+  }
+  snap->ref = (IRRef1)J->cur.nins;
+  emitir_raw(IRTGI(IR_LE), inc2, vs->stop);
+  irt_setphi(IR(inc2)->t);
+  emitir_raw(IRTI(IR_PHI), vs->idx, inc2);
+}
+
+/* Vectorize a loop. */
+void lj_opt_vec(jit_State *J)
+{
+  const uint32_t need = (JIT_F_OPT_VEC|JIT_F_OPT_LOOP|JIT_F_SSE2);
+  VecState vs;
+  if ((J->flags & need) != need || !J->loopref)
+    return;
+  memset(&vs, 0, sizeof(VecState));
+  vs.loop = J->loopref;
+  if (vec_check(J, &vs)) {
+    /* Use temp buffer for a copy of the loop body and the substitution
+    ** table. Only refs in [nk,guard) are valid indexes for the latter.
+    ** Caveat: don't call into the VM or run the GC or the buffer may be gone.
+    */
+    IRRef nk = J->cur.nk, nbody = vs.guard - vs.loop;
+    IRIns *body = (IRIns *)lj_str_needbuf(J->L, &G(J->L)->tmpbuf,
+			nbody*sizeof(IRIns) + (vs.guard-nk)*sizeof(IRRef1));
+    IRRef1 *subst = (IRRef1 *)(body + nbody);
+    memcpy(body, IR(vs.loop), nbody*sizeof(IRIns));
+    memset(subst, 0, (vs.guard-nk)*sizeof(IRRef1));
+    vec_emit(J, &vs, body, subst - nk);
+  }
+}
+
+#undef IR
+#undef emitir_raw
+
+#endif
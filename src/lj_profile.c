@@ -0,0 +1,260 @@
+/*
+** Low-overhead sampling profiler.
+** Copyright (C) 2005-2010 Mike Pall. See Copyright Notice in luajit.h
+*/
+
+#define lj_profile_c
+#define LUA_CORE
+
+/* To get REG_RIP/REG_EIP. Must be defined before any system includes. */
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif
+
+#include "lj_obj.h"
+
+#if LJ_HASPROFILE
+
+#include <signal.h>
+#include <sys/time.h>
+#if LJ_TARGET_LINUX
+#include <ucontext.h>
+#endif
+
+#include "lj_frame.h"
+#include "lj_dispatch.h"
+#if LJ_HASJIT
+#include "lj_jit.h"
+#include "lj_ir.h"
+#endif
+#include "lj_profile.h"
+
+/* A timer signal (SIGPROF) takes a sample of the VM state. Nothing else
+** may be done in the signal handler. It queues the sample and sets the
+** profile hook, which makes the interpreter call back at the start of the
+** next instruction. Samples taken while compiled code is running are
+** delivered after the trace exits. Their machine code address is mapped
+** to a snapshot of the trace to recover the prototype and line.
+*/
+
+#define PROFILE_MAXPEND		256	/* Max. number of queued samples. */
+
+/* Queued sample. */
+typedef struct ProfileSample {
+  int vmstate;			/* VM state or trace number. */
+  uintptr_t ip;			/* Interrupted machine code address. */
+} ProfileSample;
+
+/* Profiler state. */
+typedef struct ProfileState {
+  global_State *g;		/* VM state that started the profiler. */
+  lj_profile_callback cb;	/* Profiler callback. */
+  void *data;			/* Profiler callback data. */
+  uintptr_t cbip;		/* Machine code address for current callback. */
+  volatile int samples;		/* Number of samples for next callback. */
+  volatile MSize npend;		/* Number of queued samples. */
+  ProfileSample pend[PROFILE_MAXPEND];  /* Queue. Overflow goes to last. */
+  struct sigaction oldsa;	/* Previous SIGPROF state. */
+} ProfileState;
+
+/* Signals are per process, so there's only a single profiler. */
+static ProfileState profile_state;
+
+/* -- Signal handling ----------------------------------------------------- */
+
+/* Get the interrupted machine code address. */
+static uintptr_t profile_ip(void *ctx)
+{
+#if LJ_TARGET_LINUX && LJ_TARGET_X64
+  return (uintptr_t)((ucontext_t *)ctx)->uc_mcontext.gregs[REG_RIP];
+#elif LJ_TARGET_LINUX && LJ_TARGET_X86
+  return (uintptr_t)((ucontext_t *)ctx)->uc_mcontext.gregs[REG_EIP];
+#else
+  UNUSED(ctx);
+  return 0;  /* Unknown. Trace samples map to the first snapshot. */
+#endif
+}
+
+static void profile_signal(int sig, siginfo_t *si, void *ctx)
+{
+  ProfileState *ps = &profile_state;
+  global_State *g = ps->g;
+  uint8_t mask = g->hookmask;
+  MSize n = ps->npend;
+  UNUSED(sig); UNUSED(si);
+  if ((mask & HOOK_VMEVENT))
+    return;  /* Don't sample the profiler callback or other VM handlers. */
+  ps->samples++;
+  if (n < PROFILE_MAXPEND) {
+    ps->pend[n].vmstate = g->vmstate;
+    ps->pend[n].ip = profile_ip(ctx);
+    ps->npend = n+1;
+  }
+  if (!(mask & HOOK_PROFILE)) {  /* Set profile hook. */
+    g->hookmask = (uint8_t)(mask | HOOK_PROFILE);
+    lj_dispatch_update(g);
+  }
+}
+
+/* Block or unblock the timer signal around updates of the pending samples. */
+static void profile_lock(sigset_t *old)
+{
+  sigset_t set;
+  sigemptyset(&set);
+  sigaddset(&set, SIGPROF);
+  sigprocmask(SIG_BLOCK, &set, old);
+}
+
+#define profile_unlock(old)	sigprocmask(SIG_SETMASK, (old), NULL)
+
+static void profile_timer(int interval)
+{
+  struct itimerval tm;
+  tm.it_value.tv_sec = tm.it_interval.tv_sec = interval / 1000;
+  tm.it_value.tv_usec = tm.it_interval.tv_usec = (interval % 1000) * 1000;
+  setitimer(ITIMER_PROF, &tm, NULL);
+}
+
+/* -- Profiler callback --------------------------------------------------- */
+
+/* Deliver queued samples. Called by the interpreter with HOOK_PROFILE. */
+void LJ_FASTCALL lj_profile_interpreter(lua_State *L)
+{
+  ProfileState *ps = &profile_state;
+  global_State *g = G(L);
+  ProfileSample pend[PROFILE_MAXPEND];
+  sigset_t old;
+  MSize i, n;
+  int samples;
+  profile_lock(&old);
+  n = ps->npend;
+  samples = ps->samples;
+  memcpy(pend, ps->pend, n*sizeof(ProfileSample));
+  ps->npend = 0;
+  ps->samples = 0;
+  g->hookmask &= ~HOOK_PROFILE;
+  lj_dispatch_update(g);
+  profile_unlock(&old);
+  if (n > 0 && ps->g == g) {
+    uint8_t oldh = hook_save(g);
+    hook_vmevent(g);  /* No hooks, no recording and no samples in callback. */
+    for (i = 0; i < n && ps->g == g; i++) {
+      ps->cbip = pend[i].ip;
+      ps->cb(ps->data, L, i == n-1 ? samples-(int)i : 1, pend[i].vmstate);
+    }
+    hook_restore(g, oldh);
+    setvmstate(g, INTERP);
+  }
+}
+
+/* Map the machine code address of a trace sample to the frames inside the
+** trace. Fills in up to max prototypes and PCs, innermost frame first.
+** The PC is ~0 if it can't be recovered. Returns the number of frames.
+*/
+MSize lj_profile_traceframes(lua_State *L, int vmstate, GCproto **pts,
+			     BCPos *pos, MSize max)
+{
+#if LJ_HASJIT
+  jit_State *J = G2J(G(L));
+  GCtrace *T;
+  if (vmstate > 0 && (MSize)vmstate < J->sizetrace &&
+      (T = traceref(J, vmstate)) != NULL) {
+    uintptr_t ofs = profile_state.cbip - (uintptr_t)T->mcode;
+    SnapShot *snap = &T->snap[0];
+    SnapEntry *map, *flinks, *flim;
+    GCproto *frpt[256];
+    const BCIns *pc;
+    MSize n, nfr = 1, nf = 0;
+    int merge = 0;
+    if (ofs < T->szmcode) {  /* Snapshot mcode offsets are ascending. */
+      SnapNo i;
+      for (i = 1; i < T->nsnap && T->snap[i].mcofs <= ofs; i++)
+	snap = &T->snap[i];
+    }
+    map = &T->snapmap[snap->mapofs];
+    flinks = map + snap->nent + 1;
+    flim = flinks + snap->depth;
+    frpt[0] = gco2pt(gcref(T->startpt));
+    for (n = 0; n < snap->nent; n++) {  /* Collect frames, ascending. */
+      SnapEntry sn = map[n];
+      if (snap_isframe(sn)) {
+	IRIns *ir = &T->ir[snap_ref(sn)];
+	GCproto *pt = NULL;
+	if (ir->o == IR_KGC && isluafunc(ir_kfunc(ir)))
+	  pt = funcproto(ir_kfunc(ir));
+	else if (ir->o == IR_FNEW)  /* Closure created on the trace. */
+	  pt = gco2pt(ir_kgc(&T->ir[ir->op1]));
+	if (snap_slot(sn) == 0) frpt[0] = pt; else frpt[nfr++] = pt;
+      }
+    }
+    pc = snap_pc(map[snap->nent]);
+    while (nfr > 0 && nf < max) {  /* Walk the frame links, innermost first. */
+      GCproto *pt = frpt[--nfr];
+      SnapEntry ftsz;
+      if (!pt) break;
+      if (!merge) {
+	pts[nf] = pt;
+	pos[nf++] = (pc && pc > proto_bc(pt) && pc <= proto_bc(pt)+pt->sizebc) ?
+		    proto_bcpos(pt, pc) - 1 : ~(BCPos)0;
+      }
+      merge = 0;
+      if (nfr == 0 || flinks >= flim) break;
+      ftsz = *flinks++;
+      if ((ftsz & FRAME_TYPE) == FRAME_LUA) {  /* Link is the caller PC. */
+	pc = snap_pc(ftsz);
+      } else if ((ftsz & FRAME_TYPE) == FRAME_CONT && flinks < flim) {
+	pc = snap_pc(*flinks++);  /* Continuation links hold the caller PC. */
+      } else {
+	pc = NULL;
+	merge = ((ftsz & FRAME_TYPE) == FRAME_VARG);  /* Frame is copied up. */
+      }
+    }
+    return nf;
+  }
+#else
+  UNUSED(L); UNUSED(vmstate); UNUSED(pts); UNUSED(pos); UNUSED(max);
+#endif
+  return 0;
+}
+
+/* -- Public profiling API ------------------------------------------------ */
+
+/* Start profiling with a sample interval in milliseconds. */
+int lj_profile_start(lua_State *L, int interval, lj_profile_callback cb,
+		     void *data)
+{
+  ProfileState *ps = &profile_state;
+  struct sigaction sa;
+  if (ps->g) {
+    if (ps->g != G(L)) return 0;  /* Already running for another VM. */
+    lj_profile_stop(L);
+  }
+  if (interval <= 0) interval = 1;
+  ps->g = G(L);
+  ps->cb = cb;
+  ps->data = data;
+  ps->samples = 0;
+  ps->npend = 0;
+  sa.sa_flags = SA_RESTART | SA_SIGINFO;
+  sa.sa_sigaction = profile_signal;
+  sigemptyset(&sa.sa_mask);
+  sigaction(SIGPROF, &sa, &ps->oldsa);
+  profile_timer(interval);
+  return 1;
+}
+
+/* Stop profiling. Pending samples are dropped. */
+void lj_profile_stop(lua_State *L)
+{
+  ProfileState *ps = &profile_state;
+  global_State *g = ps->g;
+  if (g == G(L)) {
+    profile_timer(0);
+    sigaction(SIGPROF, &ps->oldsa, NULL);
+    g->hookmask &= ~HOOK_PROFILE;
+    lj_dispatch_update(g);
+    ps->g = NULL;
+  }
+}
+
+#endif
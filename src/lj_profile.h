@@ -0,0 +1,26 @@
+/*
+** Low-overhead sampling profiler.
+** Copyright (C) 2005-2010 Mike Pall. See Copyright Notice in luajit.h
+*/
+
+#ifndef _LJ_PROFILE_H
+#define _LJ_PROFILE_H
+
+#include "lj_obj.h"
+
+#if LJ_HASPROFILE
+
+/* Profiler callback. Called at a safe point in the interpreter. */
+typedef void (*lj_profile_callback)(void *data, lua_State *L,
+				    int samples, int vmstate);
+
+LJ_FUNC void LJ_FASTCALL lj_profile_interpreter(lua_State *L);
+LJ_FUNC int lj_profile_start(lua_State *L, int interval,
+			     lj_profile_callback cb, void *data);
+LJ_FUNC void lj_profile_stop(lua_State *L);
+LJ_FUNC MSize lj_profile_traceframes(lua_State *L, int vmstate,
+				     GCproto **pts, BCPos *pos, MSize max);
+
+#endif
+
+#endif
@@ -27,6 +27,8 @@
 #include "lj_asm.h"
 #include "lj_dispatch.h"
 #include "lj_vm.h"
+#include "lj_target.h"
+#include "lj_char.h"
 
 /* Some local macros to save typing. Undef'd at the end. */
 #define IR(ref)			(&J->cur.ir[(ref)])
@@ -123,6 +125,9 @@ static void rec_check_slots(jit_State *J)
 	lua_assert(ir_kptr(ir) == gcrefp(tv->gcr, void));
 	lua_assert((J->slot[s+1] & TREF_FRAME));
 	depth++;
+      } else if ((tr & TREF_KEYINDEX)) {
+	lua_assert(tvisnil(tv) && tref_isinteger(tr));
+	if (tref_isk(tr)) lua_assert(tv->u32.lo == (uint32_t)ir->i);
       } else {
 	if (tvisnum(tv))
 	  lua_assert(tref_isnumber(tr));  /* Could be IRT_INT etc., too. */
@@ -218,7 +223,7 @@ static void canonicalize_slots(jit_State *J)
   BCReg s;
   for (s = J->baseslot+J->maxslot-1; s >= 1; s--) {
     TRef tr = J->slot[s];
-    if (tref_isinteger(tr)) {
+    if (tref_isinteger(tr) && !(tr & TREF_KEYINDEX)) {
       IRIns *ir = IR(tref_ref(tr));
       if (!(ir->o == IR_SLOAD && (ir->op2 & IRSLOAD_READONLY)))
 	J->slot[s] = emitir(IRTN(IR_TONUM), tr, 0);
@@ -412,6 +417,111 @@ static LoopEvent rec_iterl(jit_State *J, const BCIns iterins)
   }
 }
 
+/* Record ISNEXT: check that pairs() returned next() for a plain traversal. */
+static void rec_isnext(jit_State *J, BCReg ra)
+{
+  cTValue *b = &J->L->base[ra-3];
+  if (tvisfunc(b) && funcV(b)->c.ffid == FF_next_N &&
+      tvistab(b+1) && tvisnil(b+2)) {
+    emitir(IRTG(IR_EQ, IRT_FUNC), getslot(J, ra-3), lj_ir_kfunc(J, funcV(b)));
+    (void)getslot(J, ra-2);  /* Specialize to a table. */
+    (void)getslot(J, ra-1);  /* Specialize to nil. */
+    J->base[ra-1] = lj_ir_kint(J, 0) | TREF_KEYINDEX;
+  } else {  /* The interpreter despecializes ISNEXT and ITERN. */
+    setintV(&J->errinfo, (int32_t)BC_ISNEXT);
+    lj_trace_err_info(J, LJ_TRERR_NYIBC);
+  }
+}
+
+/* Record the lookup of the next non-nil table slot for a traversal index.
+**
+** Indexes below asize point to the array part, the rest to the hash part.
+** The empty slots are skipped by a call to lj_tab_nexti(). The recorded
+** path depends only on the part holding the next slot and the key and value
+** types, so a traversal of a table with holes doesn't spawn side traces.
+** The found index is guarded against the current asize and hmask of the
+** table. Returns 0 at the end of the traversal, otherwise sets kv[0..2] to
+** the key, the value and the index of the slot.
+*/
+static int rec_nextslot(jit_State *J, GCtab *t, uint32_t i,
+			TRef tab, TRef idx, TRef *kv)
+{
+  uint32_t j = lj_tab_nexti(t, i);  /* Runtime index of next slot. */
+  TRef asize = emitir(IRTI(IR_FLOAD), tab, IRFL_TAB_ASIZE);
+  TRef nidx = lj_ir_call(J, IRCALL_lj_tab_nexti, tab, idx);
+  TRef key, val;
+  if (j < t->asize) {  /* Slot in array part. */
+    IRType tv = itype2irt(arrayslot(t, j));
+    TRef arrayref = emitir(IRT(IR_FLOAD, IRT_PTR), tab, IRFL_TAB_ARRAY);
+    emitir(IRTGI(IR_ABC), asize, nidx);
+    val = emitir(IRTG(IR_ALOAD, tv), emitir(IRT(IR_AREF, IRT_PTR),
+					  arrayref, nidx), 0);
+    if (irtype_ispri(tv)) val = TREF_PRI(tv);
+    key = emitir(IRTN(IR_TONUM), nidx, 0);
+  } else {  /* Slot in hash part or end of traversal. */
+    uint32_t h = j - t->asize;
+    TRef hmask, hkey, nref;
+    IRType tv, tk;
+    Node *n;
+    emitir(IRTGI(IR_ULE), asize, nidx);  /* Inv. bounds check. */
+    hmask = emitir(IRTI(IR_FLOAD), tab, IRFL_TAB_HMASK);
+    hkey = emitir(IRTI(IR_SUB), nidx, asize);
+    if (h > t->hmask) {  /* End of traversal. */
+      emitir(IRTGI(IR_UGT), hkey, hmask);
+      return 0;
+    }
+    emitir(IRTGI(IR_ULE), hkey, hmask);
+    n = &noderef(t->node)[h];
+    tv = itype2irt(&n->val);
+    tk = itype2irt(&n->key);
+    nref = emitir(IRT(IR_NREF, IRT_PTR),
+		  emitir(IRT(IR_FLOAD, IRT_PTR), tab, IRFL_TAB_NODE), hkey);
+    val = emitir(IRTG(IR_HLOAD, tv), nref, 0);
+    if (irtype_ispri(tv)) val = TREF_PRI(tv);
+    key = emitir(IRTG(IR_HKLOAD, tk), nref, 0);
+    if (irtype_ispri(tk)) key = TREF_PRI(tk);
+  }
+  kv[0] = key;
+  kv[1] = val;
+  kv[2] = nidx;
+  return 1;
+}
+
+/* Record ITERN: inlined next() for the table traversal of pairs().
+**
+** The control var holds the traversal index as an integer with a nil tag.
+** It's advanced past the slot found by rec_nextslot().
+*/
+static LoopEvent rec_itern(jit_State *J, BCReg ra)
+{
+  GCtab *t = tabV(&J->L->base[ra-2]);
+  uint32_t i = J->L->base[ra-1].u32.lo;  /* Runtime traversal index. */
+  TRef tab = getslot(J, ra-2);
+  TRef idx = J->base[ra-1];
+  TRef kv[3];
+  if (!idx) {
+    idx = sloadt(J, (int32_t)(ra-1), IRT_INT|IRT_GUARD,
+		 IRSLOAD_TYPECHECK|IRSLOAD_KEYINDEX);
+  } else if (!(idx & TREF_KEYINDEX)) {
+    setintV(&J->errinfo, (int32_t)BC_ITERN);
+    lj_trace_err_info(J, LJ_TRERR_NYIBC);
+  }
+  if (rec_nextslot(J, t, i, tab, idx, kv)) {  /* Looping back? */
+    J->base[ra-1] = emitir(IRTI(IR_ADD), kv[2], lj_ir_kint(J, 1)) |
+		    TREF_KEYINDEX;
+    J->base[ra] = kv[0];
+    J->base[ra+1] = kv[1];
+    J->maxslot = ra-1+bc_b(J->pc[0]);
+    J->pc += bc_j(J->pc[1])+2;
+    J->needsnap = 1;
+    return LOOPEV_ENTER;
+  } else {
+    J->maxslot = ra-3;
+    J->pc += 2;
+    return LOOPEV_LEAVE;
+  }
+}
+
 /* Record LOOP/JLOOP. Now, that was easy. */
 static LoopEvent rec_loop(jit_State *J, BCReg ra)
 {
@@ -467,10 +577,10 @@ static void rec_loop_interp(jit_State *J, const BCIns *pc, LoopEvent ev)
 /* Handle the case when an already compiled loop op is hit. */
 static void rec_loop_jit(jit_State *J, TraceNo lnk, LoopEvent ev)
 {
-  if (J->parent == 0) {  /* Root trace hit an inner loop. */
+  if (J->parent == 0 && J->retdepth == 0) {  /* Root trace hit inner loop. */
     /* Better let the inner loop spawn a side trace back here. */
     lj_trace_err(J, LJ_TRERR_LINNER);
-  } else if (ev != LOOPEV_LEAVE) {  /* Side trace enters a compiled loop. */
+  } else if (ev != LOOPEV_LEAVE) {  /* Trace enters a compiled loop. */
     J->instunroll = 0;  /* Cannot continue across a compiled loop op. */
     if (J->pc == J->startpc && J->framedepth + J->retdepth == 0)
       lnk = J->cur.traceno;  /* Can form an extra loop. */
@@ -478,6 +588,20 @@ static void rec_loop_jit(jit_State *J, TraceNo lnk, LoopEvent ev)
   }  /* Side trace continues across a loop that's left or not entered. */
 }
 
+/* Handle the case when a root trace, which has returned to a frame below
+** its start frame, hits a loop op. The loop is not part of the trace, so
+** stop before recording the loop op and let the interpreter run it. The
+** loop gets its own root trace once it gets hot.
+*/
+static int rec_loop_lower(jit_State *J)
+{
+  if (J->parent == 0 && J->retdepth > 0) {
+    rec_stop(J, TRACE_INTERP);
+    return 1;
+  }
+  return 0;
+}
+
 /* -- Record calls and returns -------------------------------------------- */
 
 /* Record call setup. */
@@ -500,9 +624,16 @@ static void rec_call_setup(jit_State *J, BCReg func, ptrdiff_t nargs)
     functv = &ix.mobjv;
   }
 
-  /* Specialize to the runtime value of the called function. */
-  trfunc = lj_ir_kfunc(J, funcV(functv));
-  emitir(IRTG(IR_EQ, IRT_FUNC), fbase[0], trfunc);
+  if (!tref_isk(fbase[0]) && IR(tref_ref(fbase[0]))->o == IR_FNEW) {
+    /* A new closure is already specialized to its (constant) prototype. */
+    lua_assert(ir_kgc(IR(IR(tref_ref(fbase[0]))->op1)) ==
+	       obj2gco(funcproto(funcV(functv))));
+    trfunc = fbase[0];
+  } else {
+    /* Specialize to the runtime value of the called function. */
+    trfunc = lj_ir_kfunc(J, funcV(functv));
+    emitir(IRTG(IR_EQ, IRT_FUNC), fbase[0], trfunc);
+  }
   fbase[0] = trfunc | TREF_FRAME;
   J->maxslot = (BCReg)nargs;
 }
@@ -560,6 +691,46 @@ static int check_downrec_unroll(jit_State *J, GCproto *pt)
   return 0;
 }
 
+/* Check whether a root trace may return to a frame below its start frame.
+** Traces starting at a function entry or a return may continue in the
+** lower frame, but returning from a loop would leave the loop.
+*/
+static void check_ret_lower(jit_State *J)
+{
+  BCOp op = bc_op(J->cur.startins);
+  if (J->parent == 0 && !bc_isret(op) && op != BC_FUNCF)
+    lj_trace_err(J, LJ_TRERR_LLEAVE);
+}
+
+/* Record return from a pcall or vararg frame. Returns the new result base. */
+static BCReg rec_ret_delta(jit_State *J, TValue *frame, BCReg rbase,
+			   ptrdiff_t gotresults)
+{
+  BCReg cbase = (BCReg)frame_delta(frame);
+  if (J->framedepth > 0) {  /* Return to a frame that is part of the trace. */
+    J->framedepth--;
+    lua_assert(J->baseslot > cbase);
+    J->baseslot -= cbase;
+    J->base -= cbase;
+  } else {  /* Return to lower frame. Guard for the frame link. */
+    check_ret_lower(J);
+    if (J->pt && frame == J->L->base - 1)
+      lj_snap_add(J);
+    /* The BASE adjustment is only committed by the following RETF. */
+    emitir(IRTG(IR_RETF, IRT_PTR), TREF_NIL,
+	   lj_ir_kint(J, (int32_t)frame_ftsz(frame)));
+    J->retdepth++;
+    J->needsnap = 1;
+    J->cur.retlower = 1;
+    lua_assert(J->baseslot == 1);
+    /* Shift result slots up and clear the slots of the frame below. */
+    memmove(J->base + rbase + cbase, J->base + rbase,
+	    sizeof(TRef)*(size_t)gotresults);
+    memset(J->base-1, 0, sizeof(TRef)*(rbase+cbase+1));
+  }
+  return rbase + cbase;
+}
+
 /* Record return. */
 static void rec_ret(jit_State *J, BCReg rbase, ptrdiff_t gotresults)
 {
@@ -567,26 +738,13 @@ static void rec_ret(jit_State *J, BCReg rbase, ptrdiff_t gotresults)
   ptrdiff_t i;
   for (i = 0; i < gotresults; i++)
     getslot(J, rbase+i);  /* Ensure all results have a reference. */
-  while (frame_ispcall(frame)) {  /* Immediately resolve pcall() returns. */
-    BCReg cbase = (BCReg)frame_delta(frame);
-    if (--J->framedepth < 0)
-      lj_trace_err(J, LJ_TRERR_NYIRETL);
-    lua_assert(J->baseslot > 1);
-    gotresults++;
-    rbase += cbase;
-    J->baseslot -= (BCReg)cbase;
-    J->base -= cbase;
-    J->base[--rbase] = TREF_TRUE;  /* Prepend true to results. */
-    frame = frame_prevd(frame);
-  }
-  if (frame_isvarg(frame)) {
-    BCReg cbase = (BCReg)frame_delta(frame);
-    if (--J->framedepth < 0)  /* NYI: return of vararg func to lower frame. */
-      lj_trace_err(J, LJ_TRERR_NYIRETL);
-    lua_assert(J->baseslot > 1);
-    rbase += cbase;
-    J->baseslot -= (BCReg)cbase;
-    J->base -= cbase;
+  /* Immediately resolve pcall() returns and returns from vararg funcs. */
+  while (frame_ispcall(frame) || frame_isvarg(frame)) {
+    rbase = rec_ret_delta(J, frame, rbase, gotresults);
+    if (frame_ispcall(frame)) {
+      gotresults++;
+      J->base[--rbase] = TREF_TRUE;  /* Prepend true to results. */
+    }
     frame = frame_prevd(frame);
   }
   if (frame_islua(frame)) {  /* Return to Lua frame. */
@@ -610,15 +768,15 @@ static void rec_ret(jit_State *J, BCReg rbase, ptrdiff_t gotresults)
       lua_assert(J->baseslot > cbase+1);
       J->baseslot -= cbase+1;
       J->base -= cbase+1;
-    } else if (J->parent == 0 && !bc_isret(bc_op(J->cur.startins))) {
-      /* Return to lower frame would leave the loop in a root trace. */
-      lj_trace_err(J, LJ_TRERR_LLEAVE);
     } else {  /* Return to lower frame. Guard for the target we return to. */
-      TRef trpt = lj_ir_kgc(J, obj2gco(pt), IRT_PROTO);
-      TRef trpc = lj_ir_kptr(J, (void *)frame_pc(frame));
+      TRef trpt, trpc;
+      check_ret_lower(J);
+      trpt = lj_ir_kgc(J, obj2gco(pt), IRT_PROTO);
+      trpc = lj_ir_kptr(J, (void *)frame_pc(frame));
       emitir(IRTG(IR_RETF, IRT_PTR), trpt, trpc);
       J->retdepth++;
       J->needsnap = 1;
+      J->cur.retlower = 1;
       lua_assert(J->baseslot == 1);
       /* Shift result slots up and clear the slots of the new frame below. */
       memmove(J->base + cbase, J->base-1, sizeof(TRef)*nresults);
@@ -627,20 +785,43 @@ static void rec_ret(jit_State *J, BCReg rbase, ptrdiff_t gotresults)
   } else if (frame_iscont(frame)) {  /* Return to continuation frame. */
     ASMFunction cont = frame_contf(frame);
     BCReg cbase = (BCReg)frame_delta(frame);
-    if ((J->framedepth -= 2) < 0)
-      lj_trace_err(J, LJ_TRERR_NYIRETL);
-    J->baseslot -= (BCReg)cbase;
-    J->base -= cbase;
+    TRef tr = gotresults ? J->base[rbase] : TREF_NIL;
+    if (J->framedepth >= 2) {  /* Return to a frame that is part of the trace. */
+      J->framedepth -= 2;
+      J->baseslot -= (BCReg)cbase;
+      J->base -= cbase;
+    } else {  /* Return to lower frame. Guard for the frame link. */
+      if (J->framedepth != 0 || (cont == lj_cont_cat &&
+	  bc_b(*(frame_contpc(frame)-1)) != cbase-2))
+	lj_trace_err(J, LJ_TRERR_NYIRETL);  /* NYI: continue concatenation. */
+      check_ret_lower(J);
+      if (J->pt && frame == J->L->base - 1)
+	lj_snap_add(J);
+      /* The PC of the continuation determines its function and delta. */
+      emitir(IRTG(IR_RETF, IRT_PTR),
+	     lj_ir_kptr(J, (void *)frame_contpc(frame)),
+	     lj_ir_kint(J, (int32_t)frame_ftsz(frame)));
+      J->retdepth++;
+      J->needsnap = 1;
+      J->cur.retlower = 1;
+      lua_assert(J->baseslot == 1);
+      /* Clear the slots of the frame below. */
+      memset(J->base-1, 0, sizeof(TRef)*(cbase+1));
+    }
     J->maxslot = cbase-2;
     if (cont == lj_cont_ra) {
       /* Copy result to destination slot. */
       BCReg dst = bc_a(*(frame_contpc(frame)-1));
-      J->base[dst] = gotresults ? J->base[cbase+rbase] : TREF_NIL;
+      J->base[dst] = tr;
       if (dst >= J->maxslot) J->maxslot = dst+1;
     } else if (cont == lj_cont_nop) {
       /* Nothing to do here. */
     } else if (cont == lj_cont_cat) {
-      lua_assert(0);
+      /* Only a __concat of the last two operands is recorded (see rec_cat). */
+      BCReg dst = bc_a(*(frame_contpc(frame)-1));
+      lua_assert(bc_b(*(frame_contpc(frame)-1)) == J->maxslot);
+      J->base[dst] = tr;
+      if (dst >= J->maxslot) J->maxslot = dst+1;
     } else {
       /* Result type already specialized. */
       lua_assert(cont == lj_cont_condf || cont == lj_cont_condt);
@@ -656,7 +837,8 @@ static void rec_ret(jit_State *J, BCReg rbase, ptrdiff_t gotresults)
 /* Prepare to record call to metamethod. */
 static BCReg rec_mm_prep(jit_State *J, ASMFunction cont)
 {
-  BCReg s, top = curr_proto(J->L)->framesize;
+  BCReg s, top = cont == lj_cont_cat ? J->maxslot :
+			  curr_proto(J->L)->framesize;
   TRef trcont;
   setcont(&J->L->base[top], cont);
 #if LJ_64
@@ -716,7 +898,7 @@ nocheck:
 static TRef rec_mm_arith(jit_State *J, RecordIndex *ix, MMS mm)
 {
   /* Set up metamethod call first to save ix->tab and ix->tabv. */
-  BCReg func = rec_mm_prep(J, lj_cont_ra);
+  BCReg func = rec_mm_prep(J, mm == MM_concat ? lj_cont_cat : lj_cont_ra);
   TRef *base = J->base + func;
   TValue *basev = J->L->base + func;
   base[1] = ix->tab; base[2] = ix->key;
@@ -738,6 +920,49 @@ ok:
   return 0;  /* No result yet. */
 }
 
+/* Record string concatenation. */
+static TRef rec_cat(jit_State *J, BCReg baseslot, BCReg topslot)
+{
+  TRef *top = &J->base[topslot];
+  BCReg s;
+  lua_assert(baseslot < topslot);
+  for (s = baseslot; s <= topslot; s++)
+    (void)getslot(J, s);  /* Ensure all operands have a reference. */
+  for (s = baseslot; s <= topslot; s++)
+    if (!tref_isnumber_str(J->base[s]))
+      break;
+  if (s > topslot) {  /* Only strings and numbers. */
+    TRef *trp, tr = emitir(IRT(IR_BUFHDR, IRT_PTR),
+			   lj_ir_kptr(J, &J2G(J)->tmpbuf), IRBUFHDR_RESET);
+    for (trp = &J->base[baseslot]; trp <= top; trp++) {
+      TRef tn = *trp;
+      if (tref_isnumber(tn))
+	tn = emitir(IRT(IR_TOSTR, IRT_STR), tn, 0);
+      tr = emitir(IRT(IR_BUFPUT, IRT_PTR), tr, tn);
+    }
+    J->maxslot = baseslot;  /* Operands are temporaries. */
+    return emitir(IRT(IR_BUFSTR, IRT_STR), tr, 0);
+  } else if (baseslot+1 == topslot) {  /* __concat of two operands. */
+    TValue savetv[5];
+    RecordIndex ix;
+    ix.tab = top[-1];
+    ix.key = top[0];
+    copyTV(J->L, &ix.tabv, &J->L->base[baseslot]);
+    copyTV(J->L, &ix.keyv, &J->L->base[topslot]);
+    J->maxslot = baseslot;
+    /* The metamethod frame overlaps the operands, like in lj_meta_cat. */
+    memcpy(savetv, &J->L->base[baseslot], sizeof(savetv));  /* Save slots. */
+    rec_mm_arith(J, &ix, MM_concat);
+    memcpy(&J->L->base[baseslot], savetv, sizeof(savetv));  /* Restore. */
+    return 0;  /* No result yet. */
+  } else {
+    /* NYI: mixed concatenation of strings and objects with __concat. */
+    setintV(&J->errinfo, BC_CAT);
+    lj_trace_err_info(J, LJ_TRERR_NYIBC);
+    return 0;
+  }
+}
+
 /* Call a comparison metamethod. */
 static void rec_mm_callcomp(jit_State *J, RecordIndex *ix, int op)
 {
@@ -862,7 +1087,8 @@ static void rec_idx_abc(jit_State *J, TRef asizeref, TRef ikey, uint32_t asize)
 }
 
 /* Record indexed key lookup. */
-static TRef rec_idx_key(jit_State *J, RecordIndex *ix)
+static TRef rec_idx_key(jit_State *J, RecordIndex *ix, IRRef *rbref,
+		       IRType1 *rbguard)
 {
   TRef key;
   GCtab *t = tabV(&ix->tabv);
@@ -882,6 +1108,8 @@ static TRef rec_idx_key(jit_State *J, RecordIndex *ix)
       asizeref = emitir(IRTI(IR_FLOAD), ix->tab, IRFL_TAB_ASIZE);
       if ((MSize)k < t->asize) {  /* Currently an array key? */
 	TRef arrayref;
+	*rbref = J->cur.nins;  /* Mark possible rollback point. */
+	*rbguard = J->guardemit;
 	rec_idx_abc(J, asizeref, ikey, t->asize);
 	arrayref = emitir(IRT(IR_FLOAD, IRT_PTR), ix->tab, IRFL_TAB_ARRAY);
 	return emitir(IRT(IR_AREF, IRT_PTR), arrayref, ikey);
@@ -913,8 +1141,10 @@ static TRef rec_idx_key(jit_State *J, RecordIndex *ix)
     MSize hslot = (MSize)((char *)ix->oldv - (char *)&noderef(t->node)[0].val);
     if (t->hmask > 0 && hslot <= t->hmask*(MSize)sizeof(Node) &&
 	hslot <= 65535*(MSize)sizeof(Node)) {
-      TRef node, kslot;
-      TRef hm = emitir(IRTI(IR_FLOAD), ix->tab, IRFL_TAB_HMASK);
+      TRef node, kslot, hm;
+      *rbref = J->cur.nins;  /* Mark possible rollback point. */
+      *rbguard = J->guardemit;
+      hm = emitir(IRTI(IR_FLOAD), ix->tab, IRFL_TAB_HMASK);
       emitir(IRTGI(IR_EQ), hm, lj_ir_kint(J, (int32_t)t->hmask));
       node = emitir(IRT(IR_FLOAD, IRT_PTR), ix->tab, IRFL_TAB_NODE);
       kslot = lj_ir_kslot(J, key, hslot / sizeof(Node));
@@ -947,6 +1177,8 @@ static TRef rec_idx(jit_State *J, RecordIndex *ix)
 {
   TRef xref;
   IROp xrefop, loadop;
+  IRRef rbref = 0;
+  IRType1 rbguard;
   cTValue *oldv;
 
   while (!tref_istab(ix->tab)) { /* Handle non-table lookup. */
@@ -991,7 +1223,8 @@ static TRef rec_idx(jit_State *J, RecordIndex *ix)
   }
 
   /* Record the key lookup. */
-  xref = rec_idx_key(J, ix);
+  rbguard.irt = 0;
+  xref = rec_idx_key(J, ix, &rbref, &rbguard);
   xrefop = IR(tref_ref(xref))->o;
   loadop = xrefop == IR_AREF ? IR_ALOAD : IR_HLOAD;
   oldv = ix->oldv;
@@ -1005,6 +1238,10 @@ static TRef rec_idx(jit_State *J, RecordIndex *ix)
     } else {
       res = emitir(IRTG(loadop, t), xref, 0);
     }
+    if (tref_ref(res) < rbref) {  /* Load was forwarded? */
+      lj_ir_rollback(J, rbref);  /* Remove the guards for the key lookup. */
+      J->guardemit = rbguard;
+    }
     if (t == IRT_NIL && ix->idxchain && rec_mm_lookup(J, ix, MM_index))
       goto handlemm;
     if (irtype_ispri(t)) res = TREF_PRI(t);  /* Canonicalize primitives. */
@@ -1117,6 +1354,35 @@ static TRef rec_upvalue(jit_State *J, uint32_t uv, TRef val)
   }
 }
 
+/* Get a pointer to a stack slot of the current frame. */
+static TRef rec_slotptr(jit_State *J, BCReg slot)
+{
+  int32_t ofs = 8*((int32_t)(J->baseslot + slot) - 1);
+  return ofs ? emitir(IRT(IR_ADD, IRT_PTR), REF_BASE, lj_ir_kint(J, ofs)) :
+	       REF_BASE;
+}
+
+/* Record closing of upvalues. */
+static void rec_uclo(jit_State *J, BCReg ra)
+{
+  BCReg s;
+  /* Closing copies the values from the Lua stack. The slots are stored
+  ** from the snapshot right before, so they must hold numbers, not ints.
+  ** The guard prevents merging the snapshot with the next one.
+  */
+  for (s = ra; s < J->maxslot; s++) {
+    TRef tr = J->base[s];
+    if (tref_isinteger(tr) && !(tr & TREF_KEYINDEX)) {
+      IRIns *ir = IR(tref_ref(tr));
+      if (!(ir->o == IR_SLOAD && (ir->op2 & IRSLOAD_READONLY)))
+	J->base[s] = emitir(IRTN(IR_TONUM), tr, 0);
+    }
+  }
+  lj_snap_add(J);
+  emitir(IRTG(IR_UCLO, IRT_NIL), rec_slotptr(J, ra), J->baseslot + ra);
+  J->needsnap = 1;
+}
+
 /* -- Fast function recording handlers ------------------------------------ */
 
 /* Conventions for fast function call handlers:
@@ -1408,6 +1674,39 @@ static void LJ_FASTCALL recff_tostring(jit_State *J, RecordFFData *rd)
   }
 }
 
+static void LJ_FASTCALL recff_next(jit_State *J, RecordFFData *rd)
+{
+  TRef tab = J->base[0];
+  if (tref_istab(tab)) {
+    TRef kv[3];
+    if (J->base[1] && !tref_isnil(J->base[1]))
+      recff_nyiu(J);  /* NYI: traversal from an arbitrary key. */
+    if (rec_nextslot(J, tabV(&rd->argv[0]), 0, tab, lj_ir_kint(J, 0), kv)) {
+      J->base[0] = kv[0];
+      J->base[1] = kv[1];
+      rd->nres = 2;
+    } else {
+      J->base[0] = TREF_NIL;
+    }
+  }  /* else: Interpreter will throw. */
+}
+
+static void LJ_FASTCALL recff_pairs(jit_State *J, RecordFFData *rd)
+{
+#ifdef LUAJIT_ENABLE_LUA52COMPAT
+  if (!recff_metacall(J, rd, MM_pairs))
+#endif
+  {
+    TRef tab = J->base[0];
+    if (tref_istab(tab)) {
+      J->base[0] = lj_ir_kfunc(J, funcV(&J->fn->c.upvalue[0]));
+      J->base[1] = tab;
+      J->base[2] = TREF_NIL;
+      rd->nres = 3;
+    }  /* else: Interpreter will throw. */
+  }
+}
+
 static void LJ_FASTCALL recff_ipairs_aux(jit_State *J, RecordFFData *rd)
 {
   RecordIndex ix;
@@ -1739,6 +2038,211 @@ static void LJ_FASTCALL recff_string_range(jit_State *J, RecordFFData *rd)
   }
 }
 
+/* Handle a plain string.find. Pattern matching is not recorded (yet). */
+static void LJ_FASTCALL recff_string_find(jit_State *J, RecordFFData *rd)
+{
+  TRef trstr = lj_ir_tostr(J, J->base[0]);
+  TRef trpat = lj_ir_tostr(J, J->base[1]);
+  TRef trlen = emitir(IRTI(IR_FLOAD), trstr, IRFL_STR_LEN);
+  TRef trplen, trinit, tr, tr0 = lj_ir_kint(J, 0);
+  GCstr *str = argv2str(J, &rd->argv[0]);
+  GCstr *pat = argv2str(J, &rd->argv[1]);
+  int32_t init = 0, pos;
+  if (J->base[2] && !tref_isnil(J->base[2])) {
+    init = argv2int(J, &rd->argv[2]) - 1;
+    if (init < 0 || (MSize)init > str->len)
+      recff_nyiu(J);  /* NYI: relative or out of range start position. */
+    trinit = emitir(IRTI(IR_ADD), lj_ir_toint(J, J->base[2]),
+		    lj_ir_kint(J, -1));
+    emitir(IRTGI(IR_ULE), trinit, trlen);
+  } else {
+    trinit = tr0;
+  }
+  if (!(J->base[2] && J->base[3] && tref_istruecond(J->base[3]))) {
+    /* Not an explicit plain search: specialize to a pattern without any
+    ** special characters. Must match SPECIALS in lib_string.c.
+    */
+    if (strpbrk(strdata(pat), "^$*+?.([%-") != NULL)
+      recff_nyiu(J);  /* NYI: pattern matching. */
+    if (!tref_isk(trpat)) {
+      TRef trk = lj_ir_kstr(J, pat);
+      emitir(IRTG(IR_EQ, IRT_STR), trpat, trk);
+      trpat = trk;
+    }
+  }
+  trplen = emitir(IRTI(IR_FLOAD), trpat, IRFL_STR_LEN);
+  tr = lj_ir_call(J, IRCALL_lj_str_find,
+		  emitir(IRT(IR_STRREF, IRT_PTR), trstr, trinit),
+		  emitir(IRT(IR_STRREF, IRT_PTR), trpat, tr0),
+		  emitir(IRTI(IR_SUB), trlen, trinit), trplen);
+  pos = lj_str_find(strdata(str)+init, strdata(pat), str->len-(MSize)init,
+		    pat->len);
+  if (pos >= 0) {
+    emitir(IRTGI(IR_GE), tr, tr0);
+    tr = emitir(IRTI(IR_ADD), tr, trinit);
+    J->base[0] = emitir(IRTI(IR_ADD), tr, lj_ir_kint(J, 1));
+    J->base[1] = emitir(IRTI(IR_ADD), tr, trplen);
+    rd->nres = 2;
+  } else {
+    emitir(IRTGI(IR_LT), tr, tr0);
+    J->base[0] = TREF_NIL;
+  }
+}
+
+/* Record a constant format string at argument arg and the arguments after
+** it as a sequence of puts to the buffer tr. Returns the last put.
+*/
+static TRef recff_format(jit_State *J, RecordFFData *rd, TRef tr,
+			 ptrdiff_t arg)
+{
+  TRef trfmt = lj_ir_tostr(J, J->base[arg]);
+  GCstr *fmt = argv2str(J, &rd->argv[arg]);
+  const char *p = strdata(fmt), *e = p + fmt->len;
+  if (!tref_isk(trfmt))
+    emitir(IRTG(IR_EQ, IRT_STR), trfmt, lj_ir_kstr(J, fmt));
+  while (p < e) {
+    const char *q = p;
+    TRef tra;
+    TValue *o;
+    char form[LJ_MAX_FMTSPEC];
+    MSize len;
+    if (*p != '%') {  /* Literal text. */
+      while (++q < e && *q != '%') ;
+      tr = emitir(IRT(IR_BUFPUT, IRT_PTR), tr,
+		  lj_ir_kstr(J, lj_str_new(J->L, p, (size_t)(q - p))));
+      p = q;
+      continue;
+    }
+    if (++p < e && *p == '%') {  /* %% */
+      tr = emitir(IRT(IR_BUFPUT, IRT_PTR), tr,
+		  lj_ir_kstr(J, lj_str_new(J->L, p, 1)));
+      p++;
+      continue;
+    }
+    /* Scan a format item in the same way as scanformat in lib_string.c. */
+    q = p;
+    while (p < e && *p && strchr("-+ #0", *p)) p++;
+    if (p - q > 5) recff_nyiu(J);
+    if (p < e && lj_char_isdigit((uint8_t)*p)) p++;
+    if (p < e && lj_char_isdigit((uint8_t)*p)) p++;
+    if (p < e && *p == '.') {
+      p++;
+      if (p < e && lj_char_isdigit((uint8_t)*p)) p++;
+      if (p < e && lj_char_isdigit((uint8_t)*p)) p++;
+    }
+    if (p >= e || lj_char_isdigit((uint8_t)*p))
+      recff_nyiu(J);  /* NYI: invalid format, raises an error. */
+    len = (MSize)(++p - q);
+    form[0] = '%';
+    memcpy(form+1, q, len);
+    form[len+1] = '\0';
+    tra = J->base[++arg];
+    o = &rd->argv[arg];
+    if (!tra) recff_nyiu(J);  /* NYI: missing argument. */
+    switch (p[-1]) {
+    case 's':
+      if (len != 1 || !tref_isnumber_str(tra))
+	recff_nyiu(J);  /* NYI: width/precision or __tostring. */
+      if (tref_isnumber(tra))
+	tra = emitir(IRT(IR_TOSTR, IRT_STR), tra, 0);
+      tr = emitir(IRT(IR_BUFPUT, IRT_PTR), tr, tra);
+      break;
+    case 'd': case 'i':
+      if (len == 1 && tref_isinteger(tra)) {
+	tr = emitir(IRT(IR_BUFPUT, IRT_PTR), tr, tra);
+	break;
+      } else if (len == 1 && tref_isnum(tra) && tvisnum(o) &&
+		 numV(o) == (lua_Number)lj_num2int(numV(o))) {
+	tra = emitir(IRTGI(IR_TOINT), tra, IRTOINT_CHECK);
+	tr = emitir(IRT(IR_BUFPUT, IRT_PTR), tr, tra);
+	break;
+      }
+      /* fallthrough */
+    case 'c': case 'o': case 'u': case 'x': case 'X':
+    case 'e': case 'E': case 'f': case 'g': case 'G': {
+      TRef trform;
+      if (!tref_isnumber(tra))
+	recff_nyiu(J);  /* NYI: string coercion. */
+      trform = lj_ir_kstr(J, lj_str_new(J->L, form, len+1));
+      trform = emitir(IRT(IR_STRREF, IRT_PTR), trform, lj_ir_kint(J, 0));
+      tra = emitir(IRT(IR_CARG, IRT_NIL), trform, lj_ir_tonum(J, tra));
+      tr = emitir(IRT(IR_BUFPUT, IRT_PTR), tr, tra);
+      break;
+      }
+    default:
+      recff_nyiu(J);  /* NYI: %q, %p and invalid options. */
+      break;
+    }
+  }
+  return tr;
+}
+
+/* Record string.format with a constant format string. */
+static void LJ_FASTCALL recff_string_format(jit_State *J, RecordFFData *rd)
+{
+  TRef tr = emitir(IRT(IR_BUFHDR, IRT_PTR),
+		   lj_ir_kptr(J, &J2G(J)->tmpbuf), IRBUFHDR_RESET);
+  tr = recff_format(J, rd, tr, 0);
+  J->base[0] = emitir(IRT(IR_BUFSTR, IRT_STR), tr, 0);
+}
+
+/* -- String buffer fast functions ---------------------------------------- */
+
+/* Check that the object is a buffer. */
+static TRef recff_buffer_ud(jit_State *J, RecordFFData *rd)
+{
+  TRef ud = J->base[0], tr;
+  if (!(tref_isudata(ud) && udataV(&rd->argv[0])->udtype == UDTYPE_BUFFER))
+    lj_trace_err(J, LJ_TRERR_BADTYPE);
+  tr = emitir(IRT(IR_FLOAD, IRT_U8), ud, IRFL_UDATA_UDTYPE);
+  emitir(IRTGI(IR_EQ), tr, lj_ir_kint(J, UDTYPE_BUFFER));
+  return ud;
+}
+
+static void LJ_FASTCALL recff_buffer_put(jit_State *J, RecordFFData *rd)
+{
+  TRef ud = recff_buffer_ud(J, rd), tr;
+  ptrdiff_t i;
+  for (i = 1; J->base[i]; i++)
+    if (!tref_isnumber_str(J->base[i]))
+      recff_nyiu(J);  /* NYI: put of another buffer. */
+  tr = emitir(IRT(IR_BUFHDR, IRT_PTR), ud, IRBUFHDR_APPEND);
+  for (i = 1; J->base[i]; i++) {
+    TRef tn = J->base[i];
+    if (tref_isnumber(tn))
+      tn = emitir(IRT(IR_TOSTR, IRT_STR), tn, 0);
+    tr = emitir(IRT(IR_BUFPUT, IRT_PTR), tr, tn);
+  }
+  emitir(IRT(IR_USE, IRT_NIL), tr, 0);  /* Keep the chain alive. */
+  J->needsnap = 1;  /* Don't redo the puts on a later exit. */
+}
+
+static void LJ_FASTCALL recff_buffer_putf(jit_State *J, RecordFFData *rd)
+{
+  TRef ud = recff_buffer_ud(J, rd), tr;
+  if (!J->base[1])
+    recff_nyiu(J);  /* Interpreter will throw. */
+  tr = emitir(IRT(IR_BUFHDR, IRT_PTR), ud, IRBUFHDR_APPEND);
+  tr = recff_format(J, rd, tr, 1);
+  emitir(IRT(IR_USE, IRT_NIL), tr, 0);  /* Keep the chain alive. */
+  J->needsnap = 1;  /* Don't redo the puts on a later exit. */
+}
+
+static void LJ_FASTCALL recff_buffer_reset(jit_State *J, RecordFFData *rd)
+{
+  TRef ud = recff_buffer_ud(J, rd);
+  TRef tr = emitir(IRT(IR_BUFHDR, IRT_PTR), ud, IRBUFHDR_RESET);
+  emitir(IRT(IR_USE, IRT_NIL), tr, 0);
+  J->needsnap = 1;
+}
+
+static void LJ_FASTCALL recff_buffer_tostring(jit_State *J, RecordFFData *rd)
+{
+  TRef ud = recff_buffer_ud(J, rd);
+  TRef tr = emitir(IRT(IR_BUFHDR, IRT_PTR), ud, IRBUFHDR_APPEND);
+  J->base[0] = emitir(IRT(IR_BUFSTR, IRT_STR), tr, 0);
+}
+
 /* -- Table library fast functions ---------------------------------------- */
 
 static void LJ_FASTCALL recff_table_getn(jit_State *J, RecordFFData *rd)
@@ -1802,6 +2306,39 @@ static void LJ_FASTCALL recff_table_insert(jit_State *J, RecordFFData *rd)
   }  /* else: Interpreter will throw. */
 }
 
+/* Specialize to the runtime value of an int argument. */
+static int32_t recff_kint(jit_State *J, TRef tr, TValue *o)
+{
+  int32_t k;
+  if (!tref_isnumber(tr))
+    recff_nyiu(J);
+  k = argv2int(J, o);
+  if (!tref_isk(tr))
+    emitir(IRTGI(IR_EQ), lj_ir_toint(J, tr), lj_ir_kint(J, k));
+  return k;
+}
+
+static void LJ_FASTCALL recff_table_new(jit_State *J, RecordFFData *rd)
+{
+  int32_t a = recff_kint(J, J->base[0], &rd->argv[0]);
+  int32_t h = recff_kint(J, J->base[1], &rd->argv[1]);
+  uint32_t asize = a > 0 ? (uint32_t)a+1 : 0;
+  uint32_t hbits = h > 0 ? hsize2hbits(h) : 0;
+  /* The sizes are literal operands, so they must not look like refs. */
+  if (asize >= REF_BIAS || hbits > LJ_MAX_HBITS)
+    recff_nyiu(J);
+  J->base[0] = emitir(IRTG(IR_TNEW, IRT_TAB), asize, hbits);
+}
+
+static void LJ_FASTCALL recff_table_clear(jit_State *J, RecordFFData *rd)
+{
+  rd->nres = 0;
+  if (tref_istab(J->base[0])) {
+    emitir(IRT(IR_TCLEAR, IRT_NIL), J->base[0], 0);
+    J->needsnap = 1;  /* Don't clear again on a later exit. */
+  }  /* else: Interpreter will throw. */
+}
+
 /* -- I/O library fast functions ------------------------------------------ */
 
 /* Get FILE* for I/O function. Any I/O error aborts recording, so there's
@@ -1953,6 +2490,20 @@ static void rec_func_lua(jit_State *J)
 /* Record entry to an already compiled function. */
 static void rec_func_jit(jit_State *J, TraceNo lnk)
 {
+  GCtrace *T = traceref(J, lnk);
+  if (T->retlower) {
+    /* Linking would continue in a trace that leaves the caller. Better
+    ** record the function as part of the caller, e.g. to form a loop.
+    ** Temporarily unpatch JFUNCF, so the interpreter follows, too.
+    */
+    if (J->patchpc)
+      *J->patchpc = J->patchins;  /* Commit a pending re-patch first. */
+    J->patchins = *J->pc;
+    J->patchpc = (BCIns *)J->pc;
+    *J->patchpc = T->startins;
+    rec_func_lua(J);
+    return;
+  }
   rec_func_setup(J);
   J->instunroll = 0;  /* Cannot continue across a compiled function. */
   if (J->pc == J->startpc && J->framedepth + J->retdepth == 0)
@@ -2083,6 +2634,16 @@ static TRef rec_tnew(jit_State *J, uint32_t ah)
   return emitir(IRTG(IR_TNEW, IRT_TAB), asize, hbits);
 }
 
+/* Record closure creation. Captured locals point to the Lua stack. */
+static TRef rec_fnew(jit_State *J, GCproto *pt)
+{
+  TRef args;
+  lj_snap_add(J);  /* Allocation sinking needs the slots of captured locals. */
+  args = emitir(IRT(IR_CARG, IRT_NIL), getcurrf(J), rec_slotptr(J, 0));
+  return emitir(IRTG(IR_FNEW, IRT_FUNC),
+		lj_ir_kgc(J, obj2gco(pt), IRT_PROTO), args);
+}
+
 /* -- Record bytecode ops ------------------------------------------------- */
 
 /* Prepare for comparison. */
@@ -2322,6 +2883,12 @@ void lj_record_ins(jit_State *J)
       rc = rec_mm_arith(J, &ix, MM_pow);
     break;
 
+  /* -- String ops -------------------------------------------------------- */
+
+  case BC_CAT:
+    rc = rec_cat(J, rb, rc);
+    break;
+
   /* -- Constant and move ops --------------------------------------------- */
 
   case BC_MOV:
@@ -2347,6 +2914,14 @@ void lj_record_ins(jit_State *J)
   case BC_USETV: case BC_USETS: case BC_USETN: case BC_USETP:
     rec_upvalue(J, ra, rc);
     break;
+  case BC_UCLO:
+    rec_uclo(J, ra);
+    if (ra < J->maxslot)
+      J->maxslot = ra;  /* Shrink used slots. */
+    break;
+  case BC_FNEW:
+    rc = rec_fnew(J, gco2pt(proto_kgc(J->pt, ~(ptrdiff_t)rc)));
+    break;
 
   /* -- Table ops --------------------------------------------------------- */
 
@@ -2376,6 +2951,10 @@ void lj_record_ins(jit_State *J)
 
   /* -- Calls and vararg handling ----------------------------------------- */
 
+  case BC_ISNEXT:
+    rec_isnext(J, ra);
+    break;
+
   case BC_ITERC:
     J->base[ra] = getslot(J, ra-3);
     J->base[ra+1] = getslot(J, ra-2);
@@ -2421,6 +3000,8 @@ void lj_record_ins(jit_State *J)
   /* -- Loops and branches ------------------------------------------------ */
 
   case BC_FORI:
+    if (rec_loop_lower(J))
+      break;
     if (rec_for(J, pc, 0) != LOOPEV_LEAVE)
       J->loopref = J->cur.nins;
     break;
@@ -2432,13 +3013,24 @@ void lj_record_ins(jit_State *J)
     break;
 
   case BC_FORL:
-    rec_loop_interp(J, pc, rec_for(J, pc+((ptrdiff_t)rc-BCBIAS_J), 1));
+    if (!rec_loop_lower(J))
+      rec_loop_interp(J, pc, rec_for(J, pc+((ptrdiff_t)rc-BCBIAS_J), 1));
     break;
   case BC_ITERL:
-    rec_loop_interp(J, pc, rec_iterl(J, *pc));
+    if (!rec_loop_lower(J))
+      rec_loop_interp(J, pc, rec_iterl(J, *pc));
     break;
   case BC_LOOP:
-    rec_loop_interp(J, pc, rec_loop(J, ra));
+    if (!rec_loop_lower(J))
+      rec_loop_interp(J, pc, rec_loop(J, ra));
+    break;
+  case BC_ITERN:  /* The loop event is handled by the following ITERL. */
+    if (bc_op(pc[1]) == BC_JITERL)
+      rec_loop_jit(J, bc_d(pc[1]), rec_itern(J, ra));
+    else if (bc_op(pc[1]) != BC_ITERL)
+      lj_trace_err(J, LJ_TRERR_BLACKL);
+    else if (!rec_loop_lower(J))
+      rec_loop_interp(J, pc+1, rec_itern(J, ra));
     break;
 
   case BC_JFORL:
@@ -2492,11 +3084,6 @@ void lj_record_ins(jit_State *J)
       break;
     }
     /* fallthrough */
-  case BC_ITERN:
-  case BC_ISNEXT:
-  case BC_CAT:
-  case BC_UCLO:
-  case BC_FNEW:
   case BC_TSETM:
     setintV(&J->errinfo, (int32_t)op);
     lj_trace_err_info(J, LJ_TRERR_NYIBC);
@@ -2586,11 +3173,11 @@ static const BCIns *rec_setup_root(jit_State *J)
     J->bc_min = pc;
     break;
   case BC_ITERL:
-    lua_assert(bc_op(pc[-1]) == BC_ITERC);
+    lua_assert(bc_op(pc[-1]) == BC_ITERC || bc_op(pc[-1]) == BC_ITERN);
     J->maxslot = ra + bc_b(pc[-1]) - 1;
     J->bc_extent = (MSize)(-bc_j(ins))*sizeof(BCIns);
     pc += 1+bc_j(ins);
-    lua_assert(bc_op(pc[-1]) == BC_JMP);
+    lua_assert(bc_op(pc[-1]) == BC_JMP || bc_op(pc[-1]) == BC_ISNEXT);
     J->bc_min = pc;
     break;
   case BC_LOOP:
@@ -2622,6 +3209,80 @@ static const BCIns *rec_setup_root(jit_State *J)
   return pc;
 }
 
+
+/* Emit a constant inherited from a parent trace. */
+static TRef rec_side_const(jit_State *J, IRIns *ir)
+{
+  switch ((IROp)ir->o) {
+  /* Only have to deal with constants that can occur in stack slots. */
+  case IR_KPRI: return TREF_PRI(irt_type(ir->t));
+  case IR_KINT: return lj_ir_kint(J, ir->i);
+  case IR_KGC:  return lj_ir_kgc(J, ir_kgc(ir), irt_t(ir->t));
+  case IR_KNUM: return lj_ir_knum_addr(J, ir_knum(ir));
+  case IR_KPTR: return lj_ir_kptr(J, ir_kptr(ir));  /* Continuation. */
+  default: lua_assert(0); return 0;
+  }
+}
+
+/* Emit a value stored to a sunk allocation of a parent trace. */
+static TRef rec_side_val(jit_State *J, GCtrace *T, SnapShot *snap,
+			 IRRef ref)
+{
+  IRIns *ir = &T->ir[ref];
+  SnapEntry *map = &T->snapmap[snap->mapofs];
+  MSize n, nent = snap->nent;
+  IRRef pv;
+  if (irref_isk(ref))
+    return rec_side_const(J, ir);
+  for (n = 0; n < nent; n++)  /* Reuse an inherited slot, if any. */
+    if (snap_ref(map[n]) == ref)
+      return J->slot[snap_slot(map[n])] &
+	     ~(SNAP_KEYINDEX|SNAP_CONT|SNAP_FRAME);
+  for (pv = J->chain[IR_PVAL]; pv; pv = IR(pv)->prev)
+    if (IR(pv)->op1 == ref - REF_BIAS)
+      return TREF(pv, irt_type(ir->t));
+  return emitir_raw(IRT(IR_PVAL, irt_type(ir->t)), ref - REF_BIAS, 0);
+}
+
+/* Replay a sunk allocation of a parent trace and its stores. */
+static TRef rec_side_unsink(jit_State *J, GCtrace *T, SnapShot *snap,
+			    IRRef ref)
+{
+  IRIns *ir = &T->ir[ref];
+  IRRef irs;
+  TRef tr;
+  if (ir->o == IR_TNEW)
+    tr = emitir(IRTG(IR_TNEW, IRT_TAB), ir->op1, ir->op2);
+  else
+    tr = emitir(IRTG(IR_TDUP, IRT_TAB),
+		lj_ir_ktab(J, ir_ktab(&T->ir[ir->op1])), 0);
+  for (irs = ref+1; irs < snap->ref; irs++) {
+    IRIns *irst = &T->ir[irs];
+    if (irst->r == RID_SINK &&
+	(irst->o == IR_ASTORE || irst->o == IR_HSTORE) &&
+	lj_snap_sunkalloc(T, irst) == ref) {
+      IRIns *irk = &T->ir[irst->op1];
+      TRef xref, val = rec_side_val(J, T, snap, irst->op2);
+      if (irk->o == IR_AREF) {
+	TRef arrayref = emitir(IRT(IR_FLOAD, IRT_PTR), tr, IRFL_TAB_ARRAY);
+	xref = emitir(IRT(IR_AREF, IRT_PTR), arrayref,
+		      lj_ir_kint(J, T->ir[irk->op2].i));
+      } else if (irk->o == IR_HREFK) {
+	IRIns *irkslot = &T->ir[irk->op2];
+	TRef node = emitir(IRT(IR_FLOAD, IRT_PTR), tr, IRFL_TAB_NODE);
+	TRef key = rec_side_const(J, &T->ir[irkslot->op1]);
+	xref = emitir(IRT(IR_HREFK, IRT_PTR), node,
+		      lj_ir_kslot(J, key, irkslot->op2));
+      } else {
+	xref = emitir(IRT(IR_NEWREF, IRT_PTR), tr,
+		      rec_side_const(J, &T->ir[irk->op2]));
+      }
+      emitir(IRT(irst->o, tref_type(val)), xref, val);
+    }
+  }
+  return tr;
+}
+
 /* Setup recording for a side trace. */
 static void rec_setup_side(jit_State *J, GCtrace *T)
 {
@@ -2629,6 +3290,7 @@ static void rec_setup_side(jit_State *J, GCtrace *T)
   SnapEntry *map = &T->snapmap[snap->mapofs];
   MSize n, nent = snap->nent;
   BloomFilter seen = 0;
+  int sunk = 0;
   /* Emit IR for slots inherited from parent snapshot. */
   for (n = 0; n < nent; n++) {
     SnapEntry sn = map[n];
@@ -2646,33 +3308,63 @@ static void rec_setup_side(jit_State *J, GCtrace *T)
 	}
     }
     bloomset(seen, ref);
-    switch ((IROp)ir->o) {
-    /* Only have to deal with constants that can occur in stack slots. */
-    case IR_KPRI: tr = TREF_PRI(irt_type(ir->t)); break;
-    case IR_KINT: tr = lj_ir_kint(J, ir->i); break;
-    case IR_KGC:  tr = lj_ir_kgc(J, ir_kgc(ir), irt_t(ir->t)); break;
-    case IR_KNUM: tr = lj_ir_knum_addr(J, ir_knum(ir)); break;
-    case IR_KPTR:  tr = lj_ir_kptr(J, ir_kptr(ir)); break;  /* Continuation. */
-    /* Inherited SLOADs don't need a guard or type check. */
-    case IR_SLOAD:
+    if ((sn & SNAP_FRAME) && !irref_isk(ref))
+      lj_trace_err(J, LJ_TRERR_NYIFNEW);  /* NYI: prototype of the frame. */
+    if (irref_isk(ref)) {
+      tr = rec_side_const(J, ir);
+    } else if (T->sinktags && ir->r == RID_SINK) {
+      sunk = 1;  /* Replayed below, after all inherited values. */
+      tr = 0;
+    } else if (ir->o == IR_SLOAD) {
+      /* Inherited SLOADs don't need a guard or type check. */
       tr = emitir_raw(ir->ot & ~IRT_GUARD, s,
 	     (ir->op2&IRSLOAD_READONLY) | IRSLOAD_INHERIT|IRSLOAD_PARENT);
-      break;
-    /* Parent refs are already typed and don't need a guard. */
-    default:
+    } else {
+      /* Parent refs are already typed and don't need a guard. */
       tr = emitir_raw(IRT(IR_SLOAD, irt_type(ir->t)), s,
 		      IRSLOAD_INHERIT|IRSLOAD_PARENT);
-      break;
     }
   setslot:
-    J->slot[s] = tr | (sn&(SNAP_CONT|SNAP_FRAME));  /* Same as TREF_* flags. */
+    /* Same as TREF_* flags. */
+    J->slot[s] = tr | (sn&(SNAP_KEYINDEX|SNAP_CONT|SNAP_FRAME));
     if ((sn & SNAP_FRAME))
       J->baseslot = s+1;
   }
+  if (sunk) {
+    /* First load all stored values, then replay the sunk allocations. */
+    for (n = 0; n < nent; n++) {
+      IRRef ref = snap_ref(map[n]), irs;
+      if (!irref_isk(ref) && T->ir[ref].r == RID_SINK)
+	for (irs = ref+1; irs < snap->ref; irs++) {
+	  IRIns *irst = &T->ir[irs];
+	  if (irst->r == RID_SINK &&
+	      (irst->o == IR_ASTORE || irst->o == IR_HSTORE) &&
+	      lj_snap_sunkalloc(T, irst) == ref)
+	    rec_side_val(J, T, snap, irst->op2);
+	}
+    }
+    for (n = 0; n < nent; n++) {
+      IRRef ref = snap_ref(map[n]);
+      if (!irref_isk(ref) && T->ir[ref].r == RID_SINK) {
+	MSize j;
+	TRef tr = 0;
+	for (j = 0; j < n; j++)
+	  if (snap_ref(map[j]) == ref) {
+	    tr = J->slot[snap_slot(map[j])];
+	    break;
+	  }
+	if (!tr)
+	  tr = rec_side_unsink(J, T, snap, ref);
+	J->slot[snap_slot(map[n])] = tr;
+      }
+    }
+  }
   J->base = J->slot + J->baseslot;
   J->maxslot = snap->nslots - J->baseslot;
   J->framedepth = snap->depth;
   lj_snap_add(J);
+  if (sunk)  /* Explicit GC check after the replayed allocations. */
+    emitir_raw(IRTG(IR_GCSTEP, IRT_NIL), 0, 0);
 }
 
 /* Setup for recording a new trace. */
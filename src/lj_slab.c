@@ -0,0 +1,210 @@
+/*
+** Slab allocator for small GC objects.
+** Copyright (C) 2005-2010 Mike Pall. See Copyright Notice in luajit.h
+*/
+
+#define lj_slab_c
+#define LUA_CORE
+
+#include "lj_obj.h"
+
+#if LJ_HASSLAB
+
+#include "lj_slab.h"
+
+/* Most GC objects are small and short-lived. Allocating each of them from
+** the general-purpose allocator costs a search of its bins and a boundary
+** tag per object. Instead, small objects are grouped by size class into
+** aligned pages. The page header is found by masking the object address.
+**
+** A page hands out objects from its free list first, then bumps a pointer
+** through its unused space. Pages with free objects are on a per-class
+** list. Full pages are unlinked and come back when an object is freed.
+** Empty pages go to a shared list and may be reused for any size class.
+**
+** Pages are carved out of arenas which are obtained from the pluggable
+** memory allocator. The GC returns arenas with only empty pages at the
+** end of each sweep. The memory accounting is unchanged: the GC counts
+** the sizes of the objects, not the size of the arenas.
+*/
+
+#define SLAB_PAGEBITS		12
+#define SLAB_PAGESIZE		(1u << SLAB_PAGEBITS)
+#define SLAB_ARENAPAGES		64
+
+/* Arena header. Lives in the alignment slack in front of the first page. */
+typedef struct SlabArena {
+  struct SlabArena *next;	/* Next arena. */
+  char *pages;			/* First page. */
+  MSize top;			/* Number of pages carved out so far. */
+  MSize nfree;			/* Number of pages on the free page list. */
+} SlabArena;
+
+#define SLAB_ARENASIZE \
+  (SLAB_ARENAPAGES*SLAB_PAGESIZE + SLAB_PAGESIZE + sizeof(SlabArena))
+
+/* Page header. Objects follow the header. */
+typedef struct SlabPage {
+  struct SlabPage *next, *prev;	/* Links in size class or free page list. */
+  SlabArena *arena;		/* Arena of this page. */
+  void *free;			/* List of freed objects. */
+  uint16_t used;		/* Number of objects in use. */
+  uint16_t cap;			/* Max. number of objects. */
+  uint16_t bump;		/* Offset of never used space. */
+  uint8_t cls;			/* Size class. */
+  uint8_t unused1;
+} SlabPage;
+
+#define SLAB_PAGEHDR		((sizeof(SlabPage)+7) & ~(size_t)7)
+
+#define slab_page(p) \
+  ((SlabPage *)((uintptr_t)(p) & ~(uintptr_t)(SLAB_PAGESIZE-1)))
+#define slab_arenapage(a, i) \
+  ((SlabPage *)((a)->pages + ((size_t)(i) << SLAB_PAGEBITS)))
+
+/* -- Page lists ---------------------------------------------------------- */
+
+static LJ_AINLINE void slab_push(SlabPage **head, SlabPage *pg)
+{
+  SlabPage *next = *head;
+  pg->prev = NULL;
+  pg->next = next;
+  if (next) next->prev = pg;
+  *head = pg;
+}
+
+static LJ_AINLINE void slab_unlink(SlabPage **head, SlabPage *pg)
+{
+  if (pg->prev) pg->prev->next = pg->next; else *head = pg->next;
+  if (pg->next) pg->next->prev = pg->prev;
+}
+
+/* -- Pages and arenas ---------------------------------------------------- */
+
+/* Allocate a new arena and make it the one to carve pages from. */
+static SlabArena *slab_newarena(global_State *g)
+{
+  char *base = (char *)g->allocf(g->allocd, NULL, 0, SLAB_ARENASIZE);
+  SlabArena *a = (SlabArena *)base;
+  if (base == NULL)
+    return NULL;
+  lua_assert(checkptr32(base));
+  a->pages = (char *)(((uintptr_t)(base + sizeof(SlabArena)) +
+		       SLAB_PAGESIZE-1) & ~(uintptr_t)(SLAB_PAGESIZE-1));
+  a->top = 0;
+  a->nfree = 0;
+  a->next = g->slab.arena;
+  g->slab.arena = a;
+  return a;
+}
+
+/* Get a page for a size class. Reuse an empty page, if possible. */
+static SlabPage *slab_newpage(global_State *g, MSize c)
+{
+  SlabPage *pg = g->slab.freepage;
+  if (pg) {
+    slab_unlink(&g->slab.freepage, pg);
+    pg->arena->nfree--;
+  } else {
+    SlabArena *a = g->slab.arena;
+    if ((a == NULL || a->top == SLAB_ARENAPAGES) &&
+	(a = slab_newarena(g)) == NULL)
+      return NULL;
+    pg = slab_arenapage(a, a->top);
+    a->top++;
+    pg->arena = a;
+  }
+  pg->free = NULL;
+  pg->used = 0;
+  pg->cap = (uint16_t)((SLAB_PAGESIZE - SLAB_PAGEHDR) / ((c+1) << 3));
+  pg->bump = (uint16_t)SLAB_PAGEHDR;
+  pg->cls = (uint8_t)c;
+  slab_push(&g->slab.page[c], pg);
+  return pg;
+}
+
+/* -- Object allocation --------------------------------------------------- */
+
+/* Allocate a small object. Returns NULL if out of memory. */
+void *lj_slab_alloc(global_State *g, MSize size)
+{
+  MSize c = (size-1) >> 3;
+  SlabPage *pg = g->slab.page[c];
+  void *p;
+  lua_assert(size > 0 && size <= LJ_SLAB_MAXSIZE);
+  if (LJ_UNLIKELY(pg == NULL) && (pg = slab_newpage(g, c)) == NULL)
+    return NULL;
+  p = pg->free;
+  if (p) {
+    pg->free = *(void **)p;
+  } else {
+    p = (char *)pg + pg->bump;
+    pg->bump = (uint16_t)(pg->bump + ((c+1) << 3));
+  }
+  if (++pg->used == pg->cap) {  /* Page is full: take it off the list. */
+    SlabPage *next = pg->next;
+    g->slab.page[c] = next;
+    if (next) next->prev = NULL;
+  }
+  return p;
+}
+
+/* Free a small object. The size must match the allocation. */
+void lj_slab_free(global_State *g, void *p, MSize size)
+{
+  SlabPage *pg = slab_page(p);
+  MSize c = (size-1) >> 3;
+  lua_assert(pg->cls == c && pg->used > 0);
+  *(void **)p = pg->free;
+  pg->free = p;
+  if (pg->used-- == pg->cap) {  /* Page was full: put it back on the list. */
+    slab_push(&g->slab.page[c], pg);
+  } else if (pg->used == 0) {  /* Page is empty: release it. */
+    slab_unlink(&g->slab.page[c], pg);
+    slab_push(&g->slab.freepage, pg);
+    pg->arena->nfree++;
+  }
+}
+
+/* -- Arena release ------------------------------------------------------- */
+
+/* Return arenas with only empty pages. Called at the end of a sweep.
+** Releases at most lim arenas per call and continues at the same arena
+** with the next call. Returns 0 when all arenas have been checked.
+*/
+int lj_slab_trim(global_State *g, MSize lim)
+{
+  SlabArena **ap = g->slab.trim ? g->slab.trim : &g->slab.arena, *a;
+  while ((a = *ap) != NULL) {
+    if (a->nfree == a->top) {
+      MSize i;
+      if (lim-- == 0) {
+	g->slab.trim = ap;  /* Stays valid: only trimming frees arenas. */
+	return 1;
+      }
+      for (i = 0; i < a->top; i++)
+	slab_unlink(&g->slab.freepage, slab_arenapage(a, i));
+      *ap = a->next;
+      g->allocf(g->allocd, a, SLAB_ARENASIZE, 0);
+    } else {
+      ap = &a->next;
+    }
+  }
+  g->slab.trim = NULL;
+  return 0;
+}
+
+/* Free all arenas. All objects must have been freed before. */
+void lj_slab_freeall(global_State *g)
+{
+  SlabArena *a = g->slab.arena;
+  while (a != NULL) {
+    SlabArena *next = a->next;
+    lua_assert(a->nfree == a->top);
+    g->allocf(g->allocd, a, SLAB_ARENASIZE, 0);
+    a = next;
+  }
+  memset(&g->slab, 0, sizeof(SlabState));
+}
+
+#endif
@@ -0,0 +1,18 @@
+/*
+** Slab allocator for small GC objects.
+** Copyright (C) 2005-2010 Mike Pall. See Copyright Notice in luajit.h
+*/
+
+#ifndef _LJ_SLAB_H
+#define _LJ_SLAB_H
+
+#include "lj_obj.h"
+
+#if LJ_HASSLAB
+LJ_FUNC void *lj_slab_alloc(global_State *g, MSize size);
+LJ_FUNC void lj_slab_free(global_State *g, void *p, MSize size);
+LJ_FUNC int lj_slab_trim(global_State *g, MSize lim);
+LJ_FUNC void lj_slab_freeall(global_State *g);
+#endif
+
+#endif
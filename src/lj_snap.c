@@ -11,6 +11,7 @@
 #if LJ_HASJIT
 
 #include "lj_gc.h"
+#include "lj_tab.h"
 #include "lj_state.h"
 #include "lj_frame.h"
 #include "lj_ir.h"
@@ -117,6 +118,7 @@ static void snapshot_stack(jit_State *J, SnapShot *snap, MSize nsnapmap)
   snap->depth = (uint8_t)J->framedepth;
   snap->nslots = (uint8_t)nslots;
   snap->count = 0;
+  snap->mcofs = 0;
   J->cur.nsnapmap = (uint16_t)(nsnapmap + nent + 1 + J->framedepth);
 }
 
@@ -209,6 +211,101 @@ void lj_snap_regspmap(uint16_t *rsmap, GCtrace *T, SnapNo snapno)
   }
 }
 
+/* Get the RegSP of a ref for a snapshot, following any renames. */
+uint16_t lj_snap_regspref(GCtrace *T, SnapNo snapno, IRRef ref)
+{
+  BloomFilter rfilt = snap_renamefilter(T, snapno);
+  RegSP rs = T->ir[ref].prev;
+  if (bloomtest(rfilt, ref))
+    rs = snap_renameref(T, snapno, ref, rs);
+  return (uint16_t)rs;
+}
+
+/* -- Snapshot restore ---------------------------------------------------- */
+
+/* Restore a value from the trace exit state. */
+static void snap_restoreval(lua_State *L, GCtrace *T, ExitState *ex,
+			    SnapNo snapno, BloomFilter rfilt,
+			    IRRef ref, TValue *o)
+{
+  IRIns *ir = &T->ir[ref];
+  IRType1 t = ir->t;
+  RegSP rs = ir->prev;
+  if (irref_isk(ref)) {  /* Restore constant slot. */
+    lj_ir_kvalue(L, o, ir);
+    return;
+  }
+  if (LJ_UNLIKELY(bloomtest(rfilt, ref)))
+    rs = snap_renameref(T, snapno, ref, rs);
+  if (ra_hasspill(regsp_spill(rs))) {  /* Restore from spill slot. */
+    int32_t *sps = &ex->spill[regsp_spill(rs)];
+    if (irt_isinteger(t)) {
+      setintV(o, *sps);
+    } else if (irt_isnum(t)) {
+      o->u64 = *(uint64_t *)sps;
+#if LJ_64
+    } else if (irt_islightud(t)) {
+      /* 64 bit lightuserdata which may escape already has the tag bits. */
+      o->u64 = *(uint64_t *)sps;
+#endif
+    } else {
+      lua_assert(!irt_ispri(t));  /* PRI refs never have a spill slot. */
+      setgcrefi(o->gcr, *sps);
+      setitype(o, irt_toitype(t));
+    }
+  } else {  /* Restore from register. */
+    Reg r = regsp_reg(rs);
+    lua_assert(ra_hasreg(r));
+    if (irt_isinteger(t)) {
+      setintV(o, ex->gpr[r-RID_MIN_GPR]);
+    } else if (irt_isnum(t)) {
+      setnumV(o, ex->fpr[r-RID_MIN_FPR]);
+#if LJ_64
+    } else if (irt_islightud(t)) {
+      /* 64 bit lightuserdata which may escape already has the tag bits. */
+      o->u64 = ex->gpr[r-RID_MIN_GPR];
+#endif
+    } else {
+      if (!irt_ispri(t))
+	setgcrefi(o->gcr, ex->gpr[r-RID_MIN_GPR]);
+      setitype(o, irt_toitype(t));
+    }
+  }
+}
+
+/* Rebuild a sunk allocation and replay its stores up to the snapshot. */
+static void snap_unsink(lua_State *L, GCtrace *T, ExitState *ex,
+			SnapNo snapno, BloomFilter rfilt,
+			IRRef ref, TValue *o)
+{
+  IRIns *ir = &T->ir[ref];
+  IRRef irs, lim = T->snap[snapno].ref;
+  GCtab *t;
+  lua_assert(ir->o == IR_TNEW || ir->o == IR_TDUP);
+  t = ir->o == IR_TNEW ? lj_tab_new(L, ir->op1, ir->op2) :
+			 lj_tab_dup(L, ir_ktab(&T->ir[ir->op1]));
+  settabV(L, o, t);
+  for (irs = ref+1; irs < lim; irs++) {
+    IRIns *irst = &T->ir[irs];
+    if (irst->r == RID_SINK &&
+	(irst->o == IR_ASTORE || irst->o == IR_HSTORE) &&
+	lj_snap_sunkalloc(T, irst) == ref) {
+      IRIns *irk = &T->ir[irst->op1];
+      TValue *val;
+      if (irk->o == IR_AREF) {
+	val = lj_tab_setint(L, t, T->ir[irk->op2].i);
+      } else {
+	TValue keyv;
+	IRIns *irkey = &T->ir[irk->op2];
+	if (irkey->o == IR_KSLOT) irkey = &T->ir[irkey->op1];
+	lj_ir_kvalue(L, &keyv, irkey);
+	val = lj_tab_set(L, t, &keyv);
+      }
+      snap_restoreval(L, T, ex, snapno, rfilt, irst->op2, val);
+    }
+  }
+}
+
 /* Restore interpreter state from exit state with the help of a snapshot. */
 const BCIns *lj_snap_restore(jit_State *J, void *exptr)
 {
@@ -243,66 +340,42 @@ const BCIns *lj_snap_restore(jit_State *J, void *exptr)
     IRRef ref = snap_ref(sn);
     BCReg s = snap_slot(sn);
     TValue *o = &frame[s];  /* Stack slots are relative to start frame. */
-    IRIns *ir = &T->ir[ref];
-    if (irref_isk(ref)) {  /* Restore constant slot. */
-      lj_ir_kvalue(L, o, ir);
-      if ((sn & (SNAP_CONT|SNAP_FRAME))) {
-	/* Overwrite tag with frame link. */
-	o->fr.tp.ftsz = s != 0 ? (int32_t)*flinks-- : ftsz0;
-	if ((sn & SNAP_FRAME)) {
-	  GCfunc *fn = ir_kfunc(ir);
-	  if (isluafunc(fn)) {
-	    MSize framesize = funcproto(fn)->framesize;
-	    L->base = ++o;
-	    if (LJ_UNLIKELY(o + framesize > tvref(L->maxstack))) {
-	      ptrdiff_t fsave = savestack(L, frame);
-	      L->top = o;
-	      lj_state_growstack(L, framesize);  /* Grow again. */
-	      frame = restorestack(L, fsave);
-	    }
-	  }
+    if (!irref_isk(ref) && T->ir[ref].r == RID_SINK) {
+      MSize j;
+      lua_assert(!(sn & (SNAP_CONT|SNAP_FRAME|SNAP_NORESTORE)));
+      for (j = 0; j < n; j++)
+	if (snap_ref(map[j]) == ref) {  /* De-duplicate sunk allocations. */
+	  copyTV(L, o, &frame[snap_slot(map[j])]);
+	  break;
 	}
-      }
-    } else if (!(sn & SNAP_NORESTORE)) {
-      IRType1 t = ir->t;
-      RegSP rs = ir->prev;
-      lua_assert(!(sn & (SNAP_CONT|SNAP_FRAME)));
-      if (LJ_UNLIKELY(bloomtest(rfilt, ref)))
-	rs = snap_renameref(T, snapno, ref, rs);
-      if (ra_hasspill(regsp_spill(rs))) {  /* Restore from spill slot. */
-	int32_t *sps = &ex->spill[regsp_spill(rs)];
-	if (irt_isinteger(t)) {
-	  setintV(o, *sps);
-	} else if (irt_isnum(t)) {
-	  o->u64 = *(uint64_t *)sps;
-#if LJ_64
-	} else if (irt_islightud(t)) {
-	  /* 64 bit lightuserdata which may escape already has the tag bits. */
-	  o->u64 = *(uint64_t *)sps;
-#endif
-	} else {
-	  lua_assert(!irt_ispri(t));  /* PRI refs never have a spill slot. */
-	  setgcrefi(o->gcr, *sps);
-	  setitype(o, irt_toitype(t));
-	}
-      } else {  /* Restore from register. */
-	Reg r = regsp_reg(rs);
-	lua_assert(ra_hasreg(r));
-	if (irt_isinteger(t)) {
-	  setintV(o, ex->gpr[r-RID_MIN_GPR]);
-	} else if (irt_isnum(t)) {
-	  setnumV(o, ex->fpr[r-RID_MIN_FPR]);
-#if LJ_64
-	} else if (irt_islightud(t)) {
-	  /* 64 bit lightuserdata which may escape already has the tag bits. */
-	  o->u64 = ex->gpr[r-RID_MIN_GPR];
-#endif
-	} else {
-	  if (!irt_ispri(t))
-	    setgcrefi(o->gcr, ex->gpr[r-RID_MIN_GPR]);
-	  setitype(o, irt_toitype(t));
+      if (j == n)
+	snap_unsink(L, T, ex, snapno, rfilt, ref, o);
+      continue;
+    } else if (irref_isk(ref) || !(sn & SNAP_NORESTORE)) {
+      lua_assert(irref_isk(ref) || !(sn & SNAP_CONT));
+      snap_restoreval(L, T, ex, snapno, rfilt, ref, o);
+    }
+    if ((sn & (SNAP_CONT|SNAP_FRAME))) {
+      /* Overwrite tag with frame link. */
+      o->fr.tp.ftsz = s != 0 ? (int32_t)*flinks-- : ftsz0;
+      if ((sn & SNAP_FRAME)) {
+	GCfunc *fn = frame_func(o);
+	if (isluafunc(fn)) {
+	  MSize framesize = funcproto(fn)->framesize;
+	  L->base = ++o;
+	  if (LJ_UNLIKELY(o + framesize > tvref(L->maxstack))) {
+	    ptrdiff_t fsave = savestack(L, frame);
+	    L->top = o;
+	    lj_state_growstack(L, framesize);  /* Grow again. */
+	    frame = restorestack(L, fsave);
+	  }
 	}
       }
+    } else if ((sn & (SNAP_KEYINDEX|SNAP_NORESTORE)) == SNAP_KEYINDEX) {
+      /* The traversal index is stored with a nil tag. */
+      int32_t k = lj_num2int(numV(o));
+      setnilV(o);
+      o->u32.lo = (uint32_t)k;
     }
   }
   switch (bc_op(*pc)) {
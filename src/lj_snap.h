@@ -13,6 +13,7 @@
 LJ_FUNC void lj_snap_add(jit_State *J);
 LJ_FUNC void lj_snap_shrink(jit_State *J);
 LJ_FUNC void lj_snap_regspmap(uint16_t *rsmap, GCtrace *T, SnapNo snapno);
+LJ_FUNC uint16_t lj_snap_regspref(GCtrace *T, SnapNo snapno, IRRef ref);
 LJ_FUNC const BCIns *lj_snap_restore(jit_State *J, void *exptr);
 LJ_FUNC void lj_snap_grow_buf_(jit_State *J, MSize need);
 LJ_FUNC void lj_snap_grow_map_(jit_State *J, MSize need);
@@ -27,6 +28,15 @@ static LJ_AINLINE void lj_snap_grow_map(jit_State *J, MSize need)
   if (LJ_UNLIKELY(need > J->sizesnapmap)) lj_snap_grow_map_(J, need);
 }
 
+/* Get the allocation of a sunk store. */
+static LJ_AINLINE IRRef lj_snap_sunkalloc(GCtrace *T, IRIns *irs)
+{
+  IRIns *irk = &T->ir[irs->op1];  /* NEWREF, AREF or HREFK. */
+  if (irk->o != IR_NEWREF)
+    irk = &T->ir[irk->op1];  /* FLOAD tab.array or tab.node. */
+  return irk->op1;
+}
+
 #endif
 
 #endif
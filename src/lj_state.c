@@ -23,9 +23,13 @@
 #endif
 #include "lj_trace.h"
 #include "lj_dispatch.h"
+#if LJ_HASPROFILE
+#include "lj_profile.h"
+#endif
 #include "lj_vm.h"
 #include "lj_lex.h"
 #include "lj_alloc.h"
+#include "lj_slab.h"
 
 /* -- Stack handling ------------------------------------------------------ */
 
@@ -161,8 +165,12 @@ static void close_state(lua_State *L)
   lua_assert(g->strnum == 0);
   lj_trace_freestate(g);
   lj_mem_freevec(g, g->strhash, g->strmask+1, GCRef);
+  lj_mem_freevec(g, g->strdirty, lj_str_dirtysz(g->strmask), uint32_t);
   lj_str_freebuf(g, &g->tmpbuf);
   lj_mem_freevec(g, tvref(L->stack), L->stacksize, TValue);
+#if LJ_HASSLAB
+  lj_slab_freeall(g);
+#endif
   lua_assert(g->gc.total == sizeof(GG_State));
 #ifndef LUAJIT_USE_SYSMALLOC
   if (g->allocf == lj_alloc_f)
@@ -192,6 +200,9 @@ LUA_API lua_State *lua_newstate(lua_Alloc f, void *ud)
   g->strempty.gct = ~LJ_TSTR;
   g->allocf = f;
   g->allocd = ud;
+#if LJ_STRHASH_FULL
+  lj_str_initkey(g);
+#endif
   setgcref(g->mainthref, obj2gco(L));
   setgcref(g->uvhead.prev, obj2gco(&g->uvhead));
   setgcref(g->uvhead.next, obj2gco(&g->uvhead));
@@ -199,7 +210,9 @@ LUA_API lua_State *lua_newstate(lua_Alloc f, void *ud)
   setnilV(registry(L));
   setnilV(&g->nilnode.val);
   setnilV(&g->nilnode.key);
+#if !LJ_TABHASH_OPEN
   setmref(g->nilnode.freetop, &g->nilnode);
+#endif
   lj_str_initbuf(L, &g->tmpbuf);
   g->gc.state = GCSpause;
   setgcref(g->gc.root, obj2gco(L));
@@ -207,6 +220,7 @@ LUA_API lua_State *lua_newstate(lua_Alloc f, void *ud)
   g->gc.total = sizeof(GG_State);
   g->gc.pause = LUAI_GCPAUSE;
   g->gc.stepmul = LUAI_GCMUL;
+  g->gc.genminor = LUAI_GCGENMINOR;
   lj_dispatch_init((GG_State *)L);
   L->status = LUA_ERRERR+1;  /* Avoid touching the stack upon memory error. */
   if (lj_vm_cpcall(L, NULL, NULL, cpluaopen) != 0) {
@@ -231,6 +245,9 @@ LUA_API void lua_close(lua_State *L)
 {
   global_State *g = G(L);
   L = mainthread(g);  /* Only the main thread can be closed. */
+#if LJ_HASPROFILE
+  lj_profile_stop(L);
+#endif
   lj_func_closeuv(L, tvref(L->stack));
   lj_gc_separateudata(g, 1);  /* Separate udata which have GC metamethods. */
 #if LJ_HASJIT
@@ -271,6 +288,6 @@ void LJ_FASTCALL lj_state_free(global_State *g, lua_State *L)
   lj_func_closeuv(L, tvref(L->stack));
   lua_assert(gcref(L->openupval) == NULL);
   lj_mem_freevec(g, tvref(L->stack), L->stacksize, TValue);
-  lj_mem_freet(g, L);
+  lj_mem_freegcot(g, L);
 }
 
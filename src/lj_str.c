@@ -7,6 +7,8 @@
 */
 
 #include <stdio.h>
+#include <time.h>
+#include <locale.h>
 
 #define lj_str_c
 #define LUA_CORE
@@ -64,63 +66,160 @@ static LJ_AINLINE int str_fastcmp(const char *a, const char *b, MSize len)
   return 0;
 }
 
+/* Resizing the string hash table is incremental. The old table is kept
+** until all of its chains have been moved to the new table. Each newly
+** interned string and each GC step moves a few chains. Lookups check the
+** chain in the old table, too, unless it has been moved already.
+*/
+#define STR_MIGRATE	4	/* Chains moved per newly interned string. */
+
+/* Move up to n chains from the old to the new string hash table. */
+MSize lj_str_migrate(global_State *g, MSize n)
+{
+  GCRef *oldhash = g->stroldhash;
+  MSize i = g->strmigrate, oldmask = g->stroldmask, m = 0;
+  lua_assert(oldhash != NULL);
+  for (; m < n && i <= oldmask; m++, i++) {
+    GCobj *p = gcref(oldhash[i]);
+    while (p) {  /* Follow the hash chain and reinsert all strings. */
+      MSize h = gco2str(p)->hash & g->strmask;
+      GCobj *next = gcnext(p);
+      /* NOBARRIER: The string table is a GC root. */
+      setgcrefr(p->gch.nextgc, g->strhash[h]);
+      setgcref(g->strhash[h], p);
+      /* Chains are reordered, so a generational sweep must not stop here. */
+      p->gch.marked &= cast_byte(~LJ_GC_OLD);
+      lj_str_setdirty(g, h);
+      p = next;
+    }
+  }
+  g->strmigrate = i;
+  if (i > oldmask) {  /* All chains moved: free the old table. */
+    MSize sz = (oldmask+1)*(MSize)sizeof(GCRef);
+    lj_mem_freevec(g, oldhash, oldmask+1, GCRef);
+    g->stroldhash = NULL;
+    g->gc.estimate = g->gc.estimate > sz ? g->gc.estimate - sz : 0;
+  }
+  return m;
+}
+
 /* Resize the string hash table (grow and shrink). */
 void lj_str_resize(lua_State *L, MSize newmask)
 {
   global_State *g = G(L);
   GCRef *newhash;
-  MSize i;
+  uint32_t *newdirty;
   if (g->gc.state == GCSsweepstring || newmask >= LJ_MAX_STRTAB-1)
     return;  /* No resizing during GC traversal or if already too big. */
+  if (g->stroldhash)  /* Finish the previous resize. */
+    lj_str_migrate(g, ~(MSize)0);
   newhash = lj_mem_newvec(L, newmask+1, GCRef);
   memset(newhash, 0, (newmask+1)*sizeof(GCRef));
-  for (i = g->strmask; i != ~(MSize)0; i--) {  /* Rehash old table. */
-    GCobj *p = gcref(g->strhash[i]);
-    while (p) {  /* Follow each hash chain and reinsert all strings. */
-      MSize h = gco2str(p)->hash & newmask;
-      GCobj *next = gcnext(p);
-      /* NOBARRIER: The string table is a GC root. */
-      setgcrefr(p->gch.nextgc, newhash[h]);
-      setgcref(newhash[h], p);
-      p = next;
-    }
+  newdirty = lj_mem_newvec(L, lj_str_dirtysz(newmask), uint32_t);
+  memset(newdirty, 0, lj_str_dirtysz(newmask)*sizeof(uint32_t));
+  lj_mem_freevec(g, g->strdirty, lj_str_dirtysz(g->strmask), uint32_t);
+  if (g->strnum == 0) {  /* Nothing to move. */
+    lj_mem_freevec(g, g->strhash, g->strmask+1, GCRef);
+  } else {
+    g->stroldhash = g->strhash;
+    g->stroldmask = g->strmask;
+    g->strmigrate = 0;
   }
-  lj_mem_freevec(g, g->strhash, g->strmask+1, GCRef);
   g->strmask = newmask;
   g->strhash = newhash;
+  g->strdirty = newdirty;
 }
 
-/* Intern a string and return string object. */
-GCstr *lj_str_new(lua_State *L, const char *str, size_t lenx)
+#if LJ_STRHASH_FULL
+/* Hash all bytes of a string with SipHash-1-3, keyed per state. The key is
+** unknown to the producer of the string, so collisions can't be prepared.
+** SipHash by Jean-Philippe Aumasson and Daniel J. Bernstein.
+*/
+#define sip_rol(x, n)	(((x)<<(n)) | ((x)>>(64-(n))))
+#define sip_round(v0, v1, v2, v3) \
+  { v0 += v1; v1 = sip_rol(v1, 13); v1 ^= v0; v0 = sip_rol(v0, 32); \
+    v2 += v3; v3 = sip_rol(v3, 16); v3 ^= v2; \
+    v0 += v3; v3 = sip_rol(v3, 21); v3 ^= v0; \
+    v2 += v1; v1 = sip_rol(v1, 17); v1 ^= v2; v2 = sip_rol(v2, 32); }
+
+static LJ_AINLINE MSize str_hash(global_State *g, const char *str, MSize len)
+{
+  uint64_t v0 = g->strkey[0] ^ U64x(736f6d65,70736575);
+  uint64_t v1 = g->strkey[1] ^ U64x(646f7261,6e646f6d);
+  uint64_t v2 = g->strkey[0] ^ U64x(6c796765,6e657261);
+  uint64_t v3 = g->strkey[1] ^ U64x(74656462,79746573);
+  uint64_t m = (uint64_t)len << 56;
+  const char *end = str + (len & ~(MSize)7);
+  for (; str < end; str += 8) {  /* Caveat: unaligned access! */
+    uint64_t w = *(const uint64_t *)str;
+    v3 ^= w; sip_round(v0, v1, v2, v3); v0 ^= w;
+  }
+  switch (len & 7) {  /* Remaining bytes and the length form the last word. */
+  case 7: m |= (uint64_t)(uint8_t)str[6] << 48;  /* fallthrough */
+  case 6: m |= (uint64_t)(uint8_t)str[5] << 40;  /* fallthrough */
+  case 5: m |= (uint64_t)(uint8_t)str[4] << 32;  /* fallthrough */
+  case 4: m |= (uint64_t)(uint8_t)str[3] << 24;  /* fallthrough */
+  case 3: m |= (uint64_t)(uint8_t)str[2] << 16;  /* fallthrough */
+  case 2: m |= (uint64_t)(uint8_t)str[1] << 8;  /* fallthrough */
+  case 1: m |= (uint64_t)(uint8_t)str[0]; break;
+  default: break;
+  }
+  v3 ^= m; sip_round(v0, v1, v2, v3); v0 ^= m;
+  v2 ^= 0xff;
+  sip_round(v0, v1, v2, v3);
+  sip_round(v0, v1, v2, v3);
+  sip_round(v0, v1, v2, v3);
+  m = v0 ^ v1 ^ v2 ^ v3;
+  return (MSize)(m ^ (m >> 32));
+}
+
+/* Initialize the hash key of a new state. Needs to be hard to guess, but
+** not cryptographically strong. Mixes addresses (ASLR) and time.
+*/
+void lj_str_initkey(global_State *g)
+{
+  uint64_t v0 = (uint64_t)(uintptr_t)g ^ ((uint64_t)time(NULL) << 32);
+  uint64_t v1 = (uint64_t)(uintptr_t)&v0 ^ ((uint64_t)clock() << 24);
+  uint64_t v2 = (uint64_t)(uintptr_t)lj_str_initkey ^ U64x(6c796765,6e657261);
+  uint64_t v3 = (uint64_t)(uintptr_t)g->allocd ^ U64x(74656462,79746573);
+  sip_round(v0, v1, v2, v3);
+  sip_round(v0, v1, v2, v3);
+  sip_round(v0, v1, v2, v3);
+  sip_round(v0, v1, v2, v3);
+  g->strkey[0] = v0 ^ v1;
+  g->strkey[1] = v2 ^ v3;
+}
+#else
+/* Hash a sample of the bytes of a string. Fast, but collides easily.
+** Constants taken from lookup3 hash by Bob Jenkins.
+*/
+static LJ_AINLINE MSize str_hash(global_State *g, const char *str, MSize len)
 {
-  global_State *g;
-  GCstr *s;
-  GCobj *o;
-  MSize len = (MSize)lenx;
   MSize a, b, h = len;
-  if (lenx >= LJ_MAX_STR)
-    lj_err_msg(L, LJ_ERR_STROV);
-  g = G(L);
-  /* Compute string hash. Constants taken from lookup3 hash by Bob Jenkins. */
+  UNUSED(g);
   if (len >= 4) {  /* Caveat: unaligned access! */
     a = *(const uint32_t *)str;
     h ^= *(const uint32_t *)(str+len-4);
     b = *(const uint32_t *)(str+(len>>1)-2);
     h ^= b; h -= lj_rol(b, 14);
     b += *(const uint32_t *)(str+(len>>2)-1);
-  } else if (len > 0) {
+  } else {
     a = *(const uint8_t *)str;
     h ^= *(const uint8_t *)(str+len-1);
     b = *(const uint8_t *)(str+(len>>1));
     h ^= b; h -= lj_rol(b, 14);
-  } else {
-    return &g->strempty;
   }
   a ^= h; a -= lj_rol(h, 11);
   b ^= a; b -= lj_rol(a, 25);
   h ^= b; h -= lj_rol(b, 16);
-  /* Check if the string has already been interned. */
-  o = gcref(g->strhash[h & g->strmask]);
+  return h;
+}
+#endif
+
+/* Find an interned string in a hash chain. */
+static LJ_AINLINE GCstr *str_find(global_State *g, GCobj *o,
+				  const char *str, MSize len)
+{
   if (LJ_LIKELY((((uintptr_t)str + len) & (LJ_PAGESIZE-1)) <= LJ_PAGESIZE-4)) {
     while (o != NULL) {
       GCstr *sx = gco2str(o);
@@ -142,8 +241,35 @@ GCstr *lj_str_new(lua_State *L, const char *str, size_t lenx)
       o = gcnext(o);
     }
   }
+  return NULL;
+}
+
+/* Intern a string and return string object. */
+GCstr *lj_str_new(lua_State *L, const char *str, size_t lenx)
+{
+  global_State *g;
+  GCstr *s;
+  MSize len = (MSize)lenx;
+  MSize h;
+  if (lenx >= LJ_MAX_STR)
+    lj_err_msg(L, LJ_ERR_STROV);
+  g = G(L);
+  if (len == 0)
+    return &g->strempty;
+  h = str_hash(g, str, len);
+  /* Check if the string has already been interned. */
+  s = str_find(g, gcref(g->strhash[h & g->strmask]), str, len);
+  if (s)
+    return s;
+  if (LJ_UNLIKELY(g->stroldhash != NULL)) {  /* Resize in progress. */
+    MSize oh = h & g->stroldmask;
+    if (oh >= g->strmigrate &&
+	(s = str_find(g, gcref(g->stroldhash[oh]), str, len)) != NULL)
+      return s;
+    lj_str_migrate(g, STR_MIGRATE);
+  }
   /* Nope, create a new string. */
-  s = lj_mem_newt(L, sizeof(GCstr)+len+1, GCstr);
+  s = lj_mem_newgcot(L, sizeof(GCstr)+len+1, GCstr);
   newwhite(g, s);
   s->gct = ~LJ_TSTR;
   s->len = len;
@@ -156,6 +282,7 @@ GCstr *lj_str_new(lua_State *L, const char *str, size_t lenx)
   s->nextgc = g->strhash[h];
   /* NOBARRIER: The string table is a GC root. */
   setgcref(g->strhash[h], obj2gco(s));
+  lj_str_setdirty(g, h);
   if (g->strnum++ > g->strmask)  /* Allow a 100% load factor. */
     lj_str_resize(L, (g->strmask<<1)+1);  /* Grow string table. */
   return s;  /* Return newly interned string. */
@@ -164,7 +291,26 @@ GCstr *lj_str_new(lua_State *L, const char *str, size_t lenx)
 void LJ_FASTCALL lj_str_free(global_State *g, GCstr *s)
 {
   g->strnum--;
-  lj_mem_free(g, s, sizestring(s));
+  lj_mem_freegco(g, s, sizestring(s));
+}
+
+/* -- String search ------------------------------------------------------- */
+
+/* Find first occurrence of p in s. Returns the offset or -1. */
+int32_t lj_str_find(const char *s, const char *p, MSize slen, MSize plen)
+{
+  if (plen == 0) {
+    return 0;  /* Empty strings are everywhere. */
+  } else if (plen <= slen) {
+    const char *q = s, *e = s + (slen - plen) + 1;
+    plen--;  /* First char is checked by memchr. */
+    while (q < e && (q = (const char *)memchr(q, *p, (size_t)(e - q)))) {
+      if (memcmp(q+1, p+1, plen) == 0)
+	return (int32_t)(q - s);
+      q++;
+    }
+  }
+  return -1;  /* Not found. */
 }
 
 /* -- Type conversions ---------------------------------------------------- */
@@ -175,6 +321,68 @@ int LJ_FASTCALL lj_str_tonum(GCstr *str, TValue *n)
   return lj_str_numconv(strdata(str), n);
 }
 
+/* Powers of ten which are exactly representable as doubles. */
+static const double str_pow10[] = {
+  1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+  1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+/* Parse an unsigned decimal number. Returns the end of the number or NULL,
+** if the result cannot be computed exactly with a single rounding step.
+**
+** Up to 19 significant digits are accumulated in an integer. The result
+** is exact, if this integer fits into the mantissa of a double and the
+** decimal exponent can be applied with an exactly representable power of
+** ten (Clinger's fast path). Everything else is left to strtod().
+*/
+static const uint8_t *str_numdec(const uint8_t *p, lua_Number *np)
+{
+  uint64_t m = 0;
+  int32_t nd = 0, ex = 0, any = 0;
+  for (; (uint32_t)(*p - '0') < 10; p++, any = 1) {
+    if (nd < 19) { m = m*10 + (uint32_t)(*p - '0'); nd += (m != 0); }
+    else if (*p == '0') ex++;
+    else return NULL;
+  }
+  if (*p == '.') {
+    for (p++; (uint32_t)(*p - '0') < 10; p++, any = 1) {
+      if (nd < 19) { m = m*10 + (uint32_t)(*p - '0'); nd += (m != 0); ex--; }
+      else if (*p != '0') return NULL;
+    }
+  }
+  if (!any) return NULL;
+  if ((*p & ~0x20) == 'E') {
+    int32_t neg = 0, e = 0;
+    p++;
+    if (*p == '-') { p++; neg = 1; } else if (*p == '+') { p++; }
+    if ((uint32_t)(*p - '0') >= 10) return NULL;
+    for (; (uint32_t)(*p - '0') < 10; p++)
+      if (e < 100000) e = e*10 + (int32_t)(*p - '0');
+    ex += neg ? -e : e;
+  }
+  if (m > U64x(00200000,00000000)) return NULL;
+  if (m == 0 || ex == 0) {
+    *np = (lua_Number)(int64_t)m;
+    return p;
+  }
+#if LJ_TARGET_X86 && !defined(__SSE2__)
+  return NULL;  /* x87 arithmetic may round twice. */
+#else
+  if (ex > 0) {
+    for (; ex > 22; ex--) {  /* Shift excess powers into the integer. */
+      if (m > U64x(00200000,00000000)/10) return NULL;
+      m *= 10;
+    }
+    *np = (lua_Number)(int64_t)m * str_pow10[ex];
+  } else if (ex >= -22) {
+    *np = (lua_Number)(int64_t)m / str_pow10[-ex];
+  } else {
+    return NULL;
+  }
+  return p;
+#endif
+}
+
 /* Convert string to number. */
 int LJ_FASTCALL lj_str_numconv(const char *s, TValue *n)
 {
@@ -182,35 +390,48 @@ int LJ_FASTCALL lj_str_numconv(const char *s, TValue *n)
   const uint8_t *p = (const uint8_t *)s;
   while (lj_char_isspace(*p)) p++;
   if (*p == '-') { p++; sign = -1; } else if (*p == '+') { p++; }
-  if ((uint32_t)(*p - '0') < 10) {
-    uint32_t k = (uint32_t)(*p++ - '0');
-    if (k == 0 && ((*p & ~0x20) == 'X')) {
+  if (*p == '0' && ((p[1] & ~0x20) == 'X')) {
+    uint32_t k = 0;
+    p += 2;
+    if (!lj_char_isxdigit(*p))
+      return 0;  /* Don't accept '0x' without hex digits. */
+    do {
+      if (k >= 0x10000000) goto parsedbl;
+      k = (k << 4) + (*p & 15u);
+      if (!lj_char_isdigit(*p)) k += 9;
       p++;
-      if (!lj_char_isxdigit(*p))
-	return 0;  /* Don't accept '0x' without hex digits. */
-      do {
-	if (k >= 0x10000000) goto parsedbl;
-	k = (k << 4) + (*p & 15u);
-	if (!lj_char_isdigit(*p)) k += 9;
-	p++;
-      } while (lj_char_isxdigit(*p));
-    } else {
-      while ((uint32_t)(*p - '0') < 10) {
-	if (k >= 0x19999999) goto parsedbl;
-	k = k * 10u + (uint32_t)(*p++ - '0');
-      }
-    }
+    } while (lj_char_isxdigit(*p));
     while (LJ_UNLIKELY(lj_char_isspace(*p))) p++;
     if (LJ_LIKELY(*p == '\0')) {
       setnumV(n, sign * cast_num(k));
       return 1;
     }
+  } else {
+    lua_Number d;
+    const uint8_t *q = str_numdec(p, &d);
+    if (LJ_LIKELY(q != NULL)) {
+      while (LJ_UNLIKELY(lj_char_isspace(*q))) q++;
+      if (*q != '\0') return 0;  /* Invalid trailing characters. */
+      setnumV(n, sign * d);
+      return 1;
+    }
   }
 parsedbl:
   {
     TValue tv;
     char *endptr;
     setnumV(&tv, lua_str2number(s, &endptr));
+    if (LJ_UNLIKELY(*endptr == '.')) {
+      /* Retry with the decimal point of the current locale. */
+      char buf[LUAI_MAXNUMBER2STR*4], *ep, dp = localeconv()->decimal_point[0];
+      size_t len = strlen(s);
+      if (dp != '.' && len < sizeof(buf)) {
+	memcpy(buf, s, len+1);
+	buf[endptr - s] = dp;
+	setnumV(&tv, lua_str2number(buf, &ep));
+	endptr = (char *)s + (ep - buf);
+      }
+    }
     if (endptr == s) return 0;  /* Conversion failed. */
     if (LJ_UNLIKELY(*endptr != '\0')) {
       while (lj_char_isspace((uint8_t)*endptr)) endptr++;
@@ -224,12 +445,101 @@ parsedbl:
   }
 }
 
+/* Write the decimal digits of an unsigned integer before p. */
+static char *str_putdig(char *p, uint32_t u)
+{
+  do { *--p = (char)('0' + u % 10); } while (u /= 10);
+  return p;
+}
+
+/* Print finite number to buffer, in the format of LUA_NUMBER_FMT (%.14g).
+**
+** Integers are printed directly. Otherwise the number is scaled by an
+** exact power of ten to a 14 digit integer. A single rounding error is
+** made, which is at most 2^-7 for results below 2^47. This decides the
+** rounding to 14 digits, unless the fraction is close to one half. Such
+** numbers and numbers outside the range of the table use sprintf.
+*/
+static size_t str_bufnum(char *s, lua_Number n)
+{
+  char dig[14], *p = s;
+  TValue tv;
+  lua_Number a, x;
+  int32_t e10, k, i, nd;
+  uint64_t d;
+  tv.n = n;
+  a = (tv.u32.hi & 0x80000000) ? -n : n;
+  if (a < 1e14 && a == (lua_Number)(int64_t)a) {  /* Integer fast path. */
+    char buf[14];
+    char *q = buf+sizeof(buf);
+    d = (uint64_t)a;
+    if (d >= 10000000) {
+      q = str_putdig(q, (uint32_t)(d % 10000000));
+      while (q > buf+sizeof(buf)-7) *--q = '0';
+      d /= 10000000;
+    }
+    q = str_putdig(q, (uint32_t)d);
+    if ((tv.u32.hi & 0x80000000)) *p++ = '-';  /* Also for -0. */
+    while (q < buf+sizeof(buf)) *p++ = *q++;
+    return (size_t)(p - s);
+  }
+  /* Estimate the decimal exponent, possibly off by one. */
+  e10 = (((int32_t)((tv.u32.hi >> 20) & 0x7ff) - 1023) * 1233) >> 12;
+  k = 13 - e10;
+  if (k < -21 || k > 22) goto slow;
+  x = k >= 0 ? a * str_pow10[k] : a / str_pow10[-k];
+  if (x >= 1e14) {
+    e10++; k--;
+    x = k >= 0 ? a * str_pow10[k] : a / str_pow10[-k];
+  }
+  if (!(x >= 1e13 && x < 1e14)) goto slow;
+  d = (uint64_t)x;
+  x -= (lua_Number)d;
+  if (x > 0.5-0.015625 && x < 0.5+0.015625) goto slow;
+  if (x > 0.5 && ++d == U64x(00005af3,107a4000)) {  /* Carry to 10^14. */
+    d = U64x(00000918,4e72a000);
+    e10++;
+  }
+  {
+    uint32_t lo = (uint32_t)(d % 10000000), hi = (uint32_t)(d / 10000000);
+    for (i = 13; i >= 7; i--, lo /= 10) dig[i] = (char)('0' + lo % 10);
+    for (; i >= 0; i--, hi /= 10) dig[i] = (char)('0' + hi % 10);
+  }
+  for (nd = 14; dig[nd-1] == '0'; nd--) ;  /* Drop trailing zeros. */
+  if (n < 0) *p++ = '-';
+  if (e10 < -4 || e10 >= 14) {  /* Exponential format. */
+    uint32_t ue = (uint32_t)(e10 < 0 ? -e10 : e10);
+    *p++ = dig[0];
+    if (nd > 1) {
+      *p++ = '.';
+      for (i = 1; i < nd; i++) *p++ = dig[i];
+    }
+    *p++ = 'e';
+    *p++ = e10 < 0 ? '-' : '+';
+    if (ue >= 100) { *p++ = (char)('0' + ue / 100); ue %= 100; }
+    *p++ = (char)('0' + ue / 10);
+    *p++ = (char)('0' + ue % 10);
+  } else if (e10 >= 0) {  /* Fixed format with integer part. */
+    for (i = 0; i <= e10; i++) *p++ = dig[i];
+    if (nd > i) {
+      *p++ = '.';
+      for (; i < nd; i++) *p++ = dig[i];
+    }
+  } else {  /* Fixed format with leading zeros. */
+    *p++ = '0'; *p++ = '.';
+    for (i = e10+1; i < 0; i++) *p++ = '0';
+    for (i = 0; i < nd; i++) *p++ = dig[i];
+  }
+  return (size_t)(p - s);
+slow:
+  return (size_t)lua_number2str(s, n);
+}
+
 /* Print number to buffer. Canonicalizes non-finite values. */
 size_t LJ_FASTCALL lj_str_bufnum(char *s, cTValue *o)
 {
   if (LJ_LIKELY((o->u32.hi << 1) < 0xffe00000)) {  /* Finite? */
-    lua_Number n = o->n;
-    return (size_t)lua_number2str(s, n);
+    return str_bufnum(s, o->n);
   } else if (((o->u32.hi & 0x000fffff) | o->u32.lo) != 0) {
     s[0] = 'n'; s[1] = 'a'; s[2] = 'n'; return 3;
   } else if ((o->u32.hi & 0x80000000) == 0) {
@@ -325,22 +635,9 @@ const char *lj_str_pushvf(lua_State *L, const char *fmt, va_list argp)
       addstr(L, sb, buf, len);
       break;
       }
-    case 'p': {
-#define FMTP_CHARS	(2*sizeof(ptrdiff_t))
-      char buff[2+FMTP_CHARS];
-      ptrdiff_t p = (ptrdiff_t)(va_arg(argp, void *));
-      ptrdiff_t i, lasti = 2+FMTP_CHARS;
-#if LJ_64
-      if ((p >> 32) == 0)  /* Shorten output for true 32 bit pointers. */
-	lasti = 2+2*4;
-#endif
-      buff[0] = '0';
-      buff[1] = 'x';
-      for (i = lasti-1; i >= 2; i--, p >>= 4)
-	buff[i] = "0123456789abcdef"[(p & 15)];
-      addstr(L, sb, buff, (MSize)lasti);
+    case 'p':
+      lj_str_bufputptr(L, sb, va_arg(argp, void *));
       break;
-      }
     case '%':
       addchar(L, sb, '%');
       break;
@@ -379,3 +676,124 @@ char *lj_str_needbuf(lua_State *L, SBuf *sb, MSize sz)
   return sb->buf;
 }
 
+/* Make room for len more bytes in a buffer. Returns the write position. */
+char *lj_str_bufmore(lua_State *L, SBuf *sb, MSize len)
+{
+  MSize n = sb->n;
+  if (len >= LJ_MAX_STR - n)
+    lj_err_msg(L, LJ_ERR_STROV);
+  if (n + len > sb->sz) {
+    MSize sz = sb->sz < LJ_MIN_SBUF ? LJ_MIN_SBUF : sb->sz;
+    while (n + len > sz) sz += sz;
+    lj_str_resizebuf(L, sb, sz);
+  }
+  return sb->buf + n;
+}
+
+/* Append a block of memory to a buffer. Grows the buffer as needed. */
+SBuf *lj_str_bufputmem(lua_State *L, SBuf *sb, const char *p, MSize len)
+{
+  memcpy(lj_str_bufmore(L, sb, len), p, len);
+  sb->n += len;
+  return sb;
+}
+
+/* Append string to buffer. Called from JIT-compiled code (BUFPUT). */
+SBuf *lj_str_bufput(lua_State *L, SBuf *sb, GCstr *s)
+{
+  return lj_str_bufputmem(L, sb, strdata(s), s->len);
+}
+
+/* Append integer to buffer. */
+SBuf *lj_str_bufputint(lua_State *L, SBuf *sb, int32_t k)
+{
+  char s[1+10];
+  char *p = s+sizeof(s);
+  uint32_t i = (uint32_t)(k < 0 ? -k : k);
+  do { *--p = (char)('0' + i % 10); } while (i /= 10);
+  if (k < 0) *--p = '-';
+  return lj_str_bufputmem(L, sb, p, (MSize)(s+sizeof(s)-p));
+}
+
+/* Append number to buffer. */
+SBuf *lj_str_bufputnum(lua_State *L, SBuf *sb, const lua_Number *np)
+{
+  char buf[LUAI_MAXNUMBER2STR];
+  MSize len = (MSize)lj_str_bufnum(buf, (TValue *)np);
+  return lj_str_bufputmem(L, sb, buf, len);
+}
+
+/* Append pointer to buffer. Same format as %p for lj_str_pushf. */
+SBuf *lj_str_bufputptr(lua_State *L, SBuf *sb, const void *v)
+{
+#define FMTP_CHARS	(2*sizeof(ptrdiff_t))
+  char buff[2+FMTP_CHARS];
+  ptrdiff_t p = (ptrdiff_t)v;
+  ptrdiff_t i, lasti = 2+FMTP_CHARS;
+#if LJ_64
+  if ((p >> 32) == 0)  /* Shorten output for true 32 bit pointers. */
+    lasti = 2+2*4;
+#endif
+  buff[0] = '0';
+  buff[1] = 'x';
+  for (i = lasti-1; i >= 2; i--, p >>= 4)
+    buff[i] = "0123456789abcdef"[(p & 15)];
+  return lj_str_bufputmem(L, sb, buff, (MSize)lasti);
+}
+
+/* Append a numeric format item of string.format to buffer.
+** The form is a single % conversion with flags, width and precision,
+** but without a length modifier.
+*/
+SBuf *lj_str_bufputfmt(lua_State *L, SBuf *sb, const char *form, lua_Number n)
+{
+  char f[LJ_MAX_FMTSPEC], buff[LJ_MAX_FMTITEM];
+  MSize len = (MSize)strlen(form);
+  char spec = form[len-1];
+  lua_assert(len+sizeof(LUA_INTFRMLEN) <= sizeof(f));
+  memcpy(f, form, len+1);
+  switch (spec) {
+  case 'c':
+    sprintf(buff, f, lj_num2int(n));
+    break;
+  case 'd': case 'i': case 'o': case 'u': case 'x': case 'X':
+    /* Insert the length modifier. */
+    memcpy(f+len-1, LUA_INTFRMLEN, sizeof(LUA_INTFRMLEN)-1);
+    f[len+sizeof(LUA_INTFRMLEN)-2] = spec;
+    f[len+sizeof(LUA_INTFRMLEN)-1] = '\0';
+    if (spec == 'd' || spec == 'i')
+      sprintf(buff, f, (LUA_INTFRM_T)n);
+    else
+      sprintf(buff, f, (unsigned LUA_INTFRM_T)n);
+    break;
+  default: {
+    TValue tv;
+    tv.n = n;
+    if (LJ_UNLIKELY((tv.u32.hi << 1) >= 0xffe00000)) {
+      /* Canonicalize output of non-finite values. */
+      char *p, nbuf[LUAI_MAXNUMBER2STR];
+      size_t nlen = lj_str_bufnum(nbuf, &tv);
+      if (spec == 'E' || spec == 'G') {
+	nbuf[nlen-3] = nbuf[nlen-3] - 0x20;
+	nbuf[nlen-2] = nbuf[nlen-2] - 0x20;
+	nbuf[nlen-1] = nbuf[nlen-1] - 0x20;
+      }
+      nbuf[nlen] = '\0';
+      for (p = f; *p < 'A' && *p != '.'; p++) ;
+      *p++ = 's'; *p = '\0';
+      sprintf(buff, f, nbuf);
+    } else {
+      sprintf(buff, f, (double)n);
+    }
+    break;
+    }
+  }
+  return lj_str_bufputmem(L, sb, buff, (MSize)strlen(buff));
+}
+
+/* Intern buffer contents as a string. */
+GCstr * LJ_FASTCALL lj_str_buftostr(lua_State *L, SBuf *sb)
+{
+  return lj_str_new(L, sb->buf, sb->n);
+}
+
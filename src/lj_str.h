@@ -12,13 +12,29 @@
 
 /* String interning. */
 LJ_FUNC int32_t LJ_FASTCALL lj_str_cmp(GCstr *a, GCstr *b);
+#if LJ_STRHASH_FULL
+LJ_FUNC void lj_str_initkey(global_State *g);
+#endif
+LJ_FUNC MSize lj_str_migrate(global_State *g, MSize n);
 LJ_FUNC void lj_str_resize(lua_State *L, MSize newmask);
 LJ_FUNCA GCstr *lj_str_new(lua_State *L, const char *str, size_t len);
 LJ_FUNC void LJ_FASTCALL lj_str_free(global_State *g, GCstr *s);
 
+/* Bitmap of hash chains which may hold strings younger than the last sweep.
+** Generational minor collections only sweep these chains.
+*/
+#define lj_str_dirtysz(mask)	(((mask)+1) >> 5)
+#define lj_str_isdirty(g, h)	((g)->strdirty[(h) >> 5] & (1u << ((h) & 31)))
+#define lj_str_setdirty(g, h)	((g)->strdirty[(h) >> 5] |= (1u << ((h) & 31)))
+#define lj_str_cleardirty(g, h)	((g)->strdirty[(h) >> 5] &= ~(1u << ((h) & 31)))
+
 #define lj_str_newz(L, s)	(lj_str_new(L, s, strlen(s)))
 #define lj_str_newlit(L, s)	(lj_str_new(L, "" s, sizeof(s)-1))
 
+/* String search. */
+LJ_FUNC int32_t lj_str_find(const char *s, const char *p, MSize slen,
+			    MSize plen);
+
 /* Type conversions. */
 LJ_FUNC int LJ_FASTCALL lj_str_numconv(const char *s, TValue *n);
 LJ_FUNC int LJ_FASTCALL lj_str_tonum(GCstr *str, TValue *n);
@@ -38,6 +54,16 @@ LJ_FUNC const char *lj_str_pushf(lua_State *L, const char *fmt, ...)
 
 /* Resizable string buffers. Struct definition in lj_obj.h. */
 LJ_FUNC char *lj_str_needbuf(lua_State *L, SBuf *sb, MSize sz);
+LJ_FUNC char *lj_str_bufmore(lua_State *L, SBuf *sb, MSize len);
+LJ_FUNC SBuf *lj_str_bufputmem(lua_State *L, SBuf *sb, const char *p,
+			       MSize len);
+LJ_FUNC SBuf *lj_str_bufput(lua_State *L, SBuf *sb, GCstr *s);
+LJ_FUNC SBuf *lj_str_bufputint(lua_State *L, SBuf *sb, int32_t k);
+LJ_FUNC SBuf *lj_str_bufputnum(lua_State *L, SBuf *sb, const lua_Number *np);
+LJ_FUNC SBuf *lj_str_bufputptr(lua_State *L, SBuf *sb, const void *v);
+LJ_FUNC SBuf *lj_str_bufputfmt(lua_State *L, SBuf *sb, const char *form,
+			       lua_Number n);
+LJ_FUNC GCstr * LJ_FASTCALL lj_str_buftostr(lua_State *L, SBuf *sb);
 
 #define lj_str_initbuf(L, sb)	((sb)->buf = NULL, (sb)->sz = 0)
 #define lj_str_resetbuf(sb)	((sb)->n = 0)
@@ -29,22 +29,24 @@ static LJ_AINLINE Node *hashmask(const GCtab *t, uint32_t hash)
 #define hashlohi(t, lo, hi)	hashmask((t), hashrot((lo), (hi)))
 #define hashnum(t, o)		hashlohi((t), (o)->u32.lo, ((o)->u32.hi << 1))
 #define hashptr(t, p)		hashlohi((t), u32ptr(p), u32ptr(p) + HASH_BIAS)
-#define hashgcref(t, r)		hashlohi((t), gcrefu(r), gcrefu(r) + HASH_BIAS)
 
-/* Hash an arbitrary key and return its anchor position in the hash table. */
-static Node *hashkey(const GCtab *t, cTValue *key)
+/* Hash an arbitrary key. */
+static LJ_AINLINE uint32_t hashval(cTValue *key)
 {
   if (tvisstr(key))
-    return hashstr(t, strV(key));
+    return strV(key)->hash;
   else if (tvisnum(key))
-    return hashnum(t, key);
+    return hashrot(key->u32.lo, (key->u32.hi << 1));
   else if (tvisbool(key))
-    return hashmask(t, boolV(key));
+    return boolV(key);
   else
-    return hashgcref(t, key->gcr);
+    return hashrot(gcrefu(key->gcr), gcrefu(key->gcr) + HASH_BIAS);
   /* Only hash 32 bits of lightuserdata on a 64 bit CPU. Good enough? */
 }
 
+/* Hash an arbitrary key and return its anchor position in the hash table. */
+#define hashkey(t, key)		hashmask((t), hashval((key)))
+
 /* -- Table creation and destruction -------------------------------------- */
 
 /* Create new hash part for table. */
@@ -57,7 +59,11 @@ static LJ_AINLINE void newhpart(lua_State *L, GCtab *t, uint32_t hbits)
     lj_err_msg(L, LJ_ERR_TABOV);
   hsize = 1u << hbits;
   node = lj_mem_newvec(L, hsize, Node);
+#if LJ_TABHASH_OPEN
+  t->hfree = hsize2hfree(hsize);
+#else
   setmref(node->freetop, &node[hsize]);
+#endif
   setmref(t->node, node);
   t->hmask = hsize-1;
 }
@@ -124,6 +130,9 @@ static GCtab *newtab(lua_State *L, uint32_t asize, uint32_t hbits)
       t->asize = asize;
     }
   }
+#if LJ_TABHASH_OPEN
+  t->hfree = 0;
+#endif
   if (hbits)
     newhpart(L, t, hbits);
   return t;
@@ -184,13 +193,20 @@ GCtab * LJ_FASTCALL lj_tab_dup(lua_State *L, const GCtab *kt)
     Node *node = noderef(t->node);
     Node *knode = noderef(kt->node);
     ptrdiff_t d = (char *)node - (char *)knode;
+#if LJ_TABHASH_OPEN
+    t->hfree = kt->hfree;
+#else
     setmref(node->freetop, (Node *)((char *)noderef(knode->freetop) + d));
+#endif
     for (i = 0; i <= hmask; i++) {
       Node *kn = &knode[i];
       Node *n = &node[i];
       Node *next = nextnode(kn);
       /* Don't use copyTV here, since it asserts on a copy of a dead key. */
       n->val = kn->val; n->key = kn->key;
+#if LJ_TABHASH_OPEN
+      n->hash = kn->hash;
+#endif
       setmref(n->next, next == NULL? next : (Node *)((char *)next + d));
     }
   }
@@ -205,19 +221,66 @@ void LJ_FASTCALL lj_tab_free(global_State *g, GCtab *t)
   if (t->asize > 0 && LJ_MAX_COLOSIZE && t->colo <= 0)
     lj_mem_freevec(g, tvref(t->array), t->asize, TValue);
   if (LJ_MAX_COLOSIZE && t->colo)
-    lj_mem_free(g, t, sizetabcolo((uint32_t)t->colo & 0x7f));
+    lj_mem_freegco(g, t, sizetabcolo((uint32_t)t->colo & 0x7f));
   else
-    lj_mem_freet(g, t);
+    lj_mem_freegcot(g, t);
+}
+
+/* Clear a table. Keeps the array and hash parts for reuse. */
+void LJ_FASTCALL lj_tab_clear(GCtab *t)
+{
+  clearapart(t);
+  if (t->hmask > 0) {
+#if LJ_TABHASH_OPEN
+    t->hfree = hsize2hfree(t->hmask+1);
+#else
+    Node *node = noderef(t->node);
+    setmref(node->freetop, &node[t->hmask+1]);
+#endif
+    clearhpart(t);
+  }
 }
 
 /* -- Table resizing ------------------------------------------------------ */
 
+#if LJ_TABHASH_OPEN
+/* Get a slot for a new key with the given hash. Linear probing starts at
+** the anchor position. The probe run ends before the next empty slot. The
+** next field of a slot links to the following slot, if that one is in use.
+** So the lookups walk the runs just like hash chains.
+**
+** A slot with a dead key in the probe run is reused. Otherwise the empty
+** slot at the end of the run is taken and linked in. This fails and
+** returns NULL if no more free slots may be taken.
+*/
+static Node *hashslot(GCtab *t, uint32_t hash)
+{
+  Node *node = noderef(t->node), *n, *nn;
+  uint32_t hmask = t->hmask, i = hash & hmask;
+  while (!tvisnil(&node[i].val))
+    i = (i+1) & hmask;
+  n = &node[i];
+  if (!tvisnil(&n->key))  /* Reuse slot with dead key. */
+    return n;
+  if (t->hfree == 0)
+    return NULL;
+  t->hfree--;
+  nn = &node[(i-1) & hmask];
+  if (!tvisnil(&nn->key))  /* Link to the end of the preceding run. */
+    setmref(nn->next, n);
+  nn = &node[(i+1) & hmask];
+  setmref(n->next, tvisnil(&nn->key) ? NULL : nn);
+  return n;
+}
+#endif
+
 /* Resize a table to fit the new array/hash part sizes. */
 static void resizetab(lua_State *L, GCtab *t, uint32_t asize, uint32_t hbits)
 {
   Node *oldnode = noderef(t->node);
   uint32_t oldasize = t->asize;
   uint32_t oldhmask = t->hmask;
+  lj_gc_barrierresize(G(L), t);  /* All slots move. */
   if (asize > oldasize) {  /* Array part grows? */
     TValue *array;
     uint32_t i;
@@ -247,6 +310,9 @@ static void resizetab(lua_State *L, GCtab *t, uint32_t asize, uint32_t hbits)
     global_State *g = G(L);
     setmref(t->node, &g->nilnode);
     t->hmask = 0;
+#if LJ_TABHASH_OPEN
+    t->hfree = 0;
+#endif
   }
   if (asize < oldasize) {  /* Array part shrinks? */
     TValue *array = tvref(t->array);
@@ -265,8 +331,22 @@ static void resizetab(lua_State *L, GCtab *t, uint32_t asize, uint32_t hbits)
     uint32_t i;
     for (i = 0; i <= oldhmask; i++) {
       Node *n = &oldnode[i];
-      if (!tvisnil(&n->val))
+      if (!tvisnil(&n->val)) {
+#if LJ_TABHASH_OPEN
+	/* Keys other than numbers stay in the hash part and are unique.
+	** So reuse the cached hash and skip the lookup.
+	*/
+	if (!tvisnum(&n->key)) {
+	  Node *nn = hashslot(t, n->hash);
+	  lua_assert(nn != NULL && tvisnil(&nn->key));
+	  nn->hash = n->hash;
+	  copyTV(L, &nn->key, &n->key);
+	  copyTV(L, &nn->val, &n->val);
+	  continue;
+	}
+#endif
 	copyTV(L, lj_tab_set(L, t, &n->key), &n->val);
+      }
     }
     g = G(L);
     lj_mem_freevec(g, oldnode, oldhmask+1, Node);
@@ -409,6 +489,18 @@ cTValue *lj_tab_get(lua_State *L, GCtab *t, cTValue *key)
 
 /* -- Table setters ------------------------------------------------------- */
 
+#if LJ_TABHASH_OPEN
+/* Insert new key into a free slot of its probe run. */
+TValue *lj_tab_newkey(lua_State *L, GCtab *t, cTValue *key)
+{
+  uint32_t hash = hashval(key);
+  Node *n = hashslot(t, hash);
+  if (n == NULL) {  /* No free slot left? */
+    rehashtab(L, t, key);  /* Rehash table. */
+    return lj_tab_set(L, t, key);  /* Retry key insertion. */
+  }
+  n->hash = hash;
+#else
 /* Insert new key. Use Brent's variation to optimize the chain length. */
 TValue *lj_tab_newkey(lua_State *L, GCtab *t, cTValue *key)
 {
@@ -454,6 +546,7 @@ TValue *lj_tab_newkey(lua_State *L, GCtab *t, cTValue *key)
       n = freenode;
     }
   }
+#endif
   n->key.u64 = key->u64;
   if (LJ_UNLIKELY(tvismzero(&n->key)))
     n->key.u64 = 0;
@@ -557,6 +650,21 @@ int lj_tab_next(lua_State *L, GCtab *t, TValue *key)
   return 0;  /* End of traversal. */
 }
 
+/* Find the traversal index of the next non-nil slot, starting at index i.
+** Returns asize+hmask+1 at the end of the traversal. Used by traces.
+*/
+uint32_t LJ_FASTCALL lj_tab_nexti(GCtab *t, uint32_t i)
+{
+  uint32_t h;
+  for (; i < t->asize; i++)
+    if (!tvisnil(arrayslot(t, i)))
+      return i;
+  for (h = i - t->asize; h <= t->hmask; h++)
+    if (!tvisnil(&noderef(t->node)[h].val))
+      break;
+  return t->asize + h;
+}
+
 /* -- Table length calculation -------------------------------------------- */
 
 static MSize unbound_search(GCtab *t, MSize j)
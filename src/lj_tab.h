@@ -23,7 +23,14 @@ static LJ_AINLINE uint32_t hashrot(uint32_t lo, uint32_t hi)
   return hi;
 }
 
-#define hsize2hbits(s)	((s) ? ((s)==1 ? 1 : 1+lj_fls((uint32_t)((s)-1))) : 0)
+#define hsize2hbits_(s)	((s) ? ((s)==1 ? 1 : 1+lj_fls((uint32_t)((s)-1))) : 0)
+#if LJ_TABHASH_OPEN
+/* Open addressing keeps a quarter of the hash slots (at least one) free. */
+#define hsize2hfree(hs)	((hs) - (((hs)+3) >> 2))
+#define hsize2hbits(s)	hsize2hbits_((s) + ((s)+2)/3)
+#else
+#define hsize2hbits(s)	hsize2hbits_(s)
+#endif
 
 LJ_FUNCA GCtab *lj_tab_new(lua_State *L, uint32_t asize, uint32_t hbits);
 #if LJ_HASJIT
@@ -31,6 +38,7 @@ LJ_FUNC GCtab * LJ_FASTCALL lj_tab_new1(lua_State *L, uint32_t ahsize);
 #endif
 LJ_FUNCA GCtab * LJ_FASTCALL lj_tab_dup(lua_State *L, const GCtab *kt);
 LJ_FUNC void LJ_FASTCALL lj_tab_free(global_State *g, GCtab *t);
+LJ_FUNCA void LJ_FASTCALL lj_tab_clear(GCtab *t);
 LJ_FUNCA void lj_tab_reasize(lua_State *L, GCtab *t, uint32_t nasize);
 
 /* Caveat: all getters except lj_tab_get() can return NULL! */
@@ -54,6 +62,7 @@ LJ_FUNC TValue *lj_tab_set(lua_State *L, GCtab *t, cTValue *key);
   (inarray((t), (key)) ? arrayslot((t), (key)) : lj_tab_setinth(L, (t), (key)))
 
 LJ_FUNCA int lj_tab_next(lua_State *L, GCtab *t, TValue *key);
+LJ_FUNC uint32_t LJ_FASTCALL lj_tab_nexti(GCtab *t, uint32_t i);
 LJ_FUNCA MSize LJ_FASTCALL lj_tab_len(GCtab *t);
 
 #endif
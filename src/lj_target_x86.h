@@ -251,6 +251,13 @@ typedef enum {
   XO_CVTTSD2SI=	XO_f20f(2c),
   XO_MOVD =	XO_660f(6e),
   XO_MOVDto =	XO_660f(7e),
+  XO_MOVUPD =	XO_660f(10),
+  XO_MOVUPDto =	XO_660f(11),
+  XO_UNPCKLPD =	XO_660f(14),
+  XO_ADDPD =	XO_660f(58),
+  XO_SUBPD =	XO_660f(5c),
+  XO_MULPD =	XO_660f(59),
+  XO_DIVPD =	XO_660f(5e),
 
   XO_FLDq =	XO_(dd), XOg_FLDq = 0,
   XO_FILDd =	XO_(db), XOg_FILDd = 0,
@@ -199,7 +199,7 @@ static void trace_unpatch(jit_State *J, GCtrace *T)
     *pc = T->startins;
     break;
   case BC_ITERL:
-    lua_assert(bc_op(*pc) == BC_JMP);
+    lua_assert(bc_op(*pc) == BC_JMP || bc_op(*pc) == BC_ISNEXT);
     pc += bc_j(*pc)+2;
     lua_assert(bc_op(*pc) == BC_JITERL && traceref(J, bc_d(*pc)) == T);
     *pc = T->startins;
@@ -583,7 +583,9 @@ static TValue *trace_state(lua_State *L, lua_CFunction dummy, void *ud)
 	  break;
 	}
 	J->loopref = J->chain[IR_LOOP];  /* Needed by assembler. */
+	lj_opt_vec(J);
       }
+      lj_opt_sink(J);
       J->state = LJ_TRACE_ASM;
       break;
 
@@ -27,6 +27,7 @@ TREDEF(NYICF,	"NYI: C function %p")
 TREDEF(NYIFF,	"NYI: FastFunc %s")
 TREDEF(NYIFFU,	"NYI: unsupported variant of FastFunc %s")
 TREDEF(NYIRETL,	"NYI: return to lower frame")
+TREDEF(NYIFNEW,	"NYI: side trace in frame of new closure")
 
 /* Recording indexed load/store. */
 TREDEF(STORENN,	"store with nil or NaN key")
@@ -8,11 +8,12 @@
 
 #include "lj_obj.h"
 #include "lj_gc.h"
+#include "lj_str.h"
 #include "lj_udata.h"
 
 GCudata *lj_udata_new(lua_State *L, MSize sz, GCtab *env)
 {
-  GCudata *ud = lj_mem_newt(L, sizeof(GCudata) + sz, GCudata);
+  GCudata *ud = lj_mem_newgcot(L, sizeof(GCudata) + sz, GCudata);
   global_State *g = G(L);
   newwhite(g, ud);  /* Not finalized. */
   ud->gct = ~LJ_TUDATA;
@@ -29,6 +30,8 @@ GCudata *lj_udata_new(lua_State *L, MSize sz, GCtab *env)
 
 void LJ_FASTCALL lj_udata_free(global_State *g, GCudata *ud)
 {
-  lj_mem_free(g, ud, sizeudata(ud));
+  if (ud->udtype == UDTYPE_BUFFER)  /* Free the buffer contents, too. */
+    lj_str_freebuf(g, (SBuf *)uddata(ud));
+  lj_mem_freegco(g, ud, sizeudata(ud));
 }
 
@@ -37,9 +37,12 @@
 #include "lj_state.c"
 #include "lj_dispatch.c"
 #include "lj_vmevent.c"
+#include "lj_profile.c"
 #include "lj_api.c"
 #include "lj_lex.c"
 #include "lj_parse.c"
+#include "lj_bcread.c"
+#include "lj_bcwrite.c"
 #include "lj_lib.c"
 #include "lj_ir.c"
 #include "lj_opt_mem.c"
@@ -47,6 +50,8 @@
 #include "lj_opt_narrow.c"
 #include "lj_opt_dce.c"
 #include "lj_opt_loop.c"
+#include "lj_opt_sink.c"
+#include "lj_opt_vec.c"
 #include "lj_mcode.c"
 #include "lj_snap.c"
 #include "lj_record.c"
@@ -54,6 +59,7 @@
 #include "lj_trace.c"
 #include "lj_gdbjit.c"
 #include "lj_alloc.c"
+#include "lj_slab.c"
 
 #include "lib_aux.c"
 #include "lib_base.c"
@@ -226,6 +226,10 @@ LUA_API int  (lua_status) (lua_State *L);
 #define LUA_GCSTEP		5
 #define LUA_GCSETPAUSE		6
 #define LUA_GCSETSTEPMUL	7
+#define LUA_GCGEN		10
+#define LUA_GCINC		11
+#define LUA_GCPACE		12
+#define LUA_GCSTEPTIME		13
 
 LUA_API int (lua_gc) (lua_State *L, int what, int data);
 
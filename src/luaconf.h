@@ -69,6 +69,7 @@
 #define LUAI_MAXCSTACK	8000	/* Max. # of stack slots for a C func (<10K). */
 #define LUAI_GCPAUSE	200	/* Pause GC until memory is at 200%. */
 #define LUAI_GCMUL	200	/* Run GC at 200% of allocation speed. */
+#define LUAI_GCGENMINOR	50	/* Minor GC after 50% growth (generational). */
 #define LUA_MAXCAPTURES	32	/* Max. pattern captures. */
 
 /* Compatibility with older library function names. */
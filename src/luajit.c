@@ -63,6 +63,7 @@ static void print_usage(void)
   "  -l name   Require library " LUA_QL("name") ".\n"
   "  -j cmd    Perform LuaJIT control command.\n"
   "  -O[opt]   Control LuaJIT optimizations.\n"
+  "  -b ...    Save or list bytecode.\n"
   "  -i        Enter interactive mode after executing " LUA_QL("script") ".\n"
   "  -v        Show version information.\n"
   "  --        Stop handling options.\n"
@@ -365,6 +366,24 @@ static int dojitopt(lua_State *L, const char *opt)
   return runcmdopt(L, opt);
 }
 
+/* Save or list bytecode. */
+static int dobytecode(lua_State *L, char **argv)
+{
+  int narg = 0;
+  lua_pushliteral(L, "bcsave");
+  if (loadjitmodule(L, "module jit.bcsave not found"))
+    return 1;
+  lua_remove(L, -2);  /* Drop module name. */
+  if (argv[0][2]) {
+    narg++;
+    argv[0][1] = '-';
+    lua_pushstring(L, argv[0]+1);
+  }
+  for (argv++; *argv != NULL; narg++, argv++)
+    lua_pushstring(L, *argv);
+  return report(L, lua_pcall(L, narg, 0, 0));
+}
+
 /* check that argument has no extra characters at the end */
 #define notail(x)	{if ((x)[2] != '\0') return -1;}
 
@@ -397,6 +416,9 @@ static int collectargs(char **argv, int *pi, int *pv, int *pe)
       }
       break;
     case 'O': break;  /* LuaJIT extension */
+    case 'b':  /* LuaJIT extension */
+      *pe = 1;
+      return 0;
     default: return -1;  /* invalid option */
     }
   }
@@ -438,6 +460,8 @@ static int runargs(lua_State *L, char **argv, int n)
       if (dojitopt(L, argv[i] + 2))
 	return 1;
       break;
+    case 'b':  /* LuaJIT extension */
+      return dobytecode(L, argv+i);
     default: break;
     }
   }
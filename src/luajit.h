@@ -64,6 +64,10 @@ enum {
 /* Control the JIT engine. */
 LUA_API int luaJIT_setmode(lua_State *L, int idx, int mode);
 
+/* Append to a string buffer in-place. */
+LUA_API char *luaJIT_bufreserve(lua_State *L, int idx, size_t sz, size_t *len);
+LUA_API void luaJIT_bufcommit(lua_State *L, int idx, size_t len);
+
 /* Enforce (dynamic) linker error for version mismatches. Call from main. */
 LUA_API void LUAJIT_VERSION_SYM(void);
 
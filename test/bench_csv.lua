@@ -0,0 +1,43 @@
+-- Benchmark: string to number conversion of CSV-style numeric fields.
+-- Run with: luajit test/bench_csv.lua [rows]
+-- Times tonumber() on the split fields and io.read("*n") on the same data
+-- written to a temporary file. Both sums must agree.
+local rows = tonumber(arg and arg[1]) or 200000
+local R, format, clock = math.random, string.format, os.clock
+math.randomseed(7)
+local lines = {}
+for i = 1, rows do
+  lines[i] = format("%.3f,%.2f,%d,%.6f,%g",
+		    R()*1000, R()*100, R(1, 1e6), R()/1000, -R()*1e4)
+end
+local csv = table.concat(lines, "\n")
+
+local fields, n = {}, 0
+for field in csv:gmatch("[^,\n]+") do n = n + 1; fields[n] = field end
+
+local t0 = clock()
+local sum, tonumber = 0, tonumber
+for rep = 1, 3 do
+  for i = 1, n do sum = sum + tonumber(fields[i]) end
+end
+local t1 = clock()
+
+local name = os.tmpname()
+local f = assert(io.open(name, "w"))
+f:write((csv:gsub(",", " ")))
+f:close()
+f = assert(io.open(name))
+local t2 = clock()
+local sum2 = 0
+while true do
+  local x = f:read("*n")
+  if not x then break end
+  sum2 = sum2 + x
+end
+local t3 = clock()
+f:close()
+os.remove(name)
+
+assert(math.abs(sum/3 - sum2) <= 1e-6 * math.abs(sum2), "sums differ")
+print(format("tonumber %.2fs  read(\"*n\") %.2fs  (%d fields)",
+	     t1-t0, t3-t2, n))
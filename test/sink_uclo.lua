@@ -0,0 +1,24 @@
+-- Regression test: tables captured by closures must not be sunk.
+-- Run with: luajit test/sink_uclo.lua (also try -Ohotloop=1).
+local function mk(i)
+  if i%2==0 then local v={i}; return function() return v[1] end
+  else return {i} end
+end
+local r = {}
+for i=1,100 do r[i] = mk(i) end
+for i=1,100 do
+  local o = r[i]
+  if type(o) == "function" then assert(o() == i, "fn "..i.." "..tostring(o()))
+  else assert(o[1] == i, "tab "..i) end
+end
+-- Captured table with a later store, closed at the end of a block.
+local fs = {}
+for i=1,100 do
+  do
+    local t = {x = i}
+    t.y = i*2
+    fs[i] = function() return t.x + t.y end
+  end
+end
+for i=1,100 do assert(fs[i]() == 3*i) end
+print("ok")